@@ -21,6 +21,8 @@
 
 #include "QAS_Serial_Dev_UART.hpp"
 #include "QAD_GPIO.hpp"
+#include "QAD_LTDC.hpp"
+#include "QAD_DMA2D.hpp"
 
 
 	//------------------------------------------
@@ -128,6 +130,20 @@ void USART1_IRQHandler(void) {
 }
 
 
+//LTDC_IRQHandler
+//Interrupt Handler Function
+void LTDC_IRQHandler(void) {
+	QAD_LTDC::handler();
+}
+
+
+//DMA2D_IRQHandler
+//Interrupt Handler Function
+void DMA2D_IRQHandler(void) {
+	QAD_DMA2D::handler();
+}
+
+
 
 
 
@@ -51,6 +51,8 @@ void  SysTick_Handler(void);
   //Interrupt Handler Functions
 
 void USART1_IRQHandler(void);
+void LTDC_IRQHandler(void);
+void DMA2D_IRQHandler(void);
 
 
 }
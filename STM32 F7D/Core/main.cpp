@@ -31,6 +31,7 @@
 
 #include "QAS_Serial_Dev_UART.hpp"
 #include "QAS_LCD.hpp"
+#include "QAS_LCD_FramePacer.hpp"
 
 #include <string.h>
 #include <stdio.h>
@@ -62,7 +63,8 @@ QAD_I2C* I2C_System;
 
 const uint32_t QA_FT_SDCardTickThreshold = 500;
 
-const uint32_t QA_FT_LCDTickThreshold = 33;
+const uint32_t QA_FT_LCDStatsTickThreshold = 10000;  //Time in milliseconds between reports of the LCD frame counters over UART
+                                                     //The LCD itself is rendered whenever its content changes (see QAS_LCD_FramePacer.hpp)
 
 const uint32_t QA_FT_HeartbeatTickThreshold = 500;   //Time in milliseconds between heartbeat LED updates
                                                      //The rate of flashing of the heartbeat LED will be double the value defined here
@@ -132,10 +134,49 @@ int main(void) {
 
   //Create task timing variables
   uint32_t uSDCardTicks = 0;
-  uint32_t uLCDTicks = 0;
+  uint32_t uLCDStatsTicks = 0;
 
   uint32_t uHeartbeatTicks = 0;
 
+  //Render the static parts of the SD card panel into a surface once, so they are composited each frame rather than being rebuilt
+  //If the surface cannot be created then the static parts are drawn directly each frame instead
+  uint8_t uPanel = QAS_LCD::createSurface(721, 401);
+  if (uPanel != QAS_LCD_SURFACE_NONE) {
+    QAS_LCD::setDrawSurface(uPanel);
+    QAS_LCD::setDrawColor(0xF000);
+    QAS_LCD::clearBuffer();
+
+    QAS_LCD::setFontByIndex(1);
+    QAS_LCD::setDrawColor(0xFFFF);
+    QAS_LCD::drawStrC(QAT_Vector2_16(360, 5), "SD Card Test");
+    QAS_LCD::drawStrL(QAT_Vector2_16(10, 40), "Card Present:");
+    QAS_LCD::drawStrL(QAT_Vector2_16(10, 70), "Card State:");
+    QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+  } else {
+  	UART_STLink->txStringCR("LCD: Panel surface unavailable");
+  }
+
+  //Create LCD state variables
+  //These store the SD card details displayed in the previous frame, so that the LCD is only invalidated when a detail changes
+  uint32_t uLCDState[8]    = {0};
+  uint32_t uLCDNewState[8] = {0};
+
+  //Create LCD frame pacer, which renders a frame only when the LCD has been invalidated, and no faster than the LCD refreshes
+  QAS_LCD_FramePacer cFramePacer;
+
+  //Enable dirty rectangle tracking, so that only invalidated areas of the LCD are cleared and redrawn
+  QAS_LCD::setDirtyTracking(QA_Active);
+
+  //Enable tiled rendering, so that display lists are rendered in internal RAM and written to SDRAM once per pixel
+  QAS_LCD::setTiledRendering(QA_Active);
+
+  //Enable DMA2D acceleration, so that large fills, blits and tile write-backs run while the CPU carries on rendering
+  if (QAS_LCD::setAcceleration(QA_Active))
+  	UART_STLink->txStringCR("LCD: DMA2D acceleration unavailable");
+
+  //Enable automatic windowing of layer 1, so that the LTDC only fetches the area of the overlay that holds visible content
+  QAS_LCD::setAutoWindow(QAD_LTDC_Layer1, QA_Active);
+
 
   //-----------------------------------
   //Infinite loop for device processing
@@ -169,30 +210,53 @@ int main(void) {
 
 
     //Update LCD
-    uLCDTicks += uTicks;
-    if (uLCDTicks >= QA_FT_LCDTickThreshold) {
+    //Invalidate card details area of layer 0, and request a frame, if any of the card details have changed since the previous frame
+    uLCDNewState[0] = QAD_SDMMC::getCardPresent();
+    uLCDNewState[1] = QAD_SDMMC::getCardState();
+    uLCDNewState[2] = QAD_SDMMC::getCardSizeMB();
+    uLCDNewState[3] = QAD_SDMMC::getBlockSize();
+    uLCDNewState[4] = QAD_SDMMC::getBlockCount();
+    uLCDNewState[5] = QAD_SDMMC::getCardType();
+    uLCDNewState[6] = QAD_SDMMC::getCardVersion();
+    uLCDNewState[7] = QAD_SDMMC::getCardClass();
+    if (memcmp(uLCDState, uLCDNewState, sizeof(uLCDState))) {
+    	QAS_LCD::invalidate(QAD_LTDC_Layer0, QAT_Vector2_16(40, 75), QAT_Vector2_16(760, 440));
+    	memcpy(uLCDState, uLCDNewState, sizeof(uLCDState));
+    	cFramePacer.invalidate();
+    }
+
+    //Render frame if one has been requested and the previous frame has been presented
+    if (cFramePacer.begin()) {
 
     	char strLCD[256];
 
+    	//Record frame into display list, so that rendering and flipping are skipped if the frame is unchanged
+    	QAS_LCD::beginDisplayList();
+
       QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
       QAS_LCD::setDrawColor(0xF333);
       QAS_LCD::clearBuffer();
 
-      QAS_LCD::setDrawColor(0xF000);
-      QAS_LCD::drawRectFill(QAT_Vector2_16(40, 40), QAT_Vector2_16(760, 440));
-
       QAS_LCD::setFontByIndex(1);
+      if (uPanel != QAS_LCD_SURFACE_NONE) {
+        QAS_LCD::drawSurface(QAT_Vector2_16(40, 40), uPanel);
+      } else {
+        QAS_LCD::setDrawColor(0xF000);
+        QAS_LCD::drawRectFill(QAT_Vector2_16(40, 40), QAT_Vector2_16(760, 440));
+        QAS_LCD::setDrawColor(0xFFFF);
+        QAS_LCD::drawStrC(QAT_Vector2_16(400, 45), "SD Card Test");
+        QAS_LCD::drawStrL(QAT_Vector2_16(50, 80), "Card Present:");
+        QAS_LCD::drawStrL(QAT_Vector2_16(50, 110), "Card State:");
+      }
+
       QAS_LCD::setDrawColor(0xFFFF);
-      QAS_LCD::drawStrC(QAT_Vector2_16(400, 45), "SD Card Test");
 
         //Card Presence
-      QAS_LCD::drawStrL(QAT_Vector2_16(50, 80), "Card Present:");
       if (QAD_SDMMC::getCardPresent())
       	QAS_LCD::drawStrL(QAT_Vector2_16(400, 80), "Card Present"); else
       	QAS_LCD::drawStrL(QAT_Vector2_16(400, 80), "No Card");
 
         //Card State
-      QAS_LCD::drawStrL(QAT_Vector2_16(50, 110), "Card State:");
       QAD_SDMMC_CardState eState = QAD_SDMMC::getCardState();
       if (eState == QAD_SDMMC_State_NoCard)
       	QAS_LCD::drawStrL(QAT_Vector2_16(400, 110), "No Card");
@@ -239,10 +303,28 @@ int main(void) {
       QAS_LCD::setDrawColor(0x0000);
       QAS_LCD::clearBuffer();
 
-      QAS_LCD::flipLayer0();
-      QAS_LCD::flipLayer1();
+      //Render and flip both layers if the frame has changed, with unchanged frames being counted as skipped
+      cFramePacer.end(QAS_LCD::endDisplayList());
+    }
+
+
+    //Report LCD frame counters
+    //Render times are reported in LCD lines, with each refresh of the LCD lasting QAD_LTDC_FRAMELINES lines
+    uLCDStatsTicks += uTicks;
+    if (uLCDStatsTicks >= QA_FT_LCDStatsTickThreshold) {
+    	char strStats[160];
+    	QAS_LCD_FramePacerStats sStats = cFramePacer.getStats();
+    	uint32_t uElapsed = sStats.uRenderTotal + sStats.uIdleTotal;
+
+    	sprintf(strStats, "LCD: %lu frames (%lu requests, %lu skipped), render avg %lu max %lu of %u lines, idle %lu%%, %lu missed, %lu deferred",
+    			    sStats.uFrames, sStats.uRequests, sStats.uSkipped,
+    			    sStats.uFrames ? (sStats.uRenderTotal / sStats.uFrames) : 0, sStats.uRenderMax, QAD_LTDC_FRAMELINES,
+    			    uElapsed ? (uint32_t)(((uint64_t)sStats.uIdleTotal * 100) / uElapsed) : 100,
+    			    sStats.uMissed, sStats.uDeferred);
+    	UART_STLink->txStringCR(strStats);
 
-    	uLCDTicks -= QA_FT_LCDTickThreshold;
+    	cFramePacer.resetStats();
+    	uLCDStatsTicks -= QA_FT_LCDStatsTickThreshold;
     }
 
 
@@ -447,6 +529,18 @@ QA_Result QA_SystemInit(void) {
   }
   UART_STLink->txStringCR("LCD: Initialized");
 
+  //Report the regions of SDRAM allocated by the LCD and other systems
+  char strSDRAM[96];
+  const QAD_FMC_Allocator& cSDRAM = QAD_FMC::getAllocator();
+  for (uint8_t i=0; i<cSDRAM.count(); i++) {
+  	sprintf(strSDRAM, "SDRAM: %s at 0x%08lX, %lu KB", cSDRAM[i].strName, (uint32_t)cSDRAM.getData(cSDRAM[i]), cSDRAM[i].uSize / 1024);
+  	UART_STLink->txStringCR(strSDRAM);
+  }
+  QAD_FMC_RegionStats sSDRAMStats = QAD_FMC::getStats();
+  sprintf(strSDRAM, "SDRAM: %lu of %lu KB allocated, largest free %lu KB",
+  		    sSDRAMStats.uUsed / 1024, sSDRAMStats.uSize / 1024, sSDRAMStats.uLargestFree / 1024);
+  UART_STLink->txStringCR(strSDRAM);
+
   //Test rendering methods to confirm LCD and rendering subsystem are working correctly
 
   QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
@@ -465,7 +559,7 @@ QA_Result QA_SystemInit(void) {
   QAS_LCD::clearBuffer();
 
   QAS_LCD::setDrawColor(0xFBFB);
-  QAS_LCD::setFontByName("SegoeUI12pt");
+  QAS_LCD::setFontByHash(QAS_LCD_FONTID("SegoeUI12pt"));
   //QAS_LCD::setFontByIndex(0);
   QAS_LCD::drawStrC(QAT_Vector2_16(400, 150), "Hello World!");
 
@@ -21,8 +21,28 @@
 
 
 //Includes
+//
+//When QA_HOST is defined, the project is being built for a desktop host rather than the STM32F769I Discovery board.
+//Only peripheral-independent systems and tools are built in this case, along with host versions of the drivers they rely on
+//(such as QAD_LTDC_Host.cpp), so that rendering can be checked without needing to flash the board. See QA_Host/CMakeLists.txt.
+#if defined(QA_HOST)
+#include <stdint.h>
+#include <stddef.h>
+#else
 #include "stm32f7xx.h"
 #include "stm32f7xx_hal.h"
+#endif
+
+
+  //DTCM Placement
+  //Used to place a variable in the .dtcm section, which STM32F769NIHX_FLASH.ld places at the start of RAM, within the 128KB DTCM.
+  //The DTCM is accessed by the CPU with no wait states and is not cached, and is also accessible to the DMA2D.
+  //Variables in the .dtcm section are not initialized by the startup code, and there is no DTCM on a desktop host
+#if defined(QA_HOST)
+#define QA_DTCM
+#else
+#define QA_DTCM   __attribute__((section(".dtcm")))
+#endif
 
 
 	//------------------------------------------
@@ -186,8 +206,14 @@ public:
 #define QAD_IRQPRIORITY_UART1    ((uint8_t) 0x09) //Priority for the TX/RX interrupts for UART1 handler,
                                                   //which is used for serial via STLink on the STM32F769I Discovery board.
 
+#define QAD_IRQPRIORITY_LTDC     ((uint8_t) 0x08) //Priority for the LTDC line interrupt, which presents flipped frame buffers during vertical blanking.
+                                                  //Set above the UART so that flips are not delayed into the next frame
+
 #define QAD_IRQPRIORITY_EXTI     ((uint8_t) 0x0A) //Priority to be used by external interrupt handlers. Shared by all external interrupts
 
+#define QAD_IRQPRIORITY_DMA2D    ((uint8_t) 0x0B) //Priority for the DMA2D transfer complete and error interrupts, which start each queued job.
+                                                  //QAD_DMA2D::wait() must not be called from interrupts of a higher priority
+
 #define QAD_IRQPRIORITY_FLASH    ((uint8_t) 0x0E)
 
 
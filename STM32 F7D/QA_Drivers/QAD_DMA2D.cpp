@@ -0,0 +1,379 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: DMA2D (Chrom-ART) Driver                                        */
+/*   Filename: QAD_DMA2D.cpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_DMA2D.hpp"
+
+//The following board specific methods are replaced by QAD_DMA2D_Host.cpp when building for a desktop host (see setup.hpp)
+#if !defined(QA_HOST)
+
+
+//Check that the pixel format values of QAD_DMA2D_Format match those of the HAL
+static_assert(QAD_DMA2D_ARGB8888 == DMA2D_INPUT_ARGB8888, "QAD_DMA2D_ARGB8888 does not match HAL");
+static_assert(QAD_DMA2D_RGB888 == DMA2D_INPUT_RGB888, "QAD_DMA2D_RGB888 does not match HAL");
+static_assert(QAD_DMA2D_RGB565 == DMA2D_INPUT_RGB565, "QAD_DMA2D_RGB565 does not match HAL");
+static_assert(QAD_DMA2D_ARGB1555 == DMA2D_INPUT_ARGB1555, "QAD_DMA2D_ARGB1555 does not match HAL");
+static_assert(QAD_DMA2D_ARGB4444 == DMA2D_INPUT_ARGB4444, "QAD_DMA2D_ARGB4444 does not match HAL");
+
+
+//Returns true if an address lies within a region that is cached by the Cortex-M7 default memory map, being the code and internal
+//SRAM regions and the external RAM region. The MPU is not used to change the default memory map (see boot.cpp), so frame buffers
+//and surfaces in SDRAM at 0xC0000000 are not cached, and require no cache maintenance
+static bool QAD_DMA2D_Cacheable(const void* pAddr) {
+	uint32_t uAddr = (uint32_t)pAddr;
+	return (uAddr < 0x40000000) || ((uAddr >= 0x60000000) && (uAddr < 0xA0000000));
+}
+
+
+//Used to clean, or clean and invalidate, the data cache lines covering a rectangle of pixels
+//pPixels     - Pointer to the upper-left pixel of the rectangle
+//uStride     - The number of pixels between the start of each line
+//uWidth      - The width in pixels of the rectangle
+//uHeight     - The height in pixels of the rectangle
+//eFormat     - The pixel format of the rectangle. Member of QAD_DMA2D_Format enum
+//bInvalidate - true to also invalidate the cache lines, or false to only clean them
+static void QAD_DMA2D_CacheRect(const void* pPixels, uint16_t uStride, uint16_t uWidth, uint16_t uHeight, QAD_DMA2D_Format eFormat,
+		                            bool bInvalidate) {
+	if (!QAD_DMA2D_Cacheable(pPixels))
+		return;
+
+	//The CMSIS cache methods do not align the address to a cache line, so the range is extended to the start of the first line
+	uint32_t uStart = (uint32_t)pPixels & ~0x1F;
+	uint32_t uEnd   = (uint32_t)pPixels + ((((uint32_t)(uHeight - 1) * uStride) + uWidth) * QAD_DMA2D::bytes(eFormat));
+	if (bInvalidate)
+		SCB_CleanInvalidateDCache_by_Addr((uint32_t*)uStart, uEnd - uStart); else
+		SCB_CleanDCache_by_Addr((uint32_t*)uStart, uEnd - uStart);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_DMA2D Initialization Methods
+
+//QAD_DMA2D::imp_init
+//QAD_DMA2D Initialization Method
+//
+//To be called from static method init()
+//Used to reset and enable the DMA2D peripheral and its interrupt, and to clear the job queue and job counters
+//Returns QA_OK if initialization successful, or QA_Fail if initialization fails
+QA_Result QAD_DMA2D::imp_init(void) {
+
+	//Return if driver is already initialized
+	if (m_eInitState)
+		return QA_OK;
+
+	//Initialize DMA2D Peripheral Clock
+	__HAL_RCC_DMA2D_CLK_ENABLE();
+	__HAL_RCC_DMA2D_FORCE_RESET();
+	__HAL_RCC_DMA2D_RELEASE_RESET();
+
+	//Clear job queue and job counters
+	m_uHead  = 0;
+	m_uCount = 0;
+	m_sStats = {0, 0, 0, 0, 0, 0, 0};
+
+	//Enable DMA2D interrupt, which is used to start each queued job once the previous job completes
+	HAL_NVIC_SetPriority(DMA2D_IRQn, QAD_IRQPRIORITY_DMA2D, 0);
+	HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+
+	//Set Driver State
+	m_eInitState = QA_Initialized;
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_DMA2D::imp_deinit
+//QAD_DMA2D Initialization Method
+//
+//To be called from static method deinit()
+//Used to wait for any queued jobs to complete, and then to disable the DMA2D peripheral and its interrupt
+void QAD_DMA2D::imp_deinit(void) {
+	if (!m_eInitState)
+		return;
+
+	//Wait for queued jobs to complete
+	imp_wait();
+
+	//Disable DMA2D interrupt
+	HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+
+	//Disable DMA2D Peripheral Clock
+	__HAL_RCC_DMA2D_FORCE_RESET();
+	__HAL_RCC_DMA2D_RELEASE_RESET();
+	__HAL_RCC_DMA2D_CLK_DISABLE();
+
+	//Set Driver State
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_DMA2D IRQ Handler Methods
+
+//QAD_DMA2D::imp_handler
+//QAD_DMA2D IRQ Handler Method
+//
+//To be called from static method handler(), which is called by DMA2D_IRQHandler() in handlers.cpp
+//Used to complete the job being performed, and to start the next queued job
+//The HAL interrupt handler is not used as the registers of each job are written directly (see imp_start())
+void QAD_DMA2D::imp_handler(void) {
+	uint32_t uFlags = DMA2D->ISR & (DMA2D_ISR_TCIF | DMA2D_ISR_TEIF | DMA2D_ISR_CEIF);
+	if (!uFlags)
+		return;
+
+	DMA2D->IFCR = uFlags;  //Flags of the clear register are in the same positions as those of the status register
+	imp_complete(uFlags & (DMA2D_ISR_TEIF | DMA2D_ISR_CEIF));
+}
+
+
+//QAD_DMA2D::imp_lockIRQ
+//QAD_DMA2D IRQ Handler Method
+//
+//Used to prevent the DMA2D interrupt from being handled while the job queue is being changed
+void QAD_DMA2D::imp_lockIRQ(void) {
+	HAL_NVIC_DisableIRQ(DMA2D_IRQn);
+}
+
+
+//QAD_DMA2D::imp_unlockIRQ
+//QAD_DMA2D IRQ Handler Method
+//
+//Used to allow the DMA2D interrupt to be handled again after imp_lockIRQ()
+void QAD_DMA2D::imp_unlockIRQ(void) {
+	HAL_NVIC_EnableIRQ(DMA2D_IRQn);
+}
+
+
+//QAD_DMA2D::imp_start
+//QAD_DMA2D IRQ Handler Method
+//
+//Used to program the engine with a job and start it
+//The registers are written directly rather than through HAL_DMA2D_Init(), HAL_DMA2D_ConfigLayer() and HAL_DMA2D_Start_IT(), as the
+//HAL reconfigures every register of the peripheral for each transfer, and locks its handle, so could fail when called from the interrupt
+//sJob - The job. See QAD_DMA2D_Job
+void QAD_DMA2D::imp_start(const QAD_DMA2D_Job& sJob) {
+	static const uint32_t uModes[] = {DMA2D_R2M, DMA2D_M2M, DMA2D_M2M_PFC, DMA2D_M2M_BLEND};  //Indexed by QAD_DMA2D_Mode
+
+	DMA2D->CR     = uModes[sJob.eMode] | DMA2D_CR_TCIE | DMA2D_CR_TEIE | DMA2D_CR_CEIE;
+	DMA2D->OPFCCR = sJob.eDstFormat;
+	DMA2D->OMAR   = (uint32_t)sJob.pDst;
+	DMA2D->OOR    = sJob.uDstStride - sJob.uWidth;
+	DMA2D->NLR    = ((uint32_t)sJob.uWidth << DMA2D_NLR_PL_Pos) | sJob.uHeight;
+
+	if (sJob.eMode == QAD_DMA2D_Fill) {
+		DMA2D->OCOLR = sJob.uColor;
+	} else {
+
+		//Source alpha is left unchanged unless a constant alpha is given, in which case the two are multiplied
+		uint32_t uAlphaMode = (sJob.uAlpha == 255) ? DMA2D_NO_MODIF_ALPHA : DMA2D_COMBINE_ALPHA;
+		DMA2D->FGPFCCR = sJob.eSrcFormat | (uAlphaMode << DMA2D_FGPFCCR_AM_Pos) | ((uint32_t)sJob.uAlpha << DMA2D_FGPFCCR_ALPHA_Pos);
+		DMA2D->FGMAR   = (uint32_t)sJob.pSrc;
+		DMA2D->FGOR    = sJob.uSrcStride - sJob.uWidth;
+
+		if (sJob.eMode == QAD_DMA2D_Blend) {
+			DMA2D->BGPFCCR = sJob.eBackFormat;
+			DMA2D->BGMAR   = (uint32_t)sJob.pBack;
+			DMA2D->BGOR    = sJob.uBackStride - sJob.uWidth;
+		}
+	}
+
+	DMA2D->CR |= DMA2D_CR_START;
+}
+
+
+//QAD_DMA2D::imp_poll
+//QAD_DMA2D IRQ Handler Method
+//
+//Called repeatedly while waiting for queued jobs to complete
+//Jobs are completed by the DMA2D interrupt, so there is nothing to be done while waiting
+void QAD_DMA2D::imp_poll(void) {}
+
+
+//QAD_DMA2D::imp_cleanCache
+//QAD_DMA2D IRQ Handler Method
+//
+//Used before a job is queued to write back any cached pixels that the engine is to read, and to write back and invalidate any cached
+//pixels that the engine is to write, so that stale cache lines are not later written back over the engine's pixels
+//sJob - The job. See QAD_DMA2D_Job
+void QAD_DMA2D::imp_cleanCache(const QAD_DMA2D_Job& sJob) {
+	QAD_DMA2D_CacheRect(sJob.pDst, sJob.uDstStride, sJob.uWidth, sJob.uHeight, sJob.eDstFormat, true);
+	if (sJob.eMode != QAD_DMA2D_Fill)
+		QAD_DMA2D_CacheRect(sJob.pSrc, sJob.uSrcStride, sJob.uWidth, sJob.uHeight, sJob.eSrcFormat, false);
+	if (sJob.eMode == QAD_DMA2D_Blend)
+		QAD_DMA2D_CacheRect(sJob.pBack, sJob.uBackStride, sJob.uWidth, sJob.uHeight, sJob.eBackFormat, false);
+}
+
+
+//QAD_DMA2D::imp_invalidateCache
+//QAD_DMA2D IRQ Handler Method
+//
+//Used once a job has completed to discard any cache lines covering its destination that were speculatively read while the job was
+//being performed, so that the CPU reads the engine's pixels
+//sJob - The job. See QAD_DMA2D_Job
+void QAD_DMA2D::imp_invalidateCache(const QAD_DMA2D_Job& sJob) {
+	QAD_DMA2D_CacheRect(sJob.pDst, sJob.uDstStride, sJob.uWidth, sJob.uHeight, sJob.eDstFormat, true);
+}
+
+
+#endif /* !QA_HOST */
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //---------------------
+  //---------------------
+  //QAD_DMA2D Job Methods
+  //
+  //The following methods are shared by both the board and desktop host versions of the driver, with the board and host specific
+  //IRQ handler methods being found in QAD_DMA2D.cpp and QAD_DMA2D_Host.cpp respectively
+
+//QAD_DMA2D::imp_submit
+//QAD_DMA2D Job Method
+//
+//To be called from static methods submit(), fill(), copy(), convert() and blend()
+//Used to add a job to the end of the queue, starting it straight away if the engine is idle
+//sJob - The job. See QAD_DMA2D_Job
+//Returns QA_OK if the job was queued or has no pixels, or QA_Fail if the driver is not initialized or the job cannot be described by
+//the engine's registers, such as a stride that is shorter than the width, or a pixel that is not aligned to its size
+QA_Result QAD_DMA2D::imp_submit(const QAD_DMA2D_Job& sJob) {
+	if (!m_eInitState)
+		return QA_Fail;
+	if (!sJob.uWidth || !sJob.uHeight)
+		return QA_OK;
+
+	//Check destination, source and background details
+	if ((sJob.uWidth > QAD_DMA2D_MAXLENGTH) || (sJob.eDstFormat > QAD_DMA2D_ARGB4444) || (sJob.uDstStride < sJob.uWidth) ||
+			((sJob.uDstStride - sJob.uWidth) > QAD_DMA2D_MAXLENGTH) || ((uintptr_t)sJob.pDst % (bytes(sJob.eDstFormat) & 0x06)))
+		return QA_Fail;
+	if ((sJob.eMode != QAD_DMA2D_Fill) &&
+			((sJob.eSrcFormat > QAD_DMA2D_ARGB4444) || (sJob.uSrcStride < sJob.uWidth) || ((sJob.uSrcStride - sJob.uWidth) > QAD_DMA2D_MAXLENGTH) ||
+			 ((uintptr_t)sJob.pSrc % (bytes(sJob.eSrcFormat) & 0x06)) || ((sJob.eMode == QAD_DMA2D_Copy) && (sJob.eSrcFormat != sJob.eDstFormat))))
+		return QA_Fail;
+	if ((sJob.eMode == QAD_DMA2D_Blend) &&
+			((sJob.eBackFormat > QAD_DMA2D_ARGB4444) || (sJob.uBackStride < sJob.uWidth) || ((sJob.uBackStride - sJob.uWidth) > QAD_DMA2D_MAXLENGTH) ||
+			 ((uintptr_t)sJob.pBack % (bytes(sJob.eBackFormat) & 0x06))))
+		return QA_Fail;
+
+	//Wait for the oldest job to complete if the queue is full
+	if (m_uCount == QAD_DMA2D_QUEUELENGTH) {
+		m_sStats.uStalls++;
+		while (m_uCount == QAD_DMA2D_QUEUELENGTH)
+			imp_poll();
+	}
+
+	//Write back cached pixels before the engine accesses them
+	imp_cleanCache(sJob);
+
+	//Add job to the end of the queue, and start it if it is the only queued job
+	imp_lockIRQ();
+	m_sQueue[(m_uHead + m_uCount) % QAD_DMA2D_QUEUELENGTH] = sJob;
+	m_uCount++;
+
+	m_sStats.uJobs++;
+	m_sStats.uPixels += (uint32_t)sJob.uWidth * sJob.uHeight;
+	if (m_uCount > m_sStats.uPeak)
+		m_sStats.uPeak = m_uCount;
+
+	if (m_uCount == 1)
+		imp_start(m_sQueue[m_uHead]);
+	imp_unlockIRQ();
+
+	//Return
+	return QA_OK;
+}
+
+
+//QAD_DMA2D::imp_complete
+//QAD_DMA2D Job Method
+//
+//Called by the DMA2D interrupt, or by imp_poll() on a desktop host, once the job at the head of the queue has completed
+//Used to remove the job from the queue and start the next queued job
+//bError - true if the job ended with a transfer or configuration error
+void QAD_DMA2D::imp_complete(bool bError) {
+	imp_invalidateCache(m_sQueue[m_uHead]);
+
+	m_uHead = (m_uHead + 1) % QAD_DMA2D_QUEUELENGTH;
+	m_uCount--;
+
+	m_sStats.uCompleted++;
+	if (bError)
+		m_sStats.uErrors++;
+
+	if (m_uCount)
+		imp_start(m_sQueue[m_uHead]);
+}
+
+
+//QAD_DMA2D::imp_wait
+//QAD_DMA2D Job Method
+//
+//To be called from static method wait()
+//Used to wait until all queued jobs have completed
+void QAD_DMA2D::imp_wait(void) {
+	if (!m_uCount)
+		return;
+
+	m_sStats.uWaits++;
+	while (m_uCount)
+		imp_poll();
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAD_DMA2D Job Stats Methods
+
+//QAD_DMA2D::imp_getStats
+//QAD_DMA2D Job Stats Method
+//
+//To be called from static method getStats()
+//Returns a copy of the job counters, taken while the DMA2D interrupt is prevented from changing them
+QAD_DMA2D_Stats QAD_DMA2D::imp_getStats(void) {
+	if (!m_eInitState)
+		return m_sStats;
+
+	imp_lockIRQ();
+	QAD_DMA2D_Stats sStats = m_sStats;
+	imp_unlockIRQ();
+	return sStats;
+}
+
+
+//QAD_DMA2D::imp_resetStats
+//QAD_DMA2D Job Stats Method
+//
+//To be called from static method resetStats()
+//Used to reset the job counters to zero
+void QAD_DMA2D::imp_resetStats(void) {
+	if (!m_eInitState) {
+		m_sStats = {0, 0, 0, 0, 0, 0, 0};
+		return;
+	}
+
+	imp_lockIRQ();
+	m_sStats = {0, 0, 0, 0, 0, 0, 0};
+	imp_unlockIRQ();
+}
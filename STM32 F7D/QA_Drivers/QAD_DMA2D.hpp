@@ -0,0 +1,363 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: DMA2D (Chrom-ART) Driver                                        */
+/*   Filename: QAD_DMA2D.hpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAD_DMA2D_HPP_
+#define __QAD_DMA2D_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+
+  //NOTE:
+  //The DMA2D (Chrom-ART Accelerator) is a DMA engine dedicated to blocks of pixels. It can fill a rectangle with a single color,
+  //copy a rectangle of pixels, convert a rectangle of pixels from one pixel format to another, and blend a rectangle of foreground
+  //pixels over a rectangle of background pixels, all while the CPU carries on with other work.
+  //
+  //Each operation is described by a job (see QAD_DMA2D_Job), which is added to a queue rather than being started straight away.
+  //The DMA2D transfer complete interrupt starts the next queued job as soon as the previous job finishes, so the CPU can prepare
+  //further jobs, or render elsewhere, while the engine runs. As the engine writes memory behind the CPU's back, wait() must be called
+  //before the CPU reads or writes any pixels that a queued job writes to, or writes any pixels that a queued job reads from.
+  //
+  //When building for a desktop host there is no engine, so queued jobs are performed in software by QAD_DMA2D_Host.cpp whenever the
+  //CPU waits for the queue, using the same pixel format conversion and blending equations as the engine.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//---------------------
+//QAD_DMA2D_QUEUELENGTH
+//
+//Used to determine the maximum number of jobs that can be queued. Once the queue is full, submitting a job waits for the
+//oldest job to complete
+#define QAD_DMA2D_QUEUELENGTH   16
+
+
+//-------------------
+//QAD_DMA2D_MAXLENGTH
+//
+//Largest number of pixels per line, and largest number of pixels between the end of one line and the start of the next,
+//that the engine's registers can hold
+#define QAD_DMA2D_MAXLENGTH     0x3FFF
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//----------------
+//QAD_DMA2D_Format
+//
+//Used to select the pixel format of the pixels read or written by a job
+//The values match those of the DMA2D color mode registers, which are also the same as the LTDC layer pixel format values used
+//by the formats defined in QAT_PixelFormat.hpp, so a format can be given as Format::LTDC
+enum QAD_DMA2D_Format : uint8_t {
+	QAD_DMA2D_ARGB8888 = 0,  //32bit pixels with 8 bits each for Alpha, Red, Green and Blue
+	QAD_DMA2D_RGB888,        //24bit pixels with 8 bits each for Red, Green and Blue
+	QAD_DMA2D_RGB565,        //16bit pixels with 5 bits for Red, 6 bits for Green and 5 bits for Blue
+	QAD_DMA2D_ARGB1555,      //16bit pixels with 1 bit for Alpha, and 5 bits each for Red, Green and Blue
+	QAD_DMA2D_ARGB4444       //16bit pixels with 4 bits each for Alpha, Red, Green and Blue
+};
+
+
+//--------------
+//QAD_DMA2D_Mode
+//
+//Used to select the operation performed by a job
+enum QAD_DMA2D_Mode : uint8_t {
+	QAD_DMA2D_Fill = 0,  //Fills the destination with uColor, which is given in the destination format
+	QAD_DMA2D_Copy,      //Copies source pixels to the destination without any conversion. The source format must match the destination format
+	QAD_DMA2D_Convert,   //Converts source pixels to the destination format, with their alpha multiplied by uAlpha
+	QAD_DMA2D_Blend      //Blends source pixels, with their alpha multiplied by uAlpha, over background pixels and writes the result to the destination
+};
+
+
+//-------------
+//QAD_DMA2D_Job
+//
+//Structure used to describe a single job
+//Strides are the number of pixels between the start of each line, which must be at least the width of the job
+//For QAD_DMA2D_Blend jobs the background is often the destination itself, in which case pBack and uBackStride match pDst and uDstStride
+typedef struct {
+	QAD_DMA2D_Mode   eMode;        //The operation to be performed. Member of QAD_DMA2D_Mode enum
+	QAD_DMA2D_Format eDstFormat;   //Pixel format of the destination
+	QAD_DMA2D_Format eSrcFormat;   //Pixel format of the source. Not used by QAD_DMA2D_Fill jobs
+	QAD_DMA2D_Format eBackFormat;  //Pixel format of the background. Only used by QAD_DMA2D_Blend jobs
+	uint8_t          uAlpha;       //Constant alpha that the alpha of each source pixel is multiplied by, where 255 leaves source alpha unchanged
+	uint16_t         uWidth;       //Width of the job in pixels
+	uint16_t         uHeight;      //Height of the job in pixels
+
+	void*            pDst;         //Pointer to the upper-left destination pixel
+	uint16_t         uDstStride;   //Stride of the destination in pixels
+	const void*      pSrc;         //Pointer to the upper-left source pixel. Not used by QAD_DMA2D_Fill jobs
+	uint16_t         uSrcStride;   //Stride of the source in pixels
+	const void*      pBack;        //Pointer to the upper-left background pixel. Only used by QAD_DMA2D_Blend jobs
+	uint16_t         uBackStride;  //Stride of the background in pixels
+	uint32_t         uColor;       //Fill color in the destination format. Only used by QAD_DMA2D_Fill jobs
+} QAD_DMA2D_Job;
+
+
+//---------------
+//QAD_DMA2D_Stats
+//
+//Structure used to report the job counters of the driver
+typedef struct {
+	uint32_t uJobs;       //Number of jobs submitted
+	uint32_t uCompleted;  //Number of jobs completed
+	uint32_t uPixels;     //Number of pixels written by submitted jobs
+	uint32_t uStalls;     //Number of times a job was submitted while the queue was full, and so had to wait for a free entry
+	uint32_t uWaits;      //Number of times wait() had to wait for queued jobs to complete
+	uint32_t uErrors;     //Number of jobs that ended with a transfer or configuration error, whose destination pixels are undefined
+	uint32_t uPeak;       //Largest number of jobs that have been queued at once
+} QAD_DMA2D_Stats;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//---------
+//QAD_DMA2D
+//
+//Singleton class
+//Driver class for the DMA2D (Chrom-ART Accelerator) peripheral, which is used to offload fills, copies, pixel format conversions and
+//blending of rectangular blocks of pixels from the CPU
+//This is setup as a singleton class due to only one DMA2D peripheral being available on the STM32F769I Discovery board, meaning
+//that potential conflicts are prevented by not allowing more than one instance of the class to exist.
+class QAD_DMA2D {
+private:
+
+	QA_InitState m_eInitState;                            //Stores whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+
+	QAD_DMA2D_Job    m_sQueue[QAD_DMA2D_QUEUELENGTH];     //Queue of jobs, with the job at m_uHead being performed by the engine
+	volatile uint8_t m_uHead;                             //Index within m_sQueue of the oldest queued job
+	volatile uint8_t m_uCount;                            //Number of queued jobs, including the job being performed
+
+	QAD_DMA2D_Stats  m_sStats;                            //Job counters
+
+
+	//------------
+	//Constructors
+
+	//As this is a private method in a singleton class, this method will be called the first time the class's get() method is called
+	QAD_DMA2D() :
+		m_eInitState(QA_NotInitialized),
+		m_uHead(0),
+		m_uCount(0),
+		m_sStats{0, 0, 0, 0, 0, 0, 0} {}
+
+public:
+
+	//----------------------------------------------------------------------------------
+	//Delete the copy constructor and assignment operator due to being a singleton class
+	QAD_DMA2D(const QAD_DMA2D& other) = delete;
+	QAD_DMA2D& operator=(const QAD_DMA2D& other) = delete;
+
+
+	//-----------------
+	//Singleton Methods
+	//
+	//Used to retrieve a reference to the singleton class
+	static QAD_DMA2D& get(void) {
+		static QAD_DMA2D instance;
+		return instance;
+	}
+
+
+	//----------------------
+	//Initialization Methods
+
+	//Used to initialize the DMA2D peripheral and its interrupt
+	//Returns QA_OK if initialization is successful, or QA_Fail if initialization fails
+	static QA_Result init(void) {
+		return get().imp_init();
+	}
+
+	//Used to deinitialize the DMA2D peripheral, once any queued jobs have completed
+	static void deinit(void) {
+		get().imp_deinit();
+	}
+
+	//Returns whether the driver is currently initialized. Member of QA_InitState enum defined in setup.hpp
+	static QA_InitState getInitState(void) {
+		return get().m_eInitState;
+	}
+
+
+	//-----------
+	//Job Methods
+
+	//Used to queue a job, which is started as soon as all previously queued jobs have completed
+	//If the queue is full, this waits until the oldest job has completed
+	//sJob - The job. See QAD_DMA2D_Job
+	//Returns QA_OK if the job was queued, or QA_Fail if the driver is not initialized or the job cannot be performed by the engine,
+	//in which case the caller is to perform the operation itself
+	static QA_Result submit(const QAD_DMA2D_Job& sJob) {
+		return get().imp_submit(sJob);
+	}
+
+	//Used to queue a job that fills a rectangle with a single color
+	//pDst    - Pointer to the upper-left pixel of the rectangle
+	//uStride - The number of pixels between the start of each line
+	//uWidth  - The width in pixels of the rectangle
+	//uHeight - The height in pixels of the rectangle
+	//eFormat - The pixel format of the rectangle. Member of QAD_DMA2D_Format enum
+	//uColor  - The color, in the pixel format of the rectangle
+	//Returns QA_OK if the job was queued, or QA_Fail if it was not (see submit())
+	static QA_Result fill(void* pDst, uint16_t uStride, uint16_t uWidth, uint16_t uHeight, QAD_DMA2D_Format eFormat, uint32_t uColor) {
+		return get().imp_submit({QAD_DMA2D_Fill, eFormat, eFormat, eFormat, 255, uWidth, uHeight, pDst, uStride, NULL, 0, NULL, 0, uColor});
+	}
+
+	//Used to queue a job that copies a rectangle of pixels without any conversion
+	//pDst       - Pointer to the upper-left pixel of the destination rectangle
+	//uDstStride - The number of pixels between the start of each line of the destination
+	//pSrc       - Pointer to the upper-left pixel of the source rectangle
+	//uSrcStride - The number of pixels between the start of each line of the source
+	//uWidth     - The width in pixels of the rectangle
+	//uHeight    - The height in pixels of the rectangle
+	//eFormat    - The pixel format of both rectangles. Member of QAD_DMA2D_Format enum
+	//Returns QA_OK if the job was queued, or QA_Fail if it was not (see submit())
+	static QA_Result copy(void* pDst, uint16_t uDstStride, const void* pSrc, uint16_t uSrcStride, uint16_t uWidth, uint16_t uHeight,
+			                  QAD_DMA2D_Format eFormat) {
+		return get().imp_submit({QAD_DMA2D_Copy, eFormat, eFormat, eFormat, 255, uWidth, uHeight, pDst, uDstStride, pSrc, uSrcStride, NULL, 0, 0});
+	}
+
+	//Used to queue a job that converts a rectangle of pixels from one pixel format to another
+	//pDst       - Pointer to the upper-left pixel of the destination rectangle
+	//uDstStride - The number of pixels between the start of each line of the destination
+	//eDstFormat - The pixel format of the destination. Member of QAD_DMA2D_Format enum
+	//pSrc       - Pointer to the upper-left pixel of the source rectangle
+	//uSrcStride - The number of pixels between the start of each line of the source
+	//eSrcFormat - The pixel format of the source. Member of QAD_DMA2D_Format enum
+	//uWidth     - The width in pixels of the rectangle
+	//uHeight    - The height in pixels of the rectangle
+	//uAlpha     - Constant alpha that the alpha of each source pixel is multiplied by, where 255 leaves source alpha unchanged
+	//Returns QA_OK if the job was queued, or QA_Fail if it was not (see submit())
+	static QA_Result convert(void* pDst, uint16_t uDstStride, QAD_DMA2D_Format eDstFormat, const void* pSrc, uint16_t uSrcStride,
+			                     QAD_DMA2D_Format eSrcFormat, uint16_t uWidth, uint16_t uHeight, uint8_t uAlpha = 255) {
+		return get().imp_submit({QAD_DMA2D_Convert, eDstFormat, eSrcFormat, eDstFormat, uAlpha, uWidth, uHeight, pDst, uDstStride, pSrc, uSrcStride,
+			                       NULL, 0, 0});
+	}
+
+	//Used to queue a job that blends a rectangle of source pixels over the pixels of the destination
+	//pDst       - Pointer to the upper-left pixel of the destination rectangle, which is also the background
+	//uDstStride - The number of pixels between the start of each line of the destination
+	//eDstFormat - The pixel format of the destination. Member of QAD_DMA2D_Format enum
+	//pSrc       - Pointer to the upper-left pixel of the source rectangle
+	//uSrcStride - The number of pixels between the start of each line of the source
+	//eSrcFormat - The pixel format of the source. Member of QAD_DMA2D_Format enum
+	//uWidth     - The width in pixels of the rectangle
+	//uHeight    - The height in pixels of the rectangle
+	//uAlpha     - Constant alpha that the alpha of each source pixel is multiplied by, where 255 leaves source alpha unchanged
+	//Returns QA_OK if the job was queued, or QA_Fail if it was not (see submit())
+	static QA_Result blend(void* pDst, uint16_t uDstStride, QAD_DMA2D_Format eDstFormat, const void* pSrc, uint16_t uSrcStride,
+			                   QAD_DMA2D_Format eSrcFormat, uint16_t uWidth, uint16_t uHeight, uint8_t uAlpha = 255) {
+		return get().imp_submit({QAD_DMA2D_Blend, eDstFormat, eSrcFormat, eDstFormat, uAlpha, uWidth, uHeight, pDst, uDstStride, pSrc, uSrcStride,
+			                       pDst, uDstStride, 0});
+	}
+
+	//Used to wait until all queued jobs have completed, so that the pixels they access can be accessed by the CPU
+	//Must not be called from an interrupt with a higher priority than QAD_IRQPRIORITY_DMA2D
+	static void wait(void) {
+		get().imp_wait();
+	}
+
+	//Returns the number of queued jobs that have not yet completed
+	static uint8_t pending(void) {
+		return get().m_uCount;
+	}
+
+
+	//-----------------
+	//Job Stats Methods
+
+	//Returns the job counters of the driver
+	static QAD_DMA2D_Stats getStats(void) {
+		return get().imp_getStats();
+	}
+
+	//Used to reset the job counters of the driver to zero
+	static void resetStats(void) {
+		get().imp_resetStats();
+	}
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	//Used to handle the DMA2D interrupt
+	//This method is only to be called by the interrupt request handler function from handlers.cpp
+	static void handler(void) {
+		get().imp_handler();
+	}
+
+
+	//---------------------
+	//Format Helper Methods
+
+	//Returns the size in bytes of a single pixel of a format
+	//eFormat - The pixel format. Member of QAD_DMA2D_Format enum
+	static constexpr uint8_t bytes(QAD_DMA2D_Format eFormat) {
+		return (eFormat == QAD_DMA2D_ARGB8888) ? 4 : ((eFormat == QAD_DMA2D_RGB888) ? 3 : 2);
+	}
+
+
+private:
+
+	//NOTE: Please see QAD_DMA2D.cpp for details of the following methods
+
+	//----------------------
+	//Initialization Methods
+
+	QA_Result imp_init(void);
+	void imp_deinit(void);
+
+
+	//-----------
+	//Job Methods
+
+	QA_Result imp_submit(const QAD_DMA2D_Job& sJob);
+	void imp_complete(bool bError);
+	void imp_wait(void);
+
+
+	//-----------------
+	//Job Stats Methods
+
+	QAD_DMA2D_Stats imp_getStats(void);
+	void imp_resetStats(void);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void imp_handler(void);
+	void imp_lockIRQ(void);
+	void imp_unlockIRQ(void);
+	void imp_start(const QAD_DMA2D_Job& sJob);
+	void imp_poll(void);
+	void imp_cleanCache(const QAD_DMA2D_Job& sJob);
+	void imp_invalidateCache(const QAD_DMA2D_Job& sJob);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAD_DMA2D_HPP_ */
@@ -0,0 +1,239 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: DMA2D (Chrom-ART) Driver - Desktop Host Version                 */
+/*   Filename: QAD_DMA2D_Host.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_DMA2D.hpp"
+
+//This version of the driver is only built for a desktop host (see setup.hpp)
+//As there is no DMA2D engine, queued jobs are performed in software, one at a time, whenever the CPU waits for the queue with wait()
+//or waits for a free queue entry. Jobs are performed using the same pixel format conversions and blending equations as the engine,
+//so that the pixels rendered on a host match those rendered on the board
+#if defined(QA_HOST)
+
+#include "QAT_PixelFormat.hpp"
+
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Returns a pixel converted to ARGB8888, with components that are not stored by the format being expanded by replicating their upper
+//bits, and formats that do not store alpha being opaque, in the same manner as the engine's input pixel format converter
+//pPixels - Pointer to the pixels
+//uIdx    - Index of the pixel
+//eFormat - The pixel format. Member of QAD_DMA2D_Format enum
+static uint32_t QAD_DMA2D_HostRead(const void* pPixels, uint32_t uIdx, QAD_DMA2D_Format eFormat) {
+	switch (eFormat) {
+		case (QAD_DMA2D_ARGB8888):
+			return ((const uint32_t*)pPixels)[uIdx];
+		case (QAD_DMA2D_RGB888): {
+			const uint8_t* pPxl = &((const uint8_t*)pPixels)[uIdx * 3];
+			return 0xFF000000 | ((uint32_t)pPxl[2] << 16) | ((uint32_t)pPxl[1] << 8) | pPxl[0];
+		}
+		case (QAD_DMA2D_RGB565):
+			return QAT_PixelConvert<QAT_PixelFormat_ARGB8888, QAT_PixelFormat_RGB565>::convert(((const uint16_t*)pPixels)[uIdx]);
+		case (QAD_DMA2D_ARGB1555): {
+			uint16_t uPxl = ((const uint16_t*)pPixels)[uIdx];
+			uint8_t  uR   = (uPxl >> 10) & 0x1F;
+			uint8_t  uG   = (uPxl >> 5) & 0x1F;
+			uint8_t  uB   = uPxl & 0x1F;
+			return QAT_PixelFormat_ARGB8888::pack((uPxl & 0x8000) ? 0xFF : 0x00, (uR << 3) | (uR >> 2), (uG << 3) | (uG >> 2), (uB << 3) | (uB >> 2));
+		}
+		default:
+			return QAT_PixelConvert<QAT_PixelFormat_ARGB8888, QAT_PixelFormat_ARGB4444>::convert(((const uint16_t*)pPixels)[uIdx]);
+	}
+}
+
+
+//Used to write an ARGB8888 pixel in another format, with the lower bits of each component being discarded in the same manner as the
+//engine's output pixel format converter
+//pPixels - Pointer to the pixels
+//uIdx    - Index of the pixel
+//eFormat - The pixel format. Member of QAD_DMA2D_Format enum
+//uPxl    - The ARGB8888 pixel
+static void QAD_DMA2D_HostWrite(void* pPixels, uint32_t uIdx, QAD_DMA2D_Format eFormat, uint32_t uPxl) {
+	switch (eFormat) {
+		case (QAD_DMA2D_ARGB8888):
+			((uint32_t*)pPixels)[uIdx] = uPxl;
+			break;
+		case (QAD_DMA2D_RGB888): {
+			uint8_t* pPxl = &((uint8_t*)pPixels)[uIdx * 3];
+			pPxl[0] = uPxl & 0xFF;
+			pPxl[1] = (uPxl >> 8) & 0xFF;
+			pPxl[2] = (uPxl >> 16) & 0xFF;
+			break;
+		}
+		case (QAD_DMA2D_RGB565):
+			((uint16_t*)pPixels)[uIdx] = QAT_PixelConvert<QAT_PixelFormat_RGB565, QAT_PixelFormat_ARGB8888>::convert(uPxl);
+			break;
+		case (QAD_DMA2D_ARGB1555):
+			((uint16_t*)pPixels)[uIdx] = ((uPxl >> 16) & 0x8000) | ((uPxl >> 9) & 0x7C00) | ((uPxl >> 6) & 0x03E0) | ((uPxl >> 3) & 0x001F);
+			break;
+		default:
+			((uint16_t*)pPixels)[uIdx] = QAT_PixelConvert<QAT_PixelFormat_ARGB4444, QAT_PixelFormat_ARGB8888>::convert(uPxl);
+	}
+}
+
+
+//Returns an ARGB8888 source pixel with its alpha multiplied by a constant alpha, as with the engine's combine alpha mode
+//uPxl   - The ARGB8888 pixel
+//uAlpha - The constant alpha, where 255 leaves the pixel unchanged
+static uint32_t QAD_DMA2D_HostAlpha(uint32_t uPxl, uint8_t uAlpha) {
+	if (uAlpha == 255)
+		return uPxl;
+	return (uPxl & 0x00FFFFFF) | ((((uPxl >> 24) * uAlpha) / 255) << 24);
+}
+
+
+//Returns an ARGB8888 foreground pixel blended over an ARGB8888 background pixel, using the engine's blending equations:
+//  Mult = aFG * aBG / 255
+//  aOUT = aFG + aBG - Mult
+//  cOUT = (cFG * aFG + cBG * aBG - cBG * Mult) / aOUT
+//uFG - The foreground pixel
+//uBG - The background pixel
+static uint32_t QAD_DMA2D_HostBlend(uint32_t uFG, uint32_t uBG) {
+	uint32_t uAlphaFG = uFG >> 24;
+	uint32_t uAlphaBG = uBG >> 24;
+	uint32_t uMult    = (uAlphaFG * uAlphaBG) / 255;
+	uint32_t uAlpha   = uAlphaFG + uAlphaBG - uMult;
+	if (!uAlpha)
+		return 0;
+
+	uint32_t uPxl = uAlpha << 24;
+	for (uint8_t uShift=0; uShift<24; uShift+=8) {
+		uint32_t uCompFG = (uFG >> uShift) & 0xFF;
+		uint32_t uCompBG = (uBG >> uShift) & 0xFF;
+		uPxl |= (((uCompFG * uAlphaFG) + (uCompBG * uAlphaBG) - (uCompBG * uMult)) / uAlpha) << uShift;
+	}
+	return uPxl;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //--------------------------------
+  //QAD_DMA2D Initialization Methods
+
+//QAD_DMA2D::imp_init
+//QAD_DMA2D Initialization Method
+//
+//To be called from static method init()
+//Used to clear the job queue and job counters
+//Returns QA_OK
+QA_Result QAD_DMA2D::imp_init(void) {
+	if (m_eInitState)
+		return QA_OK;
+
+	m_uHead  = 0;
+	m_uCount = 0;
+	m_sStats = {0, 0, 0, 0, 0, 0, 0};
+
+	m_eInitState = QA_Initialized;
+	return QA_OK;
+}
+
+
+//QAD_DMA2D::imp_deinit
+//QAD_DMA2D Initialization Method
+//
+//To be called from static method deinit()
+//Used to perform any queued jobs
+void QAD_DMA2D::imp_deinit(void) {
+	if (!m_eInitState)
+		return;
+
+	imp_wait();
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_DMA2D IRQ Handler Methods
+  //
+  //There is no DMA2D interrupt or data cache on a host, with jobs instead being performed by imp_poll(), so the following methods
+  //have no effect
+
+void QAD_DMA2D::imp_handler(void) {}
+void QAD_DMA2D::imp_lockIRQ(void) {}
+void QAD_DMA2D::imp_unlockIRQ(void) {}
+void QAD_DMA2D::imp_start(const QAD_DMA2D_Job&) {}
+void QAD_DMA2D::imp_cleanCache(const QAD_DMA2D_Job&) {}
+void QAD_DMA2D::imp_invalidateCache(const QAD_DMA2D_Job&) {}
+
+
+//QAD_DMA2D::imp_poll
+//QAD_DMA2D IRQ Handler Method
+//
+//Called repeatedly while waiting for queued jobs to complete
+//Used to perform the job at the head of the queue in software, and then to complete it in the same manner as the DMA2D interrupt
+void QAD_DMA2D::imp_poll(void) {
+	if (!m_uCount)
+		return;
+
+	const QAD_DMA2D_Job& sJob = m_sQueue[m_uHead];
+	uint8_t uDstBytes = bytes(sJob.eDstFormat);
+
+	for (uint16_t y=0; y<sJob.uHeight; y++) {
+		uint32_t uDst  = (uint32_t)y * sJob.uDstStride;
+		uint32_t uSrc  = (uint32_t)y * sJob.uSrcStride;
+		uint32_t uBack = (uint32_t)y * sJob.uBackStride;
+
+		switch (sJob.eMode) {
+
+			//Fill pixels are written as given, without conversion
+			case (QAD_DMA2D_Fill):
+				for (uint16_t x=0; x<sJob.uWidth; x++)
+					memcpy(&((uint8_t*)sJob.pDst)[(uDst + x) * uDstBytes], &sJob.uColor, uDstBytes);
+				break;
+
+			//Copy pixels are moved one at a time from the start of each line, as the engine always copies forwards. Where the source
+			//and destination overlap, pixels that have already been written are then read again, in the same manner as the engine
+			case (QAD_DMA2D_Copy):
+				for (uint16_t x=0; x<sJob.uWidth; x++) {
+					uint8_t uPxl[4];
+					memcpy(uPxl, &((const uint8_t*)sJob.pSrc)[(uSrc + x) * uDstBytes], uDstBytes);
+					memcpy(&((uint8_t*)sJob.pDst)[(uDst + x) * uDstBytes], uPxl, uDstBytes);
+				}
+				break;
+
+			case (QAD_DMA2D_Convert):
+				for (uint16_t x=0; x<sJob.uWidth; x++)
+					QAD_DMA2D_HostWrite(sJob.pDst, uDst + x, sJob.eDstFormat,
+							                QAD_DMA2D_HostAlpha(QAD_DMA2D_HostRead(sJob.pSrc, uSrc + x, sJob.eSrcFormat), sJob.uAlpha));
+				break;
+
+			case (QAD_DMA2D_Blend):
+				for (uint16_t x=0; x<sJob.uWidth; x++)
+					QAD_DMA2D_HostWrite(sJob.pDst, uDst + x, sJob.eDstFormat,
+							                QAD_DMA2D_HostBlend(QAD_DMA2D_HostAlpha(QAD_DMA2D_HostRead(sJob.pSrc, uSrc + x, sJob.eSrcFormat), sJob.uAlpha),
+							                                    QAD_DMA2D_HostRead(sJob.pBack, uBack + x, sJob.eBackFormat)));
+				break;
+		}
+	}
+
+	imp_complete(false);
+}
+
+
+//Prevent building on the STM32F769I Discovery board
+#endif /* QA_HOST */
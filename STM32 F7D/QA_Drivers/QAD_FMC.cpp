@@ -18,6 +18,12 @@
 //Includes
 #include "QAD_FMC.hpp"
 
+#include <string.h>
+
+//The initialization and memory test methods of this driver are replaced by QAD_FMC_Host.cpp when building for a desktop host
+//(see setup.hpp), with the region allocator methods following the board specific methods being shared by both versions
+#if !defined(QA_HOST)
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -202,5 +208,162 @@ void QAD_FMC::cmd(FMC_SDRAM_CommandTypeDef& pCmd) {
 }
 
 
+  //-----------------------------
+  //-----------------------------
+  //QAD_FMC Memory Region Methods
+
+//QAD_FMC::imp_getMemory
+//QAD_FMC Memory Region Method
+//
+//To be called from the QAD_FMC constructor
+//Returns a pointer to the start of the memory that SDRAM regions are allocated from, being the SDRAM's address space
+void* QAD_FMC::imp_getMemory(void) {
+	return (void*)m_uBaseAddr;
+}
+
 
+//Prevent building for a desktop host
+#endif /* !QA_HOST */
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
 
+  //------------------------------------
+  //------------------------------------
+  //QAD_FMC_Allocator Allocation Methods
+
+//QAD_FMC_Allocator::alloc
+//QAD_FMC_Allocator Allocation Method
+//
+//Used to allocate a named region, placed at the lowest aligned address with enough space between the allocated regions
+//Alignment is relative to the address of the memory rather than to the start of the allocator's memory, so that regions are aligned
+//for the LTDC, DMA2D and data cache regardless of where the memory is located
+//strName - Name of the region, which must not match that of another allocated region. The string is not copied
+//uSize   - Size of the region in bytes, which is rounded up to a multiple of the alignment
+//uAlign  - Alignment of the region in bytes, which must be a power of two. Alignments smaller than QAD_FMC_ALIGN_WORD are increased to it
+//Returns a pointer to the start of the region, or NULL if the name or alignment are invalid, the name is already in use, all
+//regions are in use, or there is no space large enough for the region
+void* QAD_FMC_Allocator::alloc(const char* strName, uint32_t uSize, uint32_t uAlign) {
+	if ((strName == NULL) || !uSize || (uSize > m_uSize) || (uAlign & (uAlign - 1)) || (m_uCount >= QAD_FMC_REGION_LENGTH) ||
+			(find(strName) != NULL)) {
+		m_uFailures++;
+		return NULL;
+	}
+	if (uAlign < QAD_FMC_ALIGN_WORD)
+		uAlign = QAD_FMC_ALIGN_WORD;
+	uSize = (uSize + uAlign - 1) & ~(uAlign - 1);
+
+	//Search the space before each region, and then the space after the last region, for the first that the aligned region fits in
+	uintptr_t uBase = (uintptr_t)m_pBase;
+	uint32_t  uFree = 0;  //Offset of the start of the space being searched
+	for (uint8_t i=0; i<=m_uCount; i++) {
+		uint32_t uEnd    = (i < m_uCount) ? m_sRegions[i].uOffset : m_uSize;
+		uint32_t uOffset = (uint32_t)(((uBase + uFree + uAlign - 1) & ~(uintptr_t)(uAlign - 1)) - uBase);
+
+		if ((uOffset <= uEnd) && (uSize <= (uEnd - uOffset))) {
+
+			//Insert region into the table, keeping the table in order of increasing offset
+			for (uint8_t j=m_uCount; j>i; j--)
+				m_sRegions[j] = m_sRegions[j-1];
+			m_sRegions[i] = {strName, uOffset, uSize};
+			m_uCount++;
+
+			m_uUsed += uSize;
+			if (m_uUsed > m_uPeak)
+				m_uPeak = m_uUsed;
+			return &m_pBase[uOffset];
+		}
+
+		if (i < m_uCount)
+			uFree = m_sRegions[i].uOffset + m_sRegions[i].uSize;
+	}
+
+	m_uFailures++;
+	return NULL;
+}
+
+
+//QAD_FMC_Allocator::release
+//QAD_FMC_Allocator Allocation Method
+//
+//Used to release a region, so that its space can be reused by later allocations
+//pData - Pointer to the start of the region, as returned by alloc()
+//Returns QA_OK if the region was released, or QA_Fail if pData is not the start of an allocated region
+QA_Result QAD_FMC_Allocator::release(const void* pData) {
+	for (uint8_t i=0; i<m_uCount; i++) {
+		if (&m_pBase[m_sRegions[i].uOffset] != pData)
+			continue;
+
+		m_uUsed -= m_sRegions[i].uSize;
+		m_uCount--;
+		for (uint8_t j=i; j<m_uCount; j++)
+			m_sRegions[j] = m_sRegions[j+1];
+		return QA_OK;
+	}
+	return QA_Fail;
+}
+
+
+//QAD_FMC_Allocator::clear
+//QAD_FMC_Allocator Allocation Method
+//
+//Used to release all regions and reset the usage statistics
+void QAD_FMC_Allocator::clear(void) {
+	m_uCount    = 0;
+	m_uUsed     = 0;
+	m_uPeak     = 0;
+	m_uFailures = 0;
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAD_FMC_Allocator Region Methods
+
+//QAD_FMC_Allocator::find
+//QAD_FMC_Allocator Region Method
+//
+//Used to find a region by name
+//strName - Name of the region
+//pSize   - Set to the size of the region in bytes if the region is found. Can be NULL if the size is not required
+//Returns a pointer to the start of the region, or NULL if no region has the name
+void* QAD_FMC_Allocator::find(const char* strName, uint32_t* pSize) const {
+	if (strName == NULL)
+		return NULL;
+
+	for (uint8_t i=0; i<m_uCount; i++) {
+		if (strcmp(m_sRegions[i].strName, strName))
+			continue;
+
+		if (pSize != NULL)
+			*pSize = m_sRegions[i].uSize;
+		return &m_pBase[m_sRegions[i].uOffset];
+	}
+	return NULL;
+}
+
+
+  //------------------------------
+  //------------------------------
+  //QAD_FMC_Allocator Stat Methods
+
+//QAD_FMC_Allocator::getStats
+//QAD_FMC_Allocator Stat Method
+//
+//Returns the usage statistics of the allocator, as a QAD_FMC_RegionStats structure
+QAD_FMC_RegionStats QAD_FMC_Allocator::getStats(void) const {
+	QAD_FMC_RegionStats sStats = {m_uSize, m_uUsed, m_uPeak, 0, m_uFailures, m_uCount};
+
+	//Find the largest space between regions, including the spaces before the first region and after the last region
+	uint32_t uFree = 0;
+	for (uint8_t i=0; i<=m_uCount; i++) {
+		uint32_t uEnd = (i < m_uCount) ? m_sRegions[i].uOffset : m_uSize;
+		if ((uEnd - uFree) > sStats.uLargestFree)
+			sStats.uLargestFree = uEnd - uFree;
+		if (i < m_uCount)
+			uFree = m_sRegions[i].uOffset + m_sRegions[i].uSize;
+	}
+	return sStats;
+}
@@ -24,6 +24,15 @@
 #include "setup.hpp"
 
 
+  //NOTE:
+  //The SDRAM is shared out between drivers and systems using the region allocator provided by QAD_FMC (see QAD_FMC_Allocator below),
+  //so that frame buffers, offscreen surfaces, font stores and I/O buffers never overlap. Each region is given a name when allocated,
+  //which allows regions to be found by name and listed along with the allocator's usage statistics.
+  //Allocation only maintains a table of regions, and never reads or writes the SDRAM, so regions can be allocated before QAD_FMC is
+  //initialized, although their memory must not be used until it is. On a desktop host (see setup.hpp), regions are allocated from a
+  //block of ordinary memory standing in for the SDRAM (see QAD_FMC_Host.cpp).
+
+
 	//------------------------------------------
 	//------------------------------------------
 	//------------------------------------------
@@ -42,6 +51,8 @@
 #define QAD_FMC_BYTE_COUNT ((uint32_t)QAD_FMC_32BITWORD_COUNT * 4)
 
 
+#if !defined(QA_HOST)
+
 //------------------
 //QAD_FMC_DataStruct
 //
@@ -60,6 +71,137 @@ typedef struct {
 //Pointer to QAD_FMC_DataStruct, located within SDRAM address space, starting at address 0xC0000000
 #define QAD_FMC_Data ((QAD_FMC_DataStruct*)0xC0000000)
 
+#endif
+
+
+//---------------------
+//QAD_FMC_REGION_LENGTH
+//
+//Used to determine the maximum number of regions that can be allocated from the SDRAM at the same time
+#define QAD_FMC_REGION_LENGTH     ((uint8_t)16)
+
+
+//-----------------------
+//QAD_FMC_ALIGN_WORD
+//QAD_FMC_ALIGN_CACHELINE
+//QAD_FMC_ALIGN_BURST
+//QAD_FMC_ALIGN_ROW
+//
+//Alignments in bytes that can be requested when allocating a region, with the size of each region also being rounded up to a
+//multiple of its alignment so that the region ends on the same boundary
+//- QAD_FMC_ALIGN_WORD suits data that is only accessed by the CPU
+//- QAD_FMC_ALIGN_CACHELINE matches the 32 byte data cache lines of the Cortex-M7, so that cleaning or invalidating the cache for a
+//  region used by DMA never affects a neighbouring region. This is the default alignment
+//- QAD_FMC_ALIGN_BURST matches the 64 byte (16 word) bursts used by the LTDC and DMA2D to access memory, so that lines of pixels
+//  starting on the region's boundary are read and written in whole bursts
+//- QAD_FMC_ALIGN_ROW matches the 1 kilobyte rows of the SDRAM module (256 columns of 32 bits), so that a buffer starts at the
+//  beginning of a row and no burst crosses a row boundary. This suits frame buffers, which are read by the LTDC every refresh
+#define QAD_FMC_ALIGN_WORD        ((uint32_t)4)
+#define QAD_FMC_ALIGN_CACHELINE   ((uint32_t)32)
+#define QAD_FMC_ALIGN_BURST       ((uint32_t)64)
+#define QAD_FMC_ALIGN_ROW         ((uint32_t)1024)
+
+
+//--------------
+//QAD_FMC_Region
+//
+//Structure used to describe a region allocated by QAD_FMC_Allocator
+typedef struct {
+	const char* strName;  //Name of the region. The string is not copied, so must remain valid while the region is allocated
+	uint32_t    uOffset;  //Offset in bytes of the start of the region from the start of the allocator's memory
+	uint32_t    uSize;    //Size in bytes of the region, rounded up to a multiple of its alignment
+} QAD_FMC_Region;
+
+
+//-------------------
+//QAD_FMC_RegionStats
+//
+//Structure used to report the usage statistics of a QAD_FMC_Allocator
+typedef struct {
+	uint32_t uSize;         //Size in bytes of the memory regions are allocated from
+	uint32_t uUsed;         //Number of bytes currently allocated, including the rounding of region sizes
+	uint32_t uPeak;         //Largest number of bytes that have been allocated at the same time
+	uint32_t uLargestFree;  //Size in bytes of the largest unallocated space between regions, which limits the largest region that can still be allocated
+	uint32_t uFailures;     //Number of allocations that have failed
+	uint8_t  uRegions;      //Number of regions currently allocated
+} QAD_FMC_RegionStats;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-----------------
+//QAD_FMC_Allocator
+//
+//Class used to allocate named regions from a block of memory
+//Regions are placed at the lowest address with enough space, and are kept in address order so that the space between them can be
+//reused once a region is released. Only the table of regions is kept by the class, so it can manage any block of memory, which
+//allows the allocator to be tested on a desktop host against an ordinary array.
+class QAD_FMC_Allocator {
+private:
+
+	uint8_t*       m_pBase;     //Pointer to the start of the memory that regions are allocated from
+	uint32_t       m_uSize;     //Size in bytes of the memory
+	QAD_FMC_Region m_sRegions[QAD_FMC_REGION_LENGTH];  //Allocated regions, in order of increasing offset
+	uint8_t        m_uCount;    //Number of allocated regions
+	uint32_t       m_uUsed;     //Number of bytes currently allocated
+	uint32_t       m_uPeak;     //Largest number of bytes allocated at the same time
+	uint32_t       m_uFailures; //Number of failed allocations
+
+public:
+
+	//------------
+	//Constructors
+
+	//pBase - Pointer to the start of the memory that regions are to be allocated from
+	//uSize - Size in bytes of the memory
+	QAD_FMC_Allocator(void* pBase, uint32_t uSize) :
+		m_pBase((uint8_t*)pBase),
+		m_uSize(uSize) {
+		clear();
+	}
+
+
+	//NOTE: See QAD_FMC.cpp for details of the following methods
+
+	//------------------
+	//Allocation Methods
+
+	void* alloc(const char* strName, uint32_t uSize, uint32_t uAlign = QAD_FMC_ALIGN_CACHELINE);
+	QA_Result release(const void* pData);
+	void clear(void);
+
+
+	//--------------
+	//Region Methods
+
+	void* find(const char* strName, uint32_t* pSize = NULL) const;
+
+	//Returns the number of regions currently allocated
+	uint8_t count(void) const {
+		return m_uCount;
+	}
+
+	//Returns a region, with regions being indexed in order of increasing address
+	//uIdx - Index of the region, which must be less than count()
+	const QAD_FMC_Region& operator[](uint8_t uIdx) const {
+		return m_sRegions[uIdx];
+	}
+
+	//Returns a pointer to the start of a region
+	//sRegion - The region, as returned by operator[]
+	void* getData(const QAD_FMC_Region& sRegion) const {
+		return &m_pBase[sRegion.uOffset];
+	}
+
+
+	//------------
+	//Stat Methods
+
+	QAD_FMC_RegionStats getStats(void) const;
+
+};
 
 
 	//------------------------------------------
@@ -104,16 +246,21 @@ private:
 	static const uint32_t m_uBaseAddr   = 0xC0000000; //Base address of SDRAM
 	static const uint32_t m_uSize       = 0x01000000; //Size in hex of SDRAM (16 megabytes)
 
+#if !defined(QA_HOST)
 	SDRAM_HandleTypeDef m_sHandle;  //Handle used by HAL functions to access the FMC peripheral
+#endif
 	QA_InitState        m_eState;   //Stores whether the FMC driver is currently initialized. Member of QA_InitState defined in setup.hpp
 
+	QAD_FMC_Allocator   m_cAllocator; //Allocator used to share out the SDRAM
+
 
 	//------------
 	//Constructors
 
 	//As this is a private method in a singleton class, this method will be called the first time the class's get() method is called
 	QAD_FMC() :
-	  m_eState(QA_NotInitialized) {}
+	  m_eState(QA_NotInitialized),
+	  m_cAllocator(imp_getMemory(), m_uSize) {}
 
 public:
 
@@ -175,6 +322,47 @@ public:
   	return get().imp_test();
   }
 
+
+  //---------------------
+  //Memory Region Methods
+  //
+  //See NOTE at the top of this file, and QAD_FMC_Allocator, for details of how the SDRAM is shared out
+
+  //Used to allocate a named region of SDRAM
+  //strName - Name of the region, which must not match that of another allocated region. The string is not copied, so must remain
+  //          valid while the region is allocated, as is the case for string literals
+  //uSize   - Size of the region in bytes, which will be rounded up to a multiple of the alignment
+  //uAlign  - Alignment of the region in bytes, which must be a power of two. QAD_FMC_ALIGN_CACHELINE by default (see QAD_FMC_ALIGN_WORD)
+  //Returns a pointer to the start of the region, or NULL if the region could not be allocated
+  static void* alloc(const char* strName, uint32_t uSize, uint32_t uAlign = QAD_FMC_ALIGN_CACHELINE) {
+  	return get().m_cAllocator.alloc(strName, uSize, uAlign);
+  }
+
+  //Used to release a region of SDRAM, so that its memory can be reused by later allocations
+  //pData - Pointer to the start of the region, as returned by alloc()
+  //Returns QA_OK if the region was released, or QA_Fail if pData is not the start of an allocated region
+  static QA_Result release(const void* pData) {
+  	return get().m_cAllocator.release(pData);
+  }
+
+  //Used to find a region of SDRAM by name
+  //strName - Name of the region
+  //pSize   - Set to the size of the region in bytes if the region is found. Can be NULL if the size is not required
+  //Returns a pointer to the start of the region, or NULL if no region has the name
+  static void* find(const char* strName, uint32_t* pSize = NULL) {
+  	return get().m_cAllocator.find(strName, pSize);
+  }
+
+  //Returns the allocator used to share out the SDRAM, which allows the allocated regions to be listed
+  static const QAD_FMC_Allocator& getAllocator(void) {
+  	return get().m_cAllocator;
+  }
+
+  //Returns the usage statistics of the SDRAM, as a QAD_FMC_RegionStats structure
+  static QAD_FMC_RegionStats getStats(void) {
+  	return get().m_cAllocator.getStats();
+  }
+
 private:
 
   //NOTE: See QAD_FMC.cpp for details of the following functions
@@ -191,10 +379,20 @@ private:
   QA_Result imp_test(void);
 
 
+  //---------------------
+  //Memory Region Methods
+
+  static void* imp_getMemory(void);
+
+
+#if !defined(QA_HOST)
+
   //----------------------------
   //SDRAM Module Command Methods
 
   void cmd(FMC_SDRAM_CommandTypeDef& pCmd);
+
+#endif
 };
 
 
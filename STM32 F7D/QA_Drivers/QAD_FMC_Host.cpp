@@ -0,0 +1,92 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: FMC / SDRAM Driver - Desktop Host Version                       */
+/*   Filename: QAD_FMC_Host.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_FMC.hpp"
+
+//This version of the driver is only built for a desktop host (see setup.hpp)
+//As there is no FMC peripheral or SDRAM module, regions are allocated from a block of ordinary memory of the same size as the SDRAM,
+//using the same region allocator as the board (see QAD_FMC.cpp)
+#if defined(QA_HOST)
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Memory standing in for the 16 megabyte SDRAM module of the STM32F769I Discovery board
+//Aligned to an SDRAM row, so that regions are placed at the same offsets as they are on the board
+static uint32_t QAD_FMC_HostMemory[QAD_FMC_32BITWORD_COUNT] __attribute__((aligned(QAD_FMC_ALIGN_ROW)));
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //------------------------------
+  //------------------------------
+  //QAD_FMC Initialization Methods
+
+//QAD_FMC::imp_init
+//QAD_FMC Initialization Method
+//
+//To be called from static method init()
+//There is no peripheral to initialize on a host, so the driver is simply marked as initialized
+//Returns QA_OK
+QA_Result QAD_FMC::imp_init() {
+	m_eState = QA_Initialized;
+	return QA_OK;
+}
+
+
+  //--------------------
+  //QAD_FMC Test Methods
+
+//QAD_FMC::imp_test
+//QAD_FMC Test Method
+//
+//Used to perform the same read and write test as the board, on the memory standing in for the SDRAM
+//Returns QA_OK if test passes, or QA_Fail if test is not successful
+QA_Result QAD_FMC::imp_test(void) {
+	for (uint32_t i=0; i < QAD_FMC_32BITWORD_COUNT; i++)
+		QAD_FMC_HostMemory[i] = i;
+
+	for (uint32_t i=0; i < QAD_FMC_32BITWORD_COUNT; i++) {
+		if (QAD_FMC_HostMemory[i] != i)
+			return QA_Fail;
+	}
+	return QA_OK;
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_FMC Memory Region Methods
+
+//QAD_FMC::imp_getMemory
+//QAD_FMC Memory Region Method
+//
+//To be called from the QAD_FMC constructor
+//Returns a pointer to the start of the memory that SDRAM regions are allocated from, being the memory standing in for the SDRAM
+void* QAD_FMC::imp_getMemory(void) {
+	return QAD_FMC_HostMemory;
+}
+
+
+//Prevent building on the STM32F769I Discovery board
+#endif /* QA_HOST */
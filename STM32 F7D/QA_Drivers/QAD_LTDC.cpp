@@ -17,7 +17,17 @@
 
 //Includes
 #include "QAD_LTDC.hpp"
+#include "QAD_FMC.hpp"
 
+//This driver is replaced by QAD_LTDC_Host.cpp when building for a desktop host (see setup.hpp)
+#if !defined(QA_HOST)
+
+
+//Check that the layer pixel format values of each format defined in QAT_PixelFormat.hpp match those of the HAL
+static_assert(QAT_PixelFormat_ARGB8888::LTDC == LTDC_PIXEL_FORMAT_ARGB8888, "QAT_PixelFormat_ARGB8888 does not match HAL");
+static_assert(QAT_PixelFormat_RGB565::LTDC == LTDC_PIXEL_FORMAT_RGB565, "QAT_PixelFormat_RGB565 does not match HAL");
+static_assert(QAT_PixelFormat_ARGB4444::LTDC == LTDC_PIXEL_FORMAT_ARGB4444, "QAT_PixelFormat_ARGB4444 does not match HAL");
+static_assert(QAT_PixelFormat_L8::LTDC == LTDC_PIXEL_FORMAT_L8, "QAT_PixelFormat_L8 does not match HAL");
 
 
 	//------------------------------------------
@@ -186,12 +196,15 @@ QA_Result QAD_LTDC::imp_init(void) {
   //Initialize LTDC Layers
   LTDC_LayerCfgTypeDef LTDC_Layer;
 
+  //Allocate frame buffers of both layers from SDRAM, calling imp_deinit() if there is not enough SDRAM remaining
+  if (imp_allocBuffers()) {
+  	imp_deinit();
+  	return QA_Fail;
+  }
+
     //-------
     //Layer 0
 
-  //Set pointer address for layer 0 double buffer
-  m_pLayer0Ptr = (void*)0xC0000000;
-
   //Clear Layer Config structure
   LTDC_Layer = {0};
 
@@ -201,7 +214,7 @@ QA_Result QAD_LTDC::imp_init(void) {
 	LTDC_Layer.WindowY0        = 0;
 	LTDC_Layer.WindowY1        = QAD_LTDC_HEIGHT;
 
-	LTDC_Layer.PixelFormat     = LTDC_PIXEL_FORMAT_ARGB4444;   //Set pixel format as 16bits per pixel (ARGB4444)
+	LTDC_Layer.PixelFormat     = QAD_LTDC_Layer0Format::LTDC;  //Set pixel format as selected by QAD_LTDC_Layer0Format
 	LTDC_Layer.FBStartAdress   = (uint32_t)m_pLayer0Ptr;       //Set address of initial front buffer for layer 1
 	LTDC_Layer.Alpha           = 255;                          //Specify constant Alpha value used for blending
 	LTDC_Layer.Alpha0          = 0;                            //Specify default Alpha value
@@ -222,13 +235,13 @@ QA_Result QAD_LTDC::imp_init(void) {
 		return QA_Fail;
 	}
 
+	//Initialize layer 0 color look-up table
+	imp_initCLUT(QAD_LTDC_Layer0);
+
 
 	  //-------
 	  //Layer 1
 
-  //Set pointer address for layer 1 doube buffer
-	m_pLayer1Ptr = (void*)((uint32_t)m_pLayer0Ptr + (QAD_LTDC_BUFFERSIZE*2));
-
   //Clear Layer Config structure
   LTDC_Layer = {0};
 
@@ -238,7 +251,7 @@ QA_Result QAD_LTDC::imp_init(void) {
 	LTDC_Layer.WindowY0        = 0;
 	LTDC_Layer.WindowY1        = QAD_LTDC_HEIGHT;
 
-	LTDC_Layer.PixelFormat     = LTDC_PIXEL_FORMAT_ARGB4444;   //Set pixel format as 16bits per pixel (ARGB4444)
+	LTDC_Layer.PixelFormat     = QAD_LTDC_Layer1Format::LTDC;  //Set pixel format as selected by QAD_LTDC_Layer1Format
 	LTDC_Layer.FBStartAdress   = (uint32_t)m_pLayer0Ptr;       //Set address of initial front buffer for layer 1
 	LTDC_Layer.Alpha           = 255;                          //Specify constant Alpha value used for blending
 	LTDC_Layer.Alpha0          = 0;                            //Specify default Alpha value
@@ -259,6 +272,9 @@ QA_Result QAD_LTDC::imp_init(void) {
 		return QA_Fail;
 	}
 
+	//Initialize layer 1 color look-up table
+	imp_initCLUT(QAD_LTDC_Layer1);
+
 
 	//-------------------------------
 	//Enable LTDC Layer 0 and Layer 1
@@ -278,10 +294,15 @@ QA_Result QAD_LTDC::imp_init(void) {
 
 	//-------------------------------
 	//Set Initial Frame Buffer States
-	m_eLayer0Back  = QAD_LTDC_Buffer1;   //Set initial layer 0 back buffer as being buffer 1 in double buffer pair
-	m_eLayer0Front = QAD_LTDC_Buffer0;   //Set initial layer 0 front buffer as being buffer 0 in double buffer pair
-	m_eLayer1Back  = QAD_LTDC_Buffer1;   //Set initial layer 1 back buffer as being buffer 1 in double buffer pair
-	m_eLayer1Front = QAD_LTDC_Buffer0;   //Set initial layer 1 front buffer as being buffer 0 in double buffer pair
+	imp_initLayers();
+
+
+	//---------------------------------------------------------------------------------
+	//Enable LTDC line interrupt at line 0, being the start of the vertical sync period
+	//Queued buffers are presented by this interrupt, see imp_handler()
+	HAL_NVIC_SetPriority(LTDC_IRQn, QAD_IRQPRIORITY_LTDC, 0x00);
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+	HAL_LTDC_ProgramLineEvent(&m_sLTDCHandle, 0);
 
 
 	//Set Driver State as being initialized
@@ -299,6 +320,12 @@ QA_Result QAD_LTDC::imp_init(void) {
 //Used to deinitialize the DSI and LTDC peripherals, LTDC layers, reset display controller and deinitialize reset and backlight GPIO pins
 void QAD_LTDC::imp_deinit(void) {
 
+	//----------------------
+	//Disable LTDC interrupt
+	HAL_NVIC_DisableIRQ(LTDC_IRQn);
+	__HAL_LTDC_DISABLE_IT(&m_sLTDCHandle, LTDC_IT_LI);
+
+
 	//----------------------
 	//Disable DSI Peripheral
 	HAL_DSI_Stop(&m_sDSIHandle);
@@ -385,57 +412,329 @@ void QAD_LTDC::imp_setBrightness(uint8_t uBrightness) {
 }
 
 
+  //----------------------------
+  //----------------------------
+  //QAD_LTDC IRQ Handler Methods
+
+//QAD_LTDC::imp_handler
+//QAD_LTDC IRQ Handler Method
+//
+//To be called from static method handler(), which is called by LTDC_IRQHandler() in handlers.cpp
+//The line interrupt is triggered at line 0 of each frame, being the start of the vertical sync period, so buffers presented by
+//imp_vblank() are loaded while no pixels are being displayed. The HAL interrupt handler is not used as it disables the line
+//interrupt after each event
+void QAD_LTDC::imp_handler(void) {
+	if (__HAL_LTDC_GET_FLAG(&m_sLTDCHandle, LTDC_FLAG_LI)) {
+		__HAL_LTDC_CLEAR_FLAG(&m_sLTDCHandle, LTDC_FLAG_LI);
+		imp_vblank();
+	}
+}
+
+
+//QAD_LTDC::imp_lockIRQ
+//QAD_LTDC IRQ Handler Method
+//
+//Used to prevent the LTDC interrupt from being handled while the buffer state of a layer is being changed
+void QAD_LTDC::imp_lockIRQ(void) {
+	HAL_NVIC_DisableIRQ(LTDC_IRQn);
+}
+
+
+//QAD_LTDC::imp_unlockIRQ
+//QAD_LTDC IRQ Handler Method
+//
+//Used to allow the LTDC interrupt to be handled again after imp_lockIRQ()
+void QAD_LTDC::imp_unlockIRQ(void) {
+	HAL_NVIC_EnableIRQ(LTDC_IRQn);
+}
+
+
+//QAD_LTDC::imp_getLine
+//QAD_LTDC IRQ Handler Method
+//
+//Returns the line currently being displayed, counted from the start of the vertical sync period
+uint32_t QAD_LTDC::imp_getLine(void) {
+	return (m_sLTDCHandle.Instance->CPSR & LTDC_CPSR_CYPOS);
+}
+
+
+//QAD_LTDC::imp_present
+//QAD_LTDC IRQ Handler Method
+//
+//Used by imp_vblank() to load the address and window of each layer's presented buffer into the LTDC, followed by a single immediate
+//reload. A layer whose window is empty is disabled until a buffer with a non-empty window is presented
+//The registers are written directly rather than through HAL_LTDC_SetAddress() and HAL_LTDC_SetWindowSize(), as the HAL locks the
+//handle and so could fail if the interrupt occurs during another HAL LTDC call. Register values are calculated in the same manner as
+//the HAL, and the layer configuration held by the handle is kept up to date for later HAL calls
+//pBuffers - Array of the buffer to be presented for each layer, or QAD_LTDC_BufferNone if the layer is unchanged
+void QAD_LTDC::imp_present(const QAD_LTDC_BufferIdx* pBuffers) {
+	uint32_t uAHBP = (m_sLTDCHandle.Instance->BPCR & LTDC_BPCR_AHBP) >> 16;
+	uint32_t uAVBP = (m_sLTDCHandle.Instance->BPCR & LTDC_BPCR_AVBP);
+
+	for (uint8_t i=0; i<2; i++) {
+		if (pBuffers[i] == QAD_LTDC_BufferNone)
+			continue;
+
+		QAD_LTDC_LayerIdx      eLayer  = (QAD_LTDC_LayerIdx)i;
+		const QAD_LTDC_Window& sWindow = m_sLayers[i].sPending;
+		LTDC_LayerCfgTypeDef&  sCfg    = m_sLTDCHandle.LayerCfg[i];
+		LTDC_Layer_TypeDef*    pLayer  = LTDC_LAYER(&m_sLTDCHandle, i);
+		uint32_t               uAddr   = (uint32_t)imp_getWindowStart(eLayer, pBuffers[i], sWindow);
+		uint32_t               uBytes  = imp_getBytes(eLayer);
+
+		sCfg.FBStartAdress = uAddr;
+		if (!sWindow.uWidth || !sWindow.uHeight) {
+			pLayer->CR &= ~LTDC_LxCR_LEN;
+			continue;
+		}
+
+		sCfg.WindowX0    = sWindow.uX;
+		sCfg.WindowX1    = sWindow.uX + sWindow.uWidth;
+		sCfg.WindowY0    = sWindow.uY;
+		sCfg.WindowY1    = sWindow.uY + sWindow.uHeight;
+		sCfg.ImageWidth  = sWindow.uPitch;
+		sCfg.ImageHeight = sWindow.uHeight;
+
+		pLayer->WHPCR  = (sCfg.WindowX0 + uAHBP + 1) | ((sCfg.WindowX1 + uAHBP) << 16);
+		pLayer->WVPCR  = (sCfg.WindowY0 + uAVBP + 1) | ((sCfg.WindowY1 + uAVBP) << 16);
+		pLayer->CFBLR  = ((sCfg.ImageWidth * uBytes) << 16) | ((sWindow.uWidth * uBytes) + 3);
+		pLayer->CFBLNR = sCfg.ImageHeight;
+		pLayer->CFBAR  = uAddr;
+		pLayer->CR    |= LTDC_LxCR_LEN;
+	}
+	m_sLTDCHandle.Instance->SRCR = LTDC_SRCR_IMR;
+}
+
+
+//QAD_LTDC::imp_waitVBlank
+//QAD_LTDC Layer Control Method
+//
+//To be called from static method waitVBlank()
+//Used to wait until the line interrupt for the next vertical blanking period has been handled
+void QAD_LTDC::imp_waitVBlank(void) {
+	if (!m_eInitState)
+		return;
+
+	uint32_t uVBlanks = m_uVBlanks;
+	while (m_uVBlanks == uVBlanks) {}
+}
+
+
+  //---------------------
+  //---------------------
+  //QAD_LTDC CLUT Methods
+
+//QAD_LTDC::imp_initCLUT
+//QAD_LTDC CLUT Method
+//
+//Used during initialization to set a layer's CLUT to the default ramp of grays
+//If the layer uses the L8 pixel format the CLUT is also loaded into the LTDC and enabled. As this happens before the layers are
+//enabled, the CLUT can be loaded without waiting for the vertical blanking period
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+void QAD_LTDC::imp_initCLUT(QAD_LTDC_LayerIdx eLayer) {
+	for (uint16_t i=0; i<QAD_LTDC_CLUTSIZE; i++)
+		m_uCLUT[eLayer][i] = i * 0x00010101;
+
+	if (hasCLUT(eLayer)) {
+		HAL_LTDC_ConfigCLUT(&m_sLTDCHandle, m_uCLUT[eLayer], QAD_LTDC_CLUTSIZE, eLayer);
+		HAL_LTDC_EnableCLUT(&m_sLTDCHandle, eLayer);
+	}
+}
+
+
+//QAD_LTDC::imp_writeCLUT
+//QAD_LTDC CLUT Method
+//
+//Used to load a range of entries from the copy of a layer's CLUT into the LTDC
+//The LTDC only allows the CLUT of an enabled layer to be written during the vertical blanking period, so each write waits until
+//vertical data enable is inactive. This means palette changes are best made once per frame, as otherwise this may wait for up to
+//a full frame
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+//uFirst - Index of the first entry to be loaded
+//uCount - The number of entries to be loaded
+void QAD_LTDC::imp_writeCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount) {
+	LTDC_Layer_TypeDef* pLayer = LTDC_LAYER(&m_sLTDCHandle, eLayer);
+
+	for (uint16_t i=uFirst; i<(uFirst + uCount); i++) {
+		while (m_sLTDCHandle.Instance->CDSR & LTDC_CDSR_VDES) {}
+		pLayer->CLUTWR = ((uint32_t)i << LTDC_LxCLUTWR_CLUTADD_Pos) | m_uCLUT[eLayer][i];
+	}
+}
+
+
+  //-------------------------------------------------
+  //-------------------------------------------------
+  //OTM8009A Display Controller Communication Methods
+
+//DSI_IO_WriteCmd
+//OTM8009A Display Controller Communication Methods
+//Used by the OTM8009A initialization method in the otm8009a.h file
+//Calls the static dsi_IO_WriteCmd method in the QAD_LTDC driver class
+void DSI_IO_WriteCmd(uint32_t NbrParam, uint8_t* pParams) {
+  QAD_LTDC::dsi_IO_WriteCmd(NbrParam, pParams);
+}
+
+
+#endif /* !QA_HOST */
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
   //------------------------------
   //------------------------------
   //QAD_LTDC Layer Control Methods
+  //
+  //The following methods are shared by both the board and desktop host versions of the driver, with the board and host specific
+  //IRQ handler methods and imp_waitVBlank() being found in QAD_LTDC.cpp and QAD_LTDC_Host.cpp respectively
 
-//QAD_LTDC::imp_flipLayer0Buffers
+//QAD_LTDC::imp_initLayers
 //QAD_LTDC Layer Control Method
-void QAD_LTDC::imp_flipLayer0Buffers(void) {
-  if (!m_eInitState)
-  	return;
-
-  switch (m_eLayer0Front) {
-    case (QAD_LTDC_Buffer0): {
-    	m_eLayer0Back  = QAD_LTDC_Buffer0;
-    	m_eLayer0Front = QAD_LTDC_Buffer1;
-    	uint32_t uAddr = ((uint32_t)m_pLayer0Ptr + QAD_LTDC_BUFFERSIZE);
-    	HAL_LTDC_SetAddress(&m_sLTDCHandle, uAddr, 0);
-    	break;
-    }
-    case (QAD_LTDC_Buffer1): {
-    	m_eLayer0Back  = QAD_LTDC_Buffer1;
-    	m_eLayer0Front = QAD_LTDC_Buffer0;
-    	uint32_t uAddr = ((uint32_t)m_pLayer0Ptr);
-    	HAL_LTDC_SetAddress(&m_sLTDCHandle, uAddr, 0);
-    	break;
-    }
-  }
+//
+//Used during initialization to set the initial buffer state of each layer, with buffer 0 being displayed and buffer 1 being the
+//back buffer, to clear the flip counters, and to set each buffer's window to the entire LCD panel as configured by imp_init()
+void QAD_LTDC::imp_initLayers(void) {
+	for (uint8_t i=0; i<2; i++) {
+		m_sLayers[i].eBack    = QAD_LTDC_Buffer1;
+		m_sLayers[i].eFront   = QAD_LTDC_Buffer0;
+		m_sLayers[i].ePending = QAD_LTDC_BufferNone;
+		m_sLayers[i].sStats   = {0, 0, 0, 0, 0, 0, 0};
+		m_sLayers[i].sWindow  = {0, 0, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT, QAD_LTDC_WIDTH};
+		m_sLayers[i].sPending = m_sLayers[i].sWindow;
+		m_sLayers[i].sFront   = m_sLayers[i].sWindow;
+	}
+	m_uVBlanks = 0;
 }
 
 
-//QAD_LTDC::imp_flipLayer1Buffers
+//QAD_LTDC::imp_allocBuffers
 //QAD_LTDC Layer Control Method
-void QAD_LTDC::imp_flipLayer1Buffers(void) {
-  if (!m_eInitState)
-  	return;
-
-  switch (m_eLayer1Front) {
-    case (QAD_LTDC_Buffer0): {
-    	m_eLayer1Back  = QAD_LTDC_Buffer0;
-    	m_eLayer1Front = QAD_LTDC_Buffer1;
-    	uint32_t uAddr = ((uint32_t)m_pLayer1Ptr + QAD_LTDC_BUFFERSIZE);
-    	HAL_LTDC_SetAddress(&m_sLTDCHandle, uAddr, 1);
-    	break;
-    }
-    case (QAD_LTDC_Buffer1): {
-    	m_eLayer1Back  = QAD_LTDC_Buffer1;
-    	m_eLayer1Front = QAD_LTDC_Buffer0;
-    	uint32_t uAddr = ((uint32_t)m_pLayer1Ptr);
-    	HAL_LTDC_SetAddress(&m_sLTDCHandle, uAddr, 1);
-    	break;
-    }
-  }
+//
+//Used during initialization to allocate the frame buffers of each layer as a named region of SDRAM (see QAD_FMC.hpp), with the
+//buffers of a layer being placed one after another. Each region starts on an SDRAM row, so that the LTDC's bursts never cross a row
+//boundary. Frame buffers allocated by a previous initialization are reused
+//Returns QA_OK if the frame buffers of both layers are allocated, or QA_Fail if there is not enough SDRAM remaining
+QA_Result QAD_LTDC::imp_allocBuffers(void) {
+	m_pLayer0Ptr = QAD_FMC::find("LTDC Layer 0");
+	if (m_pLayer0Ptr == NULL)
+		m_pLayer0Ptr = QAD_FMC::alloc("LTDC Layer 0", QAD_LTDC_LAYER0_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT, QAD_FMC_ALIGN_ROW);
+
+	m_pLayer1Ptr = QAD_FMC::find("LTDC Layer 1");
+	if (m_pLayer1Ptr == NULL)
+		m_pLayer1Ptr = QAD_FMC::alloc("LTDC Layer 1", QAD_LTDC_LAYER1_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT, QAD_FMC_ALIGN_ROW);
+
+	return ((m_pLayer0Ptr == NULL) || (m_pLayer1Ptr == NULL)) ? QA_Fail : QA_OK;
+}
+
+
+//QAD_LTDC::imp_flip
+//QAD_LTDC Layer Control Method
+//
+//To be called from static methods flipLayer0Buffers() and flipLayer1Buffers()
+//Used to queue the back buffer of a layer to be presented at the next vertical blanking period, and to select the next back buffer
+//With double buffering the next back buffer is the current front buffer, which only becomes free once the queued buffer has been
+//presented (see imp_getBackBuffer()). With triple buffering the next back buffer is the buffer that is neither displayed nor queued,
+//or if a buffer is still queued from the previous flip then that frame is dropped, and its buffer becomes the next back buffer
+//The back buffer's window is queued along with it, to be applied when the buffer is presented
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+void QAD_LTDC::imp_flip(QAD_LTDC_LayerIdx eLayer) {
+	if (!m_eInitState)
+		return;
+
+	QAD_LTDC_LayerState& sLayer = m_sLayers[eLayer];
+
+	//With double buffering the previous flip must be presented before the back buffer can be queued, as otherwise the only other
+	//buffer is the one being displayed
+	if ((QAD_LTDC_BUFFERCOUNT < 3) && (sLayer.ePending != QAD_LTDC_BufferNone))
+		imp_waitPresented(eLayer);
+
+	imp_lockIRQ();
+	if (sLayer.ePending != QAD_LTDC_BufferNone) {
+		QAD_LTDC_BufferIdx eDropped = sLayer.ePending;
+		sLayer.ePending = sLayer.eBack;
+		sLayer.eBack    = eDropped;
+		sLayer.sStats.uDropped++;
+	} else {
+		sLayer.ePending = sLayer.eBack;
+		if (QAD_LTDC_BUFFERCOUNT < 3)
+			sLayer.eBack = sLayer.eFront; else
+			sLayer.eBack = (QAD_LTDC_BufferIdx)(QAD_LTDC_Buffer0 + QAD_LTDC_Buffer1 + QAD_LTDC_Buffer2 - sLayer.eFront - sLayer.ePending);
+	}
+	sLayer.sPending   = sLayer.sWindow;
+	sLayer.uFlipFrame = m_uVBlanks;
+	sLayer.uFlipLine  = imp_getLine();
+	sLayer.sStats.uFlips++;
+	imp_unlockIRQ();
+}
+
+
+//QAD_LTDC::imp_waitPresented
+//QAD_LTDC Layer Control Method
+//
+//Used to wait until the queued buffer of a layer has been presented, counting the wait as a stall
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+void QAD_LTDC::imp_waitPresented(QAD_LTDC_LayerIdx eLayer) {
+	m_sLayers[eLayer].sStats.uStalls++;
+	while (m_sLayers[eLayer].ePending != QAD_LTDC_BufferNone)
+		imp_waitVBlank();
+}
+
+
+//QAD_LTDC::imp_vblank
+//QAD_LTDC Layer Control Method
+//
+//Called by the LTDC line interrupt at the start of each vertical blanking period, or by the static vblank() method on a desktop host
+//Used to present the queued buffer of each layer along with its window, update the flip counters and call the present handlers
+void QAD_LTDC::imp_vblank(void) {
+	m_uVBlanks++;
+
+	QAD_LTDC_BufferIdx eBuffers[2] = {m_sLayers[QAD_LTDC_Layer0].ePending, m_sLayers[QAD_LTDC_Layer1].ePending};
+	if ((eBuffers[QAD_LTDC_Layer0] == QAD_LTDC_BufferNone) && (eBuffers[QAD_LTDC_Layer1] == QAD_LTDC_BufferNone))
+		return;
+	imp_present(eBuffers);
+
+	for (uint8_t i=0; i<2; i++) {
+		if (eBuffers[i] == QAD_LTDC_BufferNone)
+			continue;
+
+		QAD_LTDC_LayerState& sLayer = m_sLayers[i];
+		sLayer.eFront   = eBuffers[i];
+		sLayer.ePending = QAD_LTDC_BufferNone;
+		sLayer.sFront   = sLayer.sPending;
+
+		//Latency is the number of lines from the flip to the start of this frame
+		uint32_t uLatency = ((m_uVBlanks - sLayer.uFlipFrame) * QAD_LTDC_FRAMELINES) - sLayer.uFlipLine;
+		sLayer.sStats.uPresented++;
+		sLayer.sStats.uLatencyLast   = uLatency;
+		sLayer.sStats.uLatencyTotal += uLatency;
+		if (uLatency > sLayer.sStats.uLatencyMax)
+			sLayer.sStats.uLatencyMax = uLatency;
+
+		//Call present handlers
+		QAD_LTDC_LayerIdx eLayer = (QAD_LTDC_LayerIdx)i;
+		if (m_pPresentFunction)
+			m_pPresentFunction(&eLayer);
+		if (m_pPresentClass)
+			m_pPresentClass->handler(&eLayer);
+	}
+}
+
+
+//QAD_LTDC::imp_getTime
+//QAD_LTDC Layer Control Method
+//
+//To be called from static method getTime()
+//The vertical blanking count is read either side of the current line, so that a count and line from different frames are not combined
+//Returns the number of lines displayed since initialization
+uint32_t QAD_LTDC::imp_getTime(void) {
+	uint32_t uVBlanks;
+	uint32_t uLine;
+	do {
+		uVBlanks = m_uVBlanks;
+		uLine    = imp_getLine();
+	} while (uVBlanks != m_uVBlanks);
+	return (uVBlanks * QAD_LTDC_FRAMELINES) + uLine;
 }
 
 
@@ -443,95 +742,183 @@ void QAD_LTDC::imp_flipLayer1Buffers(void) {
   //---------------------------
   //QAD_LTDC Layer Data Methods
 
-//QAD_LTDC::imp_getLayer0BackBufferPtr
+//QAD_LTDC::imp_getBuffer
 //QAD_LTDC Layer Data Method
-void* QAD_LTDC::imp_getLayer0BackBufferPtr(void) {
-	if (!m_eInitState)
-		return NULL;
-
-	switch (m_eLayer0Back) {
-	  case (QAD_LTDC_Buffer0):
-	  	return m_pLayer0Ptr;
-	  	break;
-	  case (QAD_LTDC_Buffer1):
-	  	return (void*)((uint32_t)m_pLayer0Ptr + QAD_LTDC_BUFFERSIZE);
-	  	break;
-	}
-
-	return NULL;
+//
+//Returns a pointer to one of the buffers of a layer
+//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+//eBuffer - The buffer. Member of QAD_LTDC_BufferIdx enum
+void* QAD_LTDC::imp_getBuffer(QAD_LTDC_LayerIdx eLayer, QAD_LTDC_BufferIdx eBuffer) {
+	if (eLayer == QAD_LTDC_Layer0)
+		return (uint8_t*)m_pLayer0Ptr + (eBuffer * QAD_LTDC_LAYER0_BUFFERSIZE);
+	return (uint8_t*)m_pLayer1Ptr + (eBuffer * QAD_LTDC_LAYER1_BUFFERSIZE);
 }
 
 
-//QAD_LTDC::imp_getLayer0BackBuffer
+//QAD_LTDC::imp_getBackBuffer
 //QAD_LTDC Layer Data Method
-QAD_LTDC_Buffer* QAD_LTDC::imp_getLayer0BackBuffer(void) {
+//
+//To be called from static methods getLayer0BackBufferPtr(), getLayer0BackBuffer(), getLayer1BackBufferPtr() and getLayer1BackBuffer()
+//With double buffering the back buffer is the buffer being displayed until a queued flip is presented, so this waits for the flip
+//to be presented before returning the buffer, preventing rendering into a buffer that the LTDC is still reading
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+//Returns a pointer to the back buffer, or NULL if the driver is not initialized
+void* QAD_LTDC::imp_getBackBuffer(QAD_LTDC_LayerIdx eLayer) {
 	if (!m_eInitState)
 		return NULL;
 
-	switch (m_eLayer0Back) {
-	  case (QAD_LTDC_Buffer0):
-	  	return (QAD_LTDC_Buffer*)m_pLayer0Ptr;
-	  	break;
-	  case (QAD_LTDC_Buffer1):
-	  	return (QAD_LTDC_Buffer*)((uint32_t)m_pLayer0Ptr + QAD_LTDC_BUFFERSIZE);
-	  	break;
+	if ((QAD_LTDC_BUFFERCOUNT < 3) && (m_sLayers[eLayer].ePending != QAD_LTDC_BufferNone))
+		imp_waitPresented(eLayer);
+	return imp_getBuffer(eLayer, m_sLayers[eLayer].eBack);
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAD_LTDC Layer Window Methods
+
+//QAD_LTDC::imp_setLayerWindow
+//QAD_LTDC Layer Window Method
+//
+//To be called from static methods setLayerWindow() and resetLayerWindow()
+//The window is stored as the back buffer's window, and is queued by imp_flip() to be applied when the back buffer is presented
+//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+//sWindow - The window. See QAD_LTDC_Window
+//Returns QA_OK if successful, or QA_Fail if the window lies outside of the LCD panel or its pixels would not fit within the buffer
+QA_Result QAD_LTDC::imp_setLayerWindow(QAD_LTDC_LayerIdx eLayer, const QAD_LTDC_Window& sWindow) {
+	if (((sWindow.uX + sWindow.uWidth) > QAD_LTDC_WIDTH) || ((sWindow.uY + sWindow.uHeight) > QAD_LTDC_HEIGHT))
+		return QA_Fail;
+
+	//Check that the lines of a non-empty window neither overlap nor run past the end of the buffer
+	if (sWindow.uWidth && sWindow.uHeight) {
+		if ((sWindow.uPitch < sWindow.uWidth) || (sWindow.uPitch > QAD_LTDC_WIDTH))
+			return QA_Fail;
+		if ((sWindow.uPitch != QAD_LTDC_WIDTH) && ((((uint32_t)sWindow.uHeight - 1) * sWindow.uPitch) + sWindow.uWidth) > QAD_LTDC_PIXELCOUNT)
+			return QA_Fail;
 	}
 
-	return NULL;
+	m_sLayers[eLayer].sWindow = sWindow;
+	return QA_OK;
 }
 
 
-//QAD_LTDC::imp_getLayer1BackBufferPtr
-//QAD_LTDC Layer Data Method
-void* QAD_LTDC::imp_getLayer1BackBufferPtr(void) {
-	if (!m_eInitState)
-		return NULL;
+//QAD_LTDC::imp_getWindowStart
+//QAD_LTDC Layer Window Method
+//
+//Returns a pointer to the pixel of a layer's buffer that is displayed at the upper-left corner of a window, being the pixel at the
+//window's position on the LCD panel when the pitch is QAD_LTDC_WIDTH, or otherwise the first pixel of the buffer (see QAD_LTDC_Window)
+//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+//eBuffer - The buffer. Member of QAD_LTDC_BufferIdx enum
+//sWindow - The window
+void* QAD_LTDC::imp_getWindowStart(QAD_LTDC_LayerIdx eLayer, QAD_LTDC_BufferIdx eBuffer, const QAD_LTDC_Window& sWindow) {
+	uint8_t* pBuffer = (uint8_t*)imp_getBuffer(eLayer, eBuffer);
+	if (sWindow.uPitch != QAD_LTDC_WIDTH)
+		return pBuffer;
+	return pBuffer + ((((uint32_t)sWindow.uY * QAD_LTDC_WIDTH) + sWindow.uX) * imp_getBytes(eLayer));
+}
 
-	switch (m_eLayer1Back) {
-	  case (QAD_LTDC_Buffer0):
-	  	return m_pLayer1Ptr;
-	  	break;
-	  case (QAD_LTDC_Buffer1):
-	  	return (void*)((uint32_t)m_pLayer1Ptr + QAD_LTDC_BUFFERSIZE);
-	  	break;
-	}
 
-	return NULL;
+  //---------------------------
+  //---------------------------
+  //QAD_LTDC Flip Stats Methods
+
+//QAD_LTDC::imp_getFlipStats
+//QAD_LTDC Flip Stats Method
+//
+//To be called from static method getFlipStats()
+//The counters are copied with the LTDC interrupt locked, so that they are consistent with each other
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+QAD_LTDC_FlipStats QAD_LTDC::imp_getFlipStats(QAD_LTDC_LayerIdx eLayer) {
+	imp_lockIRQ();
+	QAD_LTDC_FlipStats sStats = m_sLayers[eLayer].sStats;
+	imp_unlockIRQ();
+	return sStats;
 }
 
 
-//QAD_LTDC::imp_getLayer1BackBuffer
-//QAD_LTDC Layer Data Method
-QAD_LTDC_Buffer* QAD_LTDC::imp_getLayer1BackBuffer(void) {
-	if (!m_eInitState)
-		return NULL;
+//QAD_LTDC::imp_resetFlipStats
+//QAD_LTDC Flip Stats Method
+//
+//To be called from static method resetFlipStats()
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+void QAD_LTDC::imp_resetFlipStats(QAD_LTDC_LayerIdx eLayer) {
+	imp_lockIRQ();
+	m_sLayers[eLayer].sStats = {0, 0, 0, 0, 0, 0, 0};
+	imp_unlockIRQ();
+}
 
-	switch (m_eLayer1Back) {
-	  case (QAD_LTDC_Buffer0):
-	  	return (QAD_LTDC_Buffer*)m_pLayer1Ptr;
-	  	break;
-	  case (QAD_LTDC_Buffer1):
-	  	return (QAD_LTDC_Buffer*)((uint32_t)m_pLayer1Ptr + QAD_LTDC_BUFFERSIZE);
-	  	break;
-	}
 
-	return NULL;
+  //---------------------
+  //---------------------
+  //QAD_LTDC CLUT Methods
+  //
+  //The following methods are shared by both the board and desktop host versions of the driver, with the board and host specific
+  //imp_initCLUT() and imp_writeCLUT() methods being found in QAD_LTDC.cpp and QAD_LTDC_Host.cpp respectively
+
+//QAD_LTDC::imp_setCLUT
+//QAD_LTDC CLUT Method
+//
+//To be called from static methods setCLUT() and setCLUTEntry()
+//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+//uFirst  - Index of the first entry to be set
+//uCount  - The number of entries to be set
+//pColors - Pointer to an array of uCount 0x00RRGGBB colors
+//Returns QA_OK if successful, or QA_Fail if the layer does not have a CLUT or the range of entries is invalid
+QA_Result QAD_LTDC::imp_setCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, const uint32_t* pColors) {
+	if (!m_eInitState || !hasCLUT(eLayer) || !uCount || ((uFirst + uCount) > QAD_LTDC_CLUTSIZE))
+		return QA_Fail;
+
+	for (uint16_t i=0; i<uCount; i++)
+		m_uCLUT[eLayer][uFirst + i] = pColors[i] & 0x00FFFFFF;
+	imp_writeCLUT(eLayer, uFirst, uCount);
+	return QA_OK;
 }
 
 
-  //-------------------------------------------------
-  //-------------------------------------------------
-  //OTM8009A Display Controller Communication Methods
+//QAD_LTDC::imp_rotateCLUT
+//QAD_LTDC CLUT Method
+//
+//To be called from static method rotateCLUT()
+//The range is rotated in place by reversing the whole range and then each of its two parts, so no temporary copy is required
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+//uFirst - Index of the first entry of the range
+//uCount - The number of entries in the range
+//iStep  - The number of places each entry is to be moved towards higher indexes, or towards lower indexes if negative
+//Returns QA_OK if successful, or QA_Fail if the layer does not have a CLUT or the range of entries is invalid
+QA_Result QAD_LTDC::imp_rotateCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, int16_t iStep) {
+	if (!m_eInitState || !hasCLUT(eLayer) || !uCount || ((uFirst + uCount) > QAD_LTDC_CLUTSIZE))
+		return QA_Fail;
 
-//DSI_IO_WriteCmd
-//OTM8009A Display Controller Communication Methods
-//Used by the OTM8009A initialization method in the otm8009a.h file
-//Calls the static dsi_IO_WriteCmd method in the QAD_LTDC driver class
-void DSI_IO_WriteCmd(uint32_t NbrParam, uint8_t* pParams) {
-  QAD_LTDC::dsi_IO_WriteCmd(NbrParam, pParams);
+	int16_t iShift = iStep % (int16_t)uCount;
+	if (iShift < 0)
+		iShift += uCount;
+	if (!iShift)
+		return QA_OK;
+
+	imp_reverseCLUT(eLayer, uFirst, uCount);
+	imp_reverseCLUT(eLayer, uFirst, iShift);
+	imp_reverseCLUT(eLayer, uFirst + iShift, uCount - iShift);
+	imp_writeCLUT(eLayer, uFirst, uCount);
+	return QA_OK;
 }
 
 
+//QAD_LTDC::imp_reverseCLUT
+//QAD_LTDC CLUT Method
+//
+//Used by imp_rotateCLUT() to reverse the order of a range of entries in the copy of a layer's CLUT
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+//uFirst - Index of the first entry of the range
+//uCount - The number of entries in the range
+void QAD_LTDC::imp_reverseCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount) {
+	uint32_t* pLo = &m_uCLUT[eLayer][uFirst];
+	uint32_t* pHi = pLo + uCount - 1;
+	while (pLo < pHi) {
+		uint32_t uTemp = *pLo;
+		*pLo++ = *pHi;
+		*pHi-- = uTemp;
+	}
+}
 
 
 
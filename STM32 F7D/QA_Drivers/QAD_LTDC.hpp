@@ -23,9 +23,12 @@
 //Includes
 #include "setup.hpp"
 
+#if !defined(QA_HOST)
 #include "otm8009a.h"
+#endif
 
 #include "QAT_Pixel.hpp"
+#include "QAT_PixelFormat.hpp"
 
 
   //NOTE:
@@ -40,6 +43,18 @@
   //For example, a background image or user interface elements that dont change often can be rendered to layer 0 at a slower update/frame rate,
   //while foreground elements that need to be updated more often can be rendered to layer1 at a faster update/frame rate,
   //providing potential performance benefits.
+  //
+  //Flipping a layer does not change the buffer being displayed straight away. Instead the back-buffer is queued, and is presented
+  //during the next vertical blanking period by the LTDC line interrupt, so that the LCD never shows part of one frame and part of
+  //another. With double buffering the previous front-buffer only becomes free to render to once the queued buffer is presented,
+  //so the renderer waits for vertical blanking when it next requests the back-buffer. With triple buffering (see
+  //QAD_LTDC_BUFFERCOUNT) a third buffer is always free, so the renderer never waits, and a queued frame that has not been presented
+  //by the time the next frame is flipped is replaced by it and counted as dropped.
+  //
+  //Each layer is displayed through a window, which by default covers the entire LCD panel. Shrinking a layer's window to the area
+  //that holds its content means the LTDC only fetches that area from SDRAM each refresh, with the rest of the layer being transparent
+  //(see QAD_LTDC_Window and Layer Window Methods below). As the window belongs to the frame being rendered, a window that is set
+  //is only applied when the back buffer is flipped and presented, so the displayed frame is never shown through another frame's window.
 
 
 	//------------------------------------------
@@ -52,7 +67,42 @@
 #define QAD_LTDC_HEIGHT      480                                                //Height in pixels of LCD panel
 #define QAD_LTDC_PIXELCOUNT  (QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT)                 //Total number of pixels in LCD panel
 
-#define QAD_LTDC_BUFFERSIZE  (QAD_LTDC_PIXELCOUNT * sizeof(QAT_Pixel_ARGB4444)) //Size of a single display buffer at 16bits per pixel
+
+//-----------------------------
+//QAD_LTDC Layer Pixel Formats
+//
+//Used to select the pixel format of each layer at compile time, from the formats defined in QAT_PixelFormat.hpp
+//QAS_LCD is able to render to either of the 16bit formats (QAT_PixelFormat_ARGB4444 or QAT_PixelFormat_RGB565), to
+//QAT_PixelFormat_ARGB8888, or to QAT_PixelFormat_L8, with the required conversion and blending kernels being selected at compile time for each layer (see QAS_LCD_Raster.hpp)
+//By default both layers use ARGB4444, so that each pixel keeps its own alpha value. A layer holding an opaque background can instead
+//use RGB565, which gives finer color gradients than ARGB4444 at the same memory bandwidth, but loses the alpha of its pixels
+//An L8 layer halves the memory bandwidth of a 16bit layer, with each pixel being an index into the layer's color look-up table
+//(see CLUT Methods below). As the CLUT has no alpha, pixels of an L8 layer are always opaque
+//An ARGB8888 layer doubles the memory bandwidth of a 16bit layer, but keeps the full precision of blended and anti-aliased pixels
+typedef QAT_PixelFormat_ARGB4444 QAD_LTDC_Layer0Format;
+typedef QAT_PixelFormat_ARGB4444 QAD_LTDC_Layer1Format;
+
+#define QAD_LTDC_LAYER0_BUFFERSIZE  (QAD_LTDC_PIXELCOUNT * QAD_LTDC_Layer0Format::Bytes)  //Size of a single display buffer for layer 0
+#define QAD_LTDC_LAYER1_BUFFERSIZE  (QAD_LTDC_PIXELCOUNT * QAD_LTDC_Layer1Format::Bytes)  //Size of a single display buffer for layer 1
+
+#define QAD_LTDC_CLUTSIZE           256                                                  //Number of entries in the color look-up table of a layer
+
+
+//--------------------
+//QAD_LTDC_BUFFERCOUNT
+//
+//Used to select the number of frame buffers of each layer at compile time. 2 selects double buffering, and 3 selects triple buffering
+//Triple buffering uses a further buffer of each layer's size in SDRAM, with the surface pool and font store following the frame
+//buffers being moved up to make room (see QAS_LCD_Surface.hpp)
+#define QAD_LTDC_BUFFERCOUNT        2
+
+
+//-------------------
+//QAD_LTDC_FRAMELINES
+//
+//Number of lines in each frame, including the vertical sync, back porch and front porch periods set in QAD_LTDC::imp_init()
+//Flip latencies are measured in lines (see QAD_LTDC_FlipStats), so dividing by this gives the latency in frames
+#define QAD_LTDC_FRAMELINES         (QAD_LTDC_HEIGHT + 36)
 
 
 	//------------------------------------------
@@ -75,10 +125,12 @@ enum QAD_LTDC_LayerIdx : uint8_t {
 //---------------
 //QAD_LTDC_BufferIdx
 //
-//As both Layer 0 and Layer 1 are double-buffered, this enum is used to select which buffer is being accessed
+//As both Layer 0 and Layer 1 are double or triple-buffered, this enum is used to select which buffer is being accessed
 enum QAD_LTDC_BufferIdx : uint8_t {
-	QAD_LTDC_Buffer0 = 0,  //Buffer 0
-	QAD_LTDC_Buffer1       //Buffer 1
+	QAD_LTDC_Buffer0 = 0,         //Buffer 0
+	QAD_LTDC_Buffer1,             //Buffer 1
+	QAD_LTDC_Buffer2,             //Buffer 2. Only used when triple buffering is selected by QAD_LTDC_BUFFERCOUNT
+	QAD_LTDC_BufferNone = 0xFF    //Used to indicate that no buffer is queued to be presented
 };
 
 
@@ -100,6 +152,59 @@ typedef struct {
 } QAD_LTDC_DoubleBuffer;
 
 
+//------------------
+//QAD_LTDC_FlipStats
+//
+//Structure used to report the flip counters of a single layer
+//Latencies are measured in lines from the time a layer is flipped until its buffer is presented. See QAD_LTDC_FRAMELINES
+typedef struct {
+	uint32_t uFlips;         //Number of times the layer has been flipped
+	uint32_t uPresented;     //Number of flipped frames that have been presented
+	uint32_t uDropped;       //Number of flipped frames that were replaced by a newer frame before being presented (triple buffering)
+	uint32_t uStalls;        //Number of times the renderer had to wait for vertical blanking before a buffer was free (double buffering)
+	uint32_t uLatencyLast;   //Latency of the most recently presented frame
+	uint32_t uLatencyMax;    //Largest latency of a presented frame
+	uint32_t uLatencyTotal;  //Sum of the latencies of all presented frames. Dividing by uPresented gives the average latency
+} QAD_LTDC_FlipStats;
+
+
+//---------------
+//QAD_LTDC_Window
+//
+//Structure used to describe the window through which a layer's buffer is displayed, and how the buffer's pixels are laid out
+//The window covers pixels uX to uX+uWidth-1 and uY to uY+uHeight-1 of the LCD panel. A window with no width or height disables the
+//layer, so that no pixels are fetched for it at all
+//uPitch is the number of pixels from the start of one line of the buffer to the start of the next. A pitch of QAD_LTDC_WIDTH lays the
+//buffer out as the full LCD panel, with the window showing the pixels of the buffer at its own position on the panel, so content
+//can be rendered in screen coordinates (as used by QAS_LCD). Any other pitch, being at least uWidth, packs the lines of the window
+//together from the start of the buffer instead, so that the window's content occupies uPitch * uHeight pixels
+typedef struct {
+	uint16_t uX;       //Left edge of the window on the LCD panel
+	uint16_t uY;       //Top edge of the window on the LCD panel
+	uint16_t uWidth;   //Width of the window in pixels
+	uint16_t uHeight;  //Height of the window in pixels
+	uint16_t uPitch;   //Number of pixels per line of the buffer
+} QAD_LTDC_Window;
+
+
+//-------------------
+//QAD_LTDC_LayerState
+//
+//Structure used by QAD_LTDC to hold the buffer state of a single layer
+//ePending and eFront are changed by the LTDC line interrupt when a queued buffer is presented
+typedef struct {
+	QAD_LTDC_BufferIdx          eBack;       //Index of the back buffer (buffer to be rendered to)
+	volatile QAD_LTDC_BufferIdx eFront;      //Index of the front buffer (buffer currently being displayed)
+	volatile QAD_LTDC_BufferIdx ePending;    //Index of the buffer queued to be presented at the next vertical blanking period, or QAD_LTDC_BufferNone
+	uint32_t                    uFlipFrame;  //Vertical blanking count when the queued buffer was flipped
+	uint32_t                    uFlipLine;   //Line being displayed when the queued buffer was flipped
+	QAD_LTDC_FlipStats          sStats;      //Flip counters of the layer
+	QAD_LTDC_Window             sWindow;     //Window of the back buffer, which is applied when the back buffer is flipped and presented
+	QAD_LTDC_Window             sPending;    //Window of the queued buffer
+	QAD_LTDC_Window             sFront;      //Window of the front buffer
+} QAD_LTDC_LayerState;
+
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -122,17 +227,22 @@ private:
 	const uint32_t m_uLCDLaneByteClk  = 62500; //LCD Lane byte clock rate in kHz
 	const uint32_t m_uLCDClkDivisor   = 15625; //LCD clock divisor
 
+#if !defined(QA_HOST)
 	DSI_HandleTypeDef  m_sDSIHandle;           //Handle used by HAL functions to access the DSI peripheral
 	DSI_VidCfgTypeDef  m_sDSICfgHandle;        //Handle used by HAL functions to configure settings for DSI peripheral
 	LTDC_HandleTypeDef m_sLTDCHandle;          //Handle used by HAL functions to access the LTDC peripheral
+#endif
 
-	void*              m_pLayer0Ptr;           //Pointer to double buffer for LTDC layer 0
-	void*              m_pLayer1Ptr;           //Pointer to double buffer for LTDC layer 1
+	void*              m_pLayer0Ptr;           //Pointer to double buffer for LTDC layer 0, allocated from SDRAM as region "LTDC Layer 0"
+	void*              m_pLayer1Ptr;           //Pointer to double buffer for LTDC layer 1, allocated from SDRAM as region "LTDC Layer 1"
 
-  QAD_LTDC_BufferIdx m_eLayer0Back;          //Index of current Layer 0 back buffer (buffer to be rendered to)
-  QAD_LTDC_BufferIdx m_eLayer0Front;         //Index to current Layer 0 front buffer (buffer currently being displayed)
-  QAD_LTDC_BufferIdx m_eLayer1Back;          //Index of current Layer 1 back buffer (buffer to be rendered to)
-  QAD_LTDC_BufferIdx m_eLayer1Front;         //Index of current Layer 1 front buffer (buffer currently being displayed)
+	QAD_LTDC_LayerState m_sLayers[2];           //Buffer state of each layer, indexed by QAD_LTDC_LayerIdx
+	volatile uint32_t   m_uVBlanks;             //Number of vertical blanking periods since initialization
+
+	QAD_IRQHandler_CallbackFunction m_pPresentFunction;  //Pointer to the callback function to be called when a layer's frame is presented
+	QAD_IRQHandler_CallbackClass*   m_pPresentClass;     //Pointer to the callback class to be called when a layer's frame is presented
+
+	uint32_t            m_uCLUT[2][QAD_LTDC_CLUTSIZE]; //Copy of the color look-up table of each layer, as 24bit 0x00RRGGBB colors
 
 
   //------------
@@ -140,7 +250,10 @@ private:
 
   //As this is a private method in a singleton class, this method will be called the first time the class's get() method is called
 	QAD_LTDC() :
-	  m_eInitState(QA_NotInitialized) {}
+	  m_eInitState(QA_NotInitialized),
+	  m_uVBlanks(0),
+	  m_pPresentFunction(NULL),
+	  m_pPresentClass(NULL) {}
 
 public:
 
@@ -211,41 +324,242 @@ public:
 
 	//Used to flip the front and back buffer for layer 0
 	//To be used at the end of rendering visual elements to layer 0 in order for them to become visible on the LCD display
+	//The back buffer is queued and presented at the next vertical blanking period, so this does not wait for the LCD
 	static void flipLayer0Buffers(void) {
-		get().imp_flipLayer0Buffers();
+		get().imp_flip(QAD_LTDC_Layer0);
 	}
 
 	//Used to flip the front and back buffer for layer 1
 	//To be used at the end of rendering visual elements to layer 1 in order for them to become visible on the LCD display
+	//The back buffer is queued and presented at the next vertical blanking period, so this does not wait for the LCD
 	static void flipLayer1Buffers(void) {
-		get().imp_flipLayer1Buffers();
+		get().imp_flip(QAD_LTDC_Layer1);
+	}
+
+	//Returns true if a layer has been flipped and its buffer has not yet been presented
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static bool isFlipPending(QAD_LTDC_LayerIdx eLayer) {
+		return (get().m_sLayers[eLayer].ePending != QAD_LTDC_BufferNone);
+	}
+
+	//Used to wait until the start of the next vertical blanking period, at which any queued buffers are presented
+	static void waitVBlank(void) {
+		get().imp_waitVBlank();
+	}
+
+	//Returns the number of vertical blanking periods since initialization, which increases once per frame displayed by the LCD
+	static uint32_t getVBlankCount(void) {
+		return get().m_uVBlanks;
+	}
+
+	//Returns the number of lines displayed by the LCD since initialization, which is used as a timebase locked to the display refresh
+	//Dividing by QAD_LTDC_FRAMELINES gives the time in frames. On a desktop host this only advances at each vertical blanking period
+	static uint32_t getTime(void) {
+		return get().imp_getTime();
+	}
+
+
+	//--------------------
+	//Layer Window Methods
+	//
+	//A window that is set applies to the layer's back buffer, taking effect when the back buffer is next flipped and presented, and
+	//remains in effect for the layer's following frames until it is changed again. See QAD_LTDC_Window for details of window layout
+
+	//Used to set the window and buffer pitch of a layer's back buffer
+	//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+	//sWindow - The window. See QAD_LTDC_Window
+	//Returns QA_OK if successful, or QA_Fail if the window lies outside of the LCD panel or its pixels would not fit within the buffer
+	static QA_Result setLayerWindow(QAD_LTDC_LayerIdx eLayer, const QAD_LTDC_Window& sWindow) {
+		return get().imp_setLayerWindow(eLayer, sWindow);
+	}
+
+	//Used to set the window of a layer's back buffer back to the entire LCD panel
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static void resetLayerWindow(QAD_LTDC_LayerIdx eLayer) {
+		get().imp_setLayerWindow(eLayer, {0, 0, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT, QAD_LTDC_WIDTH});
+	}
+
+	//Returns the window of a layer's back buffer, being the window that will be used for the next frame to be flipped
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static QAD_LTDC_Window getLayerWindow(QAD_LTDC_LayerIdx eLayer) {
+		return get().m_sLayers[eLayer].sWindow;
+	}
+
+	//Returns the number of bytes the LTDC fetches from SDRAM for a layer each refresh, based on the window of the displayed frame
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static uint32_t getLayerFetchSize(QAD_LTDC_LayerIdx eLayer) {
+		const QAD_LTDC_Window& sFront = get().m_sLayers[eLayer].sFront;
+		return (uint32_t)sFront.uWidth * sFront.uHeight * imp_getBytes(eLayer);
+	}
+
+
+	//------------------
+	//Flip Stats Methods
+
+	//Returns the flip counters of a layer
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static QAD_LTDC_FlipStats getFlipStats(QAD_LTDC_LayerIdx eLayer) {
+		return get().imp_getFlipStats(eLayer);
+	}
+
+	//Used to reset the flip counters of a layer to zero
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static void resetFlipStats(QAD_LTDC_LayerIdx eLayer) {
+		get().imp_resetFlipStats(eLayer);
+	}
+
+
+	//------------------------
+	//Present Handler Methods
+	//
+	//The handlers are called from the LTDC line interrupt each time a flipped frame of a layer is presented, with pData pointing to
+	//the QAD_LTDC_LayerIdx of the layer. As they are called from an interrupt, handlers should be kept short
+
+	//Used to set the callback function to be called when a frame is presented, or NULL for none
+	//pHandler - Pointer to callback function based on QAD_IRQHandler_CallbackFunction prototype defined in setup.hpp
+	static void setPresentHandlerFunction(QAD_IRQHandler_CallbackFunction pHandler) {
+		get().m_pPresentFunction = pHandler;
+	}
+
+	//Used to set the callback class to be called when a frame is presented, or NULL for none
+	//pHandler - Pointer to callback class based on QAD_IRQHandler_CallbackClass defined in setup.hpp
+	static void setPresentHandlerClass(QAD_IRQHandler_CallbackClass* pHandler) {
+		get().m_pPresentClass = pHandler;
+	}
+
+
+	//------------------
+	//IRQ Handler Methods
+
+	//Used to handle the LTDC interrupt
+	//This method is only to be called by the interrupt request handler function from handlers.cpp
+	static void handler(void) {
+		get().imp_handler();
 	}
 
 
 	//------------------
 	//Layer Data Methods
 
+	//The following methods that return the back buffer wait until the buffer is free to be rendered to. This is only the case with
+	//double buffering, when the previous flip of the layer has not yet been presented
+
 	//Returns a void pointer to the back/offscreen buffer to be rendered to for layer 0
 	static void* getLayer0BackBufferPtr(void) {
-		return get().imp_getLayer0BackBufferPtr();
+		return get().imp_getBackBuffer(QAD_LTDC_Layer0);
 	}
 
 	//Returns a pointer to a QAD_LTDC_Buffer structure for the back/offscreen buffer to be rendered to for layer 0
 	static QAD_LTDC_Buffer* getLayer0BackBuffer(void) {
-		return get().imp_getLayer0BackBuffer();
+		return (QAD_LTDC_Buffer*)get().imp_getBackBuffer(QAD_LTDC_Layer0);
 	}
 
 	//Returns a void pointer to the back/offscreen buffer to be rendered to for layer 1
 	static void* getLayer1BackBufferPtr(void) {
-		return get().imp_getLayer1BackBufferPtr();
+		return get().imp_getBackBuffer(QAD_LTDC_Layer1);
 	}
 
 	//Returns a pointer to a QAD_LTDC_Buffer structure for the back/offscreen buffer to be rendered to for layer 1
 	static QAD_LTDC_Buffer* getLayer1BackBuffer(void) {
-		return get().imp_getLayer1BackBuffer();
+		return (QAD_LTDC_Buffer*)get().imp_getBackBuffer(QAD_LTDC_Layer1);
+	}
+
+	//Returns the index of the back/offscreen buffer to be rendered to for layer 0. Member of QAD_LTDC_BufferIdx enum
+	static QAD_LTDC_BufferIdx getLayer0BackBufferIdx(void) {
+		return get().m_sLayers[QAD_LTDC_Layer0].eBack;
+	}
+
+	//Returns the index of the back/offscreen buffer to be rendered to for layer 1. Member of QAD_LTDC_BufferIdx enum
+	static QAD_LTDC_BufferIdx getLayer1BackBufferIdx(void) {
+		return get().m_sLayers[QAD_LTDC_Layer1].eBack;
 	}
 
 
+	//------------
+	//CLUT Methods
+	//
+	//The following methods are only effective for layers that use the L8 pixel format (see QAD_LTDC_Layer0Format and QAD_LTDC_Layer1Format).
+	//Each pixel of an L8 layer is an index into the layer's 256 entry color look-up table (CLUT), which the LTDC applies as pixels
+	//are displayed. Changing an entry therefore recolors every pixel that uses it from the next frame onwards without any pixels
+	//being written or re-rendered, which allows cheap effects such as fades, highlights and color cycling.
+	//Each layer's CLUT is initialized to a ramp of grays, where each index is its own luminance (see QAT_PixelFormat_L8)
+	//Colors are 24bit values in the form 0x00RRGGBB
+
+	//Returns true if the given layer uses the L8 pixel format, and so has a CLUT
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static constexpr bool hasCLUT(QAD_LTDC_LayerIdx eLayer) {
+		return ((eLayer == QAD_LTDC_Layer0) ? QAD_LTDC_Layer0Format::LTDC : QAD_LTDC_Layer1Format::LTDC) == QAT_PixelFormat_L8::LTDC;
+	}
+
+	//Used to set a range of entries of a layer's CLUT
+	//eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum
+	//uFirst  - Index of the first entry to be set
+	//uCount  - The number of entries to be set
+	//pColors - Pointer to an array of uCount 0x00RRGGBB colors
+	//Returns QA_OK if successful, or QA_Fail if the layer does not have a CLUT or the range of entries is invalid
+	static QA_Result setCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, const uint32_t* pColors) {
+		return get().imp_setCLUT(eLayer, uFirst, uCount, pColors);
+	}
+
+	//Used to set a single entry of a layer's CLUT
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	//uIdx   - Index of the entry
+	//uColor - The 0x00RRGGBB color
+	//Returns QA_OK if successful, or QA_Fail if the layer does not have a CLUT
+	static QA_Result setCLUTEntry(QAD_LTDC_LayerIdx eLayer, uint8_t uIdx, uint32_t uColor) {
+		return get().imp_setCLUT(eLayer, uIdx, 1, &uColor);
+	}
+
+	//Used to rotate a range of entries of a layer's CLUT, for color cycling effects
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	//uFirst - Index of the first entry of the range
+	//uCount - The number of entries in the range
+	//iStep  - The number of places each entry is to be moved. Positive values move entries to higher indexes, with entries
+	//         leaving the end of the range wrapping around to its start, while negative values move entries the other way
+	//Returns QA_OK if successful, or QA_Fail if the layer does not have a CLUT or the range of entries is invalid
+	static QA_Result rotateCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, int16_t iStep) {
+		return get().imp_rotateCLUT(eLayer, uFirst, uCount, iStep);
+	}
+
+	//Returns the 0x00RRGGBB color of a single entry of a layer's CLUT
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	//uIdx   - Index of the entry
+	static uint32_t getCLUTEntry(QAD_LTDC_LayerIdx eLayer, uint8_t uIdx) {
+		return get().m_uCLUT[eLayer][uIdx];
+	}
+
+#if defined(QA_HOST)
+
+	//------------
+	//Host Methods
+	//
+	//The following methods are only available when building for a desktop host (see setup.hpp)
+
+	//Used to write the image currently being displayed to a binary PPM (P6) file
+	//The front-buffers of layer 1 and layer 0 are composited over a black background in the same manner as the LTDC peripheral
+	//strFilename - The name of the file to be written
+	//Returns QA_OK if successful, or QA_Fail if the driver is not initialized or the file could not be written
+	//As the frame is read out as it would be by the LCD, a vertical blanking period takes place first, presenting any queued buffers
+	static QA_Result writeFrame(const char* strFilename) {
+		return get().imp_writeFrame(strFilename);
+	}
+
+	//Used to read the image currently being displayed into a buffer of 8bit RGB pixels, composited in the same manner as writeFrame()
+	//This allows rendered frames to be compared against reference images without being written to a file
+	//pRGB - Pointer to a buffer of at least (QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT * 3) bytes, which is filled line by line
+	//Returns QA_OK if successful, or QA_Fail if the driver is not initialized
+	static QA_Result readFrame(uint8_t* pRGB) {
+		return get().imp_readFrame(pRGB);
+	}
+
+	//Used to simulate a vertical blanking period, presenting any queued buffers
+	static void vblank(void) {
+		get().imp_vblank();
+	}
+
+#endif
+
+
 private:
 
 	//NOTE: Please see QAD_LTDC.cpp for details of the following methods
@@ -274,17 +588,71 @@ private:
 	//---------------------
 	//Layer Control Methods
 
-	void imp_flipLayer0Buffers(void);
-	void imp_flipLayer1Buffers(void);
+	void imp_initLayers(void);
+	QA_Result imp_allocBuffers(void);
+	void imp_flip(QAD_LTDC_LayerIdx eLayer);
+	void imp_waitPresented(QAD_LTDC_LayerIdx eLayer);
+	void imp_waitVBlank(void);
+	void imp_vblank(void);
+	uint32_t imp_getTime(void);
 
 
 	//------------------
 	//Layer Data Methods
 
-	void* imp_getLayer0BackBufferPtr(void);
-	QAD_LTDC_Buffer* imp_getLayer0BackBuffer(void);
-	void* imp_getLayer1BackBufferPtr(void);
-	QAD_LTDC_Buffer* imp_getLayer1BackBuffer(void);
+	void* imp_getBuffer(QAD_LTDC_LayerIdx eLayer, QAD_LTDC_BufferIdx eBuffer);
+	void* imp_getBackBuffer(QAD_LTDC_LayerIdx eLayer);
+
+
+	//--------------------
+	//Layer Window Methods
+
+	QA_Result imp_setLayerWindow(QAD_LTDC_LayerIdx eLayer, const QAD_LTDC_Window& sWindow);
+	void* imp_getWindowStart(QAD_LTDC_LayerIdx eLayer, QAD_LTDC_BufferIdx eBuffer, const QAD_LTDC_Window& sWindow);
+
+	//Returns the number of bytes per pixel of a layer's pixel format
+	//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+	static constexpr uint8_t imp_getBytes(QAD_LTDC_LayerIdx eLayer) {
+		return (eLayer == QAD_LTDC_Layer0) ? QAD_LTDC_Layer0Format::Bytes : QAD_LTDC_Layer1Format::Bytes;
+	}
+
+
+	//------------------
+	//Flip Stats Methods
+
+	QAD_LTDC_FlipStats imp_getFlipStats(QAD_LTDC_LayerIdx eLayer);
+	void imp_resetFlipStats(QAD_LTDC_LayerIdx eLayer);
+
+
+	//-------------------
+	//IRQ Handler Methods
+
+	void imp_handler(void);
+	void imp_lockIRQ(void);
+	void imp_unlockIRQ(void);
+	uint32_t imp_getLine(void);
+	void imp_present(const QAD_LTDC_BufferIdx* pBuffers);
+
+
+	//------------
+	//CLUT Methods
+
+	void imp_initCLUT(QAD_LTDC_LayerIdx eLayer);
+	QA_Result imp_setCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, const uint32_t* pColors);
+	QA_Result imp_rotateCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, int16_t iStep);
+	void imp_reverseCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount);
+	void imp_writeCLUT(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount);
+
+#if defined(QA_HOST)
+
+	//------------
+	//Host Methods
+
+	QA_Result imp_writeFrame(const char* strFilename);
+	QA_Result imp_readFrame(uint8_t* pRGB);
+	void imp_readLine(uint16_t uLine, uint8_t* pRGB);
+
+#endif
 
 };
 
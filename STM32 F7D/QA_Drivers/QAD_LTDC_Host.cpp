@@ -0,0 +1,264 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Driver                                                        */
+/*   Role: LTDC Driver - Desktop Host Version                              */
+/*   Filename: QAD_LTDC_Host.cpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAD_LTDC.hpp"
+
+//This version of the driver is only built for a desktop host (see setup.hpp)
+//The frame buffers are allocated from the memory standing in for the SDRAM (see QAD_FMC_Host.cpp), and as there is no LCD, vertical blanking periods take place
+//when a frame is written with writeFrame() or read with readFrame(), when vblank() is called, or when the renderer would otherwise wait for one.
+//This allows QAS_LCD to be built and run on a host by QA_Host/CMakeLists.txt, which also builds a tool that writes rendered frames to
+//image files, and the golden-image tests and rendering benchmarks
+#if defined(QA_HOST)
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Returns a frame buffer pixel converted to ARGB8888
+//pBuffer - Pointer to the frame buffer, holding pixels of the given format
+//uIdx    - Index of the pixel within the frame buffer
+//pCLUT   - Pointer to the layer's color look-up table, used by the L8 format
+template <class Format>
+static uint32_t QAD_LTDC_HostPixel(const void* pBuffer, uint32_t uIdx, const uint32_t*) {
+	return QAT_PixelConvert<QAT_PixelFormat_ARGB8888, Format>::convert(((const typename Format::Type*)pBuffer)[uIdx]);
+}
+
+//L8 pixels are looked up in the layer's color look-up table, and are always opaque
+template <>
+inline uint32_t QAD_LTDC_HostPixel<QAT_PixelFormat_L8>(const void* pBuffer, uint32_t uIdx, const uint32_t* pCLUT) {
+	return 0xFF000000 | pCLUT[((const uint8_t*)pBuffer)[uIdx]];
+}
+
+
+//Returns the ARGB8888 pixel of a layer displayed at a position on the LCD panel, or a transparent pixel if the position lies outside of
+//the layer's window, in the same manner as the LTDC
+//pStart  - Pointer to the pixel of the layer's buffer displayed at the upper-left corner of the window
+//sWindow - The window of the layer's buffer. See QAD_LTDC_Window
+//pCLUT   - Pointer to the layer's color look-up table, used by the L8 format
+//x & y   - The position on the LCD panel
+template <class Format>
+static uint32_t QAD_LTDC_HostWindowPixel(const void* pStart, const QAD_LTDC_Window& sWindow, const uint32_t* pCLUT, uint16_t x, uint16_t y) {
+	if ((x < sWindow.uX) || (x >= (sWindow.uX + sWindow.uWidth)) || (y < sWindow.uY) || (y >= (sWindow.uY + sWindow.uHeight)))
+		return 0x00000000;
+	return QAD_LTDC_HostPixel<Format>(pStart, ((uint32_t)(y - sWindow.uY) * sWindow.uPitch) + (x - sWindow.uX), pCLUT);
+}
+
+
+//Returns a color component of an ARGB8888 pixel blended over the same component of the layers beneath it, using the pixel's alpha
+//uPxl   - The ARGB8888 pixel
+//uComp  - The color component. 0 = red, 1 = green, 2 = blue
+//uBelow - The 8bit value of the component from the layers beneath
+static uint32_t QAD_LTDC_HostBlend(uint32_t uPxl, uint8_t uComp, uint32_t uBelow) {
+	uint32_t uAlpha = QAT_PixelFormat_ARGB8888::a(uPxl);
+	uint32_t uValue = (uPxl >> (16 - (uComp * 8))) & 0xFF;
+	return ((uValue * uAlpha) + (uBelow * (255 - uAlpha))) / 255;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //-------------------------------
+  //QAD_LTDC Initialization Methods
+
+//QAD_LTDC::imp_init
+//QAD_LTDC Initialization Method
+//
+//To be called from static method init()
+//Used to allocate and clear the frame buffers and set the initial frame buffer states
+//Returns QA_OK if initialization successful, or QA_Fail if there is not enough memory remaining for the frame buffers
+QA_Result QAD_LTDC::imp_init(void) {
+	if (imp_allocBuffers())
+		return QA_Fail;
+	memset(m_pLayer0Ptr, 0, QAD_LTDC_LAYER0_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT);
+	memset(m_pLayer1Ptr, 0, QAD_LTDC_LAYER1_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT);
+
+	//Initialize color look-up tables
+	imp_initCLUT(QAD_LTDC_Layer0);
+	imp_initCLUT(QAD_LTDC_Layer1);
+
+	//Set Initial Frame Buffer States, matching those of the board
+	imp_initLayers();
+
+	m_eInitState = QA_Initialized;
+	return QA_OK;
+}
+
+
+//QAD_LTDC::imp_deinit
+//QAD_LTDC Initialization Method
+//
+//To be called from static method deinit()
+void QAD_LTDC::imp_deinit(void) {
+	m_eInitState = QA_NotInitialized;
+}
+
+
+  //-----------------------------------
+  //-----------------------------------
+  //QAD_LTDC DSI and Control Methods
+  //
+  //There is no display controller or backlight on a host, so the following methods have no effect
+
+void QAD_LTDC::imp_dsi_IO_WriteCmd(uint32_t, uint8_t*) {}
+void QAD_LTDC::imp_lcdOn(void) {}
+void QAD_LTDC::imp_lcdOff(void) {}
+void QAD_LTDC::imp_setBrightness(uint8_t) {}
+
+
+  //----------------------------
+  //----------------------------
+  //QAD_LTDC IRQ Handler Methods
+  //
+  //There is no LTDC interrupt on a host, with vertical blanking periods instead being simulated by calling imp_vblank() directly,
+  //so the following methods have no effect
+
+void QAD_LTDC::imp_handler(void) {}
+void QAD_LTDC::imp_lockIRQ(void) {}
+void QAD_LTDC::imp_unlockIRQ(void) {}
+void QAD_LTDC::imp_present(const QAD_LTDC_BufferIdx*) {}
+
+
+//QAD_LTDC::imp_getLine
+//QAD_LTDC IRQ Handler Method
+//
+//Returns the line currently being displayed. As frames are only displayed when written on a host, this is always line 0
+uint32_t QAD_LTDC::imp_getLine(void) {
+	return 0;
+}
+
+
+//QAD_LTDC::imp_waitVBlank
+//QAD_LTDC Layer Control Method
+//
+//To be called from static method waitVBlank()
+//There is no LCD to wait for on a host, so a vertical blanking period takes place straight away
+void QAD_LTDC::imp_waitVBlank(void) {
+	if (m_eInitState)
+		imp_vblank();
+}
+
+
+  //---------------------
+  //---------------------
+  //QAD_LTDC CLUT Methods
+
+//QAD_LTDC::imp_initCLUT
+//QAD_LTDC CLUT Method
+//
+//Used during initialization to set a layer's CLUT to the default ramp of grays
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx enum
+void QAD_LTDC::imp_initCLUT(QAD_LTDC_LayerIdx eLayer) {
+	for (uint16_t i=0; i<QAD_LTDC_CLUTSIZE; i++)
+		m_uCLUT[eLayer][i] = i * 0x00010101;
+}
+
+
+//QAD_LTDC::imp_writeCLUT
+//QAD_LTDC CLUT Method
+//
+//There is no LTDC on a host, with writeFrame() reading the copy of each layer's CLUT directly, so this method has no effect
+void QAD_LTDC::imp_writeCLUT(QAD_LTDC_LayerIdx, uint16_t, uint16_t) {}
+
+
+  //-----------------------
+  //-----------------------
+  //QAD_LTDC Host Methods
+
+//QAD_LTDC::imp_writeFrame
+//QAD_LTDC Host Method
+//
+//To be called from static method writeFrame()
+//Used to write the image currently being displayed to a binary PPM (P6) file, with each line being composited by imp_readLine()
+//strFilename - The name of the file to be written
+//Returns QA_OK if successful, or QA_Fail if the driver is not initialized or the file could not be written
+QA_Result QAD_LTDC::imp_writeFrame(const char* strFilename) {
+	if (!m_eInitState)
+		return QA_Fail;
+
+	//Present any queued buffers, as would happen before the LCD reads out a frame
+	imp_vblank();
+
+	FILE* pFile = fopen(strFilename, "wb");
+	if (!pFile)
+		return QA_Fail;
+
+	uint8_t uLine[QAD_LTDC_WIDTH * 3];
+	fprintf(pFile, "P6\n%d %d\n255\n", QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT);
+	for (uint16_t y=0; y<QAD_LTDC_HEIGHT; y++) {
+		imp_readLine(y, uLine);
+		fwrite(uLine, 1, sizeof(uLine), pFile);
+	}
+
+	return (fclose(pFile) == 0) ? QA_OK : QA_Fail;
+}
+
+
+//QAD_LTDC::imp_readFrame
+//QAD_LTDC Host Method
+//
+//To be called from static method readFrame()
+//Used to read the image currently being displayed into a buffer of 8bit RGB pixels, with each line being composited by imp_readLine()
+//pRGB - Pointer to a buffer of at least (QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT * 3) bytes
+//Returns QA_OK if successful, or QA_Fail if the driver is not initialized
+QA_Result QAD_LTDC::imp_readFrame(uint8_t* pRGB) {
+	if (!m_eInitState)
+		return QA_Fail;
+
+	//Present any queued buffers, as would happen before the LCD reads out a frame
+	imp_vblank();
+
+	for (uint16_t y=0; y<QAD_LTDC_HEIGHT; y++)
+		imp_readLine(y, &pRGB[(uint32_t)y * QAD_LTDC_WIDTH * 3]);
+	return QA_OK;
+}
+
+
+//QAD_LTDC::imp_readLine
+//QAD_LTDC Host Method
+//
+//Used by imp_writeFrame() and imp_readFrame() to composite a single line of the image currently being displayed
+//Each layer's front-buffer pixel is blended over the result of the layers beneath it using the pixel's alpha, in the same
+//manner as the LTDC's pixel alpha blending factors, with layer 0 being blended over a black background. Pixels are unpacked using
+//the pixel format of each layer (see QAD_LTDC_Layer0Format and QAD_LTDC_Layer1Format), with formats that do not store alpha being opaque
+//and L8 pixels being looked up in the layer's CLUT. Each layer only covers the window of its front-buffer, being transparent elsewhere
+//uLine - The line to be composited
+//pRGB  - Pointer to a buffer of at least (QAD_LTDC_WIDTH * 3) bytes, to be filled with 8bit RGB pixels
+void QAD_LTDC::imp_readLine(uint16_t uLine, uint8_t* pRGB) {
+	const QAD_LTDC_LayerState& sLayer0 = m_sLayers[QAD_LTDC_Layer0];
+	const QAD_LTDC_LayerState& sLayer1 = m_sLayers[QAD_LTDC_Layer1];
+	const void* pLayer0 = imp_getWindowStart(QAD_LTDC_Layer0, sLayer0.eFront, sLayer0.sFront);
+	const void* pLayer1 = imp_getWindowStart(QAD_LTDC_Layer1, sLayer1.eFront, sLayer1.sFront);
+
+	for (uint16_t x=0; x<QAD_LTDC_WIDTH; x++) {
+		uint32_t uPxl0 = QAD_LTDC_HostWindowPixel<QAD_LTDC_Layer0Format>(pLayer0, sLayer0.sFront, m_uCLUT[QAD_LTDC_Layer0], x, uLine);
+		uint32_t uPxl1 = QAD_LTDC_HostWindowPixel<QAD_LTDC_Layer1Format>(pLayer1, sLayer1.sFront, m_uCLUT[QAD_LTDC_Layer1], x, uLine);
+		for (uint8_t c=0; c<3; c++)
+			pRGB[(x * 3) + c] = (uint8_t)QAD_LTDC_HostBlend(uPxl1, c, QAD_LTDC_HostBlend(uPxl0, c, 0));
+	}
+}
+
+
+//Prevent building on the STM32F769I Discovery board
+#endif /* QA_HOST */
@@ -0,0 +1,248 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Rendering Kernel Benchmarks                 */
+/*   Filename: QAH_Bench_Kernels.cpp                                       */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Bench.hpp"
+
+#include "QAS_LCD.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Frame buffer sized pixels written by the kernel benchmarks
+static QAT_Pixel_ARGB4444 QAH_BenchPixels[QAD_LTDC_PIXELCOUNT] __attribute__((aligned(32)));
+
+//Source pixels, and pixels blended one at a time, used by the blending benchmark
+static uint16_t QAH_BenchSource[QAD_LTDC_PIXELCOUNT] __attribute__((aligned(32)));
+static uint16_t QAH_BenchReference[QAD_LTDC_PIXELCOUNT] __attribute__((aligned(32)));
+
+//Read after each case, so that the compiler cannot discard the pixels written by it
+static volatile uint16_t QAH_BenchSink;
+
+
+//Used to fill a rectangle one pixel at a time through the pixel's setter, as QAS_LCD filled rectangles before the span kernels
+//of QAS_LCD_Span.hpp were added
+//cRect  - The rectangle
+//uColor - The color to fill the rectangle with
+static void QAH_Bench_fillPerPixel(const QAT_Rect_16& cRect, uint16_t uColor) {
+	uint32_t yofs;
+	for (int16_t y=cRect.y0; y<=cRect.y1; y++) {
+		yofs = y*QAD_LTDC_WIDTH;
+		for (int16_t x=cRect.x0; x<=cRect.x1; x++) {
+			QAH_BenchPixels[x+yofs].pxl(uColor);
+		}
+	}
+}
+
+
+//Used to draw an image one pixel at a time through the pixel's setter, reading each source pixel and testing or blending it alone
+//cPos   - Position of the upper-left pixel of the image, which must lie within the LCD
+//cImage - The image
+//eMode  - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum
+static void QAH_Bench_blitPerPixel(QAT_Vector2_16 cPos, const QAS_LCD_Image& cImage, QAS_LCD_BlitMode eMode) {
+	uint32_t yofs;
+	for (int16_t y=0; y<cImage.m_uHeight; y++) {
+		yofs = (cPos.y + y)*QAD_LTDC_WIDTH + cPos.x;
+		for (int16_t x=0; x<cImage.m_uWidth; x++) {
+			uint16_t uSrc = *cImage.pixel(x, y);
+			if (eMode == QAS_LCD_Blit_Alpha)
+				QAH_BenchPixels[x+yofs].pxl(QAS_LCD_Blend::pixel(QAH_BenchPixels[x+yofs].pxl(), uSrc, QAS_LCD_Blend_SrcOver));
+			else if ((eMode == QAS_LCD_Blit_Opaque) || (uSrc != cImage.m_uColorKey))
+				QAH_BenchPixels[x+yofs].pxl(uSrc);
+		}
+	}
+}
+
+
+//Used to fill an array of pixels with repeatable pseudo-random values
+//pPixels - The pixels
+//uCount  - The number of pixels
+//uSeed   - The starting value of the generator
+static void QAH_Bench_random(uint16_t* pPixels, uint32_t uCount, uint32_t uSeed) {
+	for (uint32_t i=0; i<uCount; i++) {
+		uSeed = (uSeed * 1103515245) + 12345;
+		pPixels[i] = (uint16_t)(uSeed >> 16);
+	}
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Pixels per second of rectangle fills drawn with the span kernels, relative to the per-pixel loops they replaced
+//Rectangles start on odd pixels where possible, so that the span kernels also write unaligned leading and trailing pixels
+//The clearBuffer() case includes the cost of selecting kernels and clipping, writes to the back buffer of layer 0, and is relative to
+//the full screen per-pixel loop
+QAH_BENCH(Fill) {
+	static const struct {
+		const char* strName;
+		QAT_Rect_16 cRect;
+	} sCases[] = {
+		{"Full screen",      QAT_Rect_16(0, 0, QAD_LTDC_WIDTH - 1, QAD_LTDC_HEIGHT - 1)},
+		{"Rectangle 101x21", QAT_Rect_16(101, 51, 201, 71)},
+		{"Span 799x1",       QAT_Rect_16(1, 200, QAD_LTDC_WIDTH - 1, 200)},
+		{"Span 7x1",         QAT_Rect_16(301, 200, 307, 200)}
+	};
+	char   strCase[64];
+	double dFullScreen = 0.0;
+
+	for (const auto& sCase : sCases) {
+		const QAT_Rect_16& cRect = sCase.cRect;
+
+		double dBaseline = cRect.area() / QAH_Bench::measure([&]() {
+			QAH_Bench_fillPerPixel(cRect, 0xF35A);
+		});
+		QAH_BenchSink = QAH_BenchPixels[cRect.x1 + (cRect.y1 * QAD_LTDC_WIDTH)].pxl();
+		if (!dFullScreen)
+			dFullScreen = dBaseline;
+		snprintf(strCase, sizeof(strCase), "%s, per pixel", sCase.strName);
+		QAH_Bench::report(strCase, dBaseline, "pixels/s");
+
+		double dSpan = cRect.area() / QAH_Bench::measure([&]() {
+			QAS_LCD_Span::fillRect((uint16_t*)&QAH_BenchPixels[cRect.x0 + (cRect.y0 * QAD_LTDC_WIDTH)], QAD_LTDC_WIDTH, cRect.width(), cRect.height(),
+					                   0xF35A);
+		});
+		QAH_BenchSink = QAH_BenchPixels[cRect.x1 + (cRect.y1 * QAD_LTDC_WIDTH)].pxl();
+		snprintf(strCase, sizeof(strCase), "%s, span kernel", sCase.strName);
+		QAH_Bench::report(strCase, dSpan, "pixels/s", dBaseline);
+	}
+
+	QAS_LCD::init();
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF35A);
+	double dClear = QAD_LTDC_PIXELCOUNT / QAH_Bench::measure([&]() {
+		QAS_LCD::clearBuffer();
+	});
+	QAH_Bench::report("Full screen, clearBuffer()", dClear, "pixels/s", dFullScreen);
+}
+
+
+//Pixels per second of full screen fills and image blends in each blend mode using the SWAR kernels of QAS_LCD_Blend, which blend two
+//pixels per 32bit word, relative to blending one pixel at a time with QAS_LCD_Blend::pixel()
+//Both are run from the same starting pixels and must produce the same result, which is reported if they do not
+QAH_BENCH(Blend) {
+	static const struct {
+		const char*       strName;
+		QAS_LCD_BlendMode eMode;
+	} sModes[] = {
+		{"SrcOver",  QAS_LCD_Blend_SrcOver},
+		{"Add",      QAS_LCD_Blend_Add},
+		{"Multiply", QAS_LCD_Blend_Multiply}
+	};
+	uint16_t* pPixels = (uint16_t*)QAH_BenchPixels;
+	char      strCase[64];
+
+	QAH_Bench_random(QAH_BenchSource, QAD_LTDC_PIXELCOUNT, 1);
+	for (const auto& sMode : sModes) {
+		QAS_LCD_BlendMode eMode = sMode.eMode;
+
+		//Fill with a translucent color
+		QAH_Bench_random(QAH_BenchReference, QAD_LTDC_PIXELCOUNT, 2);
+		QAH_Bench_random(pPixels, QAD_LTDC_PIXELCOUNT, 2);
+		double dBaseline = QAD_LTDC_PIXELCOUNT / QAH_Bench::measure([&]() {
+			for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++)
+				QAH_BenchReference[i] = QAS_LCD_Blend::pixel(QAH_BenchReference[i], 0x9C47, eMode);
+		});
+		double dSWAR = QAD_LTDC_PIXELCOUNT / QAH_Bench::measure([&]() {
+			QAS_LCD_Blend::fill(pPixels, QAD_LTDC_PIXELCOUNT, 0x9C47, eMode);
+		});
+		snprintf(strCase, sizeof(strCase), "Fill %s, per pixel", sMode.strName);
+		QAH_Bench::report(strCase, dBaseline, "pixels/s");
+		snprintf(strCase, sizeof(strCase), "Fill %s, SWAR", sMode.strName);
+		QAH_Bench::report(strCase, dSWAR, "pixels/s", dBaseline);
+
+		//Blend of image pixels
+		QAH_Bench_random(QAH_BenchReference, QAD_LTDC_PIXELCOUNT, 3);
+		QAH_Bench_random(pPixels, QAD_LTDC_PIXELCOUNT, 3);
+		uint32_t uRuns = 0;
+		dBaseline = QAD_LTDC_PIXELCOUNT / QAH_Bench::measure([&]() {
+			for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++)
+				QAH_BenchReference[i] = QAS_LCD_Blend::pixel(QAH_BenchReference[i], QAH_BenchSource[i], eMode);
+			uRuns++;
+		});
+		dSWAR = QAD_LTDC_PIXELCOUNT / QAH_Bench::measure([&]() {
+			QAS_LCD_Blend::blend(pPixels, QAH_BenchSource, QAD_LTDC_PIXELCOUNT, eMode);
+		});
+		snprintf(strCase, sizeof(strCase), "Blend %s, per pixel", sMode.strName);
+		QAH_Bench::report(strCase, dBaseline, "pixels/s");
+		snprintf(strCase, sizeof(strCase), "Blend %s, SWAR", sMode.strName);
+		QAH_Bench::report(strCase, dSWAR, "pixels/s", dBaseline);
+
+		//Blend the starting pixels the same number of times with both kernels and compare the results
+		QAH_Bench_random(QAH_BenchReference, QAD_LTDC_PIXELCOUNT, 4);
+		QAH_Bench_random(pPixels, QAD_LTDC_PIXELCOUNT, 4);
+		for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++)
+			QAH_BenchReference[i] = QAS_LCD_Blend::pixel(QAH_BenchReference[i], QAH_BenchSource[i], eMode);
+		QAS_LCD_Blend::blend(pPixels, QAH_BenchSource, QAD_LTDC_PIXELCOUNT, eMode);
+		if (memcmp(pPixels, QAH_BenchReference, sizeof(QAH_BenchReference)))
+			printf("  %s: SWAR and per pixel results differ\n", sMode.strName);
+		QAH_BenchSink = pPixels[uRuns % QAD_LTDC_PIXELCOUNT];
+	}
+}
+
+
+//Pixels per second of images drawn with drawImage() in each blit mode, relative to drawing one pixel at a time
+//Images are read from a plain array standing in for the memory-mapped QuadSPI flash, starting half way through a word, and are
+//drawn onto the back buffer of layer 0 at odd positions, so that the ends of each row are not aligned to the words of the row kernels
+QAH_BENCH(Blit) {
+	static const struct {
+		const char*      strName;
+		QAS_LCD_BlitMode eMode;
+		uint16_t         uWidth;
+		uint16_t         uHeight;
+	} sCases[] = {
+		{"Opaque 301x151",   QAS_LCD_Blit_Opaque,   301, 151},
+		{"ColorKey 301x151", QAS_LCD_Blit_ColorKey, 301, 151},
+		{"Alpha 301x151",    QAS_LCD_Blit_Alpha,    301, 151},
+		{"Opaque 7x5",       QAS_LCD_Blit_Opaque,   7,   5}
+	};
+	QAT_Vector2_16 cPos(101, 51);
+	char           strCase[64];
+
+	//Every eighth source pixel is the color key
+	QAH_Bench_random(QAH_BenchSource, QAD_LTDC_PIXELCOUNT, 5);
+	for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i+=8)
+		QAH_BenchSource[i] = 0xF0F0;
+
+	QAS_LCD::init();
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	for (const auto& sCase : sCases) {
+		QAS_LCD_Image cImage(QAH_BenchSource, 2, sCase.uWidth, sCase.uHeight, 0, 0xF0F0);
+		uint32_t      uArea = (uint32_t)sCase.uWidth * sCase.uHeight;
+
+		double dBaseline = uArea / QAH_Bench::measure([&]() {
+			QAH_Bench_blitPerPixel(cPos, cImage, sCase.eMode);
+		});
+		QAH_BenchSink = QAH_BenchPixels[cPos.x + (cPos.y * QAD_LTDC_WIDTH)].pxl();
+		snprintf(strCase, sizeof(strCase), "%s, per pixel", sCase.strName);
+		QAH_Bench::report(strCase, dBaseline, "pixels/s");
+
+		double dBlit = uArea / QAH_Bench::measure([&]() {
+			QAS_LCD::drawImage(cPos, cImage, sCase.eMode);
+		});
+		snprintf(strCase, sizeof(strCase), "%s, drawImage()", sCase.strName);
+		QAH_Bench::report(strCase, dBlit, "pixels/s", dBaseline);
+	}
+}
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Rendering Benchmarks                        */
+/*   Filename: QAH_Bench_Render.cpp                                        */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Bench.hpp"
+#include "QAH_Scene.hpp"
+
+#include <stdio.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Frames per second of every scene drawn in full in each rendering mode, relative to the immediate mode
+//On a host the DMA2D is modelled in software a pixel at a time (see QAD_DMA2D_Host.cpp), so the accelerated modes measure the cost
+//of queuing jobs rather than the time saved by the DMA2D
+QAH_BENCH(Render) {
+	char strCase[64];
+	QAS_LCD::init();
+
+	for (uint8_t i=0; i<QAH_Scene::count(); i++) {
+		const QAH_SceneDesc& sScene = QAH_Scene::get(i);
+		double dBaseline = 0.0;
+
+		for (uint8_t m=0; m<QAH_Scene_ModeCount; m++) {
+			QAH_Scene::setMode((QAH_SceneMode)m);
+			double dFPS = 1.0 / QAH_Bench::measure([&]() {
+				QAH_Scene::begin(sScene);
+				QAH_Scene::draw(sScene, 0);
+			});
+			if (!m)
+				dBaseline = dFPS;
+
+			snprintf(strCase, sizeof(strCase), "%s, %s", sScene.strName, QAH_Scene::getModeName((QAH_SceneMode)m));
+			QAH_Bench::report(strCase, dFPS, "frames/s", dBaseline);
+		}
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
+
+
+//Frames per second of the status scene as drawn on the board, where only the card details change from one frame to the next
+QAH_BENCH(RenderUpdate) {
+	char strCase[64];
+	QAS_LCD::init();
+
+	const QAH_SceneDesc& sScene = *QAH_Scene::find("Status");
+	double dBaseline = 0.0;
+	for (uint8_t m=0; m<QAH_Scene_ModeCount; m++) {
+		uint32_t uFrame = 0;
+		QAH_Scene::setMode((QAH_SceneMode)m);
+		QAH_Scene::begin(sScene);
+		double dFPS = 1.0 / QAH_Bench::measure([&]() {
+			QAH_Scene::draw(sScene, uFrame++);
+		});
+		if (!m)
+			dBaseline = dFPS;
+
+		snprintf(strCase, sizeof(strCase), "Status updates, %s", QAH_Scene::getModeName((QAH_SceneMode)m));
+		QAH_Bench::report(strCase, dFPS, "frames/s", dBaseline);
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
+
+
+//Used to return the number of bytes written to the frame buffers of both layers for the most recently presented frame
+static uint32_t QAH_Bench_frameBytes(void) {
+	return (QAS_LCD::getPixelsTouched(QAD_LTDC_Layer0) * QAD_LTDC_Layer0Format::Bytes) +
+			   (QAS_LCD::getPixelsTouched(QAD_LTDC_Layer1) * QAD_LTDC_Layer1Format::Bytes);
+}
+
+
+//Bytes written to the frame buffers of both layers for every scene drawn in full in each rendering mode, and for an update of the
+//status scene once every buffer has been drawn, relative to the immediate mode
+//Pixels written to tile buffers are not included, as they are held in the DTCM rather than SDRAM, and are only written to the
+//frame buffers when each tile is written back
+QAH_BENCH(FrameBytes) {
+	char strCase[64];
+	QAS_LCD::init();
+
+	for (uint8_t i=0; i<=QAH_Scene::count(); i++) {
+		const QAH_SceneDesc& sScene = (i < QAH_Scene::count()) ? QAH_Scene::get(i) : *QAH_Scene::find("Status");
+		double dBaseline = 0.0;
+
+		for (uint8_t m=0; m<QAH_Scene_ModeCount; m++) {
+			QAH_Scene::setMode((QAH_SceneMode)m);
+			QAH_Scene::begin(sScene);
+			uint32_t uFrames = (i < QAH_Scene::count()) ? 1 : QAD_LTDC_BUFFERCOUNT + 1;
+			for (uint32_t uFrame=0; uFrame<uFrames; uFrame++)
+				QAH_Scene::draw(sScene, uFrame);
+
+			double dBytes = QAH_Bench_frameBytes();
+			if (!m)
+				dBaseline = dBytes;
+
+			snprintf(strCase, sizeof(strCase), "%s%s, %s", sScene.strName, (i < QAH_Scene::count()) ? "" : " updates",
+					     QAH_Scene::getModeName((QAH_SceneMode)m));
+			QAH_Bench::report(strCase, dBytes, "bytes/frame", dBaseline);
+		}
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
@@ -0,0 +1,116 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Text Rendering Benchmarks                   */
+/*   Filename: QAH_Bench_Text.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Bench.hpp"
+
+#include "QAS_LCD.hpp"
+#include "QAS_LCD_Fonts_SegoeUI12pt.hpp"
+#include "QAS_LCD_Fonts_SegoeUI20ptSB.hpp"
+#include "QAS_LCD_Fonts_ShowcardGothic18pt.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//String drawn by the text benchmarks
+static const char* QAH_BenchText = "The quick brown fox jumps over the lazy dog 0123456789 !\"#$%&'()*+,-./:;<=>?@[\\]^_`{|}~";
+
+//Buffer that the bitmap copies of the built-in fonts are packed into
+static uint32_t QAH_BenchFontFiles[3][0x4000 / sizeof(uint32_t)];
+
+
+//Glyphs per second of a string drawn in each of the built-in fonts, being drawn from:
+//- The font's run table built at compile time (see QAS_LCD_FontRuns.hpp), as the font is drawn on the board
+//- The font's bitmap, testing each bit as the fonts were drawn before run tables were added
+//- The font's bitmap through the glyph cache, where glyphs are converted to runs when first drawn (see QAS_LCD_GlyphCache.hpp)
+//The bitmap cases draw a copy of each font packed into a font file, as fonts added from font files have no run table
+QAH_BENCH(Glyphs) {
+	char strCase[64];
+	QAS_LCD::init();
+
+	struct {
+		const char*             strName;
+		const QAS_LCD_FontDesc* pDesc;
+		const uint8_t*          pData;
+		uint16_t                uHeight;
+		uint16_t                uSpaceWidth;
+		uint16_t                uCharGap;
+	} sFonts[3] = {
+		{"SegoeUI12pt",        QAS_LCD_Fonts_SegoeUI12pt_Desc,        QAS_LCD_Fonts_SegoeUI12pt_Data,
+		 QAS_LCD_Fonts_SegoeUI12pt_Height,        QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth,        QAS_LCD_Fonts_SegoeUI12pt_CharGap},
+		{"SegoeUI20ptSB",      QAS_LCD_Fonts_SegoeUI20ptSB_Desc,      QAS_LCD_Fonts_SegoeUI20ptSB_Data,
+		 QAS_LCD_Fonts_SegoeUI20ptSB_Height,      QAS_LCD_Fonts_SegoeUI20ptSB_SpaceWidth,      QAS_LCD_Fonts_SegoeUI20ptSB_CharGap},
+		{"ShowcardGothic18pt", QAS_LCD_Fonts_ShowcardGothic18pt_Desc, QAS_LCD_Fonts_ShowcardGothic18pt_Data,
+		 QAS_LCD_Fonts_ShowcardGothic18pt_Height, QAS_LCD_Fonts_ShowcardGothic18pt_SpaceWidth, QAS_LCD_Fonts_ShowcardGothic18pt_CharGap}
+	};
+
+	//Count the characters of the string that are drawn as glyphs
+	uint32_t uGlyphs = 0;
+	for (const char* pChar=QAH_BenchText; *pChar; pChar++) {
+		if (*pChar != ' ')
+			uGlyphs++;
+	}
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xFFFF);
+	for (uint8_t i=0; i<3; i++) {
+		char strFile[QAS_LCD_FONTNAME_LENGTH];
+		snprintf(strFile, sizeof(strFile), "%s Bitmap", sFonts[i].strName);
+		uint32_t uSize = QAS_LCD_FontFile::pack((uint8_t*)QAH_BenchFontFiles[i], sizeof(QAH_BenchFontFiles[i]), strFile, sFonts[i].pDesc,
+				                                    sFonts[i].pData, sFonts[i].uHeight, sFonts[i].uSpaceWidth, sFonts[i].uCharGap);
+		int8_t iFile = QAS_LCD::addFont(QAH_BenchFontFiles[i], uSize);
+		if (iFile < 0) {
+			printf("  %s could not be packed\n", sFonts[i].strName);
+			continue;
+		}
+
+		//Bit tested bitmap, which is the baseline
+		QAS_LCD::setGlyphCache(QA_Inactive);
+		QAS_LCD::setFontByIndex(iFile);
+		double dBaseline = uGlyphs / QAH_Bench::measure([&]() {
+			QAS_LCD::drawStrL(QAT_Vector2_16(10, 100), QAH_BenchText);
+		});
+		snprintf(strCase, sizeof(strCase), "%s, bitmap", sFonts[i].strName);
+		QAH_Bench::report(strCase, dBaseline, "glyphs/s");
+
+		//Bitmap through the glyph cache
+		QAS_LCD::setGlyphCache(QA_Active);
+		double dCache = uGlyphs / QAH_Bench::measure([&]() {
+			QAS_LCD::drawStrL(QAT_Vector2_16(10, 100), QAH_BenchText);
+		});
+		snprintf(strCase, sizeof(strCase), "%s, glyph cache", sFonts[i].strName);
+		QAH_Bench::report(strCase, dCache, "glyphs/s", dBaseline);
+
+		//Run table
+		QAS_LCD::setFontByName(sFonts[i].strName);
+		double dRuns = uGlyphs / QAH_Bench::measure([&]() {
+			QAS_LCD::drawStrL(QAT_Vector2_16(10, 100), QAH_BenchText);
+		});
+		snprintf(strCase, sizeof(strCase), "%s, run table", sFonts[i].strName);
+		QAH_Bench::report(strCase, dRuns, "glyphs/s", dBaseline);
+	}
+
+	//Remove the bitmap copies of the fonts, so that they are not drawn by other benchmarks
+	QAS_LCD::deinit();
+	QAS_LCD::init();
+}
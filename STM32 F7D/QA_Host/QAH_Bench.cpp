@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Benchmarks                                  */
+/*   Filename: QAH_Bench.cpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Bench.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Static members
+QAH_Bench* QAH_Bench::m_pFirst   = NULL;
+QAH_Bench* QAH_Bench::m_pLast    = NULL;
+double     QAH_Bench::m_dMinTime = 0.5;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //----------------------
+  //----------------------
+  //QAH_Bench Constructors
+
+//QAH_Bench::QAH_Bench
+//QAH_Bench Constructor
+//
+//Used by QAH_BENCH() to add a benchmark to the end of the list of benchmarks
+//strName - Name of the benchmark
+//pFunc   - Function holding the body of the benchmark
+QAH_Bench::QAH_Bench(const char* strName, QAH_BenchFunc pFunc) :
+	m_strName(strName),
+	m_pFunc(pFunc),
+	m_pNext(NULL) {
+
+	if (m_pLast)
+		m_pLast->m_pNext = this; else
+		m_pFirst = this;
+	m_pLast = this;
+}
+
+
+  //---------------------
+  //---------------------
+  //QAH_Bench Run Methods
+
+//QAH_Bench::run
+//QAH_Bench Run Method
+//
+//Used to run the selected benchmarks in the order they were declared, or every benchmark if none are selected
+//iCount   - The number of selected benchmarks
+//strNames - Array of the names of the selected benchmarks
+//Returns the number of selected benchmarks that do not exist
+uint32_t QAH_Bench::run(int iCount, char* strNames[]) {
+	for (int i=0; i<iCount; i++) {
+		QAH_Bench* pBench = m_pFirst;
+		while (pBench && strcmp(pBench->m_strName, strNames[i]))
+			pBench = pBench->m_pNext;
+		if (!pBench) {
+			printf("QAH_Bench: unknown benchmark %s\n", strNames[i]);
+			return 1;
+		}
+	}
+
+	for (QAH_Bench* pBench = m_pFirst; pBench; pBench = pBench->m_pNext) {
+		bool bSelected = !iCount;
+		for (int i=0; i<iCount; i++)
+			bSelected |= !strcmp(pBench->m_strName, strNames[i]);
+		if (!bSelected)
+			continue;
+
+		printf("%s\n", pBench->m_strName);
+		pBench->m_pFunc();
+		printf("\n");
+	}
+	return 0;
+}
+
+
+//QAH_Bench::setMinTime
+//QAH_Bench Run Method
+//
+//Used to set the minimum time that each case is measured for by measure()
+//dSeconds - The minimum time in seconds
+void QAH_Bench::setMinTime(double dSeconds) {
+	m_dMinTime = dSeconds;
+}
+
+
+  //---------------------------
+  //---------------------------
+  //QAH_Bench Reporting Methods
+
+//QAH_Bench::report
+//QAH_Bench Reporting Method
+//
+//Used to report the result of a case
+//strCase - Description of the case
+//dValue  - The result of the case
+//strUnit - The unit of the result
+void QAH_Bench::report(const char* strCase, double dValue, const char* strUnit) {
+	printf("  %-44s %14.1f %s\n", strCase, dValue, strUnit);
+}
+
+
+//QAH_Bench::report
+//QAH_Bench Reporting Method
+//
+//Used to report the result of a case, along with its ratio to the result of a baseline case
+//strCase   - Description of the case
+//dValue    - The result of the case
+//strUnit   - The unit of the result
+//dBaseline - The result of the baseline case, in the same unit
+void QAH_Bench::report(const char* strCase, double dValue, const char* strUnit, double dBaseline) {
+	printf("  %-44s %14.1f %-12s %6.2fx\n", strCase, dValue, strUnit, (dBaseline > 0.0) ? (dValue / dBaseline) : 0.0);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//main
+//Host Benchmark Entry Point
+//
+//Used to run the benchmarks named by the arguments, or every benchmark if none are named
+//The minimum time each case is measured for can be set with "-t <seconds>", allowing a quick run to check that every benchmark works
+//Returns 0 if successful, otherwise 1
+int main(int argc, char* argv[]) {
+	int iArg = 1;
+	if ((argc > 2) && !strcmp(argv[1], "-t")) {
+		QAH_Bench::setMinTime(atof(argv[2]));
+		iArg = 3;
+	}
+	return QAH_Bench::run(argc - iArg, &argv[iArg]) ? 1 : 0;
+}
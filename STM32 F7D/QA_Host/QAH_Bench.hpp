@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Benchmarks                                  */
+/*   Filename: QAH_Bench.hpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAH_BENCH_HPP_
+#define __QAH_BENCH_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include <chrono>
+
+
+  //NOTE:
+  //Host benchmarks are built by QA_Host/CMakeLists.txt and are only built for a desktop host (see setup.hpp).
+  //
+  //Each benchmark is a function declared with QAH_BENCH(), which measures one or more cases with measure() and reports a line of
+  //results for each case with report(). Benchmarks compare the rendering paths of QAS_LCD against each other, or against the
+  //simpler code they replaced, on the same host, so only the ratios between cases are meaningful rather than the absolute figures.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------
+//QAH_Bench
+//
+//Class used to register, run and report host benchmarks
+//An instance is created by QAH_BENCH() for each benchmark, which adds itself to the list of benchmarks when constructed
+class QAH_Bench {
+public:
+
+	//Function holding the body of a benchmark
+	typedef void (*QAH_BenchFunc)(void);
+
+private:
+
+	const char*    m_strName;  //Name of the benchmark
+	QAH_BenchFunc  m_pFunc;    //Function holding the body of the benchmark
+	QAH_Bench*     m_pNext;    //Next benchmark in the list of benchmarks
+
+	static QAH_Bench* m_pFirst;    //First and last benchmarks in the list of benchmarks
+	static QAH_Bench* m_pLast;
+	static double     m_dMinTime;  //Minimum time in seconds that each case is measured for
+
+public:
+
+	//------------
+	//Constructors
+
+	QAH_Bench(const char* strName, QAH_BenchFunc pFunc);
+
+
+	//NOTE: See QAH_Bench.cpp for details of the following methods
+
+	//-----------
+	//Run Methods
+
+	static uint32_t run(int iCount, char* strNames[]);
+	static void setMinTime(double dSeconds);
+
+
+	//-----------------
+	//Reporting Methods
+
+	static void report(const char* strCase, double dValue, const char* strUnit);
+	static void report(const char* strCase, double dValue, const char* strUnit, double dBaseline);
+
+
+	//-------------------
+	//Measurement Methods
+
+	//Used to measure the average time taken by a case, by calling it repeatedly for at least the minimum time (see setMinTime())
+	//fCase - Function or lambda performing a single run of the case
+	//Returns the average time in seconds of a single run
+	template <class Case>
+	static double measure(Case fCase) {
+		typedef std::chrono::steady_clock Clock;
+
+		fCase();  //Warm up caches and any lazily allocated state
+
+		uint32_t          uRuns  = 0;
+		double            dTime  = 0.0;
+		Clock::time_point cStart = Clock::now();
+		while (dTime < m_dMinTime) {
+			fCase();
+			uRuns++;
+			dTime = std::chrono::duration<double>(Clock::now() - cStart).count();
+		}
+		return dTime / uRuns;
+	}
+
+};
+
+
+//----------------
+//QAH_Bench Macros
+
+//Declares a benchmark, being followed by the body of the benchmark
+//name - Name of the benchmark, which must be unique
+#define QAH_BENCH(name)                                                     \
+	static void QAH_Bench_##name(void);                                       \
+	static QAH_Bench QAH_BenchReg_##name(#name, QAH_Bench_##name);            \
+	static void QAH_Bench_##name(void)
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAH_BENCH_HPP_ */
@@ -0,0 +1,147 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Frame Dump                                  */
+/*   Filename: QAH_Frames.cpp                                              */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Image.hpp"
+#include "QAH_Scene.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//The frame dump tool draws scenes (see QAH_Scene.hpp) on a desktop host, and writes each displayed frame to an image file:
+//
+//  QAH_Frames [-m <mode>] [-n <frames>] [-ppm] <directory> [scene ...]
+//
+//Frames are written as <directory>/<scene>_<frame>.png, or as binary PPM files using QAD_LTDC::writeFrame() if -ppm is given.
+//If no scenes are named then every scene is drawn. Scenes are drawn in the immediate rendering mode unless another is selected
+//with -m, and a single frame is drawn unless more are selected with -n. The number of pixels written to each layer is reported
+//for every frame, so that the effect of dirty rectangle tracking can be seen.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Frame read from the LCD
+static uint8_t QAH_FramesRGB[QAH_IMAGE_FRAMESIZE];
+
+
+//Draws the frames of a scene, writing each to a file
+//sScene       - The scene
+//uFrames      - The number of frames to draw
+//strDirectory - The directory files are written to
+//bPPM         - True to write PPM files, or false to write PNG files
+//Returns QA_OK if successful, or QA_Fail if a file could not be written
+static QA_Result QAH_Frames_scene(const QAH_SceneDesc& sScene, uint32_t uFrames, const char* strDirectory, bool bPPM) {
+	char strFilename[512];
+
+	QAH_Scene::begin(sScene);
+	for (uint32_t uFrame=0; uFrame<uFrames; uFrame++) {
+		bool bDrawn = QAH_Scene::draw(sScene, uFrame);
+		snprintf(strFilename, sizeof(strFilename), "%s/%s_%u.%s", strDirectory, sScene.strName, uFrame, bPPM ? "ppm" : "png");
+
+		QA_Result eRes;
+		if (bPPM) {
+			eRes = QAD_LTDC::writeFrame(strFilename);
+		} else {
+			eRes = QAD_LTDC::readFrame(QAH_FramesRGB);
+			if (!eRes)
+				eRes = QAH_Image::writePNG(strFilename, QAH_FramesRGB, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT);
+		}
+		if (eRes) {
+			fprintf(stderr, "QAH_Frames: unable to write %s\n", strFilename);
+			return QA_Fail;
+		}
+
+		printf("  %-40s %s  layer 0: %7u px  layer 1: %7u px\n", strFilename, bDrawn ? "drawn  " : "skipped",
+				   QAS_LCD::getPixelsTouched(QAD_LTDC_Layer0), QAS_LCD::getPixelsTouched(QAD_LTDC_Layer1));
+	}
+	return QA_OK;
+}
+
+
+//main
+//Frame Dump Entry Point
+int main(int argc, char* argv[]) {
+	QAH_SceneMode eMode   = QAH_Scene_Immediate;
+	uint32_t      uFrames = 1;
+	bool          bPPM    = false;
+
+	//Read options
+	int iArg = 1;
+	while ((iArg < argc) && (argv[iArg][0] == '-')) {
+		if (!strcmp(argv[iArg], "-ppm")) {
+			bPPM = true;
+			iArg++;
+		} else if (!strcmp(argv[iArg], "-n") && ((iArg + 1) < argc)) {
+			uFrames = (uint32_t)atoi(argv[iArg + 1]);
+			iArg += 2;
+		} else if (!strcmp(argv[iArg], "-m") && ((iArg + 1) < argc)) {
+			uint8_t i = 0;
+			while ((i < QAH_Scene_ModeCount) && strcmp(QAH_Scene::getModeName((QAH_SceneMode)i), argv[iArg + 1]))
+				i++;
+			if (i == QAH_Scene_ModeCount) {
+				fprintf(stderr, "QAH_Frames: unknown mode %s\n", argv[iArg + 1]);
+				return 1;
+			}
+			eMode = (QAH_SceneMode)i;
+			iArg += 2;
+		} else {
+			break;
+		}
+	}
+
+	if (iArg >= argc) {
+		fprintf(stderr, "usage: QAH_Frames [-m <mode>] [-n <frames>] [-ppm] <directory> [scene ...]\n");
+		fprintf(stderr, "modes:");
+		for (uint8_t i=0; i<QAH_Scene_ModeCount; i++)
+			fprintf(stderr, " %s", QAH_Scene::getModeName((QAH_SceneMode)i));
+		fprintf(stderr, "\nscenes:");
+		for (uint8_t i=0; i<QAH_Scene::count(); i++)
+			fprintf(stderr, " %s", QAH_Scene::get(i).strName);
+		fprintf(stderr, "\n");
+		return 1;
+	}
+	const char* strDirectory = argv[iArg++];
+
+	//Initialize LCD, drawing every scene if none are named
+	if (QAS_LCD::init()) {
+		fprintf(stderr, "QAH_Frames: unable to initialize LCD\n");
+		return 1;
+	}
+	QAH_Scene::setMode(eMode);
+
+	if (iArg == argc) {
+		for (uint8_t i=0; i<QAH_Scene::count(); i++) {
+			if (QAH_Frames_scene(QAH_Scene::get(i), uFrames, strDirectory, bPPM))
+				return 1;
+		}
+	} else {
+		for (; iArg<argc; iArg++) {
+			const QAH_SceneDesc* pScene = QAH_Scene::find(argv[iArg]);
+			if (!pScene) {
+				fprintf(stderr, "QAH_Frames: unknown scene %s\n", argv[iArg]);
+				return 1;
+			}
+			if (QAH_Frames_scene(*pScene, uFrames, strDirectory, bPPM))
+				return 1;
+		}
+	}
+	return 0;
+}
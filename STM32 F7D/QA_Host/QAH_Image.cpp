@@ -0,0 +1,252 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Frame Images                                */
+/*   Filename: QAH_Image.cpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Image.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zlib.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Signature stored at the start of every PNG file
+static const uint8_t QAH_ImagePNGSignature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+
+
+//Writes a 32bit value to a buffer in the big-endian order used by PNG files
+static void QAH_ImagePut32(uint8_t* pDst, uint32_t uValue) {
+	pDst[0] = (uint8_t)(uValue >> 24);
+	pDst[1] = (uint8_t)(uValue >> 16);
+	pDst[2] = (uint8_t)(uValue >> 8);
+	pDst[3] = (uint8_t)uValue;
+}
+
+//Reads a big-endian 32bit value from a buffer
+static uint32_t QAH_ImageGet32(const uint8_t* pSrc) {
+	return ((uint32_t)pSrc[0] << 24) | ((uint32_t)pSrc[1] << 16) | ((uint32_t)pSrc[2] << 8) | pSrc[3];
+}
+
+
+//Writes a single chunk to a PNG file, being its length, type, data and the CRC of its type and data
+//pFile   - The file being written
+//strType - The four character type of the chunk
+//pData   - Pointer to the data of the chunk
+//uSize   - The size in bytes of the data
+//Returns true if the chunk was written
+static bool QAH_ImageWriteChunk(FILE* pFile, const char* strType, const uint8_t* pData, uint32_t uSize) {
+	uint8_t uHead[8];
+	uint8_t uTail[4];
+	QAH_ImagePut32(uHead, uSize);
+	memcpy(&uHead[4], strType, 4);
+
+	uLong uCRC = crc32(0, &uHead[4], 4);
+	if (uSize)
+		uCRC = crc32(uCRC, pData, uSize);
+	QAH_ImagePut32(uTail, (uint32_t)uCRC);
+
+	return (fwrite(uHead, 1, sizeof(uHead), pFile) == sizeof(uHead)) &&
+			   (!uSize || (fwrite(pData, 1, uSize, pFile) == uSize)) &&
+			   (fwrite(uTail, 1, sizeof(uTail), pFile) == sizeof(uTail));
+}
+
+
+//Returns the PNG Paeth predictor of the pixels to the left, above, and above-left of a pixel
+static uint8_t QAH_ImagePaeth(uint8_t uLeft, uint8_t uAbove, uint8_t uAboveLeft) {
+	int iP  = (int)uLeft + uAbove - uAboveLeft;
+	int iPA = abs(iP - uLeft);
+	int iPB = abs(iP - uAbove);
+	int iPC = abs(iP - uAboveLeft);
+	if ((iPA <= iPB) && (iPA <= iPC))
+		return uLeft;
+	return (iPB <= iPC) ? uAbove : uAboveLeft;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //-----------------------
+  //-----------------------
+  //QAH_Image File Methods
+
+//QAH_Image::writePNG
+//QAH_Image File Method
+//
+//Used to write a frame to a PNG file
+//Each row is stored with the Sub filter, which suits the flat colors of rendered user interfaces
+//strFilename - The name of the file to be written
+//pRGB        - Pointer to the frame's 8bit RGB pixels
+//uWidth      - The width and height of the frame in pixels
+//uHeight
+//Returns QA_OK if successful, or QA_Fail if the file could not be written
+QA_Result QAH_Image::writePNG(const char* strFilename, const uint8_t* pRGB, uint16_t uWidth, uint16_t uHeight) {
+	uint32_t uRowSize = ((uint32_t)uWidth * 3) + 1;
+	uint32_t uRawSize = uRowSize * uHeight;
+	uLongf   uZipSize = compressBound(uRawSize);
+	uint8_t* pRaw     = (uint8_t*)malloc(uRawSize);
+	uint8_t* pZip     = (uint8_t*)malloc(uZipSize);
+	QA_Result eRes    = QA_Fail;
+
+	if (pRaw && pZip) {
+
+		//Filter rows
+		for (uint16_t y=0; y<uHeight; y++) {
+			const uint8_t* pSrc = &pRGB[(uint32_t)y * uWidth * 3];
+			uint8_t*       pDst = &pRaw[(uint32_t)y * uRowSize];
+			pDst[0] = 1;
+			for (uint32_t i=0; i<((uint32_t)uWidth * 3); i++)
+				pDst[i + 1] = (uint8_t)(pSrc[i] - ((i >= 3) ? pSrc[i - 3] : 0));
+		}
+
+		//Compress and write file
+		FILE* pFile = NULL;
+		if ((compress2(pZip, &uZipSize, pRaw, uRawSize, Z_BEST_COMPRESSION) == Z_OK) && (pFile = fopen(strFilename, "wb"))) {
+			uint8_t uHeader[13];
+			QAH_ImagePut32(&uHeader[0], uWidth);
+			QAH_ImagePut32(&uHeader[4], uHeight);
+			uHeader[8]  = 8;  //Bit depth
+			uHeader[9]  = 2;  //Color type - RGB
+			uHeader[10] = 0;  //Compression method
+			uHeader[11] = 0;  //Filter method
+			uHeader[12] = 0;  //Interlace method - None
+
+			bool bOK = (fwrite(QAH_ImagePNGSignature, 1, sizeof(QAH_ImagePNGSignature), pFile) == sizeof(QAH_ImagePNGSignature)) &&
+					       QAH_ImageWriteChunk(pFile, "IHDR", uHeader, sizeof(uHeader)) &&
+					       QAH_ImageWriteChunk(pFile, "IDAT", pZip, (uint32_t)uZipSize) &&
+					       QAH_ImageWriteChunk(pFile, "IEND", NULL, 0);
+			if ((fclose(pFile) == 0) && bOK)
+				eRes = QA_OK;
+		}
+	}
+
+	free(pRaw);
+	free(pZip);
+	return eRes;
+}
+
+
+//QAH_Image::readPNG
+//QAH_Image File Method
+//
+//Used to read a frame from a PNG file
+//The file must hold a non-interlaced 8bit RGB image of the given size, which may use any of the PNG row filters
+//strFilename - The name of the file to be read
+//pRGB        - Pointer to a buffer of (uWidth * uHeight * 3) bytes, to be filled with the frame's 8bit RGB pixels
+//uWidth      - The expected width and height of the image in pixels
+//uHeight
+//Returns QA_OK if successful, or QA_Fail if the file could not be read, is not a supported PNG file, or is a different size
+QA_Result QAH_Image::readPNG(const char* strFilename, uint8_t* pRGB, uint16_t uWidth, uint16_t uHeight) {
+	FILE* pFile = fopen(strFilename, "rb");
+	if (!pFile)
+		return QA_Fail;
+
+	//Read whole file
+	fseek(pFile, 0, SEEK_END);
+	long iSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+	uint8_t* pFileData = (iSize > 0) ? (uint8_t*)malloc(iSize) : NULL;
+	bool     bOK       = pFileData && (fread(pFileData, 1, iSize, pFile) == (size_t)iSize);
+	fclose(pFile);
+
+	uint32_t uRowSize = ((uint32_t)uWidth * 3) + 1;
+	uLongf   uRawSize = uRowSize * uHeight;
+	uint8_t* pRaw     = (uint8_t*)malloc(uRawSize);
+	uint8_t* pZip     = (uint8_t*)malloc(iSize > 0 ? iSize : 1);
+	uint32_t uZipSize = 0;
+	bool     bHeader  = false;
+
+	//Check signature, then walk chunks, checking the header and gathering the compressed data
+	bOK = bOK && pRaw && pZip && (iSize >= 8) && !memcmp(pFileData, QAH_ImagePNGSignature, sizeof(QAH_ImagePNGSignature));
+	uint32_t uPos = 8;
+	while (bOK && ((uPos + 12) <= (uint32_t)iSize)) {
+		uint32_t       uLen  = QAH_ImageGet32(&pFileData[uPos]);
+		const uint8_t* pType = &pFileData[uPos + 4];
+		const uint8_t* pData = &pFileData[uPos + 8];
+		if ((uLen > ((uint32_t)iSize - uPos - 12)))
+			bOK = false;
+		else if (!memcmp(pType, "IHDR", 4))
+			bOK = bHeader = (uLen == 13) && (QAH_ImageGet32(&pData[0]) == uWidth) && (QAH_ImageGet32(&pData[4]) == uHeight) &&
+			                (pData[8] == 8) && (pData[9] == 2) && (pData[10] == 0) && (pData[11] == 0) && (pData[12] == 0);
+		else if (!memcmp(pType, "IDAT", 4)) {
+			memcpy(&pZip[uZipSize], pData, uLen);
+			uZipSize += uLen;
+		} else if (!memcmp(pType, "IEND", 4))
+			break;
+		uPos += uLen + 12;
+	}
+	bOK = bOK && bHeader && (uncompress(pRaw, &uRawSize, pZip, uZipSize) == Z_OK) && (uRawSize == (uRowSize * uHeight));
+
+	//Reverse row filters
+	for (uint16_t y=0; bOK && (y<uHeight); y++) {
+		const uint8_t* pSrc   = &pRaw[(uint32_t)y * uRowSize];
+		uint8_t*       pDst   = &pRGB[(uint32_t)y * uWidth * 3];
+		const uint8_t* pAbove = y ? (pDst - ((uint32_t)uWidth * 3)) : NULL;
+		for (uint32_t i=0; i<((uint32_t)uWidth * 3); i++) {
+			uint8_t uLeft       = (i >= 3) ? pDst[i - 3] : 0;
+			uint8_t uAbove      = pAbove ? pAbove[i] : 0;
+			uint8_t uAboveLeft  = (pAbove && (i >= 3)) ? pAbove[i - 3] : 0;
+			switch (pSrc[0]) {
+				case (0): pDst[i] = pSrc[i + 1]; break;
+				case (1): pDst[i] = (uint8_t)(pSrc[i + 1] + uLeft); break;
+				case (2): pDst[i] = (uint8_t)(pSrc[i + 1] + uAbove); break;
+				case (3): pDst[i] = (uint8_t)(pSrc[i + 1] + ((uLeft + uAbove) >> 1)); break;
+				case (4): pDst[i] = (uint8_t)(pSrc[i + 1] + QAH_ImagePaeth(uLeft, uAbove, uAboveLeft)); break;
+				default:  bOK = false;
+			}
+		}
+	}
+
+	free(pFileData);
+	free(pRaw);
+	free(pZip);
+	return bOK ? QA_OK : QA_Fail;
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAH_Image Comparison Methods
+
+//QAH_Image::compare
+//QAH_Image Comparison Method
+//
+//Used to compare two frames of 8bit RGB pixels
+//pA         - Pointers to the two frames
+//pB
+//uPixels    - The number of pixels in each frame
+//uTolerance - The largest difference allowed between the same component of two pixels for the pixels to match
+//Returns the number of pixels that differ between the frames
+uint32_t QAH_Image::compare(const uint8_t* pA, const uint8_t* pB, uint32_t uPixels, uint8_t uTolerance) {
+	uint32_t uDiffer = 0;
+	for (uint32_t i=0; i<uPixels; i++) {
+		for (uint8_t c=0; c<3; c++) {
+			if (abs((int)pA[(i * 3) + c] - (int)pB[(i * 3) + c]) > uTolerance) {
+				uDiffer++;
+				break;
+			}
+		}
+	}
+	return uDiffer;
+}
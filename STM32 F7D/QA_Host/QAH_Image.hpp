@@ -0,0 +1,73 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Frame Images                                */
+/*   Filename: QAH_Image.hpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAH_IMAGE_HPP_
+#define __QAH_IMAGE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Size in bytes of a frame of 8bit RGB pixels, as read by QAD_LTDC::readFrame()
+#define QAH_IMAGE_FRAMESIZE     ((uint32_t)QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT * 3)
+
+
+//---------
+//QAH_Image
+//
+//Static class used to read, write and compare frames of 8bit RGB pixels
+//
+//Frames are stored as PNG files so that reference images can be kept in the repository at a small size and viewed with any
+//image viewer. Files are written as 8bit RGB images without interlacing, and any such file can be read back, whichever
+//row filters it was written with.
+class QAH_Image {
+public:
+
+	//------------
+	//Constructors
+
+	QAH_Image() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAH_Image.cpp for details of the following methods
+
+	//-------------
+	//File Methods
+
+	static QA_Result writePNG(const char* strFilename, const uint8_t* pRGB, uint16_t uWidth, uint16_t uHeight);
+	static QA_Result readPNG(const char* strFilename, uint8_t* pRGB, uint16_t uWidth, uint16_t uHeight);
+
+
+	//------------------
+	//Comparison Methods
+
+	static uint32_t compare(const uint8_t* pA, const uint8_t* pB, uint32_t uPixels, uint8_t uTolerance = 0);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAH_IMAGE_HPP_ */
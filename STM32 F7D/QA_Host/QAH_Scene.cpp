@@ -0,0 +1,411 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Test Scenes                                 */
+/*   Filename: QAH_Scene.cpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Scene.hpp"
+
+#include "QAS_LCD_RLE.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //------------
+  //Status Scene
+  //
+  //The SD card status screen drawn by Core/main.cpp, being a static panel held in a surface with the card details drawn over it.
+  //The details change every frame, with only their area of layer 0 being invalidated, in the same manner as the board
+
+//Surface holding the static panel
+static uint8_t QAH_SceneStatusPanel = QAS_LCD_SURFACE_NONE;
+
+static void QAH_SceneStatus_setup(void) {
+	if (QAH_SceneStatusPanel != QAS_LCD_SURFACE_NONE)
+		return;
+
+	QAH_SceneStatusPanel = QAS_LCD::createSurface(721, 401);
+	QAS_LCD::setDrawSurface(QAH_SceneStatusPanel);
+	QAS_LCD::setDrawColor(0xF000);
+	QAS_LCD::clearBuffer();
+	QAS_LCD::setDrawColor(0xF003);
+	QAS_LCD::drawRectFill(QAT_Vector2_16(0, 0), QAT_Vector2_16(720, 400));
+	QAS_LCD::setDrawColor(0xFFFF);
+	QAS_LCD::drawRect(QAT_Vector2_16(10, 10), QAT_Vector2_16(710, 390));
+	QAS_LCD::setFontByIndex(1);
+	QAS_LCD::drawStrC(QAT_Vector2_16(360, 5), "SD Card Test");
+	QAS_LCD::drawStrL(QAT_Vector2_16(10, 40), "Card Present:");
+	QAS_LCD::drawStrL(QAT_Vector2_16(10, 70), "Card State:");
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+}
+
+static void QAH_SceneStatus_draw(uint32_t uFrame) {
+	static const char* strLabels[] = {"Card Size:", "Block Size:", "Block Count:", "Card Type:", "Card Version:", "Card Class:"};
+	static const int16_t iRows[]   = {150, 190, 220, 270, 300, 330};
+	char strLCD[32];
+
+	//Only the card details change between frames
+	if (uFrame)
+		QAS_LCD::invalidate(QAD_LTDC_Layer0, QAT_Vector2_16(40, 75), QAT_Vector2_16(760, 440));
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF333);
+	QAS_LCD::clearBuffer();
+	QAS_LCD::drawSurface(QAT_Vector2_16(40, 40), QAH_SceneStatusPanel);
+
+	QAS_LCD::setFontByIndex(1);
+	QAS_LCD::setDrawColor(0xFFFF);
+	QAS_LCD::drawStrL(QAT_Vector2_16(400, 80), "Card Present");
+	QAS_LCD::drawStrL(QAT_Vector2_16(400, 110), "Mounted");
+	for (uint8_t i=0; i<6; i++) {
+		QAS_LCD::drawStrL(QAT_Vector2_16(50, iRows[i]), strLabels[i]);
+		snprintf(strLCD, sizeof(strLCD), "%lu", (unsigned long)((uFrame + 1) * (i + 3) * 977));
+		QAS_LCD::drawStrL(QAT_Vector2_16(400, iRows[i]), strLCD);
+	}
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawColor(0x0000);
+	QAS_LCD::clearBuffer();
+}
+
+
+  //----------------
+  //Primitives Scene
+  //
+  //Every line, rectangle and curve primitive, drawn both without and with anti-aliasing
+
+static void QAH_ScenePrimitives_draw(uint32_t) {
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF124);
+	QAS_LCD::clearBuffer();
+
+	for (uint8_t uAA=0; uAA<2; uAA++) {
+		int16_t iX = uAA * 400;
+		QAS_LCD::setAntiAliasing(uAA ? QA_Active : QA_Inactive);
+
+		QAS_LCD::setDrawColor(0xFFFF);
+		for (int16_t i=0; i<8; i++)
+			QAS_LCD::drawLine(QAT_Vector2_16(iX + 10, 10), QAT_Vector2_16(iX + 10 + (i * 50), 10 + ((7 - i) * 20)));
+		QAS_LCD::setDrawColor(0xFF80);
+		QAS_LCD::drawRect(QAT_Vector2_16(iX + 20, 170), QAT_Vector2_16(iX + 120, 230));
+		QAS_LCD::drawRectFill(QAT_Vector2_16(iX + 140, 170), QAT_Vector2_16(iX + 240, 230));
+		QAS_LCD::setDrawColor(0xF4F8);
+		QAS_LCD::drawRoundRect(QAT_Vector2_16(iX + 260, 170), QAT_Vector2_16(iX + 380, 230), 12);
+		QAS_LCD::drawRoundRectFill(QAT_Vector2_16(iX + 20, 250), QAT_Vector2_16(iX + 120, 310), 20);
+		QAS_LCD::setDrawColor(0xF8CF);
+		QAS_LCD::drawCircle(QAT_Vector2_16(iX + 190, 280), 30);
+		QAS_LCD::drawCircleFill(QAT_Vector2_16(iX + 320, 280), 30);
+		QAS_LCD::setDrawColor(0xFF48);
+		QAS_LCD::drawEllipse(QAT_Vector2_16(iX + 70, 380), QAT_Vector2_16(50, 30));
+		QAS_LCD::drawEllipseFill(QAT_Vector2_16(iX + 190, 380), QAT_Vector2_16(30, 50));
+		QAS_LCD::setDrawColor(0xFFFF);
+		QAS_LCD::drawArc(QAT_Vector2_16(iX + 320, 380), 40, 30, 300);
+		QAS_LCD::setDrawColor(0xF0F0);
+		QAS_LCD::drawArcFill(QAT_Vector2_16(iX + 320, 380), 34, 20, -45, 200);
+	}
+	QAS_LCD::setAntiAliasing(QA_Inactive);
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawColor(0x0000);
+	QAS_LCD::clearBuffer();
+}
+
+
+  //----------
+  //Text Scene
+  //
+  //Text in each compiled-in font and alignment, on both an opaque layer 0 and a translucent area of layer 1
+
+static void QAH_SceneText_draw(uint32_t) {
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF000);
+	QAS_LCD::clearBuffer();
+
+	for (uint8_t i=0; i<QAS_LCD::getFontCount(); i++) {
+		int16_t iY = 20 + (i * 80);
+		QAS_LCD::setFontByIndex(i);
+		QAS_LCD::setDrawColor(0xFFFF);
+		QAS_LCD::drawStrL(QAT_Vector2_16(10, iY), "Left aligned 0123456789");
+		QAS_LCD::setDrawColor(0xFFC4);
+		QAS_LCD::drawStrC(QAT_Vector2_16(400, iY + 30), "The quick brown fox");
+		QAS_LCD::setDrawColor(0xF4CF);
+		QAS_LCD::drawStrR(QAT_Vector2_16(790, iY), "Right aligned !?");
+	}
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawColor(0x0000);
+	QAS_LCD::clearBuffer();
+	QAS_LCD::setDrawColor(0x8228);
+	QAS_LCD::drawRectFill(QAT_Vector2_16(100, 280), QAT_Vector2_16(700, 440));
+	QAS_LCD::setFontByIndex(1);
+	QAS_LCD::setDrawColor(0xFFFF);
+	QAS_LCD::drawStrC(QAT_Vector2_16(400, 300), "Overlay Text");
+	QAS_LCD::setDrawColor(0xAFF0);
+	QAS_LCD::drawStrC(QAT_Vector2_16(400, 360), "Translucent Overlay Text");
+}
+
+
+  //-----------
+  //Blend Scene
+  //
+  //Translucent fills and curves drawn with each software blend mode over a striped background, and an anti-aliased curve drawn
+  //with no blend mode over opaque pixels of a layer that stores alpha
+
+static void QAH_SceneBlend_draw(uint32_t) {
+	static const QAS_LCD_BlendMode eModes[] = {QAS_LCD_Blend_SrcOver, QAS_LCD_Blend_Add, QAS_LCD_Blend_Multiply};
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF222);
+	QAS_LCD::clearBuffer();
+	for (int16_t i=0; i<16; i++) {
+		QAS_LCD::setDrawColor((i & 1) ? 0xF8AC : 0xF3A5);
+		QAS_LCD::drawRectFill(QAT_Vector2_16(0, i * 30), QAT_Vector2_16(799, (i * 30) + 14));
+	}
+
+	for (uint8_t i=0; i<3; i++) {
+		int16_t iX = 20 + (i * 260);
+		QAS_LCD::setBlendMode(eModes[i]);
+		QAS_LCD::setDrawColor(0x9F40);
+		QAS_LCD::drawRectFill(QAT_Vector2_16(iX, 40), QAT_Vector2_16(iX + 220, 200));
+		QAS_LCD::setDrawColor(0x604F);
+		QAS_LCD::drawRectFill(QAT_Vector2_16(iX + 40, 120), QAT_Vector2_16(iX + 180, 260));
+		QAS_LCD::setAntiAliasing(QA_Active);
+		QAS_LCD::setDrawColor(0xC0F8);
+		QAS_LCD::drawCircleFill(QAT_Vector2_16(iX + 110, 350), 70);
+		QAS_LCD::setAntiAliasing(QA_Inactive);
+		QAS_LCD::setFontByIndex(1);
+		QAS_LCD::setDrawColor(0xBFFF);
+		QAS_LCD::drawStrC(QAT_Vector2_16(iX + 110, 430), "Blend");
+	}
+	QAS_LCD::setBlendMode(QAS_LCD_Blend_None);
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawColor(0x0000);
+	QAS_LCD::clearBuffer();
+
+	//Anti-aliased curve with no blend mode over opaque pixels of a layer that stores alpha, whose edges are still blended
+	QAS_LCD::setDrawColor(0xF00F);
+	QAS_LCD::drawRectFill(QAT_Vector2_16(766, 200), QAT_Vector2_16(799, 280));
+	QAS_LCD::setAntiAliasing(QA_Active);
+	QAS_LCD::setDrawColor(0xFFF0);
+	QAS_LCD::drawCircleFill(QAT_Vector2_16(782, 240), 14);
+	QAS_LCD::setAntiAliasing(QA_Inactive);
+}
+
+
+  //-----------
+  //Image Scene
+  //
+  //A generated image drawn with each blit mode, as a sub-rectangle, and run-length encoded
+
+#define QAH_SCENE_IMAGE_WIDTH   96
+#define QAH_SCENE_IMAGE_HEIGHT  64
+
+//Generated ARGB4444 image, with a transparent border, a color-key band, and an alpha gradient
+static uint16_t QAH_SceneImagePixels[QAH_SCENE_IMAGE_WIDTH * QAH_SCENE_IMAGE_HEIGHT];
+
+//Run-length encoded copy of the image
+static uint32_t QAH_SceneImageRLE[QAH_SCENE_IMAGE_WIDTH * QAH_SCENE_IMAGE_HEIGHT];
+
+static void QAH_SceneImage_setup(void) {
+	static bool bEncoded = false;
+	if (bEncoded)
+		return;
+	bEncoded = true;
+
+	for (uint16_t y=0; y<QAH_SCENE_IMAGE_HEIGHT; y++) {
+		for (uint16_t x=0; x<QAH_SCENE_IMAGE_WIDTH; x++) {
+			uint16_t uPxl;
+			if ((x < 8) || (x >= (QAH_SCENE_IMAGE_WIDTH - 8)))
+				uPxl = 0x0000;
+			else if ((y >= 28) && (y < 36))
+				uPxl = 0xFF0F;
+			else
+				uPxl = (uint16_t)(((x >> 3) << 12) | ((x & 0x0F) << 8) | ((y >> 2) << 4) | ((x ^ y) & 0x0F)) | 0x1000;
+			QAH_SceneImagePixels[(y * QAH_SCENE_IMAGE_WIDTH) + x] = uPxl;
+		}
+	}
+	QAS_LCD_RLE::encode(QAH_SceneImagePixels, QAH_SCENE_IMAGE_WIDTH, QAH_SCENE_IMAGE_HEIGHT, QAH_SCENE_IMAGE_WIDTH,
+			                (uint8_t*)QAH_SceneImageRLE, sizeof(QAH_SceneImageRLE));
+}
+
+static void QAH_SceneImage_draw(uint32_t) {
+	QAS_LCD_Image    cImage(QAH_SceneImagePixels, 0, QAH_SCENE_IMAGE_WIDTH, QAH_SCENE_IMAGE_HEIGHT, 0, 0xFF0F);
+	QAS_LCD_RLEImage cRLE(QAH_SceneImageRLE, 0);
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setDrawColor(0xF468);
+	QAS_LCD::clearBuffer();
+	QAS_LCD::setDrawColor(0xFEEE);
+	QAS_LCD::drawRectFill(QAT_Vector2_16(0, 240), QAT_Vector2_16(799, 479));
+
+	for (uint8_t i=0; i<2; i++) {
+		int16_t iY = 40 + (i * 240);
+		QAS_LCD::drawImage(QAT_Vector2_16(20, iY), cImage, QAS_LCD_Blit_Opaque);
+		QAS_LCD::drawImage(QAT_Vector2_16(140, iY), cImage, QAS_LCD_Blit_ColorKey);
+		QAS_LCD::drawImage(QAT_Vector2_16(260, iY), cImage, QAS_LCD_Blit_Alpha);
+		QAS_LCD::drawImageRect(QAT_Vector2_16(380, iY), cImage, QAT_Vector2_16(16, 8), QAT_Vector2_16(63, 47), QAS_LCD_Blit_Opaque);
+		QAS_LCD::drawImage(QAT_Vector2_16(460, iY), cRLE, QAS_LCD_Blit_Opaque);
+		QAS_LCD::drawImage(QAT_Vector2_16(580, iY), cRLE, QAS_LCD_Blit_Alpha);
+		QAS_LCD::drawImage(QAT_Vector2_16(760, iY + 100), cImage, QAS_LCD_Blit_Opaque);  //Clipped by right edge of the LCD
+	}
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawColor(0x0000);
+	QAS_LCD::clearBuffer();
+	QAS_LCD::drawImage(QAT_Vector2_16(20, 140), cImage, QAS_LCD_Blit_Opaque);
+	QAS_LCD::drawImage(QAT_Vector2_16(140, 140), cImage, QAS_LCD_Blit_Alpha);
+	QAS_LCD::drawImage(QAT_Vector2_16(260, 140), cRLE, QAS_LCD_Blit_Opaque);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//QAH_SceneList
+//Scenes that can be drawn
+static const QAH_SceneDesc QAH_SceneList[] = {
+	{"Status",     QAH_SceneStatus_setup, QAH_SceneStatus_draw},
+	{"Primitives", NULL,                  QAH_ScenePrimitives_draw},
+	{"Text",       NULL,                  QAH_SceneText_draw},
+	{"Blend",      NULL,                  QAH_SceneBlend_draw},
+	{"Image",      QAH_SceneImage_setup,  QAH_SceneImage_draw}
+};
+static const uint8_t QAH_SceneCount = sizeof(QAH_SceneList) / sizeof(QAH_SceneDesc);
+
+
+//QAH_SceneModeNames
+//Names of the rendering modes, in the order of QAH_SceneMode
+static const char* QAH_SceneModeNames[QAH_Scene_ModeCount] = {"Immediate", "DisplayList", "Tiled", "Accelerated", "Dirty"};
+
+
+//The rendering mode scenes are drawn in
+static QAH_SceneMode QAH_SceneCurrentMode = QAH_Scene_Immediate;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //-----------------------
+  //-----------------------
+  //QAH_Scene Data Methods
+
+//QAH_Scene::count
+//QAH_Scene Data Method
+//
+//Returns the number of scenes
+uint8_t QAH_Scene::count(void) {
+	return QAH_SceneCount;
+}
+
+
+//QAH_Scene::get
+//QAH_Scene Data Method
+//
+//Returns a scene
+//uIdx - Index of the scene. Must be less than count()
+const QAH_SceneDesc& QAH_Scene::get(uint8_t uIdx) {
+	return QAH_SceneList[uIdx];
+}
+
+
+//QAH_Scene::find
+//QAH_Scene Data Method
+//
+//Returns a pointer to the scene with the given name, or NULL if there is no such scene
+const QAH_SceneDesc* QAH_Scene::find(const char* strName) {
+	for (uint8_t i=0; i<QAH_SceneCount; i++) {
+		if (!strcmp(QAH_SceneList[i].strName, strName))
+			return &QAH_SceneList[i];
+	}
+	return NULL;
+}
+
+
+//QAH_Scene::getModeName
+//QAH_Scene Data Method
+//
+//Returns the name of a rendering mode
+const char* QAH_Scene::getModeName(QAH_SceneMode eMode) {
+	return (eMode < QAH_Scene_ModeCount) ? QAH_SceneModeNames[eMode] : "";
+}
+
+
+  //--------------------------
+  //--------------------------
+  //QAH_Scene Drawing Methods
+
+//QAH_Scene::setMode
+//QAH_Scene Drawing Method
+//
+//Used to select the rendering mode that scenes are drawn in, enabling or disabling the matching features of QAS_LCD
+//As the contents of the buffers are then unknown, the whole of both layers is invalidated
+//eMode - The rendering mode. Member of QAH_SceneMode enum
+void QAH_Scene::setMode(QAH_SceneMode eMode) {
+	QAS_LCD::setTiledRendering((eMode >= QAH_Scene_Tiled) ? QA_Active : QA_Inactive);
+	QAS_LCD::setAcceleration((eMode >= QAH_Scene_Accelerated) ? QA_Active : QA_Inactive);
+	QAS_LCD::setDirtyTracking((eMode == QAH_Scene_Dirty) ? QA_Active : QA_Inactive);
+	QAS_LCD::setAutoWindow(QAD_LTDC_Layer1, (eMode == QAH_Scene_Dirty) ? QA_Active : QA_Inactive);
+	QAS_LCD::invalidateLayer(QAD_LTDC_Layer0);
+	QAS_LCD::invalidateLayer(QAD_LTDC_Layer1);
+	QAH_SceneCurrentMode = eMode;
+}
+
+
+//QAH_Scene::begin
+//QAH_Scene Drawing Method
+//
+//Used before the first frame of a scene is drawn, to set up the scene and invalidate the whole of both layers
+//The next frame is then always drawn in full, even if its display list matches the frame currently being displayed
+//sScene - The scene
+void QAH_Scene::begin(const QAH_SceneDesc& sScene) {
+	QAS_LCD::setBlendMode(QAS_LCD_Blend_None);
+	QAS_LCD::setAntiAliasing(QA_Inactive);
+	if (sScene.pSetup)
+		sScene.pSetup();
+	QAS_LCD::invalidateLayer(QAD_LTDC_Layer0);
+	QAS_LCD::invalidateLayer(QAD_LTDC_Layer1);
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::expose(QAT_Vector2_16(0, 0), QAT_Vector2_16(QAD_LTDC_WIDTH - 1, QAD_LTDC_HEIGHT - 1));
+}
+
+
+//QAH_Scene::draw
+//QAH_Scene Drawing Method
+//
+//Used to draw a frame of a scene in the current rendering mode, and present it on both layers
+//sScene - The scene
+//uFrame - The frame of the scene to be drawn, starting from 0
+//Returns true if the frame was drawn, or false if its display list matched the previous frame and drawing was skipped
+bool QAH_Scene::draw(const QAH_SceneDesc& sScene, uint32_t uFrame) {
+	if (QAH_SceneCurrentMode == QAH_Scene_Immediate) {
+		sScene.pDraw(uFrame);
+		QAS_LCD::flipLayer0();
+		QAS_LCD::flipLayer1();
+		return true;
+	}
+
+	QAS_LCD::beginDisplayList();
+	sScene.pDraw(uFrame);
+	return QAS_LCD::endDisplayList();
+}
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Test Scenes                                 */
+/*   Filename: QAH_Scene.hpp                                               */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAH_SCENE_HPP_
+#define __QAH_SCENE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD.hpp"
+
+
+  //NOTE:
+  //Scenes are the frames drawn by the host frame dump tool, golden-image tests and benchmarks. Each scene draws a complete frame
+  //onto both layers, and can be drawn in any of the rendering modes of QAS_LCD, which must all produce the same pixels.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAH_SceneMode
+//
+//Enum describing the rendering modes a scene can be drawn in
+enum QAH_SceneMode : uint8_t {
+	QAH_Scene_Immediate = 0,  //Drawn straight into the back buffers, which are then flipped
+	QAH_Scene_DisplayList,    //Recorded into a display list, which is then played back into the back buffers
+	QAH_Scene_Tiled,          //Recorded into a display list, which is played back one tile at a time (see QAS_LCD_Tile.hpp)
+	QAH_Scene_Accelerated,    //As QAH_Scene_Tiled, with fills, blits and tile write-backs performed by the DMA2D (see QAS_LCD_Accel.hpp)
+	QAH_Scene_Dirty,          //As QAH_Scene_Accelerated, with dirty rectangle tracking and automatic windowing of layer 1, as on the board
+	QAH_Scene_ModeCount
+};
+
+
+//-------------
+//QAH_SceneDesc
+//
+//Structure describing a scene
+typedef struct {
+	const char* strName;                //Name of the scene
+	void (*pSetup)(void);               //Creates any surfaces or images used by the scene, once only. Called by begin()
+	void (*pDraw)(uint32_t uFrame);     //Draws a frame of the scene onto both layers. Scenes may change between frames
+} QAH_SceneDesc;
+
+
+//---------
+//QAH_Scene
+//
+//Static class providing the scenes, and methods used to draw them
+class QAH_Scene {
+public:
+
+	//------------
+	//Constructors
+
+	QAH_Scene() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAH_Scene.cpp for details of the following methods
+
+	//------------
+	//Data Methods
+
+	static uint8_t count(void);
+	static const QAH_SceneDesc& get(uint8_t uIdx);
+	static const QAH_SceneDesc* find(const char* strName);
+	static const char* getModeName(QAH_SceneMode eMode);
+
+
+	//---------------
+	//Drawing Methods
+
+	static void setMode(QAH_SceneMode eMode);
+	static void begin(const QAH_SceneDesc& sScene);
+	static bool draw(const QAH_SceneDesc& sScene, uint32_t uFrame);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAH_SCENE_HPP_ */
@@ -0,0 +1,174 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Tests                                       */
+/*   Filename: QAH_Test.cpp                                                */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Static members
+QAH_Test* QAH_Test::m_pFirst    = NULL;
+QAH_Test* QAH_Test::m_pLast     = NULL;
+uint32_t  QAH_Test::m_uFailures = 0;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //---------------------
+  //---------------------
+  //QAH_Test Constructors
+
+//QAH_Test::QAH_Test
+//QAH_Test Constructor
+//
+//Used by QAH_TEST() to add a test to the end of the list of tests
+//strSuite - Name of the suite the test belongs to
+//strName  - Name of the test
+//pFunc    - Function holding the body of the test
+QAH_Test::QAH_Test(const char* strSuite, const char* strName, QAH_TestFunc pFunc) :
+	m_strSuite(strSuite),
+	m_strName(strName),
+	m_pFunc(pFunc),
+	m_pNext(NULL) {
+
+	if (m_pLast)
+		m_pLast->m_pNext = this; else
+		m_pFirst = this;
+	m_pLast = this;
+}
+
+
+  //--------------------
+  //--------------------
+  //QAH_Test Run Methods
+
+//QAH_Test::run
+//QAH_Test Run Method
+//
+//Used to run each test of a suite in the order they were declared, reporting the result of each test
+//strSuite - Name of the suite to be run
+//Returns the number of failed tests, or 1 if the suite has no tests
+uint32_t QAH_Test::run(const char* strSuite) {
+	uint32_t uTests  = 0;
+	uint32_t uFailed = 0;
+
+	for (QAH_Test* pTest = m_pFirst; pTest; pTest = pTest->m_pNext) {
+		if (strcmp(pTest->m_strSuite, strSuite))
+			continue;
+
+		m_uFailures = 0;
+		pTest->m_pFunc();
+		printf("%-6s %s.%s\n", m_uFailures ? "FAIL" : "ok", pTest->m_strSuite, pTest->m_strName);
+		uTests++;
+		if (m_uFailures)
+			uFailed++;
+	}
+
+	if (!uTests) {
+		printf("QAH_Test: unknown suite %s\n", strSuite);
+		return 1;
+	}
+	printf("%s: %u of %u tests passed\n", strSuite, uTests - uFailed, uTests);
+	return uFailed;
+}
+
+
+//QAH_Test::list
+//QAH_Test Run Method
+//
+//Used to print the name of every suite, once each
+void QAH_Test::list(void) {
+	for (QAH_Test* pTest = m_pFirst; pTest; pTest = pTest->m_pNext) {
+		QAH_Test* pPrev = m_pFirst;
+		while ((pPrev != pTest) && strcmp(pPrev->m_strSuite, pTest->m_strSuite))
+			pPrev = pPrev->m_pNext;
+		if (pPrev == pTest)
+			printf("  %s\n", pTest->m_strSuite);
+	}
+}
+
+
+  //----------------------
+  //----------------------
+  //QAH_Test Check Methods
+
+//QAH_Test::check
+//QAH_Test Check Method
+//
+//To be called through QAH_CHECK()
+//Used to record a failure of the test being run if an expression is false
+//bResult - The result of the expression
+//strExpr - The expression, as written in the test
+//strFile - The file and line of the check
+//iLine
+//Returns bResult
+bool QAH_Test::check(bool bResult, const char* strExpr, const char* strFile, int iLine) {
+	if (!bResult) {
+		printf("  %s:%d: check failed: %s\n", strFile, iLine, strExpr);
+		m_uFailures++;
+	}
+	return bResult;
+}
+
+
+//QAH_Test::checkEqual
+//QAH_Test Check Method
+//
+//To be called through QAH_CHECK_EQUAL()
+//Used to record a failure of the test being run if two values are not equal
+//iActual   - The value produced by the test
+//iExpected - The value expected by the test
+//strExpr   - The comparison, as written in the test
+//strFile   - The file and line of the check
+//iLine
+//Returns true if the values are equal
+bool QAH_Test::checkEqual(int64_t iActual, int64_t iExpected, const char* strExpr, const char* strFile, int iLine) {
+	if (iActual != iExpected) {
+		printf("  %s:%d: check failed: %s (%lld != %lld)\n", strFile, iLine, strExpr, (long long)iActual, (long long)iExpected);
+		m_uFailures++;
+	}
+	return (iActual == iExpected);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//main
+//Host Test Entry Point
+//
+//Used to run a single suite of tests, named by the first argument
+//Returns 0 if every test of the suite passed, otherwise 1
+int main(int argc, char* argv[]) {
+	if (argc != 2) {
+		printf("usage: QAH_Tests <suite>\n");
+		QAH_Test::list();
+		return 1;
+	}
+	return QAH_Test::run(argv[1]) ? 1 : 0;
+}
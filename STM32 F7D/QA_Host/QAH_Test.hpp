@@ -0,0 +1,110 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Tests                                       */
+/*   Filename: QAH_Test.hpp                                                */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAH_TEST_HPP_
+#define __QAH_TEST_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+
+  //NOTE:
+  //Host tests are built by QA_Host/CMakeLists.txt and are only built for a desktop host (see setup.hpp).
+  //
+  //Each test is a function declared with QAH_TEST(), which registers it under a suite and a name. Tests are grouped into suites,
+  //with each suite being run as a separate ctest test in its own process, as QAS_LCD and the drivers beneath it are singletons
+  //whose state carries over from one test to the next. The tests of a suite are run in the order they are declared in.
+  //
+  //A test records a failure through the QAH_CHECK() and QAH_CHECK_EQUAL() macros, and carries on running so that every failed
+  //check of the test is reported.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------
+//QAH_Test
+//
+//Class used to register and run host tests
+//An instance is created by QAH_TEST() for each test, which adds itself to the list of tests when constructed
+class QAH_Test {
+public:
+
+	//Function holding the body of a test
+	typedef void (*QAH_TestFunc)(void);
+
+private:
+
+	const char*  m_strSuite;  //Name of the suite the test belongs to
+	const char*  m_strName;   //Name of the test
+	QAH_TestFunc m_pFunc;     //Function holding the body of the test
+	QAH_Test*    m_pNext;     //Next test in the list of tests
+
+	static QAH_Test* m_pFirst;     //First and last tests in the list of tests
+	static QAH_Test* m_pLast;
+	static uint32_t  m_uFailures;  //Number of failed checks of the test being run
+
+public:
+
+	//------------
+	//Constructors
+
+	QAH_Test(const char* strSuite, const char* strName, QAH_TestFunc pFunc);
+
+
+	//NOTE: See QAH_Test.cpp for details of the following methods
+
+	//-----------
+	//Run Methods
+
+	static uint32_t run(const char* strSuite);
+	static void list(void);
+
+
+	//-------------
+	//Check Methods
+
+	static bool check(bool bResult, const char* strExpr, const char* strFile, int iLine);
+	static bool checkEqual(int64_t iActual, int64_t iExpected, const char* strExpr, const char* strFile, int iLine);
+
+};
+
+
+//---------------
+//QAH_Test Macros
+
+//Declares a test, being followed by the body of the test
+//suite - Name of the suite the test belongs to
+//name  - Name of the test, which must be unique within the suite
+#define QAH_TEST(suite, name)                                                                  \
+	static void QAH_Test_##suite##_##name(void);                                                 \
+	static QAH_Test QAH_TestReg_##suite##_##name(#suite, #name, QAH_Test_##suite##_##name);      \
+	static void QAH_Test_##suite##_##name(void)
+
+//Records a failure if an expression is false. Returns the result of the expression
+#define QAH_CHECK(expr)                     QAH_Test::check((expr), #expr, __FILE__, __LINE__)
+
+//Records a failure if two integer values are not equal, reporting both values. Returns true if the values are equal
+#define QAH_CHECK_EQUAL(actual, expected)   QAH_Test::checkEqual((int64_t)(actual), (int64_t)(expected), #actual " == " #expected, __FILE__, __LINE__)
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAH_TEST_HPP_ */
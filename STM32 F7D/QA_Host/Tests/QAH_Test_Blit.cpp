@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Image Blit Tests                            */
+/*   Filename: QAH_Test_Blit.cpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAS_LCD.hpp"
+
+
+  //NOTE:
+  //The blit tests draw images stored in a plain byte array, standing in for the QuadSPI flash in memory-mapped mode, onto the back
+  //buffer of layer 0 over pseudo-random pixels. Every pixel of the buffer is then compared against the result of blending each
+  //source pixel one at a time, so that pixels outside of the image must be left unchanged.
+  //
+  //The image starts half way through a word, and is drawn at odd positions with an odd width and a stride wider than the image, so
+  //that the ends of each row are not aligned to the words copied by the row kernels. Each test is run both with and without acceleration.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Size of the image, and number of pixels between the start of each of its lines
+#define QAH_BLIT_WIDTH   37
+#define QAH_BLIT_HEIGHT  19
+#define QAH_BLIT_STRIDE  41
+
+//Offset in bytes of the upper-left pixel of the image from the start of the mapped region
+#define QAH_BLIT_OFFSET  0x0102
+
+//Color of the pixels skipped by color keyed blits
+#define QAH_BLIT_KEY     0xF0F0
+
+
+//Byte array standing in for the memory-mapped QuadSPI flash, holding the image
+static uint8_t QAH_BlitRegion[QAH_BLIT_OFFSET + (QAH_BLIT_STRIDE * QAH_BLIT_HEIGHT * 2)] __attribute__((aligned(4)));
+
+//Pixels of the back buffer expected once the image has been drawn
+static uint16_t QAH_BlitExpected[QAD_LTDC_PIXELCOUNT];
+
+
+//Used to fill the mapped region with the image, and the back buffer of layer 0 with pseudo-random pixels
+//Every seventh pixel of the image is the color key, and the remaining pixels cover the full range of alpha values
+//Returns a descriptor of the image
+static QAS_LCD_Image QAH_Blit_begin(void) {
+	uint16_t* pImage  = (uint16_t*)&QAH_BlitRegion[QAH_BLIT_OFFSET];
+	uint16_t* pBuffer = (uint16_t*)QAD_LTDC::getLayer0BackBufferPtr();
+	uint32_t  uSeed   = 1;
+
+	for (uint32_t i=0; i<(QAH_BLIT_STRIDE * QAH_BLIT_HEIGHT); i++) {
+		uSeed = (uSeed * 1103515245) + 12345;
+		pImage[i] = (i % 7) ? (uint16_t)(uSeed >> 16) : QAH_BLIT_KEY;
+	}
+	for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++) {
+		uSeed = (uSeed * 1103515245) + 12345;
+		pBuffer[i] = QAH_BlitExpected[i] = (uint16_t)(uSeed >> 16);
+	}
+
+	QAS_LCD::setDrawBuffer(QAD_LTDC_Layer0);
+	QAS_LCD::setBlendMode(QAS_LCD_Blend_None);
+	return QAS_LCD_Image(QAH_BlitRegion, QAH_BLIT_OFFSET, QAH_BLIT_WIDTH, QAH_BLIT_HEIGHT, QAH_BLIT_STRIDE, QAH_BLIT_KEY);
+}
+
+
+//Used to work out the pixels expected once a portion of the image has been drawn, blending one pixel at a time
+//The portion is clipped by the edges of the LCD
+//cImage - The image
+//cPos   - Position of the upper-left pixel of the portion of the image
+//cSrc   - The portion of the image, in image coordinates
+//eMode  - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum
+static void QAH_Blit_expect(const QAS_LCD_Image& cImage, QAT_Vector2_16 cPos, const QAT_Rect_16& cSrc, QAS_LCD_BlitMode eMode) {
+	for (int16_t y=cSrc.y0; y<=cSrc.y1; y++) {
+		for (int16_t x=cSrc.x0; x<=cSrc.x1; x++) {
+			int16_t iX = cPos.x + (x - cSrc.x0);
+			int16_t iY = cPos.y + (y - cSrc.y0);
+			if ((iX < 0) || (iY < 0) || (iX >= QAD_LTDC_WIDTH) || (iY >= QAD_LTDC_HEIGHT))
+				continue;
+
+			uint16_t  uSrc = *cImage.pixel(x, y);
+			uint16_t& uDst = QAH_BlitExpected[iX + (iY * QAD_LTDC_WIDTH)];
+			switch (eMode) {
+			  case (QAS_LCD_Blit_Opaque):
+			  	uDst = uSrc;
+			  	break;
+			  case (QAS_LCD_Blit_ColorKey):
+			  	if (uSrc != QAH_BLIT_KEY)
+			  		uDst = uSrc;
+			  	break;
+			  case (QAS_LCD_Blit_Alpha):
+			  	uDst = QAS_LCD_Blend::pixel(uDst, uSrc, QAS_LCD_Blend_SrcOver);
+			  	break;
+			}
+		}
+	}
+}
+
+
+//Used to check every pixel of the back buffer of layer 0 against the expected pixels
+//Waits for any blits queued as DMA2D jobs to complete first, as they write the buffer behind the CPU's back
+//Returns the number of pixels that differ
+static uint32_t QAH_Blit_compare(void) {
+	const uint16_t* pBuffer = (const uint16_t*)QAD_LTDC::getLayer0BackBufferPtr();
+	uint32_t        uDiffer = 0;
+
+	QAD_DMA2D::wait();
+
+	for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++) {
+		if (pBuffer[i] != QAH_BlitExpected[i])
+			uDiffer++;
+	}
+	return uDiffer;
+}
+
+
+//Used to draw the whole of the image at a set of positions, in a given blit mode, with and without acceleration
+//eMode - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum
+static void QAH_Blit_drawAt(QAS_LCD_BlitMode eMode) {
+	static const QAT_Vector2_16 cPositions[] = {
+		QAT_Vector2_16(0, 0), QAT_Vector2_16(1, 3), QAT_Vector2_16(102, 57), QAT_Vector2_16(351, 200)
+	};
+	if (!QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK))
+		return;
+
+	for (uint8_t uAccel=0; uAccel<2; uAccel++) {
+		QAS_LCD::setAcceleration(uAccel ? QA_Active : QA_Inactive);
+		QAS_LCD_Image cImage = QAH_Blit_begin();
+		for (const QAT_Vector2_16& cPos : cPositions) {
+			QAS_LCD::drawImage(cPos, cImage, eMode);
+			QAH_Blit_expect(cImage, cPos, QAT_Rect_16(0, 0, QAH_BLIT_WIDTH-1, QAH_BLIT_HEIGHT-1), eMode);
+		}
+		QAH_CHECK_EQUAL(QAH_Blit_compare(), 0);
+	}
+	QAS_LCD::setAcceleration(QA_Inactive);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Opaque blits copy every pixel of the image, and nothing else
+QAH_TEST(Blit, Opaque) {
+	QAH_Blit_drawAt(QAS_LCD_Blit_Opaque);
+}
+
+
+//Color keyed blits copy every pixel of the image other than those matching the color key
+QAH_TEST(Blit, ColorKey) {
+	QAH_Blit_drawAt(QAS_LCD_Blit_ColorKey);
+}
+
+
+//Alpha blits blend each pixel of the image over the buffer, matching QAS_LCD_Blend::pixel()
+QAH_TEST(Blit, Alpha) {
+	QAH_Blit_drawAt(QAS_LCD_Blit_Alpha);
+}
+
+
+//Portions of the image are drawn from the requested source rectangle, clipped by the image and by the edges of the LCD, with the
+//source offset by the amount clipped from the left and top
+QAH_TEST(Blit, SubRect) {
+	if (!QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK))
+		return;
+
+	for (uint8_t uAccel=0; uAccel<2; uAccel++) {
+		QAS_LCD::setAcceleration(uAccel ? QA_Active : QA_Inactive);
+		QAS_LCD_Image cImage = QAH_Blit_begin();
+
+		//Within the LCD
+		QAS_LCD::drawImageRect(QAT_Vector2_16(203, 101), cImage, QAT_Vector2_16(5, 3), QAT_Vector2_16(30, 16), QAS_LCD_Blit_Opaque);
+		QAH_Blit_expect(cImage, QAT_Vector2_16(203, 101), QAT_Rect_16(5, 3, 30, 16), QAS_LCD_Blit_Opaque);
+
+		//Source rectangle extending beyond the image
+		QAS_LCD::drawImageRect(QAT_Vector2_16(301, 151), cImage, QAT_Vector2_16(20, 10), QAT_Vector2_16(60, 40), QAS_LCD_Blit_ColorKey);
+		QAH_Blit_expect(cImage, QAT_Vector2_16(301, 151), QAT_Rect_16(20, 10, QAH_BLIT_WIDTH-1, QAH_BLIT_HEIGHT-1), QAS_LCD_Blit_ColorKey);
+
+		//Clipped by the left and top, and by the right and bottom, edges of the LCD
+		QAS_LCD::drawImageRect(QAT_Vector2_16(-7, -4), cImage, QAT_Vector2_16(1, 1), QAT_Vector2_16(35, 17), QAS_LCD_Blit_Alpha);
+		QAH_Blit_expect(cImage, QAT_Vector2_16(-7, -4), QAT_Rect_16(1, 1, 35, 17), QAS_LCD_Blit_Alpha);
+		QAS_LCD::drawImage(QAT_Vector2_16(QAD_LTDC_WIDTH-11, QAD_LTDC_HEIGHT-6), cImage, QAS_LCD_Blit_Opaque);
+		QAH_Blit_expect(cImage, QAT_Vector2_16(QAD_LTDC_WIDTH-11, QAD_LTDC_HEIGHT-6), QAT_Rect_16(0, 0, QAH_BLIT_WIDTH-1, QAH_BLIT_HEIGHT-1),
+				            QAS_LCD_Blit_Opaque);
+
+		QAH_CHECK_EQUAL(QAH_Blit_compare(), 0);
+	}
+	QAS_LCD::setAcceleration(QA_Inactive);
+}
@@ -0,0 +1,345 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - DMA2D Driver Tests                          */
+/*   Filename: QAH_Test_DMA2D.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAD_DMA2D.hpp"
+#include "QAS_LCD_Accel.hpp"
+
+#include <string.h>
+
+
+  //NOTE:
+  //On a host, queued jobs are only performed when the CPU waits for the queue, either through wait() or when submitting a job to a
+  //full queue (see QAD_DMA2D_Host.cpp). The queue tests rely on this to fill the queue, and to check the order that jobs are
+  //performed in from the pixels that they write.
+  //
+  //The kernel tests draw the same rectangles with the accelerated kernels of QAS_LCD_RasterAccel and the CPU kernels of
+  //QAS_LCD_RasterFormat, which must write the same pixels, other than blended pixels which may differ by one step of the target
+  //format (see QAS_LCD_Accel.hpp).
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Size of the rectangles drawn by the kernel tests, being large enough for kernels to be queued
+#define QAH_DMA2D_WIDTH   40
+#define QAH_DMA2D_HEIGHT  24
+#define QAH_DMA2D_STRIDE  48
+#define QAH_DMA2D_PIXELS  (QAH_DMA2D_STRIDE * QAH_DMA2D_HEIGHT)
+
+
+//Pixels written by the tests
+static uint16_t QAH_DMA2DAccel[QAH_DMA2D_PIXELS];
+static uint16_t QAH_DMA2DCpu[QAH_DMA2D_PIXELS];
+static uint16_t QAH_DMA2DSrc[QAH_DMA2D_PIXELS];
+
+//Pixels written by the ARGB8888 kernel tests
+static uint32_t QAH_DMA2DAccel32[QAH_DMA2D_PIXELS];
+static uint32_t QAH_DMA2DCpu32[QAH_DMA2D_PIXELS];
+
+
+//Used to reset the driver to an empty queue with zeroed job counters
+static void QAH_DMA2D_reset(void) {
+	QAD_DMA2D::init();
+	QAD_DMA2D::wait();
+	QAD_DMA2D::resetStats();
+}
+
+
+//Used to fill an array of pixels with repeatable pseudo-random values
+//pPixels - The pixels
+//uCount  - The number of pixels
+//uSeed   - The starting value of the generator
+static void QAH_DMA2D_random(uint16_t* pPixels, uint32_t uCount, uint32_t uSeed) {
+	for (uint32_t i=0; i<uCount; i++) {
+		uSeed = (uSeed * 1103515245) + 12345;
+		pPixels[i] = (uint16_t)(uSeed >> 16);
+	}
+}
+
+
+//Returns the number of RGB565 pixels whose red, green or blue components differ by more than one step
+static uint32_t QAH_DMA2D_compareRGB565(const uint16_t* pA, const uint16_t* pB, uint32_t uCount) {
+	uint32_t uDiffers = 0;
+	for (uint32_t i=0; i<uCount; i++) {
+		int iR = (int)(pA[i] >> 11) - (int)(pB[i] >> 11);
+		int iG = (int)((pA[i] >> 5) & 0x3F) - (int)((pB[i] >> 5) & 0x3F);
+		int iB = (int)(pA[i] & 0x1F) - (int)(pB[i] & 0x1F);
+		if ((iR < -1) || (iR > 1) || (iG < -1) || (iG > 1) || (iB < -1) || (iB > 1))
+			uDiffers++;
+	}
+	return uDiffers;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //----------
+  //Job Checks
+
+//Jobs that the engine cannot perform are rejected, so that the caller performs the operation itself
+QAH_TEST(DMA2D, Rejects) {
+	QAD_DMA2D::deinit();
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, 16, 16, 16, QAD_DMA2D_RGB565, 0), QA_Fail);
+
+	QAH_DMA2D_reset();
+
+	//Stride less than width, of the destination and of the source
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, 15, 16, 16, QAD_DMA2D_RGB565, 0), QA_Fail);
+	QAH_CHECK_EQUAL(QAD_DMA2D::copy(QAH_DMA2DAccel, 16, QAH_DMA2DSrc, 15, 16, 16, QAD_DMA2D_RGB565), QA_Fail);
+
+	//Gap between lines, or width, larger than the engine's registers can hold
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, QAD_DMA2D_MAXLENGTH + 2, 1, 1, QAD_DMA2D_RGB565, 0), QA_Fail);
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, QAD_DMA2D_MAXLENGTH + 1, QAD_DMA2D_MAXLENGTH + 1, 1, QAD_DMA2D_RGB565, 0), QA_Fail);
+
+	//Destination and source not aligned to their pixels
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(&((uint8_t*)QAH_DMA2DAccel)[1], 16, 16, 16, QAD_DMA2D_RGB565, 0), QA_Fail);
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(&((uint8_t*)QAH_DMA2DAccel)[2], 16, 8, 8, QAD_DMA2D_ARGB8888, 0), QA_Fail);
+	QAH_CHECK_EQUAL(QAD_DMA2D::copy(QAH_DMA2DAccel, 16, &((uint8_t*)QAH_DMA2DSrc)[1], 16, 16, 16, QAD_DMA2D_ARGB4444), QA_Fail);
+
+	//Copy between formats, which requires a convert job
+	QAH_CHECK_EQUAL(QAD_DMA2D::submit({QAD_DMA2D_Copy, QAD_DMA2D_RGB565, QAD_DMA2D_ARGB4444, QAD_DMA2D_RGB565, 255, 16, 16,
+	                                   QAH_DMA2DAccel, 16, QAH_DMA2DSrc, 16, NULL, 0, 0}), QA_Fail);
+
+	//Nothing is queued by rejected jobs, while empty jobs succeed without being queued
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, 16, 0, 16, QAD_DMA2D_RGB565, 0), QA_OK);
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, 16, 16, 0, QAD_DMA2D_RGB565, 0), QA_OK);
+	QAH_CHECK_EQUAL(QAD_DMA2D::pending(), 0);
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 0);
+
+	//Aligned pixels, and the largest gap between lines, are accepted
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(&((uint8_t*)QAH_DMA2DAccel)[4], 4, 4, 1, QAD_DMA2D_ARGB8888, 0), QA_OK);
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(QAH_DMA2DAccel, QAD_DMA2D_MAXLENGTH + 1, 1, 1, QAD_DMA2D_RGB565, 0), QA_OK);
+	QAH_CHECK_EQUAL(QAD_DMA2D::pending(), 2);
+	QAD_DMA2D::wait();
+}
+
+
+  //-----------
+  //Queue Tests
+
+//Submitting to a full queue stalls until the oldest job has completed, leaving the other jobs queued
+QAH_TEST(DMA2D, QueueFull) {
+	QAH_DMA2D_reset();
+	memset(QAH_DMA2DAccel, 0, sizeof(QAH_DMA2DAccel));
+
+	for (uint16_t i=0; i<QAD_DMA2D_QUEUELENGTH; i++)
+		QAH_CHECK_EQUAL(QAD_DMA2D::fill(&QAH_DMA2DAccel[i], 1, 1, 1, QAD_DMA2D_RGB565, i + 1), QA_OK);
+
+	QAD_DMA2D_Stats sStats = QAD_DMA2D::getStats();
+	QAH_CHECK_EQUAL(QAD_DMA2D::pending(), QAD_DMA2D_QUEUELENGTH);
+	QAH_CHECK_EQUAL(sStats.uStalls, 0);
+	QAH_CHECK_EQUAL(sStats.uCompleted, 0);
+	QAH_CHECK_EQUAL(QAH_DMA2DAccel[0], 0);
+
+	//The next job waits for the first job only
+	QAH_CHECK_EQUAL(QAD_DMA2D::fill(&QAH_DMA2DAccel[QAD_DMA2D_QUEUELENGTH], 1, 1, 1, QAD_DMA2D_RGB565, QAD_DMA2D_QUEUELENGTH + 1), QA_OK);
+	sStats = QAD_DMA2D::getStats();
+	QAH_CHECK_EQUAL(QAD_DMA2D::pending(), QAD_DMA2D_QUEUELENGTH);
+	QAH_CHECK_EQUAL(sStats.uStalls, 1);
+	QAH_CHECK_EQUAL(sStats.uCompleted, 1);
+	QAH_CHECK_EQUAL(sStats.uPeak, QAD_DMA2D_QUEUELENGTH);
+	QAH_CHECK_EQUAL(sStats.uWaits, 0);
+	QAH_CHECK_EQUAL(QAH_DMA2DAccel[0], 1);
+	QAH_CHECK_EQUAL(QAH_DMA2DAccel[1], 0);
+
+	QAD_DMA2D::wait();
+	sStats = QAD_DMA2D::getStats();
+	QAH_CHECK_EQUAL(QAD_DMA2D::pending(), 0);
+	QAH_CHECK_EQUAL(sStats.uJobs, QAD_DMA2D_QUEUELENGTH + 1);
+	QAH_CHECK_EQUAL(sStats.uCompleted, QAD_DMA2D_QUEUELENGTH + 1);
+	QAH_CHECK_EQUAL(sStats.uPixels, QAD_DMA2D_QUEUELENGTH + 1);
+	QAH_CHECK_EQUAL(sStats.uWaits, 1);
+	for (uint16_t i=0; i<=QAD_DMA2D_QUEUELENGTH; i++)
+		QAH_CHECK_EQUAL(QAH_DMA2DAccel[i], i + 1);
+}
+
+
+//Jobs are performed in the order they were submitted while the queue wraps around the end of its array. Each job writes two
+//pixels, the second of which is overwritten by the next job, so each pixel is left with the value of the last job that wrote it
+QAH_TEST(DMA2D, QueueWrap) {
+	QAH_DMA2D_reset();
+	memset(QAH_DMA2DAccel, 0, sizeof(QAH_DMA2DAccel));
+
+	uint32_t uJob = 0;
+	for (uint8_t uBatch=0; uBatch<5; uBatch++) {
+		uint8_t uCount = (uBatch & 1) ? 11 : 7;
+		for (uint8_t i=0; i<uCount; i++) {
+			uJob++;
+			QAH_CHECK_EQUAL(QAD_DMA2D::fill(&QAH_DMA2DAccel[uJob], 2, 2, 1, QAD_DMA2D_RGB565, uJob), QA_OK);
+		}
+		QAH_CHECK_EQUAL(QAD_DMA2D::pending(), uCount);
+
+		QAD_DMA2D::wait();
+		for (uint32_t i=1; i<=uJob; i++)
+			QAH_CHECK_EQUAL(QAH_DMA2DAccel[i], i);
+		QAH_CHECK_EQUAL(QAH_DMA2DAccel[uJob + 1], uJob);
+	}
+
+	QAD_DMA2D_Stats sStats = QAD_DMA2D::getStats();
+	QAH_CHECK_EQUAL(sStats.uJobs, uJob);
+	QAH_CHECK_EQUAL(sStats.uCompleted, uJob);
+	QAH_CHECK_EQUAL(sStats.uStalls, 0);
+	QAH_CHECK_EQUAL(sStats.uWaits, 5);
+	QAH_CHECK_EQUAL(sStats.uPeak, 11);
+}
+
+
+  //---------
+  //Job Tests
+
+//Copies read each line forwards, so a copy to one pixel after its source repeats the first pixel of each line as the engine does,
+//rather than moving the line as memmove() would
+QAH_TEST(DMA2D, CopyForwards) {
+	QAH_DMA2D_reset();
+	for (uint16_t i=0; i<QAH_DMA2D_PIXELS; i++)
+		QAH_DMA2DAccel[i] = i;
+
+	QAH_CHECK_EQUAL(QAD_DMA2D::copy(&QAH_DMA2DAccel[1], QAH_DMA2D_STRIDE, QAH_DMA2DAccel, QAH_DMA2D_STRIDE, 8, 2, QAD_DMA2D_RGB565), QA_OK);
+	QAD_DMA2D::wait();
+
+	for (uint16_t y=0; y<2; y++) {
+		for (uint16_t x=0; x<=8; x++)
+			QAH_CHECK_EQUAL(QAH_DMA2DAccel[(y * QAH_DMA2D_STRIDE) + x], y * QAH_DMA2D_STRIDE);
+		QAH_CHECK_EQUAL(QAH_DMA2DAccel[(y * QAH_DMA2D_STRIDE) + 9], (y * QAH_DMA2D_STRIDE) + 9);
+	}
+
+	//Copies that read ahead of what they write match memmove()
+	QAH_CHECK_EQUAL(QAD_DMA2D::copy(QAH_DMA2DAccel, QAH_DMA2D_STRIDE, &QAH_DMA2DAccel[(2 * QAH_DMA2D_STRIDE) + 1], QAH_DMA2D_STRIDE, 8, 1,
+	                                QAD_DMA2D_RGB565), QA_OK);
+	QAD_DMA2D::wait();
+	for (uint16_t x=0; x<8; x++)
+		QAH_CHECK_EQUAL(QAH_DMA2DAccel[x], (2 * QAH_DMA2D_STRIDE) + 1 + x);
+}
+
+
+  //------------
+  //Kernel Tests
+
+//Fills with no blend mode and with source-over blending of an opaque color match the CPU kernels exactly
+QAH_TEST(DMA2D, KernelFill) {
+	typedef QAS_LCD_RasterAccel<QAT_PixelFormat_RGB565>    AccelRGB565;
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_RGB565>   CpuRGB565;
+	typedef QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB4444>  AccelARGB4444;
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444> CpuARGB4444;
+
+	QAH_DMA2D_reset();
+	QAH_DMA2D_random(QAH_DMA2DAccel, QAH_DMA2D_PIXELS, 1);
+	memcpy(QAH_DMA2DCpu, QAH_DMA2DAccel, sizeof(QAH_DMA2DCpu));
+
+	AccelRGB565::fillRect(&QAH_DMA2DAccel[3], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT, 0x8F3C, QAS_LCD_Blend_None);
+	AccelRGB565::fillRect(&QAH_DMA2DAccel[5], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH - 10, QAH_DMA2D_HEIGHT - 2, 0xF5A7, QAS_LCD_Blend_SrcOver);
+	AccelRGB565::sync();
+	CpuRGB565::fillRect(&QAH_DMA2DCpu[3], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT, 0x8F3C, QAS_LCD_Blend_None);
+	CpuRGB565::fillRect(&QAH_DMA2DCpu[5], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH - 10, QAH_DMA2D_HEIGHT - 2, 0xF5A7, QAS_LCD_Blend_SrcOver);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel, QAH_DMA2DCpu, sizeof(QAH_DMA2DCpu)));
+
+	AccelARGB4444::fillRect(&QAH_DMA2DAccel[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 1, 0x7ACE, QAS_LCD_Blend_None);
+	AccelARGB4444::fillRect(&QAH_DMA2DAccel[2], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 4, 0xF123, QAS_LCD_Blend_SrcOver);
+	AccelARGB4444::sync();
+	CpuARGB4444::fillRect(&QAH_DMA2DCpu[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 1, 0x7ACE, QAS_LCD_Blend_None);
+	CpuARGB4444::fillRect(&QAH_DMA2DCpu[2], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 4, 0xF123, QAS_LCD_Blend_SrcOver);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel, QAH_DMA2DCpu, sizeof(QAH_DMA2DCpu)));
+
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 4);
+}
+
+
+//Copies of ARGB4444 images, and moves, match the CPU kernels exactly, while copies blended over RGB565 pixels match to within
+//one step of each component
+QAH_TEST(DMA2D, KernelCopy) {
+	typedef QAS_LCD_RasterAccel<QAT_PixelFormat_RGB565>    AccelRGB565;
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_RGB565>   CpuRGB565;
+	typedef QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB4444>  AccelARGB4444;
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444> CpuARGB4444;
+
+	QAH_DMA2D_reset();
+	QAH_DMA2D_random(QAH_DMA2DSrc, QAH_DMA2D_PIXELS, 2);
+
+	//ARGB4444 copies with no blend mode, and moves between rectangles that do not overlap
+	QAH_DMA2D_random(QAH_DMA2DAccel, QAH_DMA2D_PIXELS, 3);
+	memcpy(QAH_DMA2DCpu, QAH_DMA2DAccel, sizeof(QAH_DMA2DCpu));
+
+	AccelARGB4444::copyRect(&QAH_DMA2DAccel[2], QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                        QAS_LCD_Blend_None);
+	AccelARGB4444::moveRect(QAH_DMA2DAccel, QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[7], QAH_DMA2D_STRIDE, 20, 20);
+	AccelARGB4444::sync();
+	CpuARGB4444::copyRect(&QAH_DMA2DCpu[2], QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                      QAS_LCD_Blend_None);
+	CpuARGB4444::moveRect(QAH_DMA2DCpu, QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[7], QAH_DMA2D_STRIDE, 20, 20);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel, QAH_DMA2DCpu, sizeof(QAH_DMA2DCpu)));
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 2);
+
+	//Moves between overlapping rectangles are left to the CPU
+	AccelARGB4444::moveRect(&QAH_DMA2DAccel[1], QAH_DMA2D_STRIDE, QAH_DMA2DAccel, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT);
+	CpuARGB4444::moveRect(&QAH_DMA2DCpu[1], QAH_DMA2D_STRIDE, QAH_DMA2DCpu, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel, QAH_DMA2DCpu, sizeof(QAH_DMA2DCpu)));
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 2);
+
+	//ARGB4444 copies blended over RGB565 pixels
+	QAH_DMA2D_random(QAH_DMA2DAccel, QAH_DMA2D_PIXELS, 4);
+	memcpy(QAH_DMA2DCpu, QAH_DMA2DAccel, sizeof(QAH_DMA2DCpu));
+
+	AccelRGB565::copyRect(&QAH_DMA2DAccel[3], QAH_DMA2D_STRIDE, QAH_DMA2DSrc, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                      QAS_LCD_Blend_SrcOver);
+	AccelRGB565::sync();
+	CpuRGB565::copyRect(&QAH_DMA2DCpu[3], QAH_DMA2D_STRIDE, QAH_DMA2DSrc, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                    QAS_LCD_Blend_SrcOver);
+	QAH_CHECK_EQUAL(QAH_DMA2D_compareRGB565(QAH_DMA2DAccel, QAH_DMA2DCpu, QAH_DMA2D_PIXELS), 0);
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 3);
+}
+
+
+//Fills, copies of ARGB4444 images with no blend mode, which are converted by the engine, and moves to ARGB8888 pixels match
+//the CPU kernels exactly
+QAH_TEST(DMA2D, KernelARGB8888) {
+	typedef QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB8888>  AccelARGB8888;
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB8888> CpuARGB8888;
+
+	QAH_DMA2D_reset();
+	QAH_DMA2D_random(QAH_DMA2DSrc, QAH_DMA2D_PIXELS, 5);
+	QAH_DMA2D_random((uint16_t*)QAH_DMA2DAccel32, QAH_DMA2D_PIXELS * 2, 6);
+	memcpy(QAH_DMA2DCpu32, QAH_DMA2DAccel32, sizeof(QAH_DMA2DCpu32));
+
+	AccelARGB8888::fillRect(&QAH_DMA2DAccel32[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT, 0x8F3C, QAS_LCD_Blend_None);
+	AccelARGB8888::fillRect(&QAH_DMA2DAccel32[4], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH - 6, QAH_DMA2D_HEIGHT - 2, 0xF5A7, QAS_LCD_Blend_SrcOver);
+	AccelARGB8888::copyRect(&QAH_DMA2DAccel32[3], QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 4,
+	                        QAS_LCD_Blend_None);
+	AccelARGB8888::moveRect(&QAH_DMA2DAccel32[QAH_DMA2D_WIDTH], QAH_DMA2D_STRIDE, &QAH_DMA2DAccel32[2], QAH_DMA2D_STRIDE, 8, 20);
+	AccelARGB8888::sync();
+	CpuARGB8888::fillRect(&QAH_DMA2DCpu32[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT, 0x8F3C, QAS_LCD_Blend_None);
+	CpuARGB8888::fillRect(&QAH_DMA2DCpu32[4], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH - 6, QAH_DMA2D_HEIGHT - 2, 0xF5A7, QAS_LCD_Blend_SrcOver);
+	CpuARGB8888::copyRect(&QAH_DMA2DCpu32[3], QAH_DMA2D_STRIDE, &QAH_DMA2DSrc[1], QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT - 4,
+	                      QAS_LCD_Blend_None);
+	CpuARGB8888::moveRect(&QAH_DMA2DCpu32[QAH_DMA2D_WIDTH], QAH_DMA2D_STRIDE, &QAH_DMA2DCpu32[2], QAH_DMA2D_STRIDE, 8, 20);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel32, QAH_DMA2DCpu32, sizeof(QAH_DMA2DCpu32)));
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 3);
+
+	//Copies blended into pixels that store alpha are left to the CPU
+	AccelARGB8888::copyRect(QAH_DMA2DAccel32, QAH_DMA2D_STRIDE, QAH_DMA2DSrc, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                        QAS_LCD_Blend_SrcOver);
+	CpuARGB8888::copyRect(QAH_DMA2DCpu32, QAH_DMA2D_STRIDE, QAH_DMA2DSrc, QAH_DMA2D_STRIDE, QAH_DMA2D_WIDTH, QAH_DMA2D_HEIGHT,
+	                      QAS_LCD_Blend_SrcOver);
+	QAH_CHECK(!memcmp(QAH_DMA2DAccel32, QAH_DMA2DCpu32, sizeof(QAH_DMA2DCpu32)));
+	QAH_CHECK_EQUAL(QAD_DMA2D::getStats().uJobs, 3);
+}
@@ -0,0 +1,114 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Dirty Rectangle Tests                       */
+/*   Filename: QAH_Test_Dirty.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+#include "QAH_Image.hpp"
+#include "QAH_Scene.hpp"
+
+#include <string.h>
+
+
+  //NOTE:
+  //The dirty rectangle tests draw a sequence of frames of a scene with dirty rectangle tracking (QAH_Scene_Dirty), and compare each
+  //displayed frame against the same frame drawn in full. The full redraws use QAH_Scene_Accelerated, which differs from
+  //QAH_Scene_Dirty only by redrawing every pixel, so the frames must match exactly.
+  //
+  //Sequences are longer than the number of buffers of each layer, so that every buffer is redrawn from its own dirty region at least
+  //once after the first frame.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Number of frames drawn in each sequence
+#define QAH_DIRTY_FRAMES  (QAD_LTDC_BUFFERCOUNT * 3)
+
+
+//Frames drawn in full, and frame drawn with dirty rectangle tracking
+static uint8_t QAH_DirtyReference[QAH_DIRTY_FRAMES][QAH_IMAGE_FRAMESIZE];
+static uint8_t QAH_DirtyFrame[QAH_IMAGE_FRAMESIZE];
+
+
+//Used to draw a sequence of frames of a scene in full, storing each displayed frame in QAH_DirtyReference
+//Returns the number of pixels written to layer 0 for the last frame
+static uint32_t QAH_Dirty_drawReference(const QAH_SceneDesc& sScene) {
+	QAH_Scene::setMode(QAH_Scene_Accelerated);
+	QAH_Scene::begin(sScene);
+	for (uint32_t i=0; i<QAH_DIRTY_FRAMES; i++) {
+		QAH_Scene::draw(sScene, i);
+		QAD_LTDC::readFrame(QAH_DirtyReference[i]);
+	}
+	return QAS_LCD::getPixelsTouched(QAD_LTDC_Layer0);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Frames of the status scene, where only the card details are invalidated after the first frame, match full redraws while
+//writing fewer pixels
+QAH_TEST(Dirty, Status) {
+	const QAH_SceneDesc* pScene = QAH_Scene::find("Status");
+	if (!QAH_CHECK(pScene != NULL) || !QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK))
+		return;
+
+	uint32_t uFullPixels = QAH_Dirty_drawReference(*pScene);
+
+	QAH_Scene::setMode(QAH_Scene_Dirty);
+	QAH_Scene::begin(*pScene);
+	for (uint32_t i=0; i<QAH_DIRTY_FRAMES; i++) {
+		QAH_CHECK(QAH_Scene::draw(*pScene, i));
+		QAD_LTDC::readFrame(QAH_DirtyFrame);
+		QAH_CHECK_EQUAL(QAH_Image::compare(QAH_DirtyFrame, QAH_DirtyReference[i], (uint32_t)QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT), 0);
+
+		//Once every buffer has been drawn in full, only the invalidated card details are redrawn
+		if (i >= QAD_LTDC_BUFFERCOUNT) {
+			QAH_CHECK(QAS_LCD::getPixelsTouched(QAD_LTDC_Layer0) < uFullPixels);
+			QAH_CHECK(QAS_LCD::getPixelsTouched(QAD_LTDC_Layer0) <= (uint32_t)(760 - 40 + 1) * (440 - 75 + 1));
+		}
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
+
+
+//Frames of the scenes that do not change are skipped once drawn, and the displayed frame is left unchanged
+QAH_TEST(Dirty, Unchanged) {
+	if (!QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK))
+		return;
+
+	for (uint8_t uScene=0; uScene<QAH_Scene::count(); uScene++) {
+		const QAH_SceneDesc& sScene = QAH_Scene::get(uScene);
+		if (!strcmp(sScene.strName, "Status"))
+			continue;
+
+		QAH_Dirty_drawReference(sScene);
+
+		QAH_Scene::setMode(QAH_Scene_Dirty);
+		QAH_Scene::begin(sScene);
+		for (uint32_t i=0; i<QAH_DIRTY_FRAMES; i++) {
+			QAH_CHECK_EQUAL(QAH_Scene::draw(sScene, i), !i);
+			QAD_LTDC::readFrame(QAH_DirtyFrame);
+			QAH_CHECK_EQUAL(QAH_Image::compare(QAH_DirtyFrame, QAH_DirtyReference[i], (uint32_t)QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT), 0);
+		}
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
@@ -0,0 +1,240 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - SDRAM Allocator Tests                       */
+/*   Filename: QAH_Test_FMC.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAD_FMC.hpp"
+#include "QAS_LCD.hpp"
+
+
+  //NOTE:
+  //The allocator tests use a plain byte array standing in for the SDRAM, aligned to an SDRAM row so that the alignment of each region
+  //can be checked against known offsets. Where the allocator's memory is deliberately started off an alignment boundary, regions
+  //must still be aligned by address rather than by offset.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Memory regions are allocated from
+#define QAH_FMC_MEMORYSIZE  ((uint32_t)65536)
+static uint8_t QAH_FMCMemory[QAH_FMC_MEMORYSIZE] __attribute__((aligned(QAD_FMC_ALIGN_ROW)));
+
+
+//Returns the offset of a pointer from the start of the memory
+static uint32_t QAH_FMC_offset(const void* pData) {
+	return (uint32_t)((const uint8_t*)pData - QAH_FMCMemory);
+}
+
+
+//Returns true if the regions of an allocator are in order of increasing offset and do not overlap
+static bool QAH_FMC_ordered(const QAD_FMC_Allocator& cAlloc) {
+	for (uint8_t i=1; i<cAlloc.count(); i++) {
+		if ((cAlloc[i-1].uOffset + cAlloc[i-1].uSize) > cAlloc[i].uOffset)
+			return false;
+	}
+	return true;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Regions are placed one after another, and a released space is reused by the first later region that fits in it
+QAH_TEST(FMC, AllocFirstFit) {
+	QAD_FMC_Allocator cAlloc(QAH_FMCMemory, QAH_FMC_MEMORYSIZE);
+
+	void* pA = cAlloc.alloc("A", 1024);
+	void* pB = cAlloc.alloc("B", 2048);
+	void* pC = cAlloc.alloc("C", 1024);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pA), 0);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pB), 1024);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pC), 3072);
+
+	//Space of B is reused by a smaller region, with a region too large for it placed after C
+	QAH_CHECK_EQUAL(cAlloc.release(pB), QA_OK);
+	void* pD = cAlloc.alloc("D", 4096);
+	void* pE = cAlloc.alloc("E", 512);
+	void* pF = cAlloc.alloc("F", 1536);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pD), 4096);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pE), 1024);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pF), 1536);
+
+	//Space of B is now full, so the next region follows D
+	void* pG = cAlloc.alloc("G", 32);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pG), 8192);
+
+	QAH_CHECK_EQUAL(cAlloc.count(), 6);
+	QAH_CHECK(QAH_FMC_ordered(cAlloc));
+	QAH_CHECK(cAlloc.find("E") == pE);
+}
+
+
+//Regions are aligned by address, padding is left for later regions, and sizes are rounded up to the alignment
+QAH_TEST(FMC, AllocAlignment) {
+	uint32_t uSize;
+
+	//Memory starting 4 bytes after a row boundary
+	QAD_FMC_Allocator cAlloc(&QAH_FMCMemory[4], QAH_FMC_MEMORYSIZE - 4);
+
+	void* pA = cAlloc.alloc("A", 100);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pA) % QAD_FMC_ALIGN_CACHELINE, 0);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pA), 32);
+	QAH_CHECK(cAlloc.find("A", &uSize) == pA);
+	QAH_CHECK_EQUAL(uSize, 128);
+
+	void* pB = cAlloc.alloc("B", 5000, QAD_FMC_ALIGN_ROW);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pB), 1024);
+	QAH_CHECK(cAlloc.find("B", &uSize) == pB);
+	QAH_CHECK_EQUAL(uSize, 5120);
+
+	void* pC = cAlloc.alloc("C", 64, QAD_FMC_ALIGN_BURST);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pC), 192);
+
+	//Alignments below a word are increased to a word, filling the padding before A
+	void* pD = cAlloc.alloc("D", 6, 1);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pD), 4);
+	QAH_CHECK(cAlloc.find("D", &uSize) == pD);
+	QAH_CHECK_EQUAL(uSize, 8);
+
+	void* pE = cAlloc.alloc("E", 4, QAD_FMC_ALIGN_WORD);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pE), 12);
+
+	QAH_CHECK(QAH_FMC_ordered(cAlloc));
+	QAH_CHECK_EQUAL(cAlloc.getStats().uUsed, 128 + 5120 + 64 + 8 + 4);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uFailures, 0);
+}
+
+
+//Invalid allocations fail, without changing the allocated regions, and are counted
+QAH_TEST(FMC, AllocRejects) {
+	QAD_FMC_Allocator cAlloc(QAH_FMCMemory, QAH_FMC_MEMORYSIZE);
+
+	QAH_CHECK(cAlloc.alloc("A", 1000) != NULL);
+	QAH_CHECK(cAlloc.alloc(NULL, 16) == NULL);
+	QAH_CHECK(cAlloc.alloc("B", 0) == NULL);
+	QAH_CHECK(cAlloc.alloc("B", QAH_FMC_MEMORYSIZE + 1) == NULL);
+	QAH_CHECK(cAlloc.alloc("B", 16, 3) == NULL);
+	QAH_CHECK(cAlloc.alloc("B", 16, 48) == NULL);
+	QAH_CHECK(cAlloc.alloc("A", 16) == NULL);
+	QAH_CHECK(cAlloc.alloc("B", QAH_FMC_MEMORYSIZE - 512) == NULL);
+	QAH_CHECK_EQUAL(cAlloc.count(), 1);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uFailures, 7);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uUsed, 1024);
+
+	//Region table holds a limited number of regions
+	static const char* strNames[QAD_FMC_REGION_LENGTH] = {"R1", "R2", "R3", "R4", "R5", "R6", "R7", "R8",
+	                                                      "R9", "R10", "R11", "R12", "R13", "R14", "R15", "R16"};
+	cAlloc.clear();
+	for (uint8_t i=0; i<QAD_FMC_REGION_LENGTH; i++)
+		QAH_CHECK(cAlloc.alloc(strNames[i], 16) != NULL);
+	QAH_CHECK(cAlloc.alloc("Full", 16) == NULL);
+	QAH_CHECK_EQUAL(cAlloc.count(), QAD_FMC_REGION_LENGTH);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uFailures, 1);
+}
+
+
+//Released regions are removed and their space reused, with the peak usage being kept
+QAH_TEST(FMC, Release) {
+	QAD_FMC_Allocator cAlloc(QAH_FMCMemory, QAH_FMC_MEMORYSIZE);
+
+	void* pA = cAlloc.alloc("A", 4096);
+	void* pB = cAlloc.alloc("B", 4096);
+	QAH_CHECK_EQUAL(cAlloc.release((uint8_t*)pA + 32), QA_Fail);
+	QAH_CHECK_EQUAL(cAlloc.release(NULL), QA_Fail);
+	QAH_CHECK_EQUAL(cAlloc.release(pA), QA_OK);
+	QAH_CHECK_EQUAL(cAlloc.release(pA), QA_Fail);
+
+	QAH_CHECK(cAlloc.find("A") == NULL);
+	QAH_CHECK(cAlloc.find("B") == pB);
+	QAH_CHECK_EQUAL(cAlloc.count(), 1);
+
+	QAD_FMC_RegionStats sStats = cAlloc.getStats();
+	QAH_CHECK_EQUAL(sStats.uUsed, 4096);
+	QAH_CHECK_EQUAL(sStats.uPeak, 8192);
+	QAH_CHECK_EQUAL(sStats.uRegions, 1);
+
+	//Name of a released region can be used again
+	QAH_CHECK(cAlloc.alloc("A", 4096) == pA);
+
+	cAlloc.clear();
+	sStats = cAlloc.getStats();
+	QAH_CHECK_EQUAL(cAlloc.count(), 0);
+	QAH_CHECK_EQUAL(sStats.uUsed, 0);
+	QAH_CHECK_EQUAL(sStats.uPeak, 0);
+	QAH_CHECK(cAlloc.alloc("B", 16) == QAH_FMCMemory);
+}
+
+
+//Largest free space covers the spaces before, between and after regions, and a region of exactly that size fits
+QAH_TEST(FMC, LargestFree) {
+	QAD_FMC_Allocator cAlloc(QAH_FMCMemory, QAH_FMC_MEMORYSIZE);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, QAH_FMC_MEMORYSIZE);
+
+	void* pA = cAlloc.alloc("A", 16384);
+	void* pB = cAlloc.alloc("B", 8192);
+	void* pC = cAlloc.alloc("C", 16384);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pB), 16384);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, QAH_FMC_MEMORYSIZE - 40960);
+
+	//Space before the first region
+	cAlloc.release(pA);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, QAH_FMC_MEMORYSIZE - 40960);
+	cAlloc.release(pC);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, QAH_FMC_MEMORYSIZE - 24576);
+
+	//Space between regions
+	void* pD = cAlloc.alloc("D", QAH_FMC_MEMORYSIZE - 24576);
+	QAH_CHECK_EQUAL(QAH_FMC_offset(pD), 24576);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, 16384);
+
+	//Fill the largest space exactly, leaving no space
+	QAH_CHECK(cAlloc.alloc("E", cAlloc.getStats().uLargestFree) == QAH_FMCMemory);
+	QAH_CHECK_EQUAL(cAlloc.getStats().uLargestFree, 0);
+	QAH_CHECK(cAlloc.alloc("F", 4, QAD_FMC_ALIGN_WORD) == NULL);
+	QAH_CHECK(QAH_FMC_ordered(cAlloc));
+}
+
+
+//Frame buffers are allocated from the SDRAM at initialization, aligned to SDRAM rows, and are not allocated again if reinitialized
+QAH_TEST(FMC, FrameBuffers) {
+	QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK);
+
+	const QAD_FMC_Allocator& cSDRAM = QAD_FMC::getAllocator();
+	uint32_t uSize0 = 0;
+	uint32_t uSize1 = 0;
+	void*    pLayer0 = cSDRAM.find("LTDC Layer 0", &uSize0);
+	void*    pLayer1 = cSDRAM.find("LTDC Layer 1", &uSize1);
+	QAH_CHECK(pLayer0 != NULL);
+	QAH_CHECK(pLayer1 != NULL);
+	QAH_CHECK_EQUAL((uintptr_t)pLayer0 % QAD_FMC_ALIGN_ROW, 0);
+	QAH_CHECK_EQUAL((uintptr_t)pLayer1 % QAD_FMC_ALIGN_ROW, 0);
+	QAH_CHECK(uSize0 >= (QAD_LTDC_LAYER0_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT));
+	QAH_CHECK(uSize1 >= (QAD_LTDC_LAYER1_BUFFERSIZE * QAD_LTDC_BUFFERCOUNT));
+	QAH_CHECK(QAH_FMC_ordered(cSDRAM));
+
+	uint8_t uRegions = QAD_FMC::getStats().uRegions;
+	QAS_LCD::deinit();
+	QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK);
+	QAH_CHECK_EQUAL(QAD_FMC::getStats().uRegions, uRegions);
+	QAH_CHECK(cSDRAM.find("LTDC Layer 0") == pLayer0);
+}
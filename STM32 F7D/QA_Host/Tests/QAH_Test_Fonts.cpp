@@ -0,0 +1,83 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Font Manager Tests                          */
+/*   Filename: QAH_Test_Fonts.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_Fonts_SegoeUI12pt.hpp"
+
+
+  //NOTE:
+  //The font tests use two names whose 32bit FNV-1a hashes are the same, to check that the Font Manager confirms the stored
+  //name of a font after its hash matches, and that a font whose name hash is already in use is not added.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Names of two fonts that have the same FNV-1a hash
+#define QAH_FONTS_NAME      "costarring"
+#define QAH_FONTS_COLLISION "liquid"
+
+
+//Font Manager to be tested, which is too large to be held on the stack
+static QAS_LCD_FontMgr QAH_FontsMgr;
+
+
+//Used to add the test font to QAH_FontsMgr under the given name
+//Returns the index of the font, or -1 if it was not added
+static int8_t QAH_Fonts_add(const char* strName) {
+	return QAH_FontsMgr.add(strName, QAS_LCD_Fonts_SegoeUI12pt_Desc, QAS_LCD_Fonts_SegoeUI12pt_Data, QAS_LCD_Fonts_SegoeUI12pt_Height,
+	                        QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth, QAS_LCD_Fonts_SegoeUI12pt_CharGap);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Checks that a name whose hash matches that of a stored font does not find or select that font
+QAH_TEST(Fonts, Collision) {
+	QAH_FontsMgr.clear();
+	QAH_CHECK_EQUAL(QAS_LCD_FontHash(QAH_FONTS_NAME), QAS_LCD_FontHash(QAH_FONTS_COLLISION));
+
+	int8_t iIdx = QAH_Fonts_add(QAH_FONTS_NAME);
+	if (!QAH_CHECK(iIdx >= 0))
+		return;
+	QAH_CHECK_EQUAL(QAH_FontsMgr.find(QAH_FONTS_NAME), iIdx);
+	QAH_CHECK_EQUAL(QAH_FontsMgr.find(QAH_FONTS_COLLISION), -1);
+
+	QAH_FontsMgr.setFontByName(QAH_FONTS_COLLISION);
+	QAH_CHECK_EQUAL(QAH_FontsMgr.getIndex(), -1);
+	QAH_FontsMgr.setFontByName(QAH_FONTS_NAME);
+	QAH_CHECK_EQUAL(QAH_FontsMgr.getIndex(), iIdx);
+}
+
+
+//Checks that a font whose name hash is already in use is not added
+QAH_TEST(Fonts, Duplicate) {
+	QAH_FontsMgr.clear();
+	if (!QAH_CHECK(QAH_Fonts_add(QAH_FONTS_NAME) >= 0))
+		return;
+	QAH_CHECK_EQUAL(QAH_Fonts_add(QAH_FONTS_NAME), -1);
+	QAH_CHECK_EQUAL(QAH_Fonts_add(QAH_FONTS_COLLISION), -1);
+	QAH_CHECK_EQUAL(QAH_FontsMgr.count(), 1);
+}
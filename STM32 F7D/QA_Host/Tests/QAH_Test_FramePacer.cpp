@@ -0,0 +1,85 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Frame Pacer Tests                           */
+/*   Filename: QAH_Test_FramePacer.cpp                                     */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAS_LCD.hpp"
+#include "QAS_LCD_FramePacer.hpp"
+
+
+  //NOTE:
+  //On a host, QAD_LTDC::getTime() only advances at each vertical blanking period, which takes place straight away when waited for
+  //with QAD_LTDC::waitVBlank(), so times measured by the tests are whole numbers of refreshes.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Rendered frames are counted along with their render time, and a frame still rendering at the following vertical blanking period
+//is counted as missed
+QAH_TEST(FramePacer, Rendered) {
+	QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK);
+	QAS_LCD_FramePacer cPacer;
+
+	QAH_CHECK(cPacer.begin());
+	QAH_CHECK(!cPacer.begin());
+	cPacer.end(true);
+
+	cPacer.invalidate();
+	QAH_CHECK(cPacer.begin());
+	QAD_LTDC::waitVBlank();
+	QAD_LTDC::waitVBlank();
+	cPacer.end();
+
+	QAS_LCD_FramePacerStats sStats = cPacer.getStats();
+	QAH_CHECK_EQUAL(sStats.uFrames, 2);
+	QAH_CHECK_EQUAL(sStats.uSkipped, 0);
+	QAH_CHECK_EQUAL(sStats.uMissed, 1);
+	QAH_CHECK_EQUAL(sStats.uRenderLast, 2 * QAD_LTDC_FRAMELINES);
+	QAH_CHECK_EQUAL(sStats.uRenderMax, 2 * QAD_LTDC_FRAMELINES);
+	QAH_CHECK_EQUAL(sStats.uRenderTotal, 2 * QAD_LTDC_FRAMELINES);
+	QAH_CHECK_EQUAL(sStats.uIdleTotal, 0);
+}
+
+
+//Frames that are started but skipped, as an unchanged display list is, are not counted as rendered, with their time counted as idle
+QAH_TEST(FramePacer, Skipped) {
+	QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK);
+	QAS_LCD_FramePacer cPacer;
+
+	QAH_CHECK(cPacer.begin());
+	QAD_LTDC::waitVBlank();
+	cPacer.end(false);
+
+	QAS_LCD_FramePacerStats sStats = cPacer.getStats();
+	QAH_CHECK_EQUAL(sStats.uFrames, 0);
+	QAH_CHECK_EQUAL(sStats.uSkipped, 1);
+	QAH_CHECK_EQUAL(sStats.uMissed, 0);
+	QAH_CHECK_EQUAL(sStats.uRenderMax, 0);
+	QAH_CHECK_EQUAL(sStats.uRenderTotal, 0);
+	QAH_CHECK_EQUAL(sStats.uIdleTotal, QAD_LTDC_FRAMELINES);
+
+	//A skipped frame ends the frame, so the next request can start another
+	QAH_CHECK(!cPacer.begin());
+	cPacer.invalidate();
+	QAH_CHECK(cPacer.begin());
+	cPacer.end();
+	QAH_CHECK_EQUAL(cPacer.getStats().uFrames, 1);
+}
@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Golden-Image Tests                          */
+/*   Filename: QAH_Test_Golden.cpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+#include "QAH_Image.hpp"
+#include "QAH_Scene.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+  //NOTE:
+  //Each scene (see QAH_Scene.hpp) is drawn in every rendering mode, and the displayed frame is compared against the scene's reference
+  //image in QA_Host/Golden. Reference images are written from the immediate rendering mode, rather than compared, when the
+  //QAH_UPDATE_GOLDEN environment variable is set. This should only be done when a change to the rendered output is intended, with
+  //the new images being reviewed before they are committed.
+  //
+  //The DMA2D blends by truncating rather than rounding (see QAD_DMA2D_Host.cpp), so frames drawn with acceleration may differ from
+  //the CPU kernels by the smallest step of a 5bit component where pixels are blended into a layer that does not store alpha, such as
+  //RGB565, being 8 or 9 once expanded to 8bits, and are compared with that tolerance.
+  //
+  //When a frame does not match, it is written to the working directory as <scene>_<mode>.png so that it can be inspected.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Largest difference allowed between components of frames drawn with DMA2D acceleration and the reference image
+#define QAH_GOLDEN_DMA2DTOLERANCE  9
+
+
+//Frame read from the LCD, and reference image
+static uint8_t QAH_GoldenFrame[QAH_IMAGE_FRAMESIZE];
+static uint8_t QAH_GoldenReference[QAH_IMAGE_FRAMESIZE];
+
+
+//Draws the first frame of a scene in every rendering mode, comparing each against the scene's reference image
+//strScene - Name of the scene
+static void QAH_Golden_check(const char* strScene) {
+	char strFilename[256];
+	snprintf(strFilename, sizeof(strFilename), "%s/%s.png", QAH_GOLDEN_DIR, strScene);
+
+	const QAH_SceneDesc* pScene = QAH_Scene::find(strScene);
+	if (!QAH_CHECK(pScene != NULL) || !QAH_CHECK_EQUAL(QAS_LCD::init(), QA_OK))
+		return;
+
+	bool bUpdate = (getenv("QAH_UPDATE_GOLDEN") != NULL);
+	if (!bUpdate && !QAH_CHECK_EQUAL(QAH_Image::readPNG(strFilename, QAH_GoldenReference, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT), QA_OK)) {
+		printf("  unable to read reference image %s\n", strFilename);
+		return;
+	}
+
+	for (uint8_t i=0; i<QAH_Scene_ModeCount; i++) {
+		QAH_SceneMode eMode = (QAH_SceneMode)i;
+		QAH_Scene::setMode(eMode);
+		QAH_Scene::begin(*pScene);
+		QAH_Scene::draw(*pScene, 0);
+		QAD_LTDC::readFrame(QAH_GoldenFrame);
+
+		if (bUpdate && (eMode == QAH_Scene_Immediate)) {
+			QAH_CHECK_EQUAL(QAH_Image::writePNG(strFilename, QAH_GoldenFrame, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT), QA_OK);
+			QAH_CHECK_EQUAL(QAH_Image::readPNG(strFilename, QAH_GoldenReference, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT), QA_OK);
+			printf("  updated %s\n", strFilename);
+		}
+
+		uint8_t  uTolerance = (eMode >= QAH_Scene_Accelerated) ? QAH_GOLDEN_DMA2DTOLERANCE : 0;
+		uint32_t uDiffer    = QAH_Image::compare(QAH_GoldenFrame, QAH_GoldenReference, (uint32_t)QAD_LTDC_WIDTH * QAD_LTDC_HEIGHT, uTolerance);
+		if (!QAH_CHECK_EQUAL(uDiffer, 0)) {
+			char strActual[128];
+			snprintf(strActual, sizeof(strActual), "%s_%s.png", strScene, QAH_Scene::getModeName(eMode));
+			QAH_Image::writePNG(strActual, QAH_GoldenFrame, QAD_LTDC_WIDTH, QAD_LTDC_HEIGHT);
+			printf("  %s differs from reference in %s mode, written to %s\n", strScene, QAH_Scene::getModeName(eMode), strActual);
+		}
+	}
+	QAH_Scene::setMode(QAH_Scene_Immediate);
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+QAH_TEST(Golden, Status) {
+	QAH_Golden_check("Status");
+}
+
+QAH_TEST(Golden, Primitives) {
+	QAH_Golden_check("Primitives");
+}
+
+QAH_TEST(Golden, Text) {
+	QAH_Golden_check("Text");
+}
+
+QAH_TEST(Golden, Blend) {
+	QAH_Golden_check("Blend");
+}
+
+QAH_TEST(Golden, Image) {
+	QAH_Golden_check("Image");
+}
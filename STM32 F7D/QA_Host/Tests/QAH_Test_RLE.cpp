@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - RLE Image Tests                             */
+/*   Filename: QAH_Test_RLE.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAS_LCD_RLE.hpp"
+
+#include <string.h>
+
+
+  //NOTE:
+  //The RLE tests encode a small image, then corrupt copies of it in the ways that a damaged file in external storage could be, and
+  //check that valid() rejects a damaged header or row table, and that drawRow() stops a row at its first malformed run without
+  //writing past the pixels decoded before it.
+  //
+  //Each row of the image encodes as a skip run of 4 pixels, a fill run of 4 pixels and a literal run of 8 pixels, so the runs of
+  //each row start at the offsets given by QAH_RLE_SKIP, QAH_RLE_FILL and QAH_RLE_LITERAL.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Size of the image
+#define QAH_RLE_WIDTH    16
+#define QAH_RLE_HEIGHT   4
+
+//Offsets in 16bit words of the tokens of each row's runs, from the start of the row
+#define QAH_RLE_SKIP     0
+#define QAH_RLE_FILL     1
+#define QAH_RLE_LITERAL  3
+
+//Value of frame buffer pixels that have not been written
+#define QAH_RLE_GUARD    0x5A5A
+
+typedef QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444> QAH_RLERaster;
+
+
+//Pixels of the image, the encoded image, and a copy of the encoded image to be corrupted
+static uint16_t QAH_RLEPixels[QAH_RLE_WIDTH * QAH_RLE_HEIGHT];
+static uint32_t QAH_RLEEncoded[64];
+static uint32_t QAH_RLECorrupt[64];
+
+
+//Used to encode the image into QAH_RLEEncoded
+//Returns the size in bytes of the encoded image
+static uint32_t QAH_RLE_encode(void) {
+	for (uint16_t y=0; y<QAH_RLE_HEIGHT; y++) {
+		for (uint16_t x=0; x<QAH_RLE_WIDTH; x++)
+			QAH_RLEPixels[(y * QAH_RLE_WIDTH) + x] = (x < 4) ? 0x0000 : ((x < 8) ? 0xF123 : (0xF000 | (y << 8) | x));
+	}
+	return QAS_LCD_RLE::encode(QAH_RLEPixels, QAH_RLE_WIDTH, QAH_RLE_HEIGHT, 0, (uint8_t*)QAH_RLEEncoded, sizeof(QAH_RLEEncoded));
+}
+
+
+//Used to copy the encoded image into QAH_RLECorrupt, so that it can be corrupted
+//Returns an image describing the copy
+static QAS_LCD_RLEImage QAH_RLE_copy(void) {
+	memcpy(QAH_RLECorrupt, QAH_RLEEncoded, sizeof(QAH_RLECorrupt));
+	return QAS_LCD_RLEImage(QAH_RLECorrupt, 0);
+}
+
+
+//Used to decode the whole of a row of an image into a line of guard pixels
+//cImage  - The image
+//y       - The row
+//pPixels - The line, which must hold QAH_RLE_WIDTH + 1 pixels, the last of which must never be written
+//Returns the number of pixels written
+static uint32_t QAH_RLE_drawRow(const QAS_LCD_RLEImage& cImage, uint16_t y, uint16_t* pPixels) {
+	for (uint16_t x=0; x<=QAH_RLE_WIDTH; x++)
+		pPixels[x] = QAH_RLE_GUARD;
+	uint32_t uWritten = QAS_LCD_RLE::drawRow(QAH_RLERaster(), cImage, y, pPixels, 0, QAH_RLE_WIDTH, QAS_LCD_Blend_None);
+	QAH_CHECK_EQUAL(pPixels[QAH_RLE_WIDTH], QAH_RLE_GUARD);
+	return uWritten;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Encoded images are valid, and every row decodes to the pixels that were encoded, leaving skipped pixels unwritten
+QAH_TEST(RLE, Decode) {
+	uint16_t uLine[QAH_RLE_WIDTH + 1];
+
+	QAH_CHECK_EQUAL(QAH_RLE_encode(), sizeof(QAS_LCD_RLEHeader) + (QAH_RLE_HEIGHT * 4) + (QAH_RLE_HEIGHT * 24));
+	QAS_LCD_RLEImage cImage(QAH_RLEEncoded, 0);
+	if (!QAH_CHECK(cImage.valid()))
+		return;
+
+	for (uint16_t y=0; y<QAH_RLE_HEIGHT; y++) {
+		QAH_CHECK_EQUAL(QAH_RLE_drawRow(cImage, y, uLine), QAH_RLE_WIDTH - 4);
+		for (uint16_t x=0; x<QAH_RLE_WIDTH; x++)
+			QAH_CHECK_EQUAL(uLine[x], (x < 4) ? QAH_RLE_GUARD : QAH_RLEPixels[(y * QAH_RLE_WIDTH) + x]);
+	}
+}
+
+
+//Images whose magic number, size or row table is damaged are not valid
+QAH_TEST(RLE, Header) {
+	uint32_t uSize = QAH_RLE_encode();
+	uint32_t uRows = sizeof(QAS_LCD_RLEHeader) / sizeof(uint32_t);
+
+	QAS_LCD_RLEImage cImage = QAH_RLE_copy();
+	QAH_RLECorrupt[0] ^= 1;
+	QAH_CHECK(!cImage.valid());
+	QAH_CHECK_EQUAL(cImage.width(), 0);
+
+	//Size not covering the row table
+	cImage = QAH_RLE_copy();
+	((QAS_LCD_RLEHeader*)QAH_RLECorrupt)->uSize = sizeof(QAS_LCD_RLEHeader) + 4;
+	QAH_CHECK(!cImage.valid());
+
+	//Rows starting within the header, at an odd offset, or past the end of the image
+	const uint32_t uOffsets[] = {0, sizeof(QAS_LCD_RLEHeader) + 6, QAH_RLEEncoded[uRows + 2] + 1, uSize, 0xFFFFFFF0};
+	for (uint32_t uOffset : uOffsets) {
+		cImage = QAH_RLE_copy();
+		QAH_RLECorrupt[uRows + 2] = uOffset;
+		QAH_CHECK(!cImage.valid());
+	}
+
+	//Size truncating the last row leaves the image valid, as every row starts within it
+	cImage = QAH_RLE_copy();
+	((QAS_LCD_RLEHeader*)QAH_RLECorrupt)->uSize = QAH_RLEEncoded[uRows + QAH_RLE_HEIGHT - 1] + 2;
+	QAH_CHECK(cImage.valid());
+}
+
+
+//Rows stop at the first malformed run, keeping the pixels decoded before it and writing nothing after it
+QAH_TEST(RLE, Runs) {
+	uint16_t uLine[QAH_RLE_WIDTH + 1];
+	uint32_t uRows = sizeof(QAS_LCD_RLEHeader) / sizeof(uint32_t);
+
+	QAH_RLE_encode();
+	const struct {
+		uint16_t uIdx;       //Offset of the token to be replaced
+		uint16_t uToken;     //The replacement token
+		uint32_t uWritten;   //Number of pixels written before the malformed run
+	} sCases[] = {
+		{QAH_RLE_FILL,    QAS_LCD_RLE_FILL,         0},  //Fill run of no pixels
+		{QAH_RLE_SKIP,    QAS_LCD_RLE_SKIP,         0},  //Skip run of no pixels, which would otherwise be read forever
+		{QAH_RLE_FILL,    QAS_LCD_RLE_TYPEMASK | 4, 0},  //Unknown run type
+		{QAH_RLE_LITERAL, QAS_LCD_RLE_LITERAL | 9,  4},  //Literal run extending past the width of the image
+		{QAH_RLE_FILL,    QAS_LCD_RLE_FILL | 13,    0}   //Fill run extending past the width of the image
+	};
+	for (const auto& sCase : sCases) {
+		QAS_LCD_RLEImage cImage = QAH_RLE_copy();
+		uint16_t*        pRow   = (uint16_t*)((uint8_t*)QAH_RLECorrupt + QAH_RLECorrupt[uRows + 1]);
+		pRow[sCase.uIdx] = sCase.uToken;
+		if (!QAH_CHECK(cImage.valid()))
+			continue;
+
+		QAH_CHECK_EQUAL(QAH_RLE_drawRow(cImage, 1, uLine), sCase.uWritten);
+		for (uint16_t x=8; x<QAH_RLE_WIDTH; x++)
+			QAH_CHECK_EQUAL(uLine[x], QAH_RLE_GUARD);
+	}
+
+	//Literal run whose data extends past the end of the image
+	QAS_LCD_RLEImage cImage = QAH_RLE_copy();
+	((QAS_LCD_RLEHeader*)QAH_RLECorrupt)->uSize = QAH_RLEEncoded[uRows + QAH_RLE_HEIGHT - 1] + ((QAH_RLE_LITERAL + 8) * 2);
+	if (QAH_CHECK(cImage.valid())) {
+		QAH_CHECK_EQUAL(QAH_RLE_drawRow(cImage, QAH_RLE_HEIGHT - 1, uLine), 4);
+		for (uint16_t x=8; x<QAH_RLE_WIDTH; x++)
+			QAH_CHECK_EQUAL(uLine[x], QAH_RLE_GUARD);
+	}
+}
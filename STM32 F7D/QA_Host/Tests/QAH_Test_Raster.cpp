@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Host                                                          */
+/*   Role: Host Test Harness - Raster Kernel Tests                         */
+/*   Filename: QAH_Test_Raster.cpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAH_Test.hpp"
+
+#include "QAS_LCD_Target.hpp"
+
+
+  //NOTE:
+  //The layers' pixel formats are selected at compile time, so the golden-image tests only cover the formats of the host build
+  //(see QAD_LTDC_Layer0Format and QAD_LTDC_Layer1Format). These tests cover the kernels of the remaining formats directly.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Every member of QAS_LCD_Raster selects the kernel class that it names, which addresses pixels of the same size
+QAH_TEST(Raster, Dispatch) {
+	uint32_t       uPixels[25];
+	QAS_LCD_Target cTarget(uPixels, QAT_Rect_16(10, 20, 14, 24), 5, QAS_LCD_Raster_ARGB4444);
+
+	for (uint8_t i=QAS_LCD_Raster_ARGB4444; i<=QAS_LCD_Raster_AccelARGB8888; i++) {
+		QAS_LCD_Raster eRaster = QAS_LCD_Raster_ARGB4444;
+		uint8_t        uBytes  = 0;
+
+		cTarget.setRaster((QAS_LCD_Raster)i);
+		cTarget.raster([&](auto cRaster) {
+			eRaster = cRaster.Raster;
+			uBytes  = cRaster.Bytes;
+		});
+		QAH_CHECK_EQUAL(eRaster, i);
+		QAH_CHECK_EQUAL(cTarget.m_uBytes, uBytes);
+		QAH_CHECK((uint8_t*)cTarget.pixel(11, 21) == ((uint8_t*)uPixels + (6 * uBytes)));
+	}
+}
+
+
+//ARGB8888 kernels convert colors and image pixels by replicating each 4bit component, and keep the full 8bit result of blends
+QAH_TEST(Raster, ARGB8888) {
+	typedef QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB8888> Raster;
+
+	uint32_t uPixels[15];
+	uint32_t uMoved[15];
+	uint16_t uImage[3] = {0x0000, 0x8F00, 0xF8C0};
+
+	QAH_CHECK_EQUAL(Raster::color(0xF8C0), 0xFF88CC00);
+
+	//Fills and copies without blending
+	for (uint8_t i=0; i<15; i++)
+		uPixels[i] = 0xFF0000FF;
+	Raster::fill(&uPixels[1], 3, 0xF8C0, QAS_LCD_Blend_None);
+	Raster::copy(&uPixels[5], uImage, 3, QAS_LCD_Blend_None);
+	QAH_CHECK_EQUAL(uPixels[0], 0xFF0000FF);
+	QAH_CHECK_EQUAL(uPixels[1], 0xFF88CC00);
+	QAH_CHECK_EQUAL(uPixels[3], 0xFF88CC00);
+	QAH_CHECK_EQUAL(uPixels[4], 0xFF0000FF);
+	QAH_CHECK_EQUAL(uPixels[5], 0x00000000);
+	QAH_CHECK_EQUAL(uPixels[6], 0x88FF0000);
+	QAH_CHECK_EQUAL(uPixels[7], 0xFF88CC00);
+
+	//Source-over blending of half transparent red over opaque blue
+	Raster::pixel(&uPixels[8], 0x8F00, QAS_LCD_Blend_SrcOver);
+	QAH_CHECK_EQUAL(uPixels[8], 0xFF880077);
+
+	//Moves of an odd number of pixels between rectangles with different strides
+	for (uint8_t i=0; i<15; i++)
+		uMoved[i] = 0;
+	Raster::moveRect(uMoved, 5, uPixels, 6, 3, 2);
+	for (uint8_t y=0; y<2; y++) {
+		for (uint8_t x=0; x<5; x++)
+			QAH_CHECK_EQUAL(uMoved[(y * 5) + x], (x < 3) ? uPixels[(y * 6) + x] : 0);
+	}
+}
@@ -23,6 +23,20 @@
 #include "QAS_LCD_Fonts_SegoeUI20ptSB.hpp"
 #include "QAS_LCD_Fonts_ShowcardGothic18pt.hpp"
 
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//QAS_LCD::m_uTileBuffer
+//Tile buffer that each tile is rendered into (see QAS_LCD_Tile.hpp)
+//Placed in the DTCM, so that the overdraw of each tile takes place in zero wait state memory. Aligned to 32 bytes, as with the frame
+//buffers, so that the DMA2D transfers between it and the frame buffers start on a cache line
+uint8_t QAS_LCD::m_uTileBuffer[QAS_LCD_TILE_BUFFERSIZE] QA_DTCM __attribute__((aligned(32)));
+
 
 	//------------------------------------------
 	//------------------------------------------
@@ -56,7 +70,7 @@ QA_Result QAS_LCD::imp_init(void) {
 	  //Add SegoeUI 12pt font (defined in QAS_LCD_Fonts_SegoeUI12pt.hpp)
 	m_cFontMgr.add("SegoeUI12pt",
 			           QAS_LCD_Fonts_SegoeUI12pt_Desc,
-								 QAS_LCD_Fonts_SegoeUI12pt_Data,
+								 QAS_LCD_Fonts_SegoeUI12pt_Runs.runs(),
 								 QAS_LCD_Fonts_SegoeUI12pt_Height,
 								 QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth,
 								 QAS_LCD_Fonts_SegoeUI12pt_CharGap);
@@ -64,7 +78,7 @@ QA_Result QAS_LCD::imp_init(void) {
 	  //Add SegoeUI 20pt Semi-bold font (defined in QAS_LCD_Fonts_SegoeUI20ptSB.hpp)
 	m_cFontMgr.add("SegoeUI20ptSB",
 			           QAS_LCD_Fonts_SegoeUI20ptSB_Desc,
-								 QAS_LCD_Fonts_SegoeUI20ptSB_Data,
+								 QAS_LCD_Fonts_SegoeUI20ptSB_Runs.runs(),
 								 QAS_LCD_Fonts_SegoeUI20ptSB_Height,
 								 QAS_LCD_Fonts_SegoeUI20ptSB_SpaceWidth,
 								 QAS_LCD_Fonts_SegoeUI20ptSB_CharGap);
@@ -72,7 +86,7 @@ QA_Result QAS_LCD::imp_init(void) {
 	  //Add Showcard Gothic 18pt font (defined in QAS_LCD_Fonts_ShowcardGothic18pt.hpp)
 	m_cFontMgr.add("ShowcardGothic18pt",
 								 QAS_LCD_Fonts_ShowcardGothic18pt_Desc,
-								 QAS_LCD_Fonts_ShowcardGothic18pt_Data,
+								 QAS_LCD_Fonts_ShowcardGothic18pt_Runs.runs(),
 								 QAS_LCD_Fonts_ShowcardGothic18pt_Height,
 								 QAS_LCD_Fonts_ShowcardGothic18pt_SpaceWidth,
 								 QAS_LCD_Fonts_ShowcardGothic18pt_CharGap);
@@ -82,8 +96,22 @@ QA_Result QAS_LCD::imp_init(void) {
 	m_eInitState = QA_Initialized; //Set system as now being initialized
 
 	//Set initial data
-	m_pDrawBuffer = NULL;   //Set current draw buffer to NULL
-	m_uDrawColor  = 0x0000; //Set current draw color to transparent black
+	m_pDrawBuffer  = NULL;                 //Set current draw buffer to NULL
+	m_uDrawSurface = QAS_LCD_SURFACE_NONE; //Set no surface as being rendered to
+	m_uDrawColor   = 0x0000;               //Set current draw color to transparent black
+
+	//Destroy any surfaces remaining from a previous initialization
+	m_cSurfaces.clear();
+
+	//Setup regions used for clipping and dirty rectangle tracking
+	m_cFullRegion.fill();              //Set full region as covering entire LCD panel
+	imp_invalidateLayer(QAD_LTDC_Layer0); //Mark all buffers as needing to be fully drawn
+	imp_invalidateLayer(QAD_LTDC_Layer1);
+	imp_resetExtents(QAD_LTDC_Layer0);    //Mark all buffers as possibly holding visible pixels anywhere
+	imp_resetExtents(QAD_LTDC_Layer1);
+	m_cClipStack.clear();
+	m_pBaseRegion = NULL;
+	m_pDrawRegion = NULL;
 
 	//Return
 	return QA_OK;
@@ -100,6 +128,9 @@ void QAS_LCD::imp_deinit(void) {
 	//Clear Font Manager Font List
 	m_cFontMgr.clear();
 
+	//Wait for any queued DMA2D jobs to complete before the frame buffers are released
+	QAD_DMA2D::wait();
+
 	//Deinitialize LTDC driver class
 	QAD_LTDC::deinit();
 
@@ -119,7 +150,24 @@ void QAS_LCD::imp_deinit(void) {
 //Used to flip the front and back buffer for layer 0
 //See QAD_LTDC.hpp for more details
 void QAS_LCD::imp_flipLayer0(void) {
+
+	//Back-buffer is about to be presented, so it is now up to date and its dirty region can be cleared
+	m_cDirty[QAD_LTDC_Layer0][QAD_LTDC::getLayer0BackBufferIdx()].clear();
+
+	//Record the area of the back-buffer holding visible pixels, shrinking the layer's window to it if automatic windowing is active
+	imp_updateExtent(QAD_LTDC_Layer0);
+
+	//Store pixel count for the presented frame and reset for the next frame
+	m_uFramePixels[QAD_LTDC_Layer0] = m_uPixelCount[QAD_LTDC_Layer0];
+	m_uPixelCount[QAD_LTDC_Layer0]  = 0;
+
+  //Wait for any queued DMA2D jobs to complete, so that the presented frame is fully drawn
+  QAD_DMA2D::wait();
+
   QAD_LTDC::flipLayer0Buffers();
+
+  //Front-buffer is no longer known to match the most recently presented display list
+  m_uListHash = QAS_LCD_DISPLAYLIST_NOHASH;
 }
 
 
@@ -130,7 +178,24 @@ void QAS_LCD::imp_flipLayer0(void) {
 //Used to flip the front and back buffer for layer 1
 //See QAD_LTDC.hpp for more details
 void QAS_LCD::imp_flipLayer1(void) {
+
+	//Back-buffer is about to be presented, so it is now up to date and its dirty region can be cleared
+	m_cDirty[QAD_LTDC_Layer1][QAD_LTDC::getLayer1BackBufferIdx()].clear();
+
+	//Record the area of the back-buffer holding visible pixels, shrinking the layer's window to it if automatic windowing is active
+	imp_updateExtent(QAD_LTDC_Layer1);
+
+	//Store pixel count for the presented frame and reset for the next frame
+	m_uFramePixels[QAD_LTDC_Layer1] = m_uPixelCount[QAD_LTDC_Layer1];
+	m_uPixelCount[QAD_LTDC_Layer1]  = 0;
+
+  //Wait for any queued DMA2D jobs to complete, so that the presented frame is fully drawn
+  QAD_DMA2D::wait();
+
   QAD_LTDC::flipLayer1Buffers();
+
+  //Front-buffer is no longer known to match the most recently presented display list
+  m_uListHash = QAS_LCD_DISPLAYLIST_NOHASH;
 }
 
 
@@ -142,18 +207,39 @@ void QAS_LCD::imp_flipLayer1(void) {
 //eLayer - Sets whether the current draw buffer is layer 0 or layer1. A member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp)
 void QAS_LCD::imp_setDrawBuffer(QAD_LTDC_LayerIdx eLayer) {
 
-	//Retrieve required Back Buffer pointer based on selected layer and store to m_pDrawBuffer
+	//Track which layers are to be flipped at the end of the display list
+	if (m_eListState != QAS_LCD_List_Immediate)
+		m_uListLayers |= (1 << eLayer);
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetDrawBuffer, (uint8_t)eLayer)))
+		return;
+
+
+	//Retrieve required Back Buffer pointer based on selected layer and store to m_pDrawBuffer, along with the kernels for
+	//the layer's pixel format
+	QAS_LCD_Raster eRaster = QAS_LCD_Raster_ARGB4444;
 	switch (eLayer) {
 	  case (QAD_LTDC_Layer0):
 	  	m_pDrawBuffer = QAD_LTDC::getLayer0BackBuffer();
+	  	eRaster       = imp_getRaster<QAD_LTDC_Layer0Format>();
 	  	break;
 	  case (QAD_LTDC_Layer1):
 	  	m_pDrawBuffer = QAD_LTDC::getLayer1BackBuffer();
+	  	eRaster       = imp_getRaster<QAD_LTDC_Layer1Format>();
 	  	break;
 	}
+	m_eDrawLayer   = eLayer;
+	m_uDrawSurface = QAS_LCD_SURFACE_NONE;
+
+	//Render directly to the selected draw buffer
+	m_cTarget = QAS_LCD_Target(m_pDrawBuffer, QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1), QAD_LTDC_WIDTH, eRaster);
 
-	//Set currently selected draw buffer to Font Manager as well, to be used for text rendering methods
-	m_cFontMgr.setDrawBuffer(m_pDrawBuffer);
+	//Set render target to Font Manager as well, to be used for text rendering methods
+	m_cFontMgr.setDrawTarget(&m_cTarget);
+
+	//Select region that rendering will be clipped against
+	imp_updateDrawRegion();
 }
 
 
@@ -164,6 +250,11 @@ void QAS_LCD::imp_setDrawBuffer(QAD_LTDC_LayerIdx eLayer) {
 //Sets the current color to be used for rendering methods
 void QAS_LCD::imp_setDrawColor(uint16_t uColor) {
 
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetDrawColor, uColor)))
+		return;
+
+
 	//Store new draw color
 	m_uDrawColor = uColor;
 
@@ -172,6 +263,981 @@ void QAS_LCD::imp_setDrawColor(uint16_t uColor) {
 }
 
 
+//QAS_LCD::imp_setAntiAliasing
+//QAS_LCD Rendering Setup Method
+//
+//To be called from static method setAntiAliasing()
+//Used to enable or disable anti-aliasing of curved rendering methods
+//eState - QA_Active to enable anti-aliasing, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+void QAS_LCD::imp_setAntiAliasing(QA_ActiveState eState) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetAntiAliasing, (uint8_t)eState)))
+		return;
+
+	m_eAntiAliasing = eState;
+}
+
+
+//QAS_LCD::imp_setBlendMode
+//QAS_LCD Rendering Setup Method
+//
+//To be called from static method setBlendMode()
+//Used to set how rendering methods combine the draw color with the existing pixels of the draw buffer
+//eMode - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD::imp_setBlendMode(QAS_LCD_BlendMode eMode) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetBlendMode, (uint8_t)eMode)))
+		return;
+
+	m_eBlendMode = eMode;
+
+	//Set blend mode to Font Manager as well, to be used for text rendering methods
+	m_cFontMgr.setBlendMode(m_eBlendMode);
+}
+
+
+  //-----------------------
+  //-----------------------
+  //QAS_LCD Surface Methods
+
+//QAS_LCD::imp_setDrawSurface
+//QAS_LCD Surface Method
+//
+//To be called from static method setDrawSurface()
+//Used to set the current draw target to a surface, with coordinates relative to the upper-left pixel of the surface
+//As the contents of a surface are not part of any display list, rendering to a surface outside of a display list means that the
+//current front-buffers can no longer be assumed to match the most recently presented display list
+//uIdx - The index of the surface. Invalid indexes are ignored
+void QAS_LCD::imp_setDrawSurface(uint8_t uIdx) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetDrawSurface, uIdx)))
+		return;
+
+	if (!m_cSurfaces.valid(uIdx))
+		return;
+
+	if (m_eListState == QAS_LCD_List_Immediate)
+		m_uListHash = QAS_LCD_DISPLAYLIST_NOHASH;
+
+	//Render to the surface using the ARGB4444 kernels, with the base region covering the entire surface
+	m_uDrawSurface = uIdx;
+	m_cTarget      = QAS_LCD_Target(m_cSurfaces.pixels(uIdx), m_cSurfaces.area(uIdx), m_cSurfaces.area(uIdx).width(),
+			                            imp_getRaster<QAT_PixelFormat_ARGB4444>());
+	m_cSurfaceRegion.clear();
+	m_cSurfaceRegion.add(m_cTarget.m_cArea);
+
+	//Set render target to Font Manager as well, to be used for text rendering methods
+	m_cFontMgr.setDrawTarget(&m_cTarget);
+
+	//Select region that rendering will be clipped against
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_destroySurface
+//QAS_LCD Surface Method
+//
+//To be called from static method destroySurface()
+//Used to destroy a surface. If the surface is currently being rendered to, the draw buffer of the current layer is reselected,
+//or no draw target is selected if a draw buffer had not previously been selected
+//uIdx - The index of the surface
+void QAS_LCD::imp_destroySurface(uint8_t uIdx) {
+	if (!m_cSurfaces.valid(uIdx))
+		return;
+
+	if (uIdx == m_uDrawSurface) {
+		m_uDrawSurface = QAS_LCD_SURFACE_NONE;
+		if (m_pDrawBuffer != NULL) {
+			imp_setDrawBuffer(m_eDrawLayer);
+		} else {
+			m_pBaseRegion = NULL;
+			m_pDrawRegion = NULL;
+		}
+	}
+
+	m_cSurfaces.destroy(uIdx);
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAS_LCD Display List Methods
+
+//QAS_LCD::imp_beginDisplayList
+//QAS_LCD Display List Method
+//
+//To be called from static method beginDisplayList()
+//Used to clear the display list and start recording rendering methods into it
+void QAS_LCD::imp_beginDisplayList(void) {
+	m_cDisplayList.clear();
+	m_uListLayers = 0;
+	m_eListState  = QAS_LCD_List_Recording;
+}
+
+
+//QAS_LCD::imp_endDisplayList
+//QAS_LCD Display List Method
+//
+//To be called from static method endDisplayList()
+//Used to finish recording the display list. If the hash of the recorded commands matches the hash of the previously
+//presented display list then rendering and flipping are skipped, otherwise the commands are rendered and each layer
+//selected while recording is flipped.
+//Returns true if the frame was rendered and flipped, or false if it was skipped
+bool QAS_LCD::imp_endDisplayList(void) {
+	uint32_t uHash = QAS_LCD_DISPLAYLIST_NOHASH;
+
+	switch (m_eListState) {
+	  case (QAS_LCD_List_Immediate):
+	  	return false;
+
+	  case (QAS_LCD_List_Recording):
+	  	//Skip frame if it is identical to the frame currently being displayed
+	  	uHash = m_cDisplayList.hash();
+	  	if (uHash == m_uListHash) {
+	  		m_eListState = QAS_LCD_List_Immediate;
+	  		return false;
+	  	}
+
+	  	//Render recorded commands, limiting layers with automatic windowing to the area their content occupies
+	  	m_eListState = QAS_LCD_List_Immediate;
+	  	imp_measureExtents();
+	  	if (m_eTiledRendering)
+	  		imp_replayTiled(); else
+	  		imp_replayDisplayList();
+	  	break;
+
+	  case (QAS_LCD_List_Overflowed):
+	  	//Commands have already been rendered, and as the display list is incomplete the frame cannot be matched in future
+	  	m_eListState = QAS_LCD_List_Immediate;
+	  	break;
+	}
+
+	//Flip each layer that was rendered to
+	if (m_uListLayers & (1 << QAD_LTDC_Layer0))
+		imp_flipLayer0();
+	if (m_uListLayers & (1 << QAD_LTDC_Layer1))
+		imp_flipLayer1();
+
+	//Store hash of presented frame
+	m_uListHash = uHash;
+	return true;
+}
+
+
+//QAS_LCD::imp_record
+//QAS_LCD Display List Method
+//
+//To be called by rendering methods while a display list is being recorded, with the result of adding their command to the display list
+//If the display list has run out of space then the commands recorded so far are rendered, and the remainder of the display list
+//is rendered immediately.
+//eResult - The result of adding the command to the display list
+//Returns true if the command was recorded, or false if the calling method should render immediately
+bool QAS_LCD::imp_record(QA_Result eResult) {
+	if (eResult == QA_OK)
+		return true;
+
+	m_eListState = QAS_LCD_List_Overflowed;
+	imp_replayDisplayList();
+	return false;
+}
+
+
+//QAS_LCD::imp_replayDisplayList
+//QAS_LCD Display List Method
+//
+//To be called from imp_endDisplayList() and imp_record() methods
+//Used to render each of the commands stored in the display list
+void QAS_LCD::imp_replayDisplayList(void) {
+	QAS_LCD_DisplayListEntry sEntry;
+	uint16_t uIdx = 0;
+
+	while (uIdx < m_cDisplayList.length()) {
+		uIdx = m_cDisplayList.read(uIdx, sEntry);
+		imp_replayEntry(sEntry);
+	}
+}
+
+
+//QAS_LCD::imp_replayEntry
+//QAS_LCD Display List Method
+//
+//To be called from imp_replayDisplayList(), imp_replayTiled() and imp_replayTile() methods
+//Used to render an individual command decoded from the display list
+//sEntry - The decoded command to be rendered
+void QAS_LCD::imp_replayEntry(const QAS_LCD_DisplayListEntry& sEntry) {
+	QAT_Vector2_16 cStart = sEntry.cStart;
+	QAT_Vector2_16 cEnd   = sEntry.cEnd;
+	QAT_Vector2_16 cExtra = sEntry.cExtra;
+
+	switch (sEntry.eCmd) {
+	  case (QAS_LCD_DLCmd_SetDrawBuffer):
+	  	imp_setDrawBuffer((QAD_LTDC_LayerIdx)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_SetDrawSurface):
+	  	imp_setDrawSurface(sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_SetDrawColor):
+	  	imp_setDrawColor(sEntry.uColor);
+	  	break;
+	  case (QAS_LCD_DLCmd_SetFont):
+	  	imp_setFontByIndex(sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_ClearBuffer):
+	  	imp_clearBuffer();
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawPixel):
+	  	imp_drawPixel(cStart);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLine):
+	  	imp_drawLine(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRect):
+	  	imp_drawRect(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRectFill):
+	  	imp_drawRectFill(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawChar):
+	  	imp_drawChar(cStart, (char)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawStr):
+	  	imp_drawStr((QAS_LCD_TextAlign)sEntry.uParam, cStart, sEntry.str);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawImage):
+	  	imp_drawImage(cStart, sEntry.cImage, cEnd, cExtra, (QAS_LCD_BlitMode)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRLEImage):
+	  	imp_drawRLEImage(cStart, sEntry.cRLE, (QAS_LCD_BlitMode)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLayout):
+	  	imp_drawLayout(cStart, *sEntry.pLayout);
+	  	break;
+	  case (QAS_LCD_DLCmd_PushClip):
+	  	imp_pushClip(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_PopClip):
+	  	imp_popClip();
+	  	break;
+	  case (QAS_LCD_DLCmd_SetAntiAliasing):
+	  	imp_setAntiAliasing((QA_ActiveState)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_SetBlendMode):
+	  	imp_setBlendMode((QAS_LCD_BlendMode)sEntry.uParam);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawEllipse):
+	  	imp_drawEllipse(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawEllipseFill):
+	  	imp_drawEllipseFill(cStart, cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawArc):
+	  	imp_drawArc(cStart, cEnd, cExtra);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawArcFill):
+	  	imp_drawArcFill(cStart, cEnd, cExtra);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRoundRect):
+	  	imp_drawRoundRect(cStart, cEnd, cExtra.x);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRoundRectFill):
+	  	imp_drawRoundRectFill(cStart, cEnd, cExtra.x);
+	  	break;
+	}
+}
+
+
+//QAS_LCD::imp_entryBounds
+//QAS_LCD Display List Method
+//
+//To be called from imp_binDisplayList() and imp_measureExtents() methods
+//Used to determine the area of the LCD that a drawing command from the display list may write to, prior to any clipping
+//Text commands are measured using the currently selected font, so the font selected while recording the command must be selected
+//sEntry - The decoded command
+//Returns the bounding rectangle of the command, which covers the entire LCD panel for clearBuffer(), or is empty for state commands
+QAT_Rect_16 QAS_LCD::imp_entryBounds(const QAS_LCD_DisplayListEntry& sEntry) {
+	QAT_Rect_16 cBounds;
+
+	switch (sEntry.eCmd) {
+	  case (QAS_LCD_DLCmd_ClearBuffer):
+	  	cBounds = QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawPixel):
+	  	cBounds = QAT_Rect_16(sEntry.cStart, sEntry.cStart);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLine):
+	  case (QAS_LCD_DLCmd_DrawRect):
+	  case (QAS_LCD_DLCmd_DrawRectFill):
+	  	cBounds = QAT_Rect_16(sEntry.cStart, sEntry.cEnd);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawEllipse):
+	  case (QAS_LCD_DLCmd_DrawEllipseFill):
+	  case (QAS_LCD_DLCmd_DrawArc):
+	  case (QAS_LCD_DLCmd_DrawArcFill): {
+	  	//Arcs store their outer radius as the X radius. Bounds are increased by a pixel for the anti-aliased fringe
+	  	bool bArc = (sEntry.eCmd == QAS_LCD_DLCmd_DrawArc) || (sEntry.eCmd == QAS_LCD_DLCmd_DrawArcFill);
+	  	cBounds = QAS_LCD_Shape::ellipse((int16_t)sEntry.cStart.x, (int16_t)sEntry.cStart.y, sEntry.cEnd.x,
+	  		                             bArc ? sEntry.cEnd.x : sEntry.cEnd.y, false).bounds();
+	  	cBounds = QAT_Rect_16(cBounds.x0-1, cBounds.y0-1, cBounds.x1+1, cBounds.y1+1);
+	  	break;
+	  }
+	  case (QAS_LCD_DLCmd_DrawRoundRect):
+	  case (QAS_LCD_DLCmd_DrawRoundRectFill):
+	  	cBounds = QAT_Rect_16(sEntry.cStart, sEntry.cEnd);
+	  	cBounds = QAT_Rect_16(cBounds.x0-1, cBounds.y0-1, cBounds.x1+1, cBounds.y1+1);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawChar):
+	  	cBounds = QAT_Rect_16(sEntry.cStart.x, sEntry.cStart.y,
+	  		                  sEntry.cStart.x + m_cFontMgr.getCharWidth((char)sEntry.uParam) - 1,
+	  		                  sEntry.cStart.y + m_cFontMgr.getHeight() - 1);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawStr): {
+	  	int16_t iWidth = m_cFontMgr.getStringWidth(sEntry.str);
+	  	int16_t iX     = sEntry.cStart.x;
+	  	if (sEntry.uParam == QAS_LCD_Align_Center)
+	  		iX -= (iWidth / 2); else
+	  	if (sEntry.uParam == QAS_LCD_Align_Right)
+	  		iX -= iWidth;
+	  	cBounds = QAT_Rect_16(iX, sEntry.cStart.y, iX + iWidth - 1, sEntry.cStart.y + m_cFontMgr.getHeight() - 1);
+	  	break;
+	  }
+	  case (QAS_LCD_DLCmd_DrawImage): {
+	  	QAT_Rect_16 cSrc;
+	  	imp_imageRects(sEntry.cStart, sEntry.cImage, sEntry.cEnd, sEntry.cExtra, cSrc, cBounds);
+	  	break;
+	  }
+	  case (QAS_LCD_DLCmd_DrawRLEImage):
+	  	cBounds = QAT_Rect_16((int16_t)sEntry.cStart.x, (int16_t)sEntry.cStart.y,
+	  		                  (int16_t)sEntry.cStart.x + sEntry.cRLE.width() - 1, (int16_t)sEntry.cStart.y + sEntry.cRLE.height() - 1);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLayout): {
+	  	//Layouts are measured when laid out, so their bounds do not depend on the selected font
+	  	const QAT_Rect_16& cLayout = sEntry.pLayout->bounds();
+	  	if (!cLayout.empty())
+	  		cBounds = QAT_Rect_16(cLayout.x0 + (int16_t)sEntry.cStart.x, cLayout.y0 + (int16_t)sEntry.cStart.y,
+	  			                  cLayout.x1 + (int16_t)sEntry.cStart.x, cLayout.y1 + (int16_t)sEntry.cStart.y);
+	  	break;
+	  }
+	  default:
+	  	break;
+	}
+
+	return cBounds;
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAS_LCD Tiled Rendering Methods
+
+//QAS_LCD::imp_binDisplayList
+//QAS_LCD Tiled Rendering Method
+//
+//To be called from imp_replayTiled() method
+//Used to sort each command of the display list into the range of tiles touched by its bounding rectangle
+//Draw buffer selections are not binned, as tiles are rendered one layer at a time. Instead each drawing command is binned
+//along with the layer that was selected when it was recorded.
+//Tiles only cover the layers, so display lists that render to a surface, or that start while a surface is selected, are not binned
+//Returns QA_OK if all commands were binned, or QA_Fail if the display list contains too many commands or renders to a surface
+QA_Result QAS_LCD::imp_binDisplayList(void) {
+	QAS_LCD_DisplayListEntry sEntry;
+	QAT_Rect_16 cScreen(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	QA_Result   eResult = QA_OK;
+	uint16_t    uIdx    = 0;
+	uint8_t     uLayer  = m_eDrawLayer;
+	int8_t      iFont   = m_cFontMgr.getIndex();
+
+	m_cTileBin.clear();
+	if (m_uDrawSurface != QAS_LCD_SURFACE_NONE)
+		return QA_Fail;
+	while ((uIdx < m_cDisplayList.length()) && (eResult == QA_OK)) {
+		uint16_t    uOffset = uIdx;
+		uint8_t     uBinLayer = uLayer;
+		QAT_Rect_16 cBounds;
+
+		uIdx = m_cDisplayList.read(uIdx, sEntry);
+		switch (sEntry.eCmd) {
+		  case (QAS_LCD_DLCmd_SetDrawBuffer):
+		  	uLayer = sEntry.uParam;
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetDrawSurface):
+		  	eResult = QA_Fail;
+		  	continue;
+
+		  case (QAS_LCD_DLCmd_SetFont):
+		  	//Font is selected while binning so that text commands can be measured
+		  	m_cFontMgr.setFontByIndex(sEntry.uParam);
+		  	cBounds   = cScreen;
+		  	uBinLayer = QAS_LCD_TILEBIN_ANYLAYER;
+		  	break;
+		  case (QAS_LCD_DLCmd_SetDrawColor):
+		  case (QAS_LCD_DLCmd_SetAntiAliasing):
+		  case (QAS_LCD_DLCmd_SetBlendMode):
+		  case (QAS_LCD_DLCmd_PushClip):
+		  case (QAS_LCD_DLCmd_PopClip):
+		  	cBounds   = cScreen;
+		  	uBinLayer = QAS_LCD_TILEBIN_ANYLAYER;
+		  	break;
+
+		  default:
+		  	cBounds = imp_entryBounds(sEntry);
+		  	break;
+		}
+
+		eResult = m_cTileBin.add(uOffset, sEntry.eCmd, uBinLayer, cBounds);
+	}
+
+	//Restore font that was selected prior to binning
+	m_cFontMgr.setFontByIndex((uint8_t)iFont);
+	return eResult;
+}
+
+
+//QAS_LCD::imp_replayTiled
+//QAS_LCD Tiled Rendering Method
+//
+//To be called from imp_endDisplayList() method when tiled rendering is active
+//Used to render the display list one tile at a time for each layer that it draws to
+//If the display list contains too many commands to be binned then it is rendered without tiling
+void QAS_LCD::imp_replayTiled(void) {
+	QAS_LCD_DisplayListEntry sEntry;
+
+	if (imp_binDisplayList()) {
+		imp_replayDisplayList();
+		return;
+	}
+
+	//Store rendering state from the start of the display list, as this needs to be restored at the start of each tile
+	QAD_LTDC_LayerIdx eLayer = m_eDrawLayer;
+	uint16_t          uColor = m_uDrawColor;
+	QA_ActiveState    eAA    = m_eAntiAliasing;
+	QAS_LCD_BlendMode eBlend = m_eBlendMode;
+	uint8_t           uFont  = (uint8_t)m_cFontMgr.getIndex();
+	QAS_LCD_ClipStack cClip  = m_cClipStack;
+
+	//Render each tile of each layer
+	m_uTilePixels = 0;
+	for (uint8_t uLayer=QAD_LTDC_Layer0; uLayer<=QAD_LTDC_Layer1; uLayer++) {
+		if (!(m_cTileBin.layers() & (1 << uLayer)))
+			continue;
+
+		imp_setDrawBuffer((QAD_LTDC_LayerIdx)uLayer);
+		for (uint8_t uRow=0; uRow<QAS_LCD_TILE_ROWS; uRow++) {
+			for (uint8_t uCol=0; uCol<QAS_LCD_TILE_COLUMNS; uCol++) {
+				imp_setDrawColor(uColor);
+				imp_setAntiAliasing(eAA);
+				imp_setBlendMode(eBlend);
+				imp_setFontByIndex(uFont);
+				m_cClipStack = cClip;
+				imp_replayTile((QAD_LTDC_LayerIdx)uLayer, uCol, uRow);
+			}
+		}
+	}
+
+	//Restore rendering state from the start of the display list and then apply each state command in turn, so that rendering
+	//state is left the same as it would be had the display list been rendered without tiling
+	m_cClipStack = cClip;
+	if (m_pDrawBuffer != NULL)
+		imp_setDrawBuffer(eLayer);
+	imp_setDrawColor(uColor);
+	imp_setAntiAliasing(eAA);
+	imp_setBlendMode(eBlend);
+	imp_setFontByIndex(uFont);
+
+	uint16_t uIdx = 0;
+	while (uIdx < m_cDisplayList.length()) {
+		uIdx = m_cDisplayList.read(uIdx, sEntry);
+		switch (sEntry.eCmd) {
+		  case (QAS_LCD_DLCmd_SetDrawBuffer):
+		  case (QAS_LCD_DLCmd_SetDrawColor):
+		  case (QAS_LCD_DLCmd_SetFont):
+		  case (QAS_LCD_DLCmd_SetAntiAliasing):
+		  case (QAS_LCD_DLCmd_SetBlendMode):
+		  case (QAS_LCD_DLCmd_PushClip):
+		  case (QAS_LCD_DLCmd_PopClip):
+		  	imp_replayEntry(sEntry);
+		  	break;
+		  default:
+		  	break;
+		}
+	}
+}
+
+
+//QAS_LCD::imp_replayTile
+//QAS_LCD Tiled Rendering Method
+//
+//To be called from imp_replayTiled() method
+//Used to render an individual tile of a layer. The portion of the current draw region within the tile is read from the frame
+//buffer into the tile buffer, each binned command touching the tile is rendered into the tile buffer, and the same portion is then
+//written back to the frame buffer. The read is skipped if the first command to touch the tile is a clearBuffer() command that
+//is not limited by a clip rectangle.
+//eLayer - The layer being rendered. Must be the currently selected draw buffer
+//uCol   - The column of the tile
+//uRow   - The row of the tile
+void QAS_LCD::imp_replayTile(QAD_LTDC_LayerIdx eLayer, uint8_t uCol, uint8_t uRow) {
+	QAS_LCD_DisplayListEntry sEntry;
+	QAT_Rect_16 cTile = QAS_LCD_TileBin::tileRect(uCol, uRow);
+
+	//Determine the portion of the current draw region within the tile, returning if there is none
+	//The region prior to clipping is used, as clip rectangles are applied by the commands being rendered
+	if (!cTile.intersects(m_pBaseRegion->bounds()))
+		return;
+	m_cTileRegion.clear();
+	for (uint8_t i=0; i<m_pBaseRegion->count(); i++)
+		m_cTileRegion.add(cTile.intersect((*m_pBaseRegion)[i]));
+	if (m_cTileRegion.empty())
+		return;
+
+	//Find the first drawing command to touch the tile, returning if there is none
+	//Tracks whether a clip rectangle or a blend mode will be in effect for the command, as either requires existing pixels
+	bool     bClipped = !m_cClipStack.empty();
+	bool     bBlended = (m_eBlendMode != QAS_LCD_Blend_None);
+	uint16_t uFirst   = 0;
+	while ((uFirst < m_cTileBin.count()) && ((m_cTileBin[uFirst].uLayer != eLayer) || !m_cTileBin.touches(uFirst, uCol, uRow))) {
+		if (m_cTileBin[uFirst].eCmd == QAS_LCD_DLCmd_PushClip)
+			bClipped = true;
+		if (m_cTileBin[uFirst].eCmd == QAS_LCD_DLCmd_SetBlendMode) {
+			m_cDisplayList.read(m_cTileBin[uFirst].uOffset, sEntry);
+			bBlended = (sEntry.uParam != QAS_LCD_Blend_None);
+		}
+		uFirst++;
+	}
+	if (uFirst >= m_cTileBin.count())
+		return;
+
+	//Switch render target and base region to the tile
+	QAS_LCD_Target cFrame = m_cTarget;
+	m_cTarget     = QAS_LCD_Target(m_uTileBuffer, cTile, QAS_LCD_TILE_WIDTH, cFrame.m_eRaster);
+	m_pBaseRegion = &m_cTileRegion;
+	m_pPixelCount = &m_uTilePixels;
+	imp_updateClipRegion();
+
+	//Read existing contents of the tile from the frame buffer, unless the whole tile is about to be cleared
+	if (bClipped || bBlended || (m_cTileBin[uFirst].eCmd != QAS_LCD_DLCmd_ClearBuffer)) {
+		cFrame.raster([&](auto cRaster) {
+			for (uint8_t i=0; i<m_cTileRegion.count(); i++) {
+				const QAT_Rect_16& cRect = m_cTileRegion[i];
+				cRaster.moveRect(m_cTarget.pixel(cRect.x0, cRect.y0), m_cTarget.m_uStride,
+						             cFrame.pixel(cRect.x0, cRect.y0), cFrame.m_uStride, cRect.width(), cRect.height());
+			}
+		});
+	}
+
+	//Render state commands and each drawing command that touches the tile
+	for (uint16_t i=0; i<m_cTileBin.count(); i++) {
+		const QAS_LCD_TileBinEntry& sBin = m_cTileBin[i];
+		if ((sBin.uLayer == QAS_LCD_TILEBIN_ANYLAYER) || ((sBin.uLayer == eLayer) && m_cTileBin.touches(i, uCol, uRow))) {
+			m_cDisplayList.read(sBin.uOffset, sEntry);
+			imp_replayEntry(sEntry);
+		}
+	}
+
+	//Write tile back to the frame buffer
+	cFrame.raster([&](auto cRaster) {
+		for (uint8_t i=0; i<m_cTileRegion.count(); i++) {
+			const QAT_Rect_16& cRect = m_cTileRegion[i];
+			cRaster.moveRect(cFrame.pixel(cRect.x0, cRect.y0), cFrame.m_uStride,
+					             m_cTarget.pixel(cRect.x0, cRect.y0), m_cTarget.m_uStride, cRect.width(), cRect.height());
+			m_uPixelCount[eLayer] += cRect.area();
+		}
+	});
+
+	//Restore render target and regions to the frame buffer
+	m_cTarget = cFrame;
+	imp_updateDrawRegion();
+}
+
+
+  //-----------------------------
+  //-----------------------------
+  //QAS_LCD Acceleration Methods
+
+//QAS_LCD::imp_setAcceleration
+//QAS_LCD Acceleration Method
+//
+//To be called from static method setAcceleration()
+//Used to enable or disable acceleration using the DMA2D, and to reselect the kernels of the current render target to match
+//Any jobs queued while acceleration was active are completed before the CPU kernels are reselected
+//eState - QA_Active to enable acceleration, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+//Returns QA_OK if successful, or QA_Fail if the DMA2D driver could not be initialized
+QA_Result QAS_LCD::imp_setAcceleration(QA_ActiveState eState) {
+	if (eState && QAD_DMA2D::init())
+		return QA_Fail;
+
+	QAD_DMA2D::wait();
+	m_eAcceleration = eState;
+
+	//Reselect kernels of the current render target
+	if (m_uDrawSurface != QAS_LCD_SURFACE_NONE)
+		m_cTarget.setRaster(imp_getRaster<QAT_PixelFormat_ARGB4444>()); else
+	if (m_pDrawBuffer != NULL)
+		m_cTarget.setRaster((m_eDrawLayer == QAD_LTDC_Layer0) ? imp_getRaster<QAD_LTDC_Layer0Format>() : imp_getRaster<QAD_LTDC_Layer1Format>());
+
+	//Return
+	return QA_OK;
+}
+
+
+  //------------------------
+  //------------------------
+  //QAS_LCD Clipping Methods
+
+//QAS_LCD::imp_pushClip
+//QAS_LCD Clipping Method
+//
+//To be called from static method pushClip()
+//Used to push a clip rectangle onto the clip stack, and to update the region that rendering is clipped against
+//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the clip rectangle
+void QAS_LCD::imp_pushClip(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_PushClip, cStart, cEnd)))
+		return;
+
+	m_cClipStack.push(QAT_Rect_16(cStart, cEnd));
+	imp_updateClipRegion();
+}
+
+
+//QAS_LCD::imp_popClip
+//QAS_LCD Clipping Method
+//
+//To be called from static method popClip()
+//Used to remove the most recently pushed clip rectangle from the clip stack, and to update the region that rendering is clipped against
+void QAS_LCD::imp_popClip(void) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_PopClip)))
+		return;
+
+	m_cClipStack.pop();
+	imp_updateClipRegion();
+}
+
+
+//QAS_LCD::imp_updateClipRegion
+//QAS_LCD Clipping Method
+//
+//To be called whenever the base region or the clip stack changes
+//Used to select the region that rendering methods are clipped against. If no clip rectangle is pushed this is the base region,
+//otherwise it is the intersection of each rectangle of the base region with the current clip rectangle.
+//The selected region and pixel counter are also passed to the Font Manager to be used for text rendering methods
+void QAS_LCD::imp_updateClipRegion(void) {
+	if (m_pBaseRegion == NULL)
+		return;
+
+	if (m_cClipStack.empty()) {
+		m_pDrawRegion = m_pBaseRegion;
+	} else {
+		const QAT_Rect_16& cClip = m_cClipStack.top();
+
+		m_cClipRegion.clear();
+		if (cClip.intersects(m_pBaseRegion->bounds())) {
+			for (uint8_t i=0; i<m_pBaseRegion->count(); i++)
+				m_cClipRegion.add(cClip.intersect((*m_pBaseRegion)[i]));
+		}
+		m_pDrawRegion = &m_cClipRegion;
+	}
+
+	m_cFontMgr.setDrawRegion(m_pDrawRegion, m_pPixelCount);
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAS_LCD Dirty Rectangle Methods
+
+//QAS_LCD::imp_setDirtyTracking
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from static method setDirtyTracking()
+//Used to enable or disable dirty rectangle tracking
+//Enabling tracking invalidates both layers so that all buffers are fully drawn before partial redraws take over
+//eState - QA_Active to enable tracking, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+void QAS_LCD::imp_setDirtyTracking(QA_ActiveState eState) {
+	if (eState && !m_eDirtyTracking) {
+		imp_invalidateLayer(QAD_LTDC_Layer0);
+		imp_invalidateLayer(QAD_LTDC_Layer1);
+	}
+	m_eDirtyTracking = eState;
+
+	//Reselect region that rendering will be clipped against
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_invalidate
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from static method invalidate()
+//Used to add an area to the dirty regions of every buffer of a layer
+//eLayer - The layer to be invalidated. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+//cRect  - The area to be invalidated
+void QAS_LCD::imp_invalidate(QAD_LTDC_LayerIdx eLayer, const QAT_Rect_16& cRect) {
+	for (uint8_t i=0; i<QAD_LTDC_BUFFERCOUNT; i++)
+		m_cDirty[eLayer][i].add(cRect);
+
+	//Update draw region in case the invalidated region is currently being rendered to
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_invalidateLayer
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from static method invalidateLayer(), and during initialization
+//Used to mark every buffer of a layer as needing to be redrawn in its entirety
+//eLayer - The layer to be invalidated. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+void QAS_LCD::imp_invalidateLayer(QAD_LTDC_LayerIdx eLayer) {
+	for (uint8_t i=0; i<QAD_LTDC_BUFFERCOUNT; i++)
+		m_cDirty[eLayer][i].fill();
+
+	//Update draw region in case the invalidated region is currently being rendered to
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_expose
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from static method expose() and from imp_scrollRect() method
+//Used to add an area to the dirty region of the currently selected back-buffer only, and to ensure that the next display list is
+//presented. As the area is being changed outside of the display list, a display list being recorded is rendered immediately from
+//this point on, which also prevents the frame from being matched in future
+//cRect - The area being redrawn
+void QAS_LCD::imp_expose(const QAT_Rect_16& cRect) {
+	if (m_eListState == QAS_LCD_List_Recording)
+		imp_record(QA_Fail);
+	if (m_eListState == QAS_LCD_List_Immediate)
+		m_uListHash = QAS_LCD_DISPLAYLIST_NOHASH;
+
+	if ((m_uDrawSurface != QAS_LCD_SURFACE_NONE) || (m_pDrawBuffer == NULL) || !m_eDirtyTracking)
+		return;
+
+	QAD_LTDC_BufferIdx eBuffer = (m_eDrawLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+	m_cDirty[m_eDrawLayer][eBuffer].add(cRect);
+
+	//Update draw region, as the area is currently being rendered to
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_getDirtyArea
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from static method getDirtyArea()
+//Returns the number of pixels within the region being rendered to, prior to any clip rectangle being applied, or 0 if no draw buffer is selected
+uint32_t QAS_LCD::imp_getDirtyArea(void) {
+	if (m_pBaseRegion == NULL)
+		return 0;
+	return m_pBaseRegion->area();
+}
+
+
+//QAS_LCD::imp_updateDrawRegion
+//QAS_LCD Dirty Rectangle Method
+//
+//To be called from imp_setDrawBuffer(), imp_setDrawSurface() and imp_setDirtyTracking() methods
+//Used to select the base region that rendering methods will be clipped against, which will either be the dirty region of the
+//currently selected back-buffer, the full LCD panel if dirty rectangle tracking is inactive, or the entire surface if a surface
+//is being rendered to.
+//While a display list is rendered to a layer with automatic windowing, the base region is further limited to the area that the
+//layer's content occupies before or after the display list (see imp_measureExtents()), as all other pixels are left transparent
+//The current clip rectangle is then applied to the base region by imp_updateClipRegion()
+void QAS_LCD::imp_updateDrawRegion(void) {
+	if (m_uDrawSurface != QAS_LCD_SURFACE_NONE) {
+		m_pBaseRegion = &m_cSurfaceRegion;
+		m_pPixelCount = &m_uSurfacePixels;
+		imp_updateClipRegion();
+		return;
+	}
+
+	if (m_pDrawBuffer == NULL)
+		return;
+
+	if (m_eDirtyTracking) {
+		QAD_LTDC_BufferIdx eBuffer = (m_eDrawLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+		m_pBaseRegion = &m_cDirty[m_eDrawLayer][eBuffer];
+	} else {
+		m_pBaseRegion = &m_cFullRegion;
+	}
+	m_pPixelCount = &m_uPixelCount[m_eDrawLayer];
+
+	if (m_uExtentLayers & (1 << m_eDrawLayer)) {
+		m_cExtentRegion.clear();
+		for (uint8_t i=0; i<m_pBaseRegion->count(); i++) {
+			m_cExtentRegion.add(m_cPrevExtent[m_eDrawLayer].intersect((*m_pBaseRegion)[i]));
+			m_cExtentRegion.add(m_cListExtent[m_eDrawLayer].intersect((*m_pBaseRegion)[i]));
+		}
+		m_pBaseRegion = &m_cExtentRegion;
+	}
+
+	imp_updateClipRegion();
+}
+
+
+  //----------------------------
+  //----------------------------
+  //QAS_LCD Layer Window Methods
+
+//QAS_LCD::imp_setAutoWindow
+//QAS_LCD Layer Window Method
+//
+//To be called from static method setAutoWindow()
+//Enabling automatic windowing marks every buffer of the layer as possibly holding visible pixels anywhere, so the layer's window
+//starts shrinking once each buffer has been cleared by a display list. Disabling it sets the window back to the entire LCD panel
+//from the next flip of the layer
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+//eState - QA_Active to enable automatic windowing, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+void QAS_LCD::imp_setAutoWindow(QAD_LTDC_LayerIdx eLayer, QA_ActiveState eState) {
+	if (eState == m_eAutoWindow[eLayer])
+		return;
+
+	imp_resetExtents(eLayer);
+	if (!eState)
+		QAD_LTDC::resetLayerWindow(eLayer);
+	m_eAutoWindow[eLayer] = eState;
+}
+
+
+//QAS_LCD::imp_resetExtents
+//QAS_LCD Layer Window Method
+//
+//To be called during initialization and from imp_setAutoWindow() method
+//Used to mark every buffer of a layer as possibly holding visible pixels anywhere on the LCD panel, as is the case when the
+//contents of the buffers are not known
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+void QAS_LCD::imp_resetExtents(QAD_LTDC_LayerIdx eLayer) {
+	for (uint8_t i=0; i<QAD_LTDC_BUFFERCOUNT; i++)
+		m_cExtent[eLayer][i] = QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	m_uExtentLayers &= ~(1 << eLayer);
+}
+
+
+//QAS_LCD::imp_measureExtents
+//QAS_LCD Layer Window Method
+//
+//To be called from imp_endDisplayList() method, before the recorded display list is rendered
+//Used to determine, for each layer with automatic windowing that the display list renders to, the area of the layer's back-buffer
+//that will hold visible pixels once the display list has been rendered.
+//Pixels outside of a buffer's extent are always transparent, so rendering is limited to the buffer's existing extent, which may need
+//clearing, and to its new extent. Any pixel outside of both is transparent before and after the display list, so can be skipped.
+//Commands are measured as follows:
+//- clearBuffer() with a transparent draw color and no blend mode or clip rectangle leaves nothing visible, so resets the extent
+//- clearBuffer() with a transparent draw color otherwise changes no visible pixels, so is ignored
+//- clearBuffer() with any other draw color makes the area it clears visible
+//- All other drawing commands add their bounds (see imp_entryBounds())
+//If pixels have already been written to a back-buffer since it was last flipped, its existing extent is taken to be the entire LCD
+//panel. Layers whose pixel format does not store alpha have no transparent pixels, so are always rendered in full
+void QAS_LCD::imp_measureExtents(void) {
+	QAT_Rect_16 cScreen(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	uint8_t     uLayers = 0;
+
+	m_uExtentLayers = 0;
+	for (uint8_t i=QAD_LTDC_Layer0; i<=QAD_LTDC_Layer1; i++) {
+		QAD_LTDC_LayerIdx eLayer = (QAD_LTDC_LayerIdx)i;
+		bool              bAlpha = (eLayer == QAD_LTDC_Layer0) ? QAD_LTDC_Layer0Format::Alpha : QAD_LTDC_Layer1Format::Alpha;
+		if (!m_eAutoWindow[eLayer] || !bAlpha || !(m_uListLayers & (1 << eLayer)))
+			continue;
+
+		QAD_LTDC_BufferIdx eBuffer = (eLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+		m_cPrevExtent[eLayer] = m_uPixelCount[eLayer] ? cScreen : m_cExtent[eLayer][eBuffer];
+		m_cListExtent[eLayer] = m_cPrevExtent[eLayer];
+		uLayers |= (1 << eLayer);
+	}
+	if (!uLayers)
+		return;
+
+	//Follow the rendering state through the display list, measuring each command that renders to a measured layer
+	QAS_LCD_DisplayListEntry sEntry;
+	QAS_LCD_ClipStack cClip   = m_cClipStack;
+	uint8_t           uLayer  = ((m_uDrawSurface == QAS_LCD_SURFACE_NONE) && (m_pDrawBuffer != NULL)) ? m_eDrawLayer : 0xFF;  //0xFF while no layer is selected
+	uint16_t          uColor  = m_uDrawColor;
+	QAS_LCD_BlendMode eBlend  = m_eBlendMode;
+	int8_t            iFont   = m_cFontMgr.getIndex();
+	uint16_t          uIdx    = 0;
+
+	while (uIdx < m_cDisplayList.length()) {
+		uIdx = m_cDisplayList.read(uIdx, sEntry);
+		switch (sEntry.eCmd) {
+		  case (QAS_LCD_DLCmd_SetDrawBuffer):
+		  	uLayer = sEntry.uParam;
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetDrawSurface):
+		  	uLayer = 0xFF;
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetDrawColor):
+		  	uColor = sEntry.uColor;
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetBlendMode):
+		  	eBlend = (QAS_LCD_BlendMode)sEntry.uParam;
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetFont):
+		  	m_cFontMgr.setFontByIndex(sEntry.uParam);
+		  	continue;
+		  case (QAS_LCD_DLCmd_PushClip):
+		  	cClip.push(QAT_Rect_16(sEntry.cStart, sEntry.cEnd));
+		  	continue;
+		  case (QAS_LCD_DLCmd_PopClip):
+		  	cClip.pop();
+		  	continue;
+		  case (QAS_LCD_DLCmd_SetAntiAliasing):
+		  	continue;
+		  default:
+		  	break;
+		}
+		if ((uLayer > QAD_LTDC_Layer1) || !(uLayers & (1 << uLayer)))
+			continue;
+
+		QAT_Rect_16 cBounds = imp_entryBounds(sEntry).intersect(cScreen);
+		if (sEntry.eCmd == QAS_LCD_DLCmd_ClearBuffer) {
+			if (!cClip.empty())
+				cBounds = cBounds.intersect(cClip.top());
+			if (!(uColor >> 12)) {
+				if ((eBlend == QAS_LCD_Blend_None) && cClip.empty())
+					m_cListExtent[uLayer] = QAT_Rect_16();
+				continue;
+			}
+		}
+		m_cListExtent[uLayer] = m_cListExtent[uLayer].merge(cBounds);
+	}
+
+	//Restore font that was selected prior to measuring, and limit the region of the current draw buffer
+	m_cFontMgr.setFontByIndex((uint8_t)iFont);
+	m_uExtentLayers = uLayers;
+	imp_updateDrawRegion();
+}
+
+
+//QAS_LCD::imp_updateExtent
+//QAS_LCD Layer Window Method
+//
+//To be called from imp_flipLayer0() and imp_flipLayer1() methods, before the layer's back-buffer is flipped
+//Used to store the extent of the back-buffer, being the extent measured by imp_measureExtents() if the buffer was rendered by a
+//display list, or otherwise the entire LCD panel. If automatic windowing is active the back-buffer's window is then set to the extent,
+//or to an empty window that disables the layer if nothing is visible
+//eLayer - The layer. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+void QAS_LCD::imp_updateExtent(QAD_LTDC_LayerIdx eLayer) {
+	if (!m_eAutoWindow[eLayer])
+		return;
+
+	QAD_LTDC_BufferIdx eBuffer = (eLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+	QAT_Rect_16&       cExtent = m_cExtent[eLayer][eBuffer];
+	if (m_uExtentLayers & (1 << eLayer))
+		cExtent = m_cListExtent[eLayer]; else
+		cExtent = QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	m_uExtentLayers &= ~(1 << eLayer);
+
+	QAD_LTDC_Window sWindow = {0, 0, 0, 0, QAD_LTDC_WIDTH};
+	if (!cExtent.empty())
+		sWindow = {(uint16_t)cExtent.x0, (uint16_t)cExtent.y0, cExtent.width(), cExtent.height(), QAD_LTDC_WIDTH};
+	QAD_LTDC::setLayerWindow(eLayer, sWindow);
+}
+
+
   //-------------------------
   //-------------------------
   //QAS_LCD Rendering Methods
@@ -180,10 +1246,14 @@ void QAS_LCD::imp_setDrawColor(uint16_t uColor) {
 //QAS_LCD Rendering Method
 //
 //To be called from static clearBuffer() method
-//Used to clear the currently selected buffer to the currently selected draw color
+//Used to clear the currently selected buffer or surface to the currently selected draw color
 void QAS_LCD::imp_clearBuffer(void) {
-  for (uint32_t i=0; i<QAD_LTDC_PIXELCOUNT; i++)
-  	m_pDrawBuffer->pixel[i] = m_uDrawColor;
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_ClearBuffer)))
+		return;
+
+	imp_fillClipped(m_cTarget.m_cArea);
 }
 
 
@@ -194,7 +1264,18 @@ void QAS_LCD::imp_clearBuffer(void) {
 //Used to draw an individual pixel located at a specific position
 //cPos - A QAT_Vector2_16 class containing the X and Y coordinates for the pixel to be drawn
 void QAS_LCD::imp_drawPixel(QAT_Vector2_16& cPos) {
-  m_pDrawBuffer->pixel[cPos.x + (cPos.y & QAD_LTDC_WIDTH)].pxl(m_uDrawColor);
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawPixel, cPos)))
+		return;
+
+	if (!m_pDrawRegion->contains(cPos.x, cPos.y))
+		return;
+
+  m_cTarget.raster([&](auto cRaster) {
+  	cRaster.pixel(m_cTarget.pixel(cPos.x, cPos.y), m_uDrawColor, m_eBlendMode);
+  });
+  (*m_pPixelCount)++;
 }
 
 
@@ -213,6 +1294,11 @@ void QAS_LCD::imp_drawPixel(QAT_Vector2_16& cPos) {
 //are the least efficient.
 void QAS_LCD::imp_drawLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawLine, cStart, cEnd)))
+		return;
+
+
 	//If line is vertical then call imp_drawVLine
   if (cStart.x == cEnd.x)
   	imp_drawVLine(cStart, cEnd); else
@@ -235,20 +1321,7 @@ void QAS_LCD::imp_drawLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 //cStart - A reference to a QAT_Vector2_16 class containing the X and Y coordinates for the line's start location
 //cEnd   - A reference to a QAT_Vector2_16 class containing the X and Y coordinates for the line's end location
 void QAS_LCD::imp_drawHLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
-  uint32_t xs;
-  uint32_t xe;
-  if (cStart.x < cEnd.x) {
-  	xs = cStart.x;
-    xe = cEnd.x;
-  } else {
-  	xs = cEnd.x;
-  	xe = cStart.x;
-  }
-
-  uint32_t yofs = cStart.y * QAD_LTDC_WIDTH;
-  for (uint32_t i=xs; i<(xe+1); i++) {
-  	m_pDrawBuffer->pixel[i + yofs].pxl(m_uDrawColor);
-  }
+	imp_fillClipped(QAT_Rect_16(cStart, cEnd));
 }
 
 
@@ -261,20 +1334,7 @@ void QAS_LCD::imp_drawHLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 //cStart - A reference to a QAT_Vector2_16 class containing the X and Y coordinates for the line's start location
 //cEnd   - A reference to a QAT_Vector2_16 class containing the X and Y coordinates for the line's end location
 void QAS_LCD::imp_drawVLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
-  uint32_t ys;
-  uint32_t ye;
-  if (cStart.y < cEnd.y) {
-  	ys = cStart.y;
-  	ye = cEnd.y;
-  } else {
-  	ys = cEnd.y;
-  	ye = cStart.y;
-  }
-
-  uint32_t xofs = cStart.x;
-  for (uint32_t i=ys; i<(ye+1); i++) {
-  	m_pDrawBuffer->pixel[(i * QAD_LTDC_WIDTH) + xofs].pxl(m_uDrawColor);
-  }
+	imp_fillClipped(QAT_Rect_16(cStart, cEnd));
 }
 
 
@@ -290,66 +1350,85 @@ void QAS_LCD::imp_drawVLine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 //This method implements a variation of Bresenham's line algorithm
 //For more information on this it is worth checking out the following Wikipedia article:
 //https://en.wikipedia.org/wiki/Bresenham%27s_line_algorithm
+//
+//The line is clipped analytically against each rectangle of the region being rendered to (see QAS_LCD_Clip::lineSteps()),
+//so only the steps of the line that are within each rectangle are iterated, and no per-pixel tests are required.
 void QAS_LCD::imp_drawALine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
-  int16_t uDeltaX = QAS_LCD_ABS(cEnd.x-cStart.x);
-  int16_t uDeltaY = QAS_LCD_ABS(cEnd.y-cStart.y);
-  int16_t uX = cStart.x;
-  int16_t uY = cStart.y;
-
-  int16_t uXInc1;
-  int16_t uXInc2;
-  int16_t uYInc1;
-  int16_t uYInc2;
-
-  if (cEnd.x >= cStart.x) {
-    uXInc1 = 1;
-    uXInc2 = 1;
-  } else {
-    uXInc1 = -1;
-    uXInc2 = -1;
-  }
 
-  if (cEnd.y >= cStart.y) {
-    uYInc1 = 1;
-    uYInc2 = 1;
-  } else {
-    uYInc1 = -1;
-    uYInc2 = -1;
-  }
-
-  int16_t uDenominator;
-  int16_t uNumerator;
-  int16_t uNumAdd;
-  int16_t uNumPixels;
-
-  if (uDeltaX >= uDeltaY) {
-    uXInc1       = 0;
-    uYInc2       = 0;
-    uDenominator = uDeltaX;
-    uNumerator   = uDeltaX / 2;
-    uNumAdd      = uDeltaY;
-    uNumPixels   = uDeltaX;
-  } else {
-    uXInc2       = 0;
-    uYInc1       = 0;
-    uDenominator = uDeltaY;
-    uNumerator   = uDeltaY / 2;
-    uNumAdd      = uDeltaX;
-    uNumPixels   = uDeltaY;
-  }
-
-  for (uint16_t i=0; i<uNumPixels; i++) {
-    m_pDrawBuffer->pixel[uX+(uY*QAD_LTDC_WIDTH)].pxl(m_uDrawColor);
-
-    uNumerator += uNumAdd;
-    if (uNumerator >= uDenominator) {
-      uNumerator -= uDenominator;
-      uX += uXInc1;
-      uY += uYInc1;
-    }
-    uX += uXInc2;
-    uY += uYInc2;
-  }
+	//Reject line if it lies entirely outside of the region being rendered to
+	if (!QAT_Rect_16(cStart, cEnd).intersects(m_pDrawRegion->bounds()))
+		return;
+
+  //Vector components are treated as signed, so that lines starting or ending off the LCD panel are drawn correctly
+  int32_t iStartX = (int16_t)cStart.x;
+  int32_t iStartY = (int16_t)cStart.y;
+  int32_t iDeltaX = QAS_LCD_ABS((int16_t)cEnd.x-iStartX);
+  int32_t iDeltaY = QAS_LCD_ABS((int16_t)cEnd.y-iStartY);
+  int32_t iDirX   = ((int16_t)cEnd.x >= iStartX) ? 1 : -1;
+  int32_t iDirY   = ((int16_t)cEnd.y >= iStartY) ? 1 : -1;
+
+  //Determine major and minor axes, along with the pointer increments in bytes for a step along each axis
+  uint8_t uBytes  = m_cTarget.m_uBytes;
+  bool    bXMajor = (iDeltaX >= iDeltaY);
+  int32_t iDen    = bXMajor ? iDeltaX : iDeltaY;
+  int32_t iAdd    = bXMajor ? iDeltaY : iDeltaX;
+  int32_t iIncX   = iDirX * uBytes;
+  int32_t iIncY   = iDirY * m_cTarget.m_uStride * uBytes;
+  int32_t iMajInc = bXMajor ? iIncX : iIncY;
+  int32_t iMinInc = bXMajor ? iIncY : iIncX;
+
+  m_cTarget.raster([&](auto cRaster) {
+  	typedef typename decltype(cRaster)::Pixel Pixel;
+
+  	//Pixels are written directly, so any queued DMA2D jobs must complete first
+  	cRaster.sync();
+
+  	//Steps along the line within each rectangle of the region, writing each pixel using cPlot
+  	auto cSteps = [&](auto cPlot) {
+  		for (uint8_t uRect=0; uRect<m_pDrawRegion->count(); uRect++) {
+  			int32_t iFirst;
+  			int32_t iLast;
+  			if (!QAS_LCD_Clip::lineSteps(cStart, cEnd, (*m_pDrawRegion)[uRect], iFirst, iLast))
+  				continue;
+
+  			//Advance line to its first step within the rectangle
+  			int64_t iError   = ((int64_t)iFirst * iAdd) + (iDen / 2);
+  			int32_t iMinor   = (int32_t)(iError / iDen);
+  			int32_t iNum     = (int32_t)(iError % iDen);
+  			int16_t iX       = iStartX + (bXMajor ? iFirst : iMinor) * iDirX;
+  			int16_t iY       = iStartY + (bXMajor ? iMinor : iFirst) * iDirY;
+  			uint8_t* pDst    = (uint8_t*)m_cTarget.pixel(iX, iY);
+
+  			for (int32_t i=iFirst; i<=iLast; i++) {
+  				cPlot(pDst);
+
+  				iNum += iAdd;
+  				if (iNum >= iDen) {
+  					iNum -= iDen;
+  					pDst += iMinInc;
+  				}
+  				pDst += iMajInc;
+  			}
+  			*m_pPixelCount += (iLast - iFirst) + 1;
+  		}
+  	};
+
+  	//Select the blend path once, so that no test of the blend mode is made for each pixel
+  	if (m_eBlendMode) {
+  		QAS_LCD_BlendMode eMode  = m_eBlendMode;
+  		uint16_t          uColor = m_uDrawColor;
+  		cSteps([&](uint8_t* pDst) {
+  			cRaster.pixel(pDst, uColor, eMode);
+  		});
+  	} else {
+
+  		//Convert draw color to the pixel format of the render target once, so that each pixel is a single store
+  		Pixel uPixel = cRaster.color(m_uDrawColor);
+  		cSteps([&](uint8_t* pDst) {
+  			*(Pixel*)pDst = uPixel;
+  		});
+  	}
+  });
 }
 
 
@@ -361,39 +1440,22 @@ void QAS_LCD::imp_drawALine(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 //Rectangle will be drawn to the currently selected draw buffer using the currently selected draw color
 //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners for the rectangle
 void QAS_LCD::imp_drawRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
-  uint32_t xs;
-  uint32_t xe;
-  if (cStart.x < cEnd.x) {
-    xs = cStart.x;
-    xe = cEnd.x;
-  } else {
-    xs = cEnd.x;
-    xe = cStart.x;
-  }
 
-  uint32_t ys;
-  uint32_t ye;
-  if (cStart.y < cEnd.y) {
-    ys = cStart.y;
-    ye = cEnd.y;
-  } else {
-    ys = cEnd.y;
-    ye = cStart.y;
-  }
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawRect, cStart, cEnd)))
+		return;
+
+	QAT_Rect_16 cRect(cStart, cEnd);
 
   //Top & Bottom
-  uint32_t yt = ys*QAD_LTDC_WIDTH;
-  uint32_t yb = ye*QAD_LTDC_WIDTH;
-  for (uint32_t x=xs; x<(xe+1); x++) {
-    m_pDrawBuffer->pixel[x+yt].pxl(m_uDrawColor);
-    m_pDrawBuffer->pixel[x+yb].pxl(m_uDrawColor);
-  }
+	imp_fillClipped(QAT_Rect_16(cRect.x0, cRect.y0, cRect.x1, cRect.y0));
+	if (cRect.y1 > cRect.y0)
+		imp_fillClipped(QAT_Rect_16(cRect.x0, cRect.y1, cRect.x1, cRect.y1));
 
   //Left & Right
-  for (uint32_t y=(ys+1); y<ye; y++) {
-    m_pDrawBuffer->pixel[xs+y*QAD_LTDC_WIDTH].pxl(m_uDrawColor);
-    m_pDrawBuffer->pixel[xe+y*QAD_LTDC_WIDTH].pxl(m_uDrawColor);
-  }
+	imp_fillClipped(QAT_Rect_16(cRect.x0, cRect.y0+1, cRect.x0, cRect.y1-1));
+	if (cRect.x1 > cRect.x0)
+		imp_fillClipped(QAT_Rect_16(cRect.x1, cRect.y0+1, cRect.x1, cRect.y1-1));
 }
 
 
@@ -405,40 +1467,783 @@ void QAS_LCD::imp_drawRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
 //Rectangle will be drawn to the currently selected draw buffer using the currently selected draw color
 //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corder for the rectangle
 void QAS_LCD::imp_drawRectFill(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd) {
-  uint32_t xs;
-  uint32_t xe;
-  if (cStart.x < cEnd.x) {
-    xs = cStart.x;
-    xe = cEnd.x;
-  } else {
-    xs = cEnd.x;
-    xe = cStart.x;
-  }
 
-  uint32_t ys;
-  uint32_t ye;
-  if (cStart.y < cEnd.y) {
-    ys = cStart.y;
-    ye = cEnd.y;
-  } else {
-    ys = cEnd.y;
-    ye = cStart.y;
-  }
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawRectFill, cStart, cEnd)))
+		return;
 
-  uint32_t yofs;
-  for (uint32_t y=ys; y<(ye+1); y++) {
-    yofs = y*QAD_LTDC_WIDTH;
-    for (uint32_t x=xs; x<(xe+1); x++) {
-      m_pDrawBuffer->pixel[x+yofs].pxl(m_uDrawColor);
-    }
-  }
+	imp_fillClipped(QAT_Rect_16(cStart, cEnd));
+}
+
+
+//QAS_LCD::imp_scrollRect
+//QAS_LCD Rendering Method
+//
+//To be called by static scrollRect() methods
+//Used to move the contents of a rectangle of the current draw target by a number of columns and rows, filling the exposed strips
+//with the currently selected draw color
+//When moving upwards each line is copied from a line below it starting from the top, and when moving downwards from the bottom,
+//so that every source line is read before it is overwritten. Purely vertical moves never overlap within a line, so the lines are
+//copied with the render target's copy kernels, while moves with a horizontal component use memmove() for each line
+//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the rectangle
+//iColumns      - The number of columns to move the contents right by, or left by if negative
+//iRows         - The number of rows to move the contents down by, or up by if negative
+void QAS_LCD::imp_scrollRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, int16_t iColumns, int16_t iRows) {
+
+	//Render a display list being recorded up to this point, so that the draw target, clip rectangle and pixels are up to date
+	if (m_eListState == QAS_LCD_List_Recording)
+		imp_record(QA_Fail);
+
+	if ((m_pBaseRegion == NULL) || (!iColumns && !iRows))
+		return;
+
+	//Clip rectangle to the render target and the current clip rectangle
+	QAT_Rect_16 cRect = QAT_Rect_16(cStart, cEnd).intersect(m_cTarget.m_cArea);
+	if (!m_cClipStack.empty())
+		cRect = cRect.intersect(m_cClipStack.top());
+	if (cRect.empty())
+		return;
+
+	//Add the rectangle to the region being rendered to
+	imp_expose(cRect);
+
+	//Move the pixels that remain within the rectangle
+	uint16_t uShiftX = QAS_LCD_ABS(iColumns);
+	uint16_t uShiftY = QAS_LCD_ABS(iRows);
+	if ((uShiftX < cRect.width()) && (uShiftY < cRect.height())) {
+		uint16_t uWidth  = cRect.width() - uShiftX;
+		uint16_t uHeight = cRect.height() - uShiftY;
+		int16_t  iSrcX   = (iColumns < 0) ? cRect.x0 + uShiftX : cRect.x0;
+		int16_t  iDstX   = (iColumns < 0) ? cRect.x0 : cRect.x0 + uShiftX;
+
+		m_cTarget.raster([&](auto cRaster) {
+			if (!iColumns && (iRows < 0)) {
+				cRaster.moveRect(m_cTarget.pixel(cRect.x0, cRect.y0), m_cTarget.m_uStride,
+						             m_cTarget.pixel(cRect.x0, cRect.y0 + uShiftY), m_cTarget.m_uStride, uWidth, uHeight);
+			} else {
+				int16_t iDstY = (iRows > 0) ? cRect.y1 : cRect.y0;
+				int16_t iStep = (iRows > 0) ? -1 : 1;
+				if (iColumns)
+					cRaster.sync();
+				for (uint16_t i=0; i<uHeight; i++) {
+					if (iColumns)
+						memmove(m_cTarget.pixel(iDstX, iDstY), m_cTarget.pixel(iSrcX, iDstY - iRows), uWidth * cRaster.Bytes); else
+						cRaster.moveRect(m_cTarget.pixel(iDstX, iDstY), m_cTarget.m_uStride,
+								             m_cTarget.pixel(iSrcX, iDstY - iRows), m_cTarget.m_uStride, uWidth, 1);
+					iDstY += iStep;
+				}
+			}
+		});
+		*m_pPixelCount += (uint32_t)uWidth * uHeight;
+	} else {
+		uShiftX = cRect.width();
+		uShiftY = cRect.height();
+	}
+
+	//Fill the exposed rows across the full width of the rectangle, and then the exposed columns of the remaining rows
+	QAT_Rect_16 cRows = cRect;
+	if (iRows < 0) {
+		cRows.y0 = cRect.y1 - uShiftY + 1;
+		cRect.y1 = cRows.y0 - 1;
+	} else {
+		cRows.y1 = cRect.y0 + uShiftY - 1;
+		cRect.y0 = cRows.y1 + 1;
+	}
+	if (uShiftY)
+		imp_fillRect(cRows);
+
+	if (uShiftX && !cRect.empty()) {
+		if (iColumns < 0)
+			cRect.x0 = cRect.x1 - uShiftX + 1; else
+			cRect.x1 = cRect.x0 + uShiftX - 1;
+		imp_fillRect(cRect);
+	}
+}
+
+
+  //--------------------------------
+  //--------------------------------
+  //QAS_LCD Curved Rendering Methods
+
+//QAS_LCD::imp_drawEllipse
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawCircle() and drawEllipse() methods
+//Used to draw a non-filled ellipse
+//cCenter - The X and Y coordinates of the center of the ellipse
+//cRadii  - The X and Y radii of the ellipse
+void QAS_LCD::imp_drawEllipse(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawEllipse, cCenter, cRadii)))
+		return;
+
+	int16_t iX = (int16_t)cCenter.x;
+	int16_t iY = (int16_t)cCenter.y;
+	QAS_LCD_Shape cShape = QAS_LCD_Shape::ellipse(iX, iY, cRadii.x, cRadii.y, false);
+	if (imp_rejectShape(cShape))
+		return;
+
+	if (m_eAntiAliasing && cShape.radX() && cShape.radY())
+		imp_drawEdgeAA(QAT_Rect_16(iX, iY, iX, iY), cShape.radX(), cShape.radY(), QAS_LCD_Edge_Outline, NULL); else
+		imp_drawShape(cShape, NULL);
+}
+
+
+//QAS_LCD::imp_drawEllipseFill
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawCircleFill() and drawEllipseFill() methods
+//Used to draw a filled ellipse
+//cCenter - The X and Y coordinates of the center of the ellipse
+//cRadii  - The X and Y radii of the ellipse
+void QAS_LCD::imp_drawEllipseFill(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawEllipseFill, cCenter, cRadii)))
+		return;
+
+	//When anti-aliased, the solid interior only includes pixels within the exact radii, and the partially covered pixels outside
+	//of it are drawn by imp_drawEdgeAA()
+	int16_t iX  = (int16_t)cCenter.x;
+	int16_t iY  = (int16_t)cCenter.y;
+	bool    bAA = m_eAntiAliasing && cRadii.x && cRadii.y;
+	QAS_LCD_Shape cShape = QAS_LCD_Shape::ellipse(iX, iY, cRadii.x, cRadii.y, bAA);
+	if (imp_rejectShape(cShape))
+		return;
+
+	imp_fillShape(cShape, NULL, NULL);
+	if (bAA)
+		imp_drawEdgeAA(QAT_Rect_16(iX, iY, iX, iY), cShape.radX(), cShape.radY(), QAS_LCD_Edge_Outer, NULL);
+}
+
+
+//QAS_LCD::imp_drawArc
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawArc() method
+//Used to draw a single pixel width arc of a circle
+//cCenter - The X and Y coordinates of the center of the arc
+//cRadii  - The radius of the arc is stored in the X component
+//cAngles - The start and end angles of the arc in degrees, stored as signed values
+void QAS_LCD::imp_drawArc(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii, QAT_Vector2_16& cAngles) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawArc, cCenter, cRadii, cAngles)))
+		return;
+
+	int16_t iX = (int16_t)cCenter.x;
+	int16_t iY = (int16_t)cCenter.y;
+	QAS_LCD_Shape  cShape = QAS_LCD_Shape::ellipse(iX, iY, cRadii.x, cRadii.x, false);
+	QAS_LCD_Sector cSector(iX, iY, (int16_t)cAngles.x, (int16_t)cAngles.y);
+	if (imp_rejectShape(cShape))
+		return;
+
+	if (m_eAntiAliasing && cShape.radX())
+		imp_drawEdgeAA(QAT_Rect_16(iX, iY, iX, iY), cShape.radX(), cShape.radX(), QAS_LCD_Edge_Outline, &cSector); else
+		imp_drawShape(cShape, &cSector);
+}
+
+
+//QAS_LCD::imp_drawArcFill
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawArcFill() method
+//Used to draw a filled arc between an outer and inner radius. An inner radius of 0 draws a filled pie slice
+//cCenter - The X and Y coordinates of the center of the arc
+//cRadii  - The outer radius of the arc is stored in the X component, and the inner radius in the Y component
+//cAngles - The start and end angles of the arc in degrees, stored as signed values
+void QAS_LCD::imp_drawArcFill(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii, QAT_Vector2_16& cAngles) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawArcFill, cCenter, cRadii, cAngles)))
+		return;
+
+	if (cRadii.y >= cRadii.x)
+		return;
+
+	int16_t iX  = (int16_t)cCenter.x;
+	int16_t iY  = (int16_t)cCenter.y;
+	bool    bAA = m_eAntiAliasing;
+	QAS_LCD_Shape  cOuter = QAS_LCD_Shape::ellipse(iX, iY, cRadii.x, cRadii.x, bAA);
+	QAS_LCD_Shape  cInner = QAS_LCD_Shape::ellipse(iX, iY, cRadii.y, cRadii.y, bAA);
+	QAS_LCD_Sector cSector(iX, iY, (int16_t)cAngles.x, (int16_t)cAngles.y);
+	if (imp_rejectShape(cOuter))
+		return;
+
+	imp_fillShape(cOuter, cRadii.y ? &cInner : NULL, &cSector);
+	if (bAA) {
+		QAT_Rect_16 cCenters(iX, iY, iX, iY);
+		imp_drawEdgeAA(cCenters, cOuter.radX(), cOuter.radX(), QAS_LCD_Edge_Outer, &cSector);
+		if (cRadii.y)
+			imp_drawEdgeAA(cCenters, cInner.radX(), cInner.radX(), QAS_LCD_Edge_Inner, &cSector);
+	}
+}
+
+
+//QAS_LCD::imp_drawRoundRect
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawRoundRect() method
+//Used to draw a non-filled rectangle with rounded corners
+//cStart & cEnd - The X and Y coordinates of the diagonally opposing corners for the rectangle
+//uRadius       - The radius of the corners
+void QAS_LCD::imp_drawRoundRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, uint16_t uRadius) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) &&
+			imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawRoundRect, cStart, cEnd, QAT_Vector2_16(uRadius, 0))))
+		return;
+
+	QAT_Rect_16   cRect(cStart, cEnd);
+	QAS_LCD_Shape cShape = QAS_LCD_Shape::roundRect(cRect, uRadius, false);
+	if (imp_rejectShape(cShape))
+		return;
+
+	//Rectangles without rounded corners are drawn as normal
+	int32_t iRad = cShape.radX();
+	if (!iRad) {
+		imp_drawRect(cStart, cEnd);
+		return;
+	}
+
+	if (!m_eAntiAliasing) {
+		imp_drawShape(cShape, NULL);
+		return;
+	}
+
+	//When anti-aliased the straight edges are drawn between the centers of the corners, and each corner is drawn as a
+	//quadrant of a circle around its own center
+	QAT_Rect_16 cCenters(cRect.x0 + iRad, cRect.y0 + iRad, cRect.x1 - iRad, cRect.y1 - iRad);
+	if ((cCenters.x1 - cCenters.x0) > 1) {
+		imp_fillClipped(QAT_Rect_16(cCenters.x0+1, cRect.y0, cCenters.x1-1, cRect.y0));
+		imp_fillClipped(QAT_Rect_16(cCenters.x0+1, cRect.y1, cCenters.x1-1, cRect.y1));
+	}
+	if ((cCenters.y1 - cCenters.y0) > 1) {
+		imp_fillClipped(QAT_Rect_16(cRect.x0, cCenters.y0+1, cRect.x0, cCenters.y1-1));
+		imp_fillClipped(QAT_Rect_16(cRect.x1, cCenters.y0+1, cRect.x1, cCenters.y1-1));
+	}
+	imp_drawEdgeAA(cCenters, iRad, iRad, QAS_LCD_Edge_Outline, NULL);
+}
+
+
+//QAS_LCD::imp_drawRoundRectFill
+//QAS_LCD Curved Rendering Method
+//
+//To be called from static drawRoundRectFill() method
+//Used to draw a filled rectangle with rounded corners
+//cStart & cEnd - The X and Y coordinates of the diagonally opposing corners for the rectangle
+//uRadius       - The radius of the corners
+void QAS_LCD::imp_drawRoundRectFill(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, uint16_t uRadius) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) &&
+			imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawRoundRectFill, cStart, cEnd, QAT_Vector2_16(uRadius, 0))))
+		return;
+
+	QAT_Rect_16   cRect(cStart, cEnd);
+	bool          bAA    = m_eAntiAliasing;
+	QAS_LCD_Shape cShape = QAS_LCD_Shape::roundRect(cRect, uRadius, bAA);
+	if (imp_rejectShape(cShape))
+		return;
+
+	imp_fillShape(cShape, NULL, NULL);
+
+	int32_t iRad = cShape.radX();
+	if (bAA && iRad)
+		imp_drawEdgeAA(QAT_Rect_16(cRect.x0 + iRad, cRect.y0 + iRad, cRect.x1 - iRad, cRect.y1 - iRad), iRad, iRad, QAS_LCD_Edge_Outer, NULL);
+}
+
+
+  //-------------------------------
+  //-------------------------------
+  //QAS_LCD Image Rendering Methods
+
+//QAS_LCD::imp_drawImage
+//QAS_LCD Image Rendering Method
+//
+//To be called from static drawImage() and drawImageRect() methods
+//Used to draw a rectangular area of an image, reading the image directly from the memory it is stored in
+//cPos      - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the area to be drawn
+//cImage    - A QAS_LCD_Image class describing the image to be drawn
+//cSrcStart - A QAT_Vector2_16 class containing the image coordinates of one corner of the area
+//cSrcEnd   - A QAT_Vector2_16 class containing the image coordinates of the diagonally opposing corner of the area
+//eMode     - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+void QAS_LCD::imp_drawImage(QAT_Vector2_16& cPos, const QAS_LCD_Image& cImage, QAT_Vector2_16& cSrcStart, QAT_Vector2_16& cSrcEnd, QAS_LCD_BlitMode eMode) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) &&
+			imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawImage, cPos, cSrcStart, cSrcEnd, (uint8_t)eMode, cImage)))
+		return;
+
+	QAT_Rect_16 cSrc;
+	QAT_Rect_16 cDst;
+	if (!imp_imageRects(cPos, cImage, cSrcStart, cSrcEnd, cSrc, cDst) || !cDst.intersects(m_pDrawRegion->bounds()))
+		return;
+
+	QAS_LCD_BlendMode eBlend = m_eBlendMode ? m_eBlendMode : QAS_LCD_Blend_SrcOver;
+
+	//Draw the portion of the image within each rectangle of the region, offsetting the source by the amount that was clipped
+	m_cTarget.raster([&](auto cRaster) {
+		for (uint8_t i=0; i<m_pDrawRegion->count(); i++) {
+			QAT_Rect_16 cClip = cDst.intersect((*m_pDrawRegion)[i]);
+			if (cClip.empty())
+				continue;
+
+			void*           pDst = m_cTarget.pixel(cClip.x0, cClip.y0);
+			const uint16_t* pSrc = cImage.pixel(cSrc.x0 + (cClip.x0 - cDst.x0), cSrc.y0 + (cClip.y0 - cDst.y0));
+			switch (eMode) {
+			  case (QAS_LCD_Blit_Opaque):
+			  	cRaster.copyRect(pDst, m_cTarget.m_uStride, pSrc, cImage.m_uStride, cClip.width(), cClip.height(), QAS_LCD_Blend_None);
+			  	break;
+			  case (QAS_LCD_Blit_ColorKey):
+			  	cRaster.copyKeyRect(pDst, m_cTarget.m_uStride, pSrc, cImage.m_uStride, cClip.width(), cClip.height(), cImage.m_uColorKey);
+			  	break;
+			  case (QAS_LCD_Blit_Alpha):
+			  	cRaster.copyRect(pDst, m_cTarget.m_uStride, pSrc, cImage.m_uStride, cClip.width(), cClip.height(), eBlend);
+			  	break;
+			}
+			*m_pPixelCount += cClip.area();
+		}
+	});
+}
+
+
+//QAS_LCD::imp_imageRects
+//QAS_LCD Image Rendering Method
+//
+//To be called from imp_drawImage() and imp_binDisplayList() methods
+//Used to determine the source and destination rectangles of an image rendering method
+//The source rectangle is limited to the area of the image, and the destination rectangle is the same size as the resulting source rectangle
+//cPos      - The screen coordinates for the upper-left location of the area to be drawn
+//cImage    - The image to be drawn
+//cSrcStart - The image coordinates of one corner of the area
+//cSrcEnd   - The image coordinates of the diagonally opposing corner of the area
+//cSrc      - Reference to a QAT_Rect_16 class that the source rectangle, in image coordinates, is to be stored into
+//cDst      - Reference to a QAT_Rect_16 class that the destination rectangle, in screen coordinates, is to be stored into
+//Returns true if any of the image is to be drawn, or false if the source rectangle lies entirely outside of the image
+bool QAS_LCD::imp_imageRects(const QAT_Vector2_16& cPos, const QAS_LCD_Image& cImage, const QAT_Vector2_16& cSrcStart, const QAT_Vector2_16& cSrcEnd,
+		                         QAT_Rect_16& cSrc, QAT_Rect_16& cDst) {
+	cSrc = cImage.source(QAT_Rect_16(cSrcStart, cSrcEnd));
+	cDst = QAT_Rect_16((int16_t)cPos.x, (int16_t)cPos.y, (int16_t)cPos.x + cSrc.width() - 1, (int16_t)cPos.y + cSrc.height() - 1);
+	return !cSrc.empty();
+}
+
+
+//QAS_LCD::imp_drawRLEImage
+//QAS_LCD Image Rendering Method
+//
+//To be called from static drawImage() method
+//Used to draw a run-length encoded image, decoding each row directly into the draw buffer
+//Rows above and below the region being rendered to are never decoded, and the runs of each visible row are clipped to the region
+//cPos   - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the image
+//cImage - A QAS_LCD_RLEImage class describing the encoded image to be drawn
+//eMode  - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+void QAS_LCD::imp_drawRLEImage(QAT_Vector2_16& cPos, const QAS_LCD_RLEImage& cImage, QAS_LCD_BlitMode eMode) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawRLEImage, cPos, (uint8_t)eMode, cImage)))
+		return;
+
+	if (!cImage.valid())
+		return;
+
+	QAT_Rect_16 cDst((int16_t)cPos.x, (int16_t)cPos.y, (int16_t)cPos.x + cImage.width() - 1, (int16_t)cPos.y + cImage.height() - 1);
+	if (!cDst.intersects(m_pDrawRegion->bounds()))
+		return;
+
+	QAS_LCD_BlendMode eBlend = (eMode == QAS_LCD_Blit_Alpha) ? (m_eBlendMode ? m_eBlendMode : QAS_LCD_Blend_SrcOver) : QAS_LCD_Blend_None;
+
+	//Decode the portion of each row within each rectangle of the region
+	m_cTarget.raster([&](auto cRaster) {
+		for (uint8_t i=0; i<m_pDrawRegion->count(); i++) {
+			QAT_Rect_16 cClip = cDst.intersect((*m_pDrawRegion)[i]);
+			if (cClip.empty())
+				continue;
+
+			for (int16_t y=cClip.y0; y<=cClip.y1; y++)
+				*m_pPixelCount += QAS_LCD_RLE::drawRow(cRaster, cImage, y - cDst.y0, m_cTarget.pixel(cClip.x0, y), cClip.x0 - cDst.x0,
+						                                   cClip.width(), eBlend);
+		}
+	});
+}
+
+
+  //------------------------------
+  //------------------------------
+  //QAS_LCD Font Rendering Methods
+
+//QAS_LCD::imp_setFontByName
+//QAS_LCD Font Rendering Method
+//
+//To be called from static setFontByName() method
+//Used to set the selected font/typeface to be used for text rendering
+//When recording a display list the font is stored by handle, so the font is only searched for once per frame
+//strName - The name of the font to be selected
+void QAS_LCD::imp_setFontByName(const char* strName) {
+	if (m_eListState == QAS_LCD_List_Recording) {
+		imp_setFontByIndex((uint8_t)m_cFontMgr.find(strName));
+		return;
+	}
+
+	m_cFontMgr.setFontByName(strName);
 }
 
 
+//QAS_LCD::imp_setFontByHash
+//QAS_LCD Font Rendering Method
+//
+//To be called from static setFontByHash() method
+//Used to set the selected font/typeface to be used for text rendering
+//When recording a display list the font is stored by handle, so the hash table only needs to be searched once per frame
+//uHash - The hash of the name of the font to be selected
+void QAS_LCD::imp_setFontByHash(uint32_t uHash) {
+	if (m_eListState == QAS_LCD_List_Recording) {
+		imp_setFontByIndex((uint8_t)m_cFontMgr.find(uHash));
+		return;
+	}
 
+	m_cFontMgr.setFontByHash(uHash);
+}
 
 
+//QAS_LCD::imp_setFontByIndex
+//QAS_LCD Font Rendering Method
+//
+//To be called from static setFontByIndex() method
+//Used to set the selected font/typeface to be used for text rendering
+//uIdx - The handle (index) of the font to be selected
+void QAS_LCD::imp_setFontByIndex(uint8_t uIdx) {
 
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_SetFont, uIdx)))
+		return;
 
+	m_cFontMgr.setFontByIndex(uIdx);
+}
 
 
+//QAS_LCD::imp_loadFonts
+//QAS_LCD Font Rendering Method
+//
+//To be called from static loadFonts() method
+//Used to read a font image from a block device into the font store, and add each of its fonts
+//pRead      - Function used to read blocks from the device
+//uBlock     - The address of the first block of the image
+//uBlockSize - The size in bytes of each block
+//Returns the number of fonts added
+uint8_t QAS_LCD::imp_loadFonts(QAS_LCD_FontReadFunc pRead, uint32_t uBlock, uint32_t uBlockSize) {
+	const uint8_t* pImage;
+	uint32_t       uSize = m_cFontStore.load(pRead, uBlock, uBlockSize, pImage);
+	return m_cFontMgr.addImage(pImage, uSize);
+}
+
+
+//QAS_LCD::imp_drawChar
+//QAS_LCD Font Rendering Method
+//
+//To be called from static drawChar() method
+//Used to draw an individual character using the currently selected font/typeface
+//cPos - The position of the upper-left location of the character to be drawn
+//ch   - The specific character to be rendered
+void QAS_LCD::imp_drawChar(QAT_Vector2_16& cPos, char ch) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawChar, cPos, ch)))
+		return;
+
+	m_cFontMgr.drawChar(cPos, ch);
+}
+
+
+//QAS_LCD::imp_drawStr
+//QAS_LCD Font Rendering Method
+//
+//To be called from static drawStrL(), drawStrC() and drawStrR() methods
+//Used to draw a string of characters using the currently selected font/typeface
+//eAlign - The alignment of the string relative to cPos. Member of QAS_LCD_TextAlign enum defined in QAS_LCD_Fonts.hpp
+//cPos   - The position the string is to be aligned to
+//str    - The C-style string to be drawn
+void QAS_LCD::imp_drawStr(QAS_LCD_TextAlign eAlign, QAT_Vector2_16& cPos, const char* str) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawStr, cPos, (uint8_t)eAlign, str)))
+		return;
+
+	switch (eAlign) {
+	  case (QAS_LCD_Align_Left):
+	  	m_cFontMgr.drawStrL(cPos, str);
+	  	break;
+	  case (QAS_LCD_Align_Center):
+	  	m_cFontMgr.drawStrC(cPos, str);
+	  	break;
+	  case (QAS_LCD_Align_Right):
+	  	m_cFontMgr.drawStrR(cPos, str);
+	  	break;
+	}
+}
+
+
+//QAS_LCD::imp_drawLayout
+//QAS_LCD Font Rendering Method
+//
+//To be called from static drawLayout() method
+//Used to draw a text layout with the font it was laid out with
+//cPos    - The position of the upper-left location of the layout's box
+//cLayout - The text layout to be drawn
+void QAS_LCD::imp_drawLayout(QAT_Vector2_16& cPos, const QAS_LCD_TextLayout& cLayout) {
+
+	//Record command if a display list is being recorded
+	if ((m_eListState == QAS_LCD_List_Recording) && imp_record(m_cDisplayList.add(QAS_LCD_DLCmd_DrawLayout, cPos, &cLayout, cLayout.hash())))
+		return;
+
+	m_cFontMgr.drawLayout(cPos, cLayout);
+}
+
+
+  //---------------------------------
+  //---------------------------------
+  //QAS_LCD Rendering Support Methods
+
+//QAS_LCD::imp_fillClipped
+//QAS_LCD Rendering Support Method
+//
+//Used to fill a rectangle with the currently selected draw color, clipped against the region currently being rendered to
+//As the rectangles of a region never overlap, each pixel of the filled rectangle will be written at most once
+//cRect - The rectangle to be filled
+void QAS_LCD::imp_fillClipped(const QAT_Rect_16& cRect) {
+
+	//Reject rectangle if it lies entirely outside of the region being rendered to
+	if (!cRect.intersects(m_pDrawRegion->bounds()))
+		return;
+
+	//Fill the portion of the rectangle within each rectangle of the region
+	for (uint8_t i=0; i<m_pDrawRegion->count(); i++) {
+		QAT_Rect_16 cClip = cRect.intersect((*m_pDrawRegion)[i]);
+		if (!cClip.empty())
+			imp_fillRect(cClip);
+	}
+}
+
+
+//QAS_LCD::imp_fillRect
+//QAS_LCD Rendering Support Method
+//
+//Used to fill a rectangle with the currently selected draw color, using the render target's kernels. For ARGB4444 targets this
+//uses the word-wide span kernels in QAS_LCD_Span.hpp, or the word-wide blending kernels in QAS_LCD_Blend.hpp if a blend mode is selected
+//The rectangle must already be clipped to the area of the current render target
+//cRect - The rectangle to be filled
+void QAS_LCD::imp_fillRect(const QAT_Rect_16& cRect) {
+	m_cTarget.raster([&](auto cRaster) {
+		cRaster.fillRect(m_cTarget.pixel(cRect.x0, cRect.y0), m_cTarget.m_uStride, cRect.width(), cRect.height(), m_uDrawColor, m_eBlendMode);
+	});
+  *m_pPixelCount += cRect.area();
+}
+
+
+//QAS_LCD::imp_fillSpan
+//QAS_LCD Rendering Support Method
+//
+//Used to fill a single horizontal span with the currently selected draw color, clipped against the region currently being rendered to
+//iY     - The row of the span
+//iLeft  - The left-most pixel of the span
+//iRight - The right-most pixel of the span
+void QAS_LCD::imp_fillSpan(int32_t iY, int32_t iLeft, int32_t iRight) {
+	m_cTarget.raster([&](auto cRaster) {
+		for (uint8_t i=0; i<m_pDrawRegion->count(); i++) {
+			const QAT_Rect_16& cRect = (*m_pDrawRegion)[i];
+			if ((iY < cRect.y0) || (iY > cRect.y1))
+				continue;
+
+			int32_t iX0 = (iLeft > cRect.x0) ? iLeft : cRect.x0;
+			int32_t iX1 = (iRight < cRect.x1) ? iRight : cRect.x1;
+			if (iX0 <= iX1) {
+				cRaster.fill(m_cTarget.pixel(iX0, iY), (iX1 - iX0) + 1, m_uDrawColor, m_eBlendMode);
+				*m_pPixelCount += (iX1 - iX0) + 1;
+			}
+		}
+	});
+}
+
+
+//QAS_LCD::imp_rejectShape
+//QAS_LCD Rendering Support Method
+//
+//Used to determine whether a curved shape lies entirely outside of the region being rendered to
+//The bounds of the shape are increased by one pixel to allow for anti-aliased edges
+//cShape - The shape to be tested
+//Returns true if the shape can be rejected, or false if it needs to be drawn
+bool QAS_LCD::imp_rejectShape(const QAS_LCD_Shape& cShape) {
+	QAT_Rect_16 cBounds = cShape.bounds();
+	return !QAT_Rect_16(cBounds.x0-1, cBounds.y0-1, cBounds.x1+1, cBounds.y1+1).intersects(m_pDrawRegion->bounds());
+}
+
+
+//QAS_LCD::imp_drawShape
+//QAS_LCD Rendering Support Method
+//
+//Used to draw the single pixel width outline of a curved shape, one row at a time
+//Only rows within the region being rendered to are processed
+//cShape  - The shape to be drawn
+//pSector - Pointer to the angular range the outline is to be limited to, or NULL to draw the entire outline
+void QAS_LCD::imp_drawShape(const QAS_LCD_Shape& cShape, const QAS_LCD_Sector* pSector) {
+	QAS_LCD_CurveSpan sSpans[QAS_LCD_CURVE_SPANLENGTH];
+	QAS_LCD_CurveSpan sClipped[QAS_LCD_CURVE_SPANLENGTH];
+	QAT_Rect_16 cRows = cShape.bounds().intersect(m_pDrawRegion->bounds());
+
+	for (int32_t iY=cRows.y0; iY<=cRows.y1; iY++) {
+		uint8_t uCount = cShape.outline(iY, sSpans);
+		const QAS_LCD_CurveSpan* pSpans = sSpans;
+		if (pSector) {
+			uCount = pSector->clip(iY, sSpans, uCount, sClipped);
+			pSpans = sClipped;
+		}
+
+		for (uint8_t i=0; i<uCount; i++)
+			imp_fillSpan(iY, pSpans[i].iLeft, pSpans[i].iRight);
+	}
+}
+
+
+//QAS_LCD::imp_fillShape
+//QAS_LCD Rendering Support Method
+//
+//Used to fill a curved shape as a single horizontal span per row, optionally excluding an inner shape and limited to an angular range
+//Only rows within the region being rendered to are processed
+//cShape  - The shape to be filled
+//pInner  - Pointer to a shape within cShape that is to be excluded, or NULL if the entire shape is to be filled
+//pSector - Pointer to the angular range the fill is to be limited to, or NULL to fill the entire shape
+void QAS_LCD::imp_fillShape(const QAS_LCD_Shape& cShape, const QAS_LCD_Shape* pInner, const QAS_LCD_Sector* pSector) {
+	QAS_LCD_CurveSpan sSpans[QAS_LCD_CURVE_SPANLENGTH];
+	QAS_LCD_CurveSpan sClipped[QAS_LCD_CURVE_SPANLENGTH];
+	QAT_Rect_16 cRows = cShape.bounds().intersect(m_pDrawRegion->bounds());
+
+	for (int32_t iY=cRows.y0; iY<=cRows.y1; iY++) {
+		int32_t iLeft, iRight, iInnerL, iInnerR;
+		uint8_t uCount = 0;
+
+		if (!cShape.span(iY, iLeft, iRight))
+			continue;
+
+		//Split row either side of the inner shape
+		if (pInner && pInner->span(iY, iInnerL, iInnerR)) {
+			if (iInnerL > iLeft) {
+				sSpans[uCount].iLeft  = iLeft;
+				sSpans[uCount].iRight = iInnerL - 1;
+				uCount++;
+			}
+			if (iInnerR < iRight) {
+				sSpans[uCount].iLeft  = iInnerR + 1;
+				sSpans[uCount].iRight = iRight;
+				uCount++;
+			}
+		} else {
+			sSpans[0].iLeft  = iLeft;
+			sSpans[0].iRight = iRight;
+			uCount = 1;
+		}
+
+		const QAS_LCD_CurveSpan* pSpans = sSpans;
+		if (pSector) {
+			uCount = pSector->clip(iY, sSpans, uCount, sClipped);
+			pSpans = sClipped;
+		}
+
+		for (uint8_t i=0; i<uCount; i++)
+			imp_fillSpan(iY, pSpans[i].iLeft, pSpans[i].iRight);
+	}
+}
+
+
+//QAS_LCD::imp_drawEdgeAA
+//QAS_LCD Rendering Support Method
+//
+//Used to draw the anti-aliased edge of an ellipse, or of the corners of a rounded rectangle
+//This is a fixed-point variation of Xiaolin Wu's algorithm. The flatter portion of each quadrant steps along X and the steeper
+//portion steps along Y, with the exact position of the curve at each step found with a single integer square root as an
+//8bit fixed-point value. The whole part selects the pair of pixels either side of the curve and the fractional part
+//gives their coverage.
+//cCenters - The centers of the left and top quadrants (x0, y0) and of the right and bottom quadrants (x1, y1). These are equal for ellipses
+//iRadX    - The X radius. Must be greater than 0
+//iRadY    - The Y radius. Must be greater than 0
+//eEdge    - Which pixels either side of the curve are to be drawn. Member of QAS_LCD_CurveEdge enum defined in QAS_LCD_Curve.hpp
+//pSector  - Pointer to the angular range the edge is to be limited to, or NULL to draw the entire edge
+void QAS_LCD::imp_drawEdgeAA(const QAT_Rect_16& cCenters, int32_t iRadX, int32_t iRadY, QAS_LCD_CurveEdge eEdge, const QAS_LCD_Sector* pSector) {
+	uint64_t uRadX2 = (uint64_t)iRadX * iRadX;
+	uint64_t uRadY2 = (uint64_t)iRadY * iRadY;
+	int32_t  iLimit = uRadX2 / QAS_LCD_Curve::isqrt(uRadX2 + uRadY2);
+
+	//Flatter portion, stepping along X until the slope of the curve reaches 45 degrees
+	for (int32_t iX=0; iX<=iLimit; iX++) {
+		uint32_t uPos  = QAS_LCD_Curve::isqrt((uRadY2 * (uRadX2 - (uint64_t)iX * iX)) << 16) / iRadX;
+		int32_t  iY    = uPos >> 8;
+		uint8_t  uFrac = uPos & 0xFF;
+
+		if (eEdge != QAS_LCD_Edge_Outer)
+			imp_plotQuadrantsAA(cCenters, iX, iY, 0xFF - uFrac, pSector);
+		if (eEdge != QAS_LCD_Edge_Inner)
+			imp_plotQuadrantsAA(cCenters, iX, iY+1, uFrac, pSector);
+	}
+
+	//Steeper portion, stepping along Y until reaching the columns already drawn
+	for (int32_t iY=0; iY<=iRadY; iY++) {
+		uint32_t uPos  = QAS_LCD_Curve::isqrt((uRadX2 * (uRadY2 - (uint64_t)iY * iY)) << 16) / iRadY;
+		int32_t  iX    = uPos >> 8;
+		uint8_t  uFrac = uPos & 0xFF;
+		if (iX <= iLimit)
+			break;
+
+		if (eEdge != QAS_LCD_Edge_Outer)
+			imp_plotQuadrantsAA(cCenters, iX, iY, 0xFF - uFrac, pSector);
+		if (eEdge != QAS_LCD_Edge_Inner)
+			imp_plotQuadrantsAA(cCenters, iX+1, iY, uFrac, pSector);
+	}
+}
+
+
+//QAS_LCD::imp_plotQuadrantsAA
+//QAS_LCD Rendering Support Method
+//
+//Used to draw a partially covered pixel into each of the four quadrants of a curve
+//The pixel is drawn with the RGB components of the current draw color, and its alpha scaled by the coverage, and is blended with
+//the existing pixel using the current blend mode, or source-over blending if no blend mode is selected, in the same manner as images.
+//Writing the pixel without blending would replace the existing pixel with a partially transparent one, leaving a fringe around
+//the curve on targets whose pixels store alpha.
+//Pixels on the axes are not repeated if the quadrants share a center
+//cCenters  - The centers of the left and top quadrants (x0, y0) and of the right and bottom quadrants (x1, y1)
+//iX & iY   - The position of the pixel relative to the center of the bottom-right quadrant
+//uCoverage - The coverage of the pixel, from 0 (none) to 255 (full)
+//pSector   - Pointer to the angular range pixels are to be limited to, or NULL if not limited
+void QAS_LCD::imp_plotQuadrantsAA(const QAT_Rect_16& cCenters, int32_t iX, int32_t iY, uint8_t uCoverage, const QAS_LCD_Sector* pSector) {
+	uint32_t uAlpha = (((m_uDrawColor >> 12) * uCoverage) + 127) / 255;
+	if (!uAlpha)
+		return;
+	uint16_t uColor = (m_uDrawColor & 0x0FFF) | (uAlpha << 12);
+
+	QAS_LCD_BlendMode eMode = m_eBlendMode ? m_eBlendMode : QAS_LCD_Blend_SrcOver;
+
+	int32_t iPosX[2] = {cCenters.x1 + iX, cCenters.x0 - iX};
+	int32_t iPosY[2] = {cCenters.y1 + iY, cCenters.y0 - iY};
+	uint8_t uCountX  = (iX || (cCenters.x0 != cCenters.x1)) ? 2 : 1;
+	uint8_t uCountY  = (iY || (cCenters.y0 != cCenters.y1)) ? 2 : 1;
+	const QAT_Rect_16& cBounds = m_pDrawRegion->bounds();
+
+	m_cTarget.raster([&](auto cRaster) {
+		for (uint8_t j=0; j<uCountY; j++) {
+			if ((iPosY[j] < cBounds.y0) || (iPosY[j] > cBounds.y1))
+				continue;
+
+			for (uint8_t i=0; i<uCountX; i++) {
+				if ((iPosX[i] < cBounds.x0) || (iPosX[i] > cBounds.x1))
+					continue;
+				if (!m_pDrawRegion->contains(iPosX[i], iPosY[j]))
+					continue;
+				if (pSector && !pSector->contains(iPosX[i], iPosY[j]))
+					continue;
+
+				cRaster.pixel(m_cTarget.pixel(iPosX[i], iPosY[j]), uColor, eMode);
+				(*m_pPixelCount)++;
+			}
+		}
+	});
+}
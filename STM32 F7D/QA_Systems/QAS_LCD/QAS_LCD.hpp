@@ -26,9 +26,39 @@
 #include "QAD_LTDC.hpp"
 
 #include "QAT_Vector.hpp"
+#include "QAT_Rect.hpp"
+
+  //Region and Clipping System Includes
+#include "QAS_LCD_Region.hpp"
+#include "QAS_LCD_Clip.hpp"
+
+  //Span Fill Kernel, Blending Kernel, Rasterizer and Render Target Includes
+#include "QAS_LCD_Span.hpp"
+#include "QAS_LCD_Blend.hpp"
+#include "QAS_LCD_Raster.hpp"
+#include "QAS_LCD_Accel.hpp"
+#include "QAS_LCD_Target.hpp"
+
+  //Curved Primitive Includes
+#include "QAS_LCD_Curve.hpp"
+
+  //Image Includes
+#include "QAS_LCD_Image.hpp"
+#include "QAS_LCD_RLE.hpp"
+
+  //Display List Includes
+#include "QAS_LCD_DisplayList.hpp"
+
+  //Tiled Rendering Includes
+#include "QAS_LCD_Tile.hpp"
+
+  //Offscreen Surface Includes
+#include "QAS_LCD_Surface.hpp"
 
   //Font System Includes
 #include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_TextLayout.hpp"
+#include "QAS_LCD_FontFile.hpp"
 
 
   //------------------------------------------
@@ -46,6 +76,22 @@
 	//------------------------------------------
 	//------------------------------------------
 
+//-----------------
+//QAS_LCD_ListState
+//
+//Used to store the current display list state of the QAS_LCD class
+enum QAS_LCD_ListState : uint8_t {
+	QAS_LCD_List_Immediate = 0,  //Rendering methods are executed immediately
+	QAS_LCD_List_Recording,      //Rendering methods are being recorded into the display list
+	QAS_LCD_List_Overflowed      //Display list ran out of space while recording, so rendering methods are being executed immediately
+	                             //until the end of the display list
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
 //-------
 //QAS_LCD
 //
@@ -60,10 +106,57 @@ private:
 
 	QAD_LTDC_Buffer*  m_pDrawBuffer;   //Stores a pointer to the current frame buffer that is being rendered to
 	                                   //This will be either the layer 0 or layer 1 back-buffer (see QAD_LTDC.hpp for more details)
+	QAD_LTDC_LayerIdx m_eDrawLayer;    //Stores which layer the current frame buffer belongs to
+
+	QAS_LCD_Target    m_cTarget;       //Stores the render target that rendering methods write to
+	                                   //This will be m_pDrawBuffer, the current draw surface, or the tile buffer while tiled rendering is in progress
+
+	QAS_LCD_SurfacePool m_cSurfaces;     //Pool that offscreen surfaces are allocated from
+	uint8_t             m_uDrawSurface;  //Index of the surface currently being rendered to, or QAS_LCD_SURFACE_NONE if rendering to m_pDrawBuffer
+	QAS_LCD_Region      m_cSurfaceRegion;//Region covering the entire current draw surface, used as the base region while rendering to a surface
+	uint32_t            m_uSurfacePixels;//Number of pixels written to surfaces
 
 	uint16_t          m_uDrawColor;    //Stores the current colour to be used by rendering methods
+	QA_ActiveState    m_eAntiAliasing; //Stores whether curved rendering methods are anti-aliased. Member of QA_ActiveState enum defined in setup.hpp
+	QAS_LCD_BlendMode m_eBlendMode;    //Stores how rendering methods combine the draw color with the draw buffer. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+
+	QA_ActiveState    m_eDirtyTracking; //Stores whether dirty rectangle tracking is currently active. Member of QA_ActiveState enum defined in setup.hpp
+	QAS_LCD_Region    m_cDirty[2][QAD_LTDC_BUFFERCOUNT]; //Dirty regions, indexed by layer and then by buffer (see QAD_LTDC_LayerIdx and QAD_LTDC_BufferIdx in QAD_LTDC.hpp)
+	QAS_LCD_Region    m_cFullRegion;    //Region covering the entire LCD panel, used when dirty rectangle tracking is inactive
+	QAS_LCD_Region*   m_pBaseRegion;    //Pointer to the region being rendered to before the clip rectangle is applied
+	QAS_LCD_Region*   m_pDrawRegion;    //Pointer to the region that all rendering methods are currently clipped against
+
+	QAS_LCD_ClipStack m_cClipStack;     //Stack of clip rectangles pushed by pushClip()
+	QAS_LCD_Region    m_cClipRegion;    //Intersection of the base region and the current clip rectangle, used while a clip rectangle is pushed
+
+	uint32_t          m_uPixelCount[2]; //Number of pixels written to each layer's back-buffer since that layer was last flipped
+	uint32_t          m_uFramePixels[2];//Number of pixels that were written to each layer for the most recently flipped frame
+	uint32_t*         m_pPixelCount;    //Pointer to the counter that rendering methods increment for each pixel written
 
   QAS_LCD_FontMgr   m_cFontMgr;      //A instance of the QAS_LCD_FontMgr class used for managing fonts and rendering of text
+  QAS_LCD_FontStore m_cFontStore;    //Store in SDRAM for font images read from an SD card. See QAS_LCD_FontFile.hpp
+
+  QAS_LCD_DisplayList m_cDisplayList; //Display list used to record rendering methods between beginDisplayList() and endDisplayList()
+  QAS_LCD_ListState   m_eListState;   //Current display list state. Member of QAS_LCD_ListState enum
+  uint8_t             m_uListLayers;  //Bitmask of layers selected by setDrawBuffer() while recording the display list
+  uint32_t            m_uListHash;    //Hash of the most recently presented display list, or QAS_LCD_DISPLAYLIST_NOHASH if
+                                      //the current front-buffers were not produced by a display list
+
+  QA_ActiveState      m_eTiledRendering; //Stores whether display lists are rendered using tiled rendering. Member of QA_ActiveState enum defined in setup.hpp
+  QAS_LCD_TileBin     m_cTileBin;        //Display list commands sorted into the tiles they touch
+  QAS_LCD_Region      m_cTileRegion;     //Region that rendering is clipped against while rendering an individual tile
+  uint32_t            m_uTilePixels;     //Number of pixels written to tile buffers since tiled rendering was last started
+  static uint8_t      m_uTileBuffer[QAS_LCD_TILE_BUFFERSIZE]; //Tile buffer that each tile is rendered into, placed in the DTCM. See QAS_LCD.cpp
+
+  QA_ActiveState      m_eAcceleration;   //Stores whether rasterizers offload work to the DMA2D. Member of QA_ActiveState enum defined in setup.hpp
+
+  QA_ActiveState      m_eAutoWindow[2];   //Stores whether each layer's window is shrunk to its content. Member of QA_ActiveState enum defined in setup.hpp
+  QAT_Rect_16         m_cExtent[2][QAD_LTDC_BUFFERCOUNT]; //Area of each buffer that may hold visible pixels, indexed by layer and then by buffer
+                                                          //All pixels outside of a buffer's extent are transparent
+  QAT_Rect_16         m_cPrevExtent[2];   //Extent each layer's back-buffer had before the display list being rendered
+  QAT_Rect_16         m_cListExtent[2];   //Extent each layer's back-buffer will have once the display list being rendered is complete
+  uint8_t             m_uExtentLayers;    //Bitmask of layers whose extents have been measured for the display list being rendered
+  QAS_LCD_Region      m_cExtentRegion;    //Intersection of the base region with the previous and new extents, used while rendering to a measured layer
 
 
   //------------
@@ -73,7 +166,26 @@ private:
 	QAS_LCD() :
 	  m_eInitState(QA_NotInitialized),
 		m_pDrawBuffer(NULL),
-		m_uDrawColor(0x0000) {}
+		m_eDrawLayer(QAD_LTDC_Layer0),
+		m_uDrawSurface(QAS_LCD_SURFACE_NONE),
+		m_uSurfacePixels(0),
+		m_uDrawColor(0x0000),
+		m_eAntiAliasing(QA_Inactive),
+		m_eBlendMode(QAS_LCD_Blend_None),
+		m_eDirtyTracking(QA_Inactive),
+		m_pBaseRegion(NULL),
+		m_pDrawRegion(NULL),
+		m_uPixelCount{0, 0},
+		m_uFramePixels{0, 0},
+		m_pPixelCount(NULL),
+		m_eListState(QAS_LCD_List_Immediate),
+		m_uListLayers(0),
+		m_uListHash(QAS_LCD_DISPLAYLIST_NOHASH),
+		m_eTiledRendering(QA_Inactive),
+		m_uTilePixels(0),
+		m_eAcceleration(QA_Inactive),
+		m_eAutoWindow{QA_Inactive, QA_Inactive},
+		m_uExtentLayers(0) {}
 
 public:
 
@@ -141,6 +253,294 @@ public:
   	get().imp_setDrawColor(cColor.pxl());
   }
 
+  //Used to set the current draw color to an entry of the color look-up table, for rendering to layers that use the L8 pixel format
+  //This is equivalent to setDrawColor(0xF000 | uIdx), and the color can be changed at any time using setPalette() without
+  //rendering again (see QAS_LCD_RasterFormat<QAT_PixelFormat_L8> in QAS_LCD_Raster.hpp)
+  //uIdx - Index of the entry of the color look-up table
+  static void setDrawIndex(uint8_t uIdx) {
+  	get().imp_setDrawColor(0xF000 | uIdx);
+  }
+
+  //Used to enable or disable anti-aliasing of curved rendering methods
+  //When active, the partially covered pixels along curved edges are drawn with the draw color's alpha scaled by their coverage
+  //eState - QA_Active to enable anti-aliasing, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  static void setAntiAliasing(QA_ActiveState eState) {
+  	get().imp_setAntiAliasing(eState);
+  }
+
+  //Used to set how rendering methods combine the draw color with the existing pixels of the draw buffer
+  //This applies to all Rendering, Curved Rendering and Font Rendering methods. Blending is performed in software, so translucent
+  //overlays can be drawn directly into a layer rather than relying on the LTDC's blending of layer 1 over layer 0
+  //eMode - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+  static void setBlendMode(QAS_LCD_BlendMode eMode) {
+  	get().imp_setBlendMode(eMode);
+  }
+
+
+	//---------------
+	//Surface Methods
+	//
+	//Surfaces are offscreen blocks of ARGB4444 pixels allocated from SDRAM (see QAS_LCD_Surface.hpp), which every Rendering, Curved
+	//Rendering, Image Rendering and Font Rendering method is able to draw into. A surface can then be composited into the current
+	//draw buffer with drawSurface(), in the same manner as an image. This allows static content, such as the frame and labels of a
+	//panel, to be rendered once and reused every frame rather than being rebuilt.
+	//
+	//While a surface is selected, coordinates are relative to the upper-left pixel of the surface and rendering is clipped to the
+	//surface and the current clip rectangle. Dirty rectangle tracking does not apply to surfaces, so an area of a layer showing a
+	//surface must be invalidated if the surface is redrawn.
+	//Surfaces are created and destroyed immediately, even while recording a display list.
+
+  //Used to create a surface
+  //Memory is allocated from the surface pool as a stack, so long-lived surfaces should be created before short-lived ones
+  //The surface is cleared to transparent black (0x0000)
+  //uWidth  - Width of the surface in pixels
+  //uHeight - Height of the surface in pixels
+  //Returns the index of the new surface, or QAS_LCD_SURFACE_NONE if the surface could not be created
+  static uint8_t createSurface(uint16_t uWidth, uint16_t uHeight) {
+  	QAD_DMA2D::wait();  //Memory of a destroyed surface may still be written by a queued DMA2D job
+  	return get().m_cSurfaces.create(uWidth, uHeight);
+  }
+
+  //Used to destroy a surface. If the surface is the current draw target then the draw buffer of the current layer is reselected
+  //uIdx - The index of the surface
+  static void destroySurface(uint8_t uIdx) {
+  	get().imp_destroySurface(uIdx);
+  }
+
+  //Used to set the current draw target to a surface, in place of the layer 0 or layer 1 back-buffer
+  //The draw target is returned to a layer by calling setDrawBuffer()
+  //uIdx - The index of the surface. Invalid indexes are ignored
+  static void setDrawSurface(uint8_t uIdx) {
+  	get().imp_setDrawSurface(uIdx);
+  }
+
+  //Used to composite a surface into the current draw target
+  //The surface is clipped and converted into the pixel format of the draw target in the same manner as drawImage()
+  //cPos  - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the surface
+  //uIdx  - The index of the surface. Invalid indexes are ignored
+  //eMode - How the pixels of the surface are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+  //        QAS_LCD_Blit_ColorKey skips pixels that are transparent black (0x0000), which is the color surfaces are cleared to
+  static void drawSurface(QAT_Vector2_16 cPos, uint8_t uIdx, QAS_LCD_BlitMode eMode = QAS_LCD_Blit_Opaque) {
+  	if (!get().m_cSurfaces.valid(uIdx))
+  		return;
+  	QAS_LCD_Image cImage = get().m_cSurfaces.image(uIdx);
+  	drawImage(cPos, cImage, eMode);
+  }
+
+  //Returns an image describing the pixels of a surface, for use with drawImageRect(), or an empty image if the index is invalid
+  //uIdx - The index of the surface
+  static QAS_LCD_Image getSurfaceImage(uint8_t uIdx) {
+  	if (!get().m_cSurfaces.valid(uIdx))
+  		return QAS_LCD_Image();
+  	return get().m_cSurfaces.image(uIdx);
+  }
+
+
+	//---------------
+	//Palette Methods
+	//
+	//Layers using the L8 pixel format hold palette indexes rather than colors (see QAD_LTDC_Layer0Format and QAD_LTDC_Layer1Format).
+	//Palette changes are applied by the LTDC as pixels are displayed, so they take effect from the next frame without any pixels
+	//being rendered, and are not recorded into display lists. See the CLUT Methods in QAD_LTDC.hpp for more details
+
+  //Used to set a range of palette entries of a layer
+  //eLayer  - The layer. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+  //uFirst  - Index of the first entry to be set
+  //uCount  - The number of entries to be set
+  //pColors - Pointer to an array of uCount 24bit 0x00RRGGBB colors
+  //Returns QA_OK if successful, or QA_Fail if the layer does not use the L8 pixel format or the range of entries is invalid
+  static QA_Result setPalette(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, const uint32_t* pColors) {
+  	return QAD_LTDC::setCLUT(eLayer, uFirst, uCount, pColors);
+  }
+
+  //Used to rotate a range of palette entries of a layer, for color cycling effects
+  //eLayer - The layer. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+  //uFirst - Index of the first entry of the range
+  //uCount - The number of entries in the range
+  //iStep  - The number of places each entry is to be moved towards higher indexes, or towards lower indexes if negative
+  //Returns QA_OK if successful, or QA_Fail if the layer does not use the L8 pixel format or the range of entries is invalid
+  static QA_Result rotatePalette(QAD_LTDC_LayerIdx eLayer, uint16_t uFirst, uint16_t uCount, int16_t iStep) {
+  	return QAD_LTDC::rotateCLUT(eLayer, uFirst, uCount, iStep);
+  }
+
+
+	//--------------------
+	//Display List Methods
+	//
+	//When a display list is being recorded, all Rendering Setup, Rendering and Font Rendering methods are stored into a
+	//compact command buffer rather than being executed. When the display list is ended, a hash of the command buffer is
+	//compared against the hash of the previously presented display list. If they match then the LCD is already showing the
+	//recorded frame, so both rendering and the buffer flip are skipped entirely. Otherwise the commands are rendered and
+	//each layer that was selected with setDrawBuffer() is flipped.
+	//
+	//NOTE: As skipped frames are not rendered, draw buffer, draw color and font selections made within a skipped display list
+	//      do not take effect.
+
+  //Used to start recording a display list
+  //Rendering methods called after this point will be recorded, and will be rendered when endDisplayList() is called
+  static void beginDisplayList(void) {
+  	get().imp_beginDisplayList();
+  }
+
+  //Used to finish recording a display list, and to render and present it if it differs from the previously presented display list
+  //Returns true if the frame was rendered and flipped, or false if it was skipped due to being identical to the previous frame
+  static bool endDisplayList(void) {
+  	return get().imp_endDisplayList();
+  }
+
+
+	//------------------------
+	//Tiled Rendering Methods
+	//
+	//When tiled rendering is active, display lists are rendered one screen tile at a time rather than one command at a time.
+	//The commands of the display list are first sorted into the tiles they touch (see QAS_LCD_Tile.hpp). Each tile is then
+	//rendered into a tile buffer in the DTCM, and once all commands touching the tile have been rendered, the tile is
+	//written back to the frame buffer as sequential line bursts. This replaces the scattered and repeated writes of rendering
+	//directly to SDRAM with a single write of each pixel, with the overdraw taking place in zero wait state DTCM instead.
+	//
+	//The existing contents of each tile are read from the frame buffer before rendering, unless the first command to touch the
+	//tile is clearBuffer(). Only pixels within the region being rendered to (see Dirty Rectangle Methods) are read and written back.
+	//Tiled rendering only applies to display lists. Rendering methods called outside of a display list are rendered immediately.
+
+  //Used to enable or disable tiled rendering of display lists
+  //eState - QA_Active to enable tiled rendering, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  static void setTiledRendering(QA_ActiveState eState) {
+  	get().m_eTiledRendering = eState;
+  }
+
+  //Returns the number of pixels written to the tile buffer while rendering the most recent display list with tiled rendering
+  //Comparing this with getPixelsTouched() gives the number of frame buffer writes saved by tiled rendering
+  static uint32_t getTilePixels(void) {
+  	return get().m_uTilePixels;
+  }
+
+
+	//--------------------
+	//Acceleration Methods
+	//
+	//When acceleration is active, large fills, image copies, source-over blits onto layers without alpha, and moves between the
+	//tile buffer and frame buffers are queued to the DMA2D (see QAS_LCD_Accel.hpp and QAD_DMA2D.hpp), and run while the CPU carries
+	//on rendering. Queued jobs are waited for before the CPU next writes pixels itself, before a layer is flipped, and before a
+	//surface is created, so rendering methods can be used in the same manner as without acceleration.
+	//Source-over blits onto RGB565 layers are blended by the DMA2D, which truncates where the CPU rounds, so can differ by one step.
+
+  //Used to enable or disable acceleration of rendering methods using the DMA2D
+  //The DMA2D driver is initialized when acceleration is first enabled
+  //eState - QA_Active to enable acceleration, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  //Returns QA_OK if successful, or QA_Fail if the DMA2D could not be initialized, in which case acceleration remains inactive
+  static QA_Result setAcceleration(QA_ActiveState eState) {
+  	return get().imp_setAcceleration(eState);
+  }
+
+  //Returns whether acceleration is currently active. Member of QA_ActiveState enum defined in setup.hpp
+  static QA_ActiveState getAcceleration(void) {
+  	return get().m_eAcceleration;
+  }
+
+
+	//----------------
+	//Clipping Methods
+	//
+	//Clip rectangles are used to limit rendering to an area of the LCD, such as an individual panel of a user interface.
+	//Each pushed clip rectangle is intersected with those already on the stack, and all rendering methods are clipped against
+	//the resulting rectangle as well as the dirty region (see Dirty Rectangle Methods). Primitives that lie entirely outside
+	//of the clip rectangle are rejected before any pixels are processed.
+	//Clip rectangles are recorded into display lists in the same way as other rendering methods.
+
+  //Used to push a clip rectangle onto the clip stack
+  //Up to QAS_LCD_CLIPSTACK_LENGTH clip rectangles can be pushed. Further pushes are ignored, but must still be matched by popClip()
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the clip rectangle
+  static void pushClip(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd) {
+  	get().imp_pushClip(cStart, cEnd);
+  }
+
+  //Used to remove the most recently pushed clip rectangle from the clip stack
+  static void popClip(void) {
+  	get().imp_popClip();
+  }
+
+
+	//-----------------------------
+	//Dirty Rectangle Methods
+	//
+	//When dirty rectangle tracking is active all rendering methods are clipped against the dirty region of the currently
+	//selected draw buffer, meaning that clears and redraws will only touch pixels within areas that have been invalidated.
+	//As each layer is double or triple-buffered, invalidated areas are added to the dirty regions of every buffer for the layer. The
+	//dirty region of a buffer is then cleared when that buffer is presented by flipLayer0() or flipLayer1(), so that the
+	//buffer that becomes the new back-buffer still has to redraw anything that changed while it was being displayed.
+
+  //Used to enable or disable dirty rectangle tracking
+  //Enabling tracking will invalidate both layers in their entirety so that the next frame drawn into each buffer is fully drawn
+  //eState - QA_Active to enable tracking, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  static void setDirtyTracking(QA_ActiveState eState) {
+  	get().imp_setDirtyTracking(eState);
+  }
+
+  //Used to mark an area of a layer as needing to be redrawn
+  //eLayer        - The layer to be invalidated. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the area
+  static void invalidate(QAD_LTDC_LayerIdx eLayer, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd) {
+  	get().imp_invalidate(eLayer, QAT_Rect_16(cStart, cEnd));
+  }
+
+  //Used to mark an entire layer as needing to be redrawn
+  //eLayer - The layer to be invalidated. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+  static void invalidateLayer(QAD_LTDC_LayerIdx eLayer) {
+  	get().imp_invalidateLayer(eLayer);
+  }
+
+  //Used to mark an area of the currently selected draw buffer as being redrawn, without invalidating the layer's other buffer
+  //This is intended for content that keeps track of what each buffer of a layer is showing, such as QAS_LCD_Console, so that it can
+  //update a single buffer while dirty rectangle tracking is active. It also ensures that the frame is presented by the next display
+  //list even if the display list is otherwise unchanged. Has no effect on the dirty regions while a surface is being rendered to.
+  //When called while recording a display list, the commands recorded so far are rendered and the remainder of the display list is
+  //rendered immediately
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the area
+  static void expose(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd) {
+  	get().imp_expose(QAT_Rect_16(cStart, cEnd));
+  }
+
+  //Returns the number of pixels that need to be redrawn for the currently selected draw buffer
+  //Will return the entire pixel count of the LCD panel if dirty rectangle tracking is inactive
+  static uint32_t getDirtyArea(void) {
+  	return get().imp_getDirtyArea();
+  }
+
+  //Returns the number of pixels that were written to a layer's frame buffer for the most recently flipped frame
+  //This can be used to measure the savings provided by dirty rectangle tracking and tiled rendering
+  //eLayer - The layer to return the pixel count for. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+  static uint32_t getPixelsTouched(QAD_LTDC_LayerIdx eLayer) {
+  	return get().m_uFramePixels[eLayer];
+  }
+
+
+	//--------------------
+	//Layer Window Methods
+	//
+	//When automatic windowing is active for a layer, QAS_LCD keeps track of the area of each of the layer's buffers that holds visible
+	//pixels, and shrinks the layer's window to that area as each frame is flipped (see QAD_LTDC_Window in QAD_LTDC.hpp). The LTDC then
+	//only fetches that area from SDRAM each refresh, rather than the entire LCD panel, and a layer with nothing visible is disabled
+	//altogether. This suits overlay layers that only hold a few elements, such as a status line or a popup.
+	//
+	//The visible area is measured from each display list before it is rendered, with clearBuffer() using a transparent draw color
+	//resetting it and other rendering methods adding their bounds. Rendering of the display list is then limited to the visible areas
+	//of the buffer before and after the frame, so that clearing an overlay only costs the area its previous content occupied.
+	//Frames rendered outside of a display list, or whose display list overflowed, are treated as being visible across the entire
+	//LCD panel. Only layers whose pixel format stores alpha have transparent pixels, so other layers always cover the entire panel.
+
+  //Used to enable or disable automatic windowing of a layer
+  //eLayer - The layer. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+  //eState - QA_Active to enable automatic windowing, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  static void setAutoWindow(QAD_LTDC_LayerIdx eLayer, QA_ActiveState eState) {
+  	get().imp_setAutoWindow(eLayer, eState);
+  }
+
+  //Returns whether automatic windowing is active for a layer. Member of QA_ActiveState enum defined in setup.hpp
+  //eLayer - The layer. Member of QAD_LTDC_LayerIdx as defined in QAD_LTDC.hpp
+  static QA_ActiveState getAutoWindow(QAD_LTDC_LayerIdx eLayer) {
+  	return get().m_eAutoWindow[eLayer];
+  }
+
 
 	//-----------------
 	//Rendering Methods
@@ -180,20 +580,238 @@ public:
   }
 
 
+  //Used to move the contents of a rectangle of the current draw target up or down by a number of rows, such as to scroll a text log
+  //Each line is moved using the word-wide copy kernels, in an order that allows the source and destination to overlap. The strip
+  //of rows left behind by the move is filled with the currently selected draw color and can then be redrawn, so content that scrolls
+  //only has to render what has newly come into view. The rectangle is clipped to the draw target and the current clip rectangle,
+  //but not to the dirty region, as the entire rectangle is exposed (see expose()).
+  //As the draw buffer of a layer holds the frame that was presented two flips earlier, the caller must keep track of what each buffer
+  //is showing when scrolling a layer, as QAS_LCD_Console does. Scrolling reads back the draw target, so it cannot be recorded into a
+  //display list. When called while recording, it is handled in the same manner as expose()
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the rectangle
+  //iRows         - The number of rows to move the contents down by, or up by if negative
+  static void scrollRect(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, int16_t iRows) {
+  	get().imp_scrollRect(cStart, cEnd, 0, iRows);
+  }
+
+  //Used to move the contents of a rectangle of the current draw target by a number of columns and rows, such as to scroll a chart
+  //sideways. This behaves in the same manner as the above method, with lines being moved using memmove() when the move has a
+  //horizontal component, and the exposed columns also being filled with the currently selected draw color
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the rectangle
+  //iColumns      - The number of columns to move the contents right by, or left by if negative
+  //iRows         - The number of rows to move the contents down by, or up by if negative
+  static void scrollRect(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, int16_t iColumns, int16_t iRows) {
+  	get().imp_scrollRect(cStart, cEnd, iColumns, iRows);
+  }
+
+
+	//-------------------------
+	//Curved Rendering Methods
+	//
+	//Outlines are a single pixel thick, and filled shapes are rendered as one horizontal span per row using the span fill
+	//kernels, with no pixel written more than once. Angles are in degrees, measured clockwise from the 3 o'clock position.
+	//Radii are limited to QAS_LCD_CURVE_MAXRADIUS (see QAS_LCD_Curve.hpp).
+	//See setAntiAliasing() for details of anti-aliased rendering.
+
+  //Used to draw a non-filled circle
+  //cCenter - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the circle
+  //uRadius - The radius of the circle in pixels
+  static void drawCircle(QAT_Vector2_16 cCenter, uint16_t uRadius) {
+  	QAT_Vector2_16 cRadii(uRadius, uRadius);
+  	get().imp_drawEllipse(cCenter, cRadii);
+  }
+
+  //Used to draw a filled circle
+  //cCenter - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the circle
+  //uRadius - The radius of the circle in pixels
+  static void drawCircleFill(QAT_Vector2_16 cCenter, uint16_t uRadius) {
+  	QAT_Vector2_16 cRadii(uRadius, uRadius);
+  	get().imp_drawEllipseFill(cCenter, cRadii);
+  }
+
+  //Used to draw a non-filled ellipse
+  //cCenter - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the ellipse
+  //cRadii  - A QAT_Vector2_16 class containing the X and Y radii of the ellipse in pixels
+  static void drawEllipse(QAT_Vector2_16 cCenter, QAT_Vector2_16 cRadii) {
+  	get().imp_drawEllipse(cCenter, cRadii);
+  }
+
+  //Used to draw a filled ellipse
+  //cCenter - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the ellipse
+  //cRadii  - A QAT_Vector2_16 class containing the X and Y radii of the ellipse in pixels
+  static void drawEllipseFill(QAT_Vector2_16 cCenter, QAT_Vector2_16 cRadii) {
+  	get().imp_drawEllipseFill(cCenter, cRadii);
+  }
+
+  //Used to draw a single pixel width arc of a circle
+  //cCenter     - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the arc
+  //uRadius     - The radius of the arc in pixels
+  //iStartAngle - The angle in degrees at which the arc starts
+  //iEndAngle   - The angle in degrees at which the arc ends. An arc of 360 degrees or more is a full circle
+  static void drawArc(QAT_Vector2_16 cCenter, uint16_t uRadius, int16_t iStartAngle, int16_t iEndAngle) {
+  	QAT_Vector2_16 cRadii(uRadius, 0);
+  	QAT_Vector2_16 cAngles((uint16_t)iStartAngle, (uint16_t)iEndAngle);
+  	get().imp_drawArc(cCenter, cRadii, cAngles);
+  }
+
+  //Used to draw a filled arc between an outer and inner radius, such as the band of a gauge
+  //An inner radius of 0 draws a filled pie slice
+  //cCenter     - A QAT_Vector2_16 class containing the X and Y coordinates of the center of the arc
+  //uOuter      - The outer radius of the arc in pixels
+  //uInner      - The inner radius of the arc in pixels
+  //iStartAngle - The angle in degrees at which the arc starts
+  //iEndAngle   - The angle in degrees at which the arc ends. An arc of 360 degrees or more is a full ring
+  static void drawArcFill(QAT_Vector2_16 cCenter, uint16_t uOuter, uint16_t uInner, int16_t iStartAngle, int16_t iEndAngle) {
+  	QAT_Vector2_16 cRadii(uOuter, uInner);
+  	QAT_Vector2_16 cAngles((uint16_t)iStartAngle, (uint16_t)iEndAngle);
+  	get().imp_drawArcFill(cCenter, cRadii, cAngles);
+  }
+
+  //Used to draw a non-filled rectangle with rounded corners
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners for the rectangle
+  //uRadius       - The radius of the corners in pixels. Limited to half of the width or height of the rectangle
+  static void drawRoundRect(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, uint16_t uRadius) {
+  	get().imp_drawRoundRect(cStart, cEnd, uRadius);
+  }
+
+  //Used to draw a filled rectangle with rounded corners
+  //cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners for the rectangle
+  //uRadius       - The radius of the corners in pixels. Limited to half of the width or height of the rectangle
+  static void drawRoundRectFill(QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, uint16_t uRadius) {
+  	get().imp_drawRoundRectFill(cStart, cEnd, uRadius);
+  }
+
+
+	//------------------------
+	//Image Rendering Methods
+	//
+	//Images are read directly from the memory they are stored in, such as the memory-mapped QuadSPI flash, with each line of
+	//the image copied using the word-wide span kernels (see QAS_LCD_Span.hpp), or converted into the pixel format of the draw
+	//layer if it is not ARGB4444 (see QAS_LCD_Raster.hpp). Images are clipped in the same way as all other rendering methods.
+	//See QAS_LCD_Image.hpp for details of describing an image.
+
+  //Used to draw an entire image
+  //cPos   - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the image
+  //cImage - A QAS_LCD_Image class describing the image to be drawn
+  //eMode  - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+  //         QAS_LCD_Blit_Alpha uses the currently selected blend mode, or source-over blending if no blend mode is selected
+  static void drawImage(QAT_Vector2_16 cPos, const QAS_LCD_Image& cImage, QAS_LCD_BlitMode eMode = QAS_LCD_Blit_Opaque) {
+  	QAT_Vector2_16 cSrcStart(0, 0);
+  	QAT_Vector2_16 cSrcEnd(cImage.m_uWidth-1, cImage.m_uHeight-1);
+  	get().imp_drawImage(cPos, cImage, cSrcStart, cSrcEnd, eMode);
+  }
+
+  //Used to draw a rectangular area of an image, such as a single sprite from a sprite sheet
+  //cPos      - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the area to be drawn
+  //cImage    - A QAS_LCD_Image class describing the image to be drawn
+  //cSrcStart - A QAT_Vector2_16 class containing the image coordinates of one corner of the area
+  //cSrcEnd   - A QAT_Vector2_16 class containing the image coordinates of the diagonally opposing corner of the area
+  //eMode     - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+  static void drawImageRect(QAT_Vector2_16 cPos, const QAS_LCD_Image& cImage, QAT_Vector2_16 cSrcStart, QAT_Vector2_16 cSrcEnd,
+  		                      QAS_LCD_BlitMode eMode = QAS_LCD_Blit_Opaque) {
+  	get().imp_drawImage(cPos, cImage, cSrcStart, cSrcEnd, eMode);
+  }
+
+  //Used to draw a run-length encoded image, decoding it directly into the draw buffer
+  //Transparent pixels are skipped regardless of blit mode, so QAS_LCD_Blit_ColorKey is the same as QAS_LCD_Blit_Opaque
+  //cPos   - A QAT_Vector2_16 class containing the X and Y coordinates for the upper-left location of the image
+  //cImage - A QAS_LCD_RLEImage class describing the encoded image to be drawn. See QAS_LCD_RLE.hpp for details of the encoding
+  //eMode  - How the pixels of the image are drawn. Member of QAS_LCD_BlitMode enum defined in QAS_LCD_Image.hpp
+  static void drawImage(QAT_Vector2_16 cPos, const QAS_LCD_RLEImage& cImage, QAS_LCD_BlitMode eMode = QAS_LCD_Blit_Opaque) {
+  	get().imp_drawRLEImage(cPos, cImage, eMode);
+  }
+
+
 	//----------------------
 	//Font Rendering Methods
 
   //Used to set the selected font/typeface to be used for text rendering
   //strName - A C-style string containing the name of the font to be selected. This must match one of the
   //          fonts stored in the font manager, otherwise no font will be selected
+  //The name is hashed and found through the font manager's hash table, with a single string comparison to confirm the match. Where
+  //the name is a string literal, setFontByHash(QAS_LCD_FONTID(...)) can be used instead so that the hash is calculated by the compiler
   static void setFontByName(const char* strName) {
-  	get().m_cFontMgr.setFontByName(strName);
+  	get().imp_setFontByName(strName);
+  }
+
+  //Used to set the selected font/typeface to be used for text rendering, from the hash of its name
+  //uHash - The hash of the name of the font to be selected, such as QAS_LCD_FONTID("SegoeUI12pt") (see QAS_LCD_Fonts.hpp)
+  static void setFontByHash(uint32_t uHash) {
+  	get().imp_setFontByHash(uHash);
   }
 
   //Used to set the selected font/typeface to be used for text rendering
-  //uIdx - The index of the fond to be selected, based on the array of fonts stored in the font manager
+  //uIdx - The handle (index) of the font to be selected, as returned when the font was added to the font manager
   static void setFontByIndex(uint8_t uIdx) {
-  	get().m_cFontMgr.setFontByIndex(uIdx);
+  	get().imp_setFontByIndex(uIdx);
+  }
+
+  //Returns the height in pixels of a font, or 0 if the index is invalid
+  //This is not affected by font selections recorded into a display list, so can be used to lay out text while recording
+  //uIdx - The index of the font, based on the array of fonts stored in the font manager
+  static uint8_t getFontHeight(uint8_t uIdx) {
+  	return get().m_cFontMgr.getHeight(uIdx);
+  }
+
+  //Returns a pointer to a font, or NULL if the index is invalid. Used by QAS_LCD_TextLayout to measure strings
+  //uIdx - The index of the font, based on the array of fonts stored in the font manager
+  static const QAS_LCD_Font* getFont(uint8_t uIdx) {
+  	return get().m_cFontMgr.getFont(uIdx);
+  }
+
+  //Returns the number of fonts stored in the font manager. Fonts added from font files each take the lowest free handle
+  static uint8_t getFontCount(void) {
+  	return get().m_cFontMgr.count();
+  }
+
+  //Used to add a font from a font file held in memory, such as in memory-mapped QuadSPI flash (see QAD_QuadSPI::enterMemoryMapped())
+  //The font is drawn directly from the file without being copied, so the file must remain in place. See QAS_LCD_FontFile.hpp
+  //pFile - Pointer to the start of the font file
+  //uSize - The number of bytes available from the start of the file
+  //Returns the handle (index) of the font, or -1 if the file is not a valid font file, the font manager is full, or a font
+  //with the same name is already stored
+  static int8_t addFont(const void* pFile, uint32_t uSize) {
+  	return get().m_cFontMgr.add(pFile, uSize);
+  }
+
+  //Used to add every font of a font image held in memory, as written by the font packer (see QAS_LCD_FontPack_Host.cpp)
+  //pImage - Pointer to the start of the font image
+  //uSize  - The size in bytes of the image
+  //Returns the number of fonts added
+  static uint8_t addFonts(const void* pImage, uint32_t uSize) {
+  	return get().m_cFontMgr.addImage(pImage, uSize);
+  }
+
+  //Used to read a font image from a block device, such as an SD card, into SDRAM and add each of its fonts
+  //pRead      - Function used to read blocks from the device, such as QAD_SDMMC::readBlocks
+  //uBlock     - The address of the first block of the image
+  //uBlockSize - The size in bytes of each block, such as the value returned by QAD_SDMMC::getBlockSize()
+  //Returns the number of fonts added
+  static uint8_t loadFonts(QAS_LCD_FontReadFunc pRead, uint32_t uBlock, uint32_t uBlockSize) {
+  	return get().imp_loadFonts(pRead, uBlock, uBlockSize);
+  }
+
+  //Used to enable or disable the glyph cache, which is active by default
+  //The glyph cache holds recently drawn characters as runs of pixels, so that they are drawn with span fills instead of being unpacked
+  //from the font's bitmap data each time they are drawn. See QAS_LCD_GlyphCache.hpp for details
+  //eState - QA_Active to enable the glyph cache, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+  static void setGlyphCache(QA_ActiveState eState) {
+  	get().m_cFontMgr.setGlyphCache(eState);
+  }
+
+  //Returns the number of characters drawn from the glyph cache since the counters were last reset
+  static uint32_t getGlyphCacheHits(void) {
+  	return get().m_cFontMgr.getGlyphCache().hits();
+  }
+
+  //Returns the number of characters that had to be converted into the glyph cache since the counters were last reset
+  static uint32_t getGlyphCacheMisses(void) {
+  	return get().m_cFontMgr.getGlyphCache().misses();
+  }
+
+  //Used to reset the glyph cache hit and miss counters to zero
+  static void resetGlyphCacheStats(void) {
+  	get().m_cFontMgr.getGlyphCache().resetStats();
   }
 
   //Used to draw an individual character using the currently selected font/typeface
@@ -201,7 +819,7 @@ public:
   //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of upper-left location of the character to be drawn
   //ch   - The specific character to be rendered
   static void drawChar(QAT_Vector2_16 cPos, char ch) {
-  	get().m_cFontMgr.drawChar(cPos, ch);
+  	get().imp_drawChar(cPos, ch);
   }
 
   //Used to draw a left-aligned string of characters using the currently selected font/typeface
@@ -209,7 +827,7 @@ public:
   //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-left location of the string to be drawn
   //str  - The C-style string to be drawn
   static void drawStrL(QAT_Vector2_16 cPos, const char* str) {
-  	get().m_cFontMgr.drawStrL(cPos, str);
+  	get().imp_drawStr(QAS_LCD_Align_Left, cPos, str);
   }
 
   //Used to draw a center-aligned string of characters using the currently selected font/typeface
@@ -217,7 +835,7 @@ public:
   //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-center location of the string to be drawn
   //str  - The C-style string to be drawn
   static void drawStrC(QAT_Vector2_16 cPos, const char* str) {
-  	get().m_cFontMgr.drawStrC(cPos, str);
+  	get().imp_drawStr(QAS_LCD_Align_Center, cPos, str);
   }
 
   //Used to draw a right-aligned string of characters using the currently selected font/typeface
@@ -225,7 +843,16 @@ public:
   //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-right location of the string to be drawn
   //str  - The C-style string to be drawn
   static void drawStrR(QAT_Vector2_16 cPos, const char* str) {
-  	get().m_cFontMgr.drawStrR(cPos, str);
+  	get().imp_drawStr(QAS_LCD_Align_Right, cPos, str);
+  }
+
+  //Used to draw a text layout, which has been measured and positioned in advance by QAS_LCD_TextLayout::layout()
+  //The layout is drawn with the font it was laid out with, regardless of the currently selected font, so no measuring takes place
+  //When recording a display list, only a pointer to the layout is recorded, so the layout must remain valid until the list is presented
+  //cPos    - A QAD_Vector2_16 class that defines the X and Y coordinates of the upper-left location of the layout's box
+  //cLayout - The text layout to be drawn. See QAS_LCD_TextLayout.hpp
+  static void drawLayout(QAT_Vector2_16 cPos, const QAS_LCD_TextLayout& cLayout) {
+  	get().imp_drawLayout(cPos, cLayout);
   }
 
 private:
@@ -247,6 +874,74 @@ private:
 
   void imp_setDrawBuffer(QAD_LTDC_LayerIdx eLayer);
   void imp_setDrawColor(uint16_t uColor);
+  void imp_setAntiAliasing(QA_ActiveState eState);
+  void imp_setBlendMode(QAS_LCD_BlendMode eMode);
+
+
+  //---------------
+  //Surface Methods
+
+  void imp_setDrawSurface(uint8_t uIdx);
+  void imp_destroySurface(uint8_t uIdx);
+
+
+  //--------------------
+  //Display List Methods
+
+  void imp_beginDisplayList(void);
+  bool imp_endDisplayList(void);
+  bool imp_record(QA_Result eResult);
+  void imp_replayDisplayList(void);
+  void imp_replayEntry(const QAS_LCD_DisplayListEntry& sEntry);
+  QAT_Rect_16 imp_entryBounds(const QAS_LCD_DisplayListEntry& sEntry);
+
+
+  //-----------------------
+  //Tiled Rendering Methods
+
+  QA_Result imp_binDisplayList(void);
+  void imp_replayTiled(void);
+  void imp_replayTile(QAD_LTDC_LayerIdx eLayer, uint8_t uCol, uint8_t uRow);
+
+
+  //--------------------
+  //Acceleration Methods
+
+  QA_Result imp_setAcceleration(QA_ActiveState eState);
+
+  //Returns the set of kernels for a pixel format, being the accelerated kernels while acceleration is active
+  template <class Format>
+  QAS_LCD_Raster imp_getRaster(void) const {
+  	return m_eAcceleration ? (QAS_LCD_Raster)QAS_LCD_RasterAccel<Format>::Raster : (QAS_LCD_Raster)QAS_LCD_RasterFormat<Format>::Raster;
+  }
+
+
+  //----------------
+  //Clipping Methods
+
+  void imp_pushClip(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd);
+  void imp_popClip(void);
+  void imp_updateClipRegion(void);
+
+
+  //-----------------------
+  //Dirty Rectangle Methods
+
+  void imp_setDirtyTracking(QA_ActiveState eState);
+  void imp_invalidate(QAD_LTDC_LayerIdx eLayer, const QAT_Rect_16& cRect);
+  void imp_invalidateLayer(QAD_LTDC_LayerIdx eLayer);
+  void imp_expose(const QAT_Rect_16& cRect);
+  uint32_t imp_getDirtyArea(void);
+  void imp_updateDrawRegion(void);
+
+
+  //--------------------
+  //Layer Window Methods
+
+  void imp_setAutoWindow(QAD_LTDC_LayerIdx eLayer, QA_ActiveState eState);
+  void imp_resetExtents(QAD_LTDC_LayerIdx eLayer);
+  void imp_measureExtents(void);
+  void imp_updateExtent(QAD_LTDC_LayerIdx eLayer);
 
 
   //-----------------
@@ -262,6 +957,53 @@ private:
 
   void imp_drawRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd);
   void imp_drawRectFill(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd);
+  void imp_scrollRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, int16_t iColumns, int16_t iRows);
+
+
+  //------------------------
+  //Curved Rendering Methods
+
+  void imp_drawEllipse(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii);
+  void imp_drawEllipseFill(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii);
+  void imp_drawArc(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii, QAT_Vector2_16& cAngles);
+  void imp_drawArcFill(QAT_Vector2_16& cCenter, QAT_Vector2_16& cRadii, QAT_Vector2_16& cAngles);
+  void imp_drawRoundRect(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, uint16_t uRadius);
+  void imp_drawRoundRectFill(QAT_Vector2_16& cStart, QAT_Vector2_16& cEnd, uint16_t uRadius);
+
+
+  //-----------------------
+  //Image Rendering Methods
+
+  void imp_drawImage(QAT_Vector2_16& cPos, const QAS_LCD_Image& cImage, QAT_Vector2_16& cSrcStart, QAT_Vector2_16& cSrcEnd, QAS_LCD_BlitMode eMode);
+  bool imp_imageRects(const QAT_Vector2_16& cPos, const QAS_LCD_Image& cImage, const QAT_Vector2_16& cSrcStart, const QAT_Vector2_16& cSrcEnd,
+  		                QAT_Rect_16& cSrc, QAT_Rect_16& cDst);
+  void imp_drawRLEImage(QAT_Vector2_16& cPos, const QAS_LCD_RLEImage& cImage, QAS_LCD_BlitMode eMode);
+
+
+  //----------------------
+  //Font Rendering Methods
+
+  void imp_setFontByName(const char* strName);
+  void imp_setFontByHash(uint32_t uHash);
+  void imp_setFontByIndex(uint8_t uIdx);
+  void imp_drawChar(QAT_Vector2_16& cPos, char ch);
+  void imp_drawStr(QAS_LCD_TextAlign eAlign, QAT_Vector2_16& cPos, const char* str);
+  void imp_drawLayout(QAT_Vector2_16& cPos, const QAS_LCD_TextLayout& cLayout);
+  uint8_t imp_loadFonts(QAS_LCD_FontReadFunc pRead, uint32_t uBlock, uint32_t uBlockSize);
+
+
+  //-------------------------
+  //Rendering Support Methods
+
+  void imp_fillClipped(const QAT_Rect_16& cRect);
+  void imp_fillRect(const QAT_Rect_16& cRect);
+  void imp_fillSpan(int32_t iY, int32_t iLeft, int32_t iRight);
+
+  bool imp_rejectShape(const QAS_LCD_Shape& cShape);
+  void imp_drawShape(const QAS_LCD_Shape& cShape, const QAS_LCD_Sector* pSector);
+  void imp_fillShape(const QAS_LCD_Shape& cShape, const QAS_LCD_Shape* pInner, const QAS_LCD_Sector* pSector);
+  void imp_drawEdgeAA(const QAT_Rect_16& cCenters, int32_t iRadX, int32_t iRadY, QAS_LCD_CurveEdge eEdge, const QAS_LCD_Sector* pSector);
+  void imp_plotQuadrantsAA(const QAT_Rect_16& cCenters, int32_t iX, int32_t iY, uint8_t uCoverage, const QAS_LCD_Sector* pSector);
 
 };
 
@@ -0,0 +1,183 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - DMA2D Accelerated Rasterizers            */
+/*   Filename: QAS_LCD_Accel.hpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_ACCEL_HPP_
+#define __QAS_LCD_ACCEL_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_DMA2D.hpp"
+
+#include "QAS_LCD_Raster.hpp"
+
+
+  //NOTE:
+  //When acceleration is enabled (see QAS_LCD::setAcceleration()), render targets use the rasterizers below in place of those of
+  //QAS_LCD_Raster.hpp. Kernels that write large rectangles are queued as DMA2D jobs (see QAD_DMA2D.hpp), so that the CPU can carry
+  //on rendering while the engine writes the pixels, and all other kernels wait for queued jobs to complete before running the
+  //CPU kernel of QAS_LCD_RasterFormat, so that pixels are always written in the order they were drawn.
+  //
+  //The following kernels are queued:
+  //- Fills with no blend mode, or with source-over blending of an opaque color, as the result is then the color itself
+  //- Copies of ARGB4444 images with no blend mode to an ARGB4444 target, which need no conversion, or to an ARGB8888 target, using
+  //  the engine's pixel format converter, which expands each component in the same manner as QAT_PixelConvert
+  //- Copies of ARGB4444 images with source-over blending to a target whose pixels do not store alpha, such as RGB565, using
+  //  the engine's blender. As the engine truncates where the CPU kernels round, blended pixels can differ by one step of the
+  //  target format from those written by the CPU
+  //- Moves between rectangles that do not overlap, such as between a frame buffer and the tile buffer
+  //Copies with a blend mode to targets that store alpha are left to the CPU, as the engine normalizes the blended color by the
+  //resulting alpha, where QAS_LCD_Blend does not. Color keyed copies are also left to the CPU, as the DMA2D of the STM32F769
+  //has no color key. L8 targets cannot be written by the engine, so all of their kernels run on the CPU.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-----------------------
+//QAS_LCD_ACCEL_MINPIXELS
+//
+//Used to determine the smallest number of pixels a kernel must write for it to be queued as a DMA2D job. Smaller kernels are
+//run on the CPU, as the cost of preparing and queuing a job outweighs the time saved
+#define QAS_LCD_ACCEL_MINPIXELS   256
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+//-------------------
+//QAS_LCD_RasterAccel
+//
+//Template class providing the same kernels as QAS_LCD_RasterFormat for a pixel format defined in QAT_PixelFormat.hpp, queuing
+//kernels as DMA2D jobs where the result matches that of the CPU kernels of QAS_LCD_RasterFormat (see NOTE above)
+template <class Format>
+class QAS_LCD_RasterAccel {
+	typedef QAS_LCD_RasterFormat<Format> Cpu;
+
+	static constexpr bool             Engine  = (Format::LTDC <= QAD_DMA2D_ARGB4444);  //Whether the engine can write the format
+	static constexpr QAD_DMA2D_Format eFormat = (QAD_DMA2D_Format)Format::LTDC;
+
+public:
+
+	typedef typename Cpu::Pixel Pixel;  //Storage type of a single pixel of the format
+
+	//Member of QAS_LCD_Raster enum identifying these kernels, with the accelerated sets following the CPU sets in the same order
+	static constexpr QAS_LCD_Raster Raster = (QAS_LCD_Raster)(Cpu::Raster + QAS_LCD_Raster_AccelARGB4444);
+	static constexpr uint8_t        Bytes  = Cpu::Bytes;  //The size in bytes of a single pixel of the format
+	static constexpr bool           Alpha  = Cpu::Alpha;  //Whether pixels store their own alpha
+
+
+	//------------
+	//Constructors
+
+	//Instances hold no data, and are only passed to the rendering methods' inner loops to select the kernels of a render target
+	//at compile time (see QAS_LCD_Target::raster())
+	constexpr QAS_LCD_RasterAccel() {}
+
+
+	//-------
+	//Kernels
+	//
+	//See QAS_LCD_RasterFormat for details of the following methods
+
+	static Pixel color(uint16_t uColor) {
+		return Cpu::color(uColor);
+	}
+
+	static void pixel(void* pDst, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		sync();
+		Cpu::pixel(pDst, uColor, eMode);
+	}
+
+	static void fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		fillRect(pDst, uCount, uCount, 1, uColor, eMode);
+	}
+
+	static void fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		bool bQueue = Engine && ((uWidth * uHeight) >= QAS_LCD_ACCEL_MINPIXELS) &&
+				          (!eMode || ((eMode == QAS_LCD_Blend_SrcOver) && ((uColor >> 12) == 0xF)));
+		if (bQueue && !QAD_DMA2D::fill(pDst, uStride, uWidth, uHeight, eFormat, Cpu::color(uColor)))
+			return;
+
+		sync();
+		Cpu::fillRect(pDst, uStride, uWidth, uHeight, uColor, eMode);
+	}
+
+	static void copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode) {
+		sync();
+		Cpu::copy(pDst, pSrc, uCount, eMode);
+	}
+
+	static void copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                 QAS_LCD_BlendMode eMode) {
+		if (Engine && ((uWidth * uHeight) >= QAS_LCD_ACCEL_MINPIXELS)) {
+			if (!eMode && Format::Alpha && (eFormat == QAD_DMA2D_ARGB4444) &&
+					!QAD_DMA2D::copy(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, QAD_DMA2D_ARGB4444))
+				return;
+			if (!eMode && Format::Alpha && (eFormat == QAD_DMA2D_ARGB8888) &&
+					!QAD_DMA2D::convert(pDst, uDstStride, QAD_DMA2D_ARGB8888, pSrc, uSrcStride, QAD_DMA2D_ARGB4444, uWidth, uHeight))
+				return;
+			if ((eMode == QAS_LCD_Blend_SrcOver) && !Format::Alpha &&
+					!QAD_DMA2D::blend(pDst, uDstStride, eFormat, pSrc, uSrcStride, QAD_DMA2D_ARGB4444, uWidth, uHeight))
+				return;
+		}
+
+		sync();
+		Cpu::copyRect(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, eMode);
+	}
+
+	static void copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                    uint16_t uKey) {
+		sync();
+		Cpu::copyKeyRect(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, uKey);
+	}
+
+	static void moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight) {
+		if (Engine && ((uWidth * uHeight) >= QAS_LCD_ACCEL_MINPIXELS) && !overlaps(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight) &&
+				!QAD_DMA2D::copy(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, eFormat))
+			return;
+
+		sync();
+		Cpu::moveRect(pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight);
+	}
+
+	static void sync(void) {
+		if (QAD_DMA2D::pending())
+			QAD_DMA2D::wait();
+	}
+
+private:
+
+	//Returns true if the memory spanned by two rectangles of pixels overlaps, in which case the engine, which always copies
+	//forwards, could read pixels that it has already overwritten
+	static bool overlaps(const void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight) {
+		uintptr_t uDst = (uintptr_t)pDst;
+		uintptr_t uSrc = (uintptr_t)pSrc;
+		uintptr_t uDstEnd = uDst + ((((uHeight - 1) * uDstStride) + uWidth) * Format::Bytes);
+		uintptr_t uSrcEnd = uSrc + ((((uHeight - 1) * uSrcStride) + uWidth) * Format::Bytes);
+		return (uDst < uSrcEnd) && (uSrc < uDstEnd);
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_ACCEL_HPP_ */
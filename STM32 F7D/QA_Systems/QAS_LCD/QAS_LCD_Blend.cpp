@@ -0,0 +1,308 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Blending Kernels                         */
+/*   Filename: QAS_LCD_Blend.cpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Blend.hpp"
+#include "QAS_LCD_Span.hpp"
+
+#include <string.h>
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Returns a single channel product divided by 15, rounded to the nearest value. Matches QAS_LCD_Blend::div15() for a single lane
+static inline uint32_t QAS_LCD_Blend_Div15(uint32_t uValue) {
+	uValue += 8;
+	return (uValue + (uValue >> 4)) >> 4;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_Blend Pixel Methods
+
+//QAS_LCD_Blend::pixel
+//QAS_LCD_Blend Pixel Method
+//
+//Used to blend a single source pixel with a single destination pixel, processing one channel at a time
+//uDst  - The destination pixel
+//uSrc  - The source pixel
+//eMode - The blend mode. Member of QAS_LCD_BlendMode enum
+//Returns the blended pixel
+uint16_t QAS_LCD_Blend::pixel(uint16_t uDst, uint16_t uSrc, QAS_LCD_BlendMode eMode) {
+	uint32_t uSrcA = (uSrc >> 12);
+	uint32_t uDstA = (uDst >> 12);
+	uint32_t uResult;
+
+	switch (eMode) {
+	  case (QAS_LCD_Blend_SrcOver):
+	  	uResult = QAS_LCD_Blend_Div15((15 * uSrcA) + (uDstA * (15 - uSrcA))) << 12;
+	  	for (uint8_t uShift=0; uShift<12; uShift+=4) {
+	  		uint32_t uS = (uSrc >> uShift) & 0x0F;
+	  		uint32_t uD = (uDst >> uShift) & 0x0F;
+	  		uResult |= QAS_LCD_Blend_Div15((uS * uSrcA) + (uD * (15 - uSrcA))) << uShift;
+	  	}
+	  	return uResult;
+
+	  case (QAS_LCD_Blend_Add):
+	  	uResult = uDstA << 12;
+	  	for (uint8_t uShift=0; uShift<12; uShift+=4) {
+	  		uint32_t uS = QAS_LCD_Blend_Div15(((uSrc >> uShift) & 0x0F) * uSrcA);
+	  		uint32_t uD = (uDst >> uShift) & 0x0F;
+	  		uResult |= (((uS + uD) > 15) ? 15 : (uS + uD)) << uShift;
+	  	}
+	  	return uResult;
+
+	  case (QAS_LCD_Blend_Multiply):
+	  	uResult = uDstA << 12;
+	  	for (uint8_t uShift=0; uShift<12; uShift+=4) {
+	  		uint32_t uS = (uSrc >> uShift) & 0x0F;
+	  		uint32_t uD = (uDst >> uShift) & 0x0F;
+	  		uResult |= QAS_LCD_Blend_Div15(uS * uD) << uShift;
+	  	}
+	  	return uResult;
+
+	  default:
+	  	return uSrc;
+	}
+}
+
+
+//QAS_LCD_Blend::pair
+//QAS_LCD_Blend Pixel Method
+//
+//Used to blend two source pixels with two destination pixels, stored as 32bit words with the first pixel in the lower 16 bits
+//Produces identical results to calling pixel() for each pixel
+//uDst  - The destination pixels
+//uSrc  - The source pixels
+//eMode - The blend mode. Member of QAS_LCD_BlendMode enum
+//Returns the blended pixels
+uint32_t QAS_LCD_Blend::pair(uint32_t uDst, uint32_t uSrc, QAS_LCD_BlendMode eMode) {
+
+	//Split pixels into blue & red lanes (even) and green & alpha lanes (odd)
+	uint32_t uDstE = uDst & 0x0F0F0F0F;
+	uint32_t uDstO = (uDst >> 4) & 0x0F0F0F0F;
+	uint32_t uSrcE = uSrc & 0x0F0F0F0F;
+	uint32_t uSrcO = (uSrc >> 4) & 0x0F0F0F0F;
+
+	//Copy the alpha of each source pixel into all lanes belonging to that pixel
+	uint32_t uAlpha = (uSrcO >> 8) & 0x000F000F;
+	uAlpha |= (uAlpha << 8);
+
+	uint32_t uOutE, uOutO;
+	switch (eMode) {
+	  case (QAS_LCD_Blend_SrcOver): {
+	  	//Source alpha lanes are replaced with 15 so that the result alpha is srcA + dstA*(1-srcA)
+	  	uint32_t uInvAlpha = 0x0F0F0F0F - uAlpha;
+	  	uOutE = div15(mul(uSrcE, uAlpha) + mul(uDstE, uInvAlpha));
+	  	uOutO = div15(mul((uSrcO & 0x000F000F) | 0x0F000F00, uAlpha) + mul(uDstO, uInvAlpha));
+	  	break;
+	  }
+
+	  case (QAS_LCD_Blend_Add):
+	  	//Source alpha lanes are cleared so that destination alpha is unchanged
+	  	uOutE = addSat(uDstE, div15(mul(uSrcE, uAlpha)));
+	  	uOutO = addSat(uDstO, div15(mul(uSrcO & 0x000F000F, uAlpha)));
+	  	break;
+
+	  case (QAS_LCD_Blend_Multiply):
+	  	//Source alpha lanes are replaced with 15 so that destination alpha is unchanged
+	  	uOutE = div15(mul(uDstE, uSrcE));
+	  	uOutO = div15(mul(uDstO, uSrcO | 0x0F000F00));
+	  	break;
+
+	  default:
+	  	return uSrc;
+	}
+
+	return uOutE | (uOutO << 4);
+}
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Blend Fill Methods
+
+//QAS_LCD_Blend::fill
+//QAS_LCD_Blend Fill Method
+//
+//Used to blend a single color into a horizontal span of 16bit pixels
+//As the color is constant, the source side of each blend is calculated once, and source-over and additive blends only require
+//a single multiply by the constant alpha for each pair of pixels
+//pDst   - Pointer to the first pixel of the span
+//uCount - The number of pixels in the span
+//uColor - The 16bit ARGB4444 color to blend into the span
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum
+void QAS_LCD_Blend::fill(uint16_t* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+
+	//Opaque source-over blends are the same as a standard fill
+	if ((eMode == QAS_LCD_Blend_None) || ((eMode == QAS_LCD_Blend_SrcOver) && ((uColor >> 12) == 0x0F))) {
+		QAS_LCD_Span::fill(pDst, uCount, uColor);
+		return;
+	}
+
+	//Blend leading pixel individually if span does not start on a 32bit boundary
+	if (((uintptr_t)pDst & 0x02) && uCount) {
+		*pDst = pixel(*pDst, uColor, eMode);
+		pDst++;
+		uCount--;
+	}
+
+	QAS_LCD_Span_Word* pWord = (QAS_LCD_Span_Word*)pDst;
+	uint32_t uWords = uCount >> 1;
+	uint32_t uSrc   = ((uint32_t)uColor << 16) | uColor;
+	uint32_t uSrcE  = uSrc & 0x0F0F0F0F;
+	uint32_t uSrcO  = (uSrc >> 4) & 0x0F0F0F0F;
+	uint32_t uAlpha = uColor >> 12;
+
+	switch (eMode) {
+	  case (QAS_LCD_Blend_SrcOver): {
+	  	uint32_t uPreE     = uSrcE * uAlpha;
+	  	uint32_t uPreO     = ((uSrcO & 0x000F000F) | 0x0F000F00) * uAlpha;
+	  	uint32_t uInvAlpha = 15 - uAlpha;
+	  	while (uWords--) {
+	  		uint32_t uDst = *pWord;
+	  		*pWord++ = div15(uPreE + ((uDst & 0x0F0F0F0F) * uInvAlpha)) |
+	  				       (div15(uPreO + (((uDst >> 4) & 0x0F0F0F0F) * uInvAlpha)) << 4);
+	  	}
+	  	break;
+	  }
+
+	  case (QAS_LCD_Blend_Add): {
+	  	uint32_t uAddE = div15(uSrcE * uAlpha);
+	  	uint32_t uAddO = div15((uSrcO & 0x000F000F) * uAlpha);
+	  	while (uWords--) {
+	  		uint32_t uDst = *pWord;
+	  		*pWord++ = addSat(uDst & 0x0F0F0F0F, uAddE) | (addSat((uDst >> 4) & 0x0F0F0F0F, uAddO) << 4);
+	  	}
+	  	break;
+	  }
+
+	  case (QAS_LCD_Blend_Multiply): {
+	  	uSrcO |= 0x0F000F00;
+	  	while (uWords--) {
+	  		uint32_t uDst = *pWord;
+	  		*pWord++ = div15(mul(uDst & 0x0F0F0F0F, uSrcE)) | (div15(mul((uDst >> 4) & 0x0F0F0F0F, uSrcO)) << 4);
+	  	}
+	  	break;
+	  }
+
+	  default:
+	  	break;
+	}
+
+	//Blend trailing pixel individually if an odd number of pixels remain
+	if (uCount & 0x01) {
+		uint16_t* pLast = (uint16_t*)pWord;
+		*pLast = pixel(*pLast, uColor, eMode);
+	}
+}
+
+
+//QAS_LCD_Blend::fillRect
+//QAS_LCD_Blend Fill Method
+//
+//Used to blend a single color into a rectangular block of 16bit pixels, one span per line
+//pDst    - Pointer to the upper-left pixel of the rectangle
+//uStride - The number of pixels between the start of each line
+//uWidth  - The width in pixels of the rectangle
+//uHeight - The height in pixels of the rectangle
+//uColor  - The 16bit ARGB4444 color to blend into the rectangle
+//eMode   - The blend mode. Member of QAS_LCD_BlendMode enum
+void QAS_LCD_Blend::fillRect(uint16_t* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+
+	//If the rectangle covers entire lines then it is a single contiguous span
+	if (uWidth == uStride) {
+		fill(pDst, uWidth * uHeight, uColor, eMode);
+		return;
+	}
+
+	for (uint32_t y=0; y<uHeight; y++) {
+		fill(pDst, uWidth, uColor, eMode);
+		pDst += uStride;
+	}
+}
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Blend Blit Methods
+
+//QAS_LCD_Blend::blend
+//QAS_LCD_Blend Blit Method
+//
+//Used to blend a horizontal span of source pixels into a horizontal span of destination pixels, two pixels at a time
+//pDst   - Pointer to the first destination pixel
+//pSrc   - Pointer to the first source pixel
+//uCount - The number of pixels in the span
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum
+void QAS_LCD_Blend::blend(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode) {
+	if (eMode == QAS_LCD_Blend_None) {
+		memcpy(pDst, pSrc, uCount * sizeof(uint16_t));
+		return;
+	}
+
+	//Blend leading pixel individually if destination does not start on a 32bit boundary
+	if (((uintptr_t)pDst & 0x02) && uCount) {
+		*pDst = pixel(*pDst, *pSrc++, eMode);
+		pDst++;
+		uCount--;
+	}
+
+	//Source pixels are read individually, as the source span may not share the alignment of the destination span
+	QAS_LCD_Span_Word* pWord = (QAS_LCD_Span_Word*)pDst;
+	uint32_t uWords = uCount >> 1;
+	while (uWords--) {
+		*pWord = pair(*pWord, pSrc[0] | ((uint32_t)pSrc[1] << 16), eMode);
+		pWord++;
+		pSrc += 2;
+	}
+
+	//Blend trailing pixel individually if an odd number of pixels remain
+	if (uCount & 0x01) {
+		uint16_t* pLast = (uint16_t*)pWord;
+		*pLast = pixel(*pLast, *pSrc, eMode);
+	}
+}
+
+
+//QAS_LCD_Blend::blendRect
+//QAS_LCD_Blend Blit Method
+//
+//Used to blend a rectangular block of source pixels into a rectangular block of destination pixels, one line at a time
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//eMode      - The blend mode. Member of QAS_LCD_BlendMode enum
+void QAS_LCD_Blend::blendRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+		                          QAS_LCD_BlendMode eMode) {
+	for (uint32_t y=0; y<uHeight; y++) {
+		blend(pDst, pSrc, uWidth, eMode);
+		pDst += uDstStride;
+		pSrc += uSrcStride;
+	}
+}
@@ -0,0 +1,135 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Blending Kernels                         */
+/*   Filename: QAS_LCD_Blend.hpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_BLEND_HPP_
+#define __QAS_LCD_BLEND_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------
+//QAS_LCD_BlendMode
+//
+//Used to select how rendering methods combine the draw color or source pixels (src) with the existing pixels of the draw buffer (dst)
+//All channels are 4bit values, with results rounded to the nearest value
+enum QAS_LCD_BlendMode : uint8_t {
+	QAS_LCD_Blend_None = 0,  //Source replaces destination.          dst = src
+	QAS_LCD_Blend_SrcOver,   //Source is drawn over destination.     dstRGB = srcRGB*srcA + dstRGB*(1-srcA), dstA = srcA + dstA*(1-srcA)
+	QAS_LCD_Blend_Add,       //Source is added to destination.       dstRGB = min(1, srcRGB*srcA + dstRGB), dstA = dstA
+	QAS_LCD_Blend_Multiply   //Destination is modulated by source.   dstRGB = srcRGB * dstRGB, dstA = dstA
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAS_LCD_Blend
+//
+//Static class providing the ARGB4444 blending kernels used by QAS_LCD
+//
+//The kernels process two pixels at a time as a single 32bit word (SWAR - SIMD within a register). Each word is split into
+//two words holding the even and odd nibbles (blue & red, and green & alpha), so that each 4bit channel sits within its own
+//byte lane and a product of two channels (at most 225) can be formed without carrying into the neighbouring lane.
+//Per-lane multiplication by differing values (such as the per-pixel alpha of a blit) is performed as four masked shift and add
+//steps, while fills multiply all lanes by a single constant alpha using one hardware multiply. Division by 15 is performed
+//per-lane as ((x + 8) + ((x + 8) >> 4)) >> 4, which is equal to x/15 rounded to the nearest value for all products of two channels.
+//
+//When building for the Cortex-M7, the saturating addition of the additive blend mode uses the DSP extension's UQADD8 instruction.
+//Otherwise a portable equivalent is used, which produces identical results. pixel() provides a per-pixel reference implementation
+//of the same arithmetic, which is also used for individual pixels such as those of lines and glyphs.
+class QAS_LCD_Blend {
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Blend() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAS_LCD_Blend.cpp for details of the following methods
+
+	//-------------
+	//Pixel Methods
+
+	static uint16_t pixel(uint16_t uDst, uint16_t uSrc, QAS_LCD_BlendMode eMode);
+	static uint32_t pair(uint32_t uDst, uint32_t uSrc, QAS_LCD_BlendMode eMode);
+
+
+	//------------
+	//Fill Methods
+
+	static void fill(uint16_t* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode);
+	static void fillRect(uint16_t* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode);
+
+
+	//------------
+	//Blit Methods
+
+	static void blend(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode);
+	static void blendRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                  QAS_LCD_BlendMode eMode);
+
+private:
+
+	//------------
+	//Lane Methods
+	//
+	//The following methods operate on four byte lanes, each holding a single channel value
+
+	//Returns each lane divided by 15, rounded to the nearest value. Each lane must be no greater than 225
+	static inline uint32_t div15(uint32_t uLanes) {
+		uLanes += 0x08080808;
+		uLanes += (uLanes >> 4) & 0x0F0F0F0F;
+		return (uLanes >> 4) & 0x0F0F0F0F;
+	}
+
+	//Returns the product of each lane of uLanes with the corresponding lane of uScale. Lanes of both must be no greater than 15
+	static inline uint32_t mul(uint32_t uLanes, uint32_t uScale) {
+		uint32_t uResult;
+		uResult  = uLanes        & (((uScale     ) & 0x01010101) * 0xFF);
+		uResult += (uLanes << 1) & (((uScale >> 1) & 0x01010101) * 0xFF);
+		uResult += (uLanes << 2) & (((uScale >> 2) & 0x01010101) * 0xFF);
+		uResult += (uLanes << 3) & (((uScale >> 3) & 0x01010101) * 0xFF);
+		return uResult;
+	}
+
+	//Returns the sum of each lane of uA and uB, limited to 15. Lanes of both must be no greater than 15
+	static inline uint32_t addSat(uint32_t uA, uint32_t uB) {
+#if defined(__ARM_FEATURE_DSP)
+		return (__UQADD8(uA << 4, uB << 4) >> 4) & 0x0F0F0F0F;
+#else
+		uint32_t uSum = uA + uB;
+		return (uSum | (((uSum >> 4) & 0x01010101) * 0x0F)) & 0x0F0F0F0F;
+#endif
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_BLEND_HPP_ */
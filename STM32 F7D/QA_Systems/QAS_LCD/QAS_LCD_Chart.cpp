@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Strip Chart                              */
+/*   Filename: QAS_LCD_Chart.cpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Chart.hpp"
+
+
+	//-------------------------
+	//-------------------------
+	//QAS_LCD_Chart Constructor
+
+//QAS_LCD_Chart::QAS_LCD_Chart
+//QAS_LCD_Chart Constructor
+//
+//Creates an empty chart, with one column for each pixel of the width of its area
+//eLayer        - The layer the chart is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the chart's area
+//iLow          - Sample value shown at the bottom of the area
+//iHigh         - Sample value shown at the top of the area
+//uDecimation   - Number of samples in each column. A value of 0 is treated as 1
+//uColor        - ARGB4444 color of the trace
+//uBackColor    - ARGB4444 color of the background
+QAS_LCD_Chart::QAS_LCD_Chart(QAD_LTDC_LayerIdx eLayer, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, int16_t iLow, int16_t iHigh,
+		                         uint16_t uDecimation, uint16_t uColor, uint16_t uBackColor) :
+	m_cArea(cStart, cEnd),
+	m_eLayer(eLayer),
+	m_uColor(uColor),
+	m_uBackColor(uBackColor),
+	m_iLow(iLow),
+	m_iHigh(iHigh),
+	m_uDecimation(uDecimation ? uDecimation : 1) {
+
+	m_uWidth = (m_cArea.width() < QAS_LCD_CHART_COLUMNS) ? m_cArea.width() : QAS_LCD_CHART_COLUMNS;
+	m_uHead  = 0;
+	m_uTail  = 0;
+	clear();
+}
+
+
+	//-----------------------------
+	//-----------------------------
+	//QAS_LCD_Chart Sample Methods
+
+//QAS_LCD_Chart::addSample
+//QAS_LCD_Chart Sample Method
+//
+//Used to add a sample to the sample ring buffer. This may be called from an interrupt handler while render() is being called from
+//the main loop, as only this method writes to the head of the ring buffer, and only render() reads from its tail
+//iSample - The sample value
+//Returns true if the sample was added, or false if the ring buffer is full
+bool QAS_LCD_Chart::addSample(int16_t iSample) {
+	uint16_t uHead = m_uHead;
+	uint16_t uNext = (uHead + 1) & (QAS_LCD_CHART_SAMPLES - 1);
+	if (uNext == m_uTail)
+		return false;
+
+	m_iSamples[uHead] = iSample;
+	m_uHead = uNext;
+	return true;
+}
+
+
+//QAS_LCD_Chart::addSamples
+//QAS_LCD_Chart Sample Method
+//
+//Used to add a block of samples to the sample ring buffer, such as a buffer filled by DMA
+//pSamples - Pointer to the array of samples
+//uCount   - The number of samples in the array
+//Returns the number of samples that were added before the ring buffer became full
+uint16_t QAS_LCD_Chart::addSamples(const int16_t* pSamples, uint16_t uCount) {
+	for (uint16_t i=0; i<uCount; i++) {
+		if (!addSample(pSamples[i]))
+			return i;
+	}
+	return uCount;
+}
+
+
+//QAS_LCD_Chart::setRange
+//QAS_LCD_Chart Sample Method
+//
+//Used to change the range of sample values shown by the chart. Both buffers are fully redrawn the next time they are rendered
+//iLow  - Sample value shown at the bottom of the area
+//iHigh - Sample value shown at the top of the area
+void QAS_LCD_Chart::setRange(int16_t iLow, int16_t iHigh) {
+	m_iLow  = iLow;
+	m_iHigh = iHigh;
+	refresh();
+}
+
+
+//QAS_LCD_Chart::clear
+//QAS_LCD_Chart Sample Method
+//
+//Used to remove all columns from the chart, and to discard any samples waiting in the ring buffer
+//Must not be called while addSample() may be running in an interrupt handler
+void QAS_LCD_Chart::clear(void) {
+	m_uTail    = m_uHead;
+	m_uColumns = 0;
+	m_uCount   = 0;
+	m_iLast    = 0;
+	m_bStarted = false;
+	refresh();
+}
+
+
+	//--------------------------------
+	//--------------------------------
+	//QAS_LCD_Chart Rendering Methods
+
+//QAS_LCD_Chart::render
+//QAS_LCD_Chart Rendering Method
+//
+//Used to decimate the samples waiting in the ring buffer, and then to bring the current back-buffer of the chart's layer up to date,
+//leaving the layer selected as the draw buffer
+//If columns have been completed since the buffer was last rendered, the buffer is scrolled left by the number of new columns and only
+//the new columns are drawn. If no columns have been completed then nothing is rendered. The buffer is fully redrawn if it is not yet
+//showing the chart, or if more columns have been completed than fit in the chart.
+//Sets the draw color and clip stack of QAS_LCD, so any required state must be reselected afterwards
+void QAS_LCD_Chart::render(void) {
+	decimate();
+	if (!m_uWidth)
+		return;
+
+	QAD_LTDC_BufferIdx eBuffer = (m_eLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+	QAS_LCD_ChartView& sView = m_sViews[eBuffer];
+
+	uint32_t uNew  = m_uColumns - sView.uColumns;
+	bool     bFull = (!sView.bValid || (uNew >= m_uWidth));
+	if (!bFull && !uNew)
+		return;
+
+	QAT_Vector2_16 cStart(m_cArea.x1 - m_uWidth + 1, m_cArea.y0);
+	QAT_Vector2_16 cEnd(m_cArea.x1, m_cArea.y1);
+
+	QAS_LCD::setDrawBuffer(m_eLayer);
+	QAS_LCD::pushClip(cStart, cEnd);
+	QAS_LCD::setDrawColor(m_uBackColor);
+
+	//Either clear the entire chart and draw every column that fits, or move the existing columns left to make room for the new ones
+	if (bFull) {
+		QAS_LCD::expose(cStart, cEnd);
+		QAS_LCD::drawRectFill(cStart, cEnd);
+		uNew = (m_uColumns < m_uWidth) ? m_uColumns : m_uWidth;
+	} else {
+		QAS_LCD::scrollRect(cStart, cEnd, -(int16_t)uNew, 0);
+	}
+
+	//Draw new columns, starting with the most recent at the right-hand edge
+	QAS_LCD::setDrawColor(m_uColor);
+	for (uint32_t i=0; i<uNew; i++) {
+		uint32_t uColumn = m_uColumns - 1 - i;
+		drawColumn(m_cArea.x1 - i, m_sColumns[uColumn % QAS_LCD_CHART_COLUMNS]);
+	}
+
+	QAS_LCD::popClip();
+
+	sView.uColumns = m_uColumns;
+	sView.bValid   = true;
+}
+
+
+//QAS_LCD_Chart::refresh
+//QAS_LCD_Chart Rendering Method
+//
+//Used to mark every buffer of the layer as not showing the chart, so that the chart is fully redrawn into each of them
+void QAS_LCD_Chart::refresh(void) {
+	for (uint8_t i=0; i<QAD_LTDC_BUFFERCOUNT; i++)
+		m_sViews[i].bValid = false;
+}
+
+
+	//------------------------------
+	//------------------------------
+	//QAS_LCD_Chart Private Methods
+
+//QAS_LCD_Chart::decimate
+//QAS_LCD_Chart Private Method
+//
+//Used to consume the samples waiting in the ring buffer, adding each to the current column and storing the column once it holds
+//m_uDecimation samples. Each column starts with the final sample of the previous column, so that the spans of neighbouring
+//columns always meet
+void QAS_LCD_Chart::decimate(void) {
+	uint16_t uTail = m_uTail;
+	uint16_t uHead = m_uHead;
+
+	while (uTail != uHead) {
+		int16_t iSample = m_iSamples[uTail];
+		uTail = (uTail + 1) & (QAS_LCD_CHART_SAMPLES - 1);
+
+		if (!m_uCount) {
+			m_sCurrent.iMin = m_bStarted ? m_iLast : iSample;
+			m_sCurrent.iMax = m_sCurrent.iMin;
+			m_bStarted      = true;
+		}
+		if (iSample < m_sCurrent.iMin)
+			m_sCurrent.iMin = iSample;
+		if (iSample > m_sCurrent.iMax)
+			m_sCurrent.iMax = iSample;
+		m_iLast = iSample;
+
+		if (++m_uCount >= m_uDecimation) {
+			m_sColumns[m_uColumns % QAS_LCD_CHART_COLUMNS] = m_sCurrent;
+			m_uColumns++;
+			m_uCount = 0;
+		}
+	}
+
+	m_uTail = uTail;
+}
+
+
+//QAS_LCD_Chart::valueY
+//QAS_LCD_Chart Private Method
+//
+//Returns the Y coordinate that a sample value is shown at, limited to the area of the chart
+//iValue - The sample value
+int16_t QAS_LCD_Chart::valueY(int16_t iValue) const {
+	int32_t iRange = (int32_t)m_iHigh - m_iLow;
+	if (!iRange)
+		return m_cArea.y0 + (m_cArea.height() / 2);
+
+	int32_t iY = m_cArea.y1 - ((((int32_t)iValue - m_iLow) * (m_cArea.height() - 1)) / iRange);
+	if (iY < m_cArea.y0)
+		return m_cArea.y0;
+	if (iY > m_cArea.y1)
+		return m_cArea.y1;
+	return iY;
+}
+
+
+//QAS_LCD_Chart::drawColumn
+//QAS_LCD_Chart Private Method
+//
+//Used to draw a single column as a vertical span covering its range of sample values
+//The draw color must be set to the trace color before calling
+//iX      - The X coordinate of the column
+//sColumn - The column to be drawn
+void QAS_LCD_Chart::drawColumn(int16_t iX, const QAS_LCD_ChartColumn& sColumn) {
+	QAS_LCD::drawLine(QAT_Vector2_16(iX, valueY(sColumn.iMax)), QAT_Vector2_16(iX, valueY(sColumn.iMin)));
+}
+
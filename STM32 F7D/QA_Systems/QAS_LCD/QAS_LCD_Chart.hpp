@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Strip Chart                              */
+/*   Filename: QAS_LCD_Chart.hpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_CHART_HPP_
+#define __QAS_LCD_CHART_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------------
+//QAS_LCD_CHART_SAMPLES
+//
+//Used to determine the number of samples the sample ring buffer of a chart can hold between calls to render(). Samples added while
+//the ring buffer is full are discarded. Must be a power of 2
+#define QAS_LCD_CHART_SAMPLES  ((uint16_t)1024)
+
+
+//---------------------
+//QAS_LCD_CHART_COLUMNS
+//
+//Used to determine the maximum width in pixels of a chart. Charts whose area is wider than this only use the right-most
+//QAS_LCD_CHART_COLUMNS columns of their area
+#define QAS_LCD_CHART_COLUMNS  ((uint16_t)QAD_LTDC_WIDTH)
+
+
+//-------------------
+//QAS_LCD_ChartColumn
+//
+//Structure used to store the range of sample values covered by a single pixel column of a chart
+typedef struct {
+	int16_t iMin;  //Lowest sample value of the column
+	int16_t iMax;  //Highest sample value of the column
+} QAS_LCD_ChartColumn;
+
+
+//-----------------
+//QAS_LCD_ChartView
+//
+//Structure used to store what a chart last rendered into one of the buffers of its layer
+typedef struct {
+	uint32_t uColumns;  //Number of completed columns when the buffer was last rendered
+	bool     bValid;    //Whether the buffer is showing the chart. If false then the chart is fully redrawn into the buffer
+} QAS_LCD_ChartView;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAS_LCD_Chart
+//
+//Class used to display a scrolling strip chart of live sample data in an area of a layer, such as an oscilloscope trace of a sensor
+//
+//Samples are added to a ring buffer, which can be done from an interrupt handler, and are consumed by render(). Consecutive samples
+//are decimated into pixel columns, with each column storing the lowest and highest sample values that fall within it, along with the
+//final sample of the previous column so that the trace remains connected. Each column is then drawn as a single vertical span,
+//however many samples it covers, with the newest column at the right-hand edge of the area.
+//
+//As each layer is double buffered, the chart keeps track of which columns each buffer is showing. When new columns have been completed
+//the existing columns of the buffer are moved to the left by QAS_LCD::scrollRect(), and only the new columns are drawn, so the cost
+//of rendering a frame only depends on the number of columns completed since the buffer was last rendered, rather than on the width of
+//the chart or the rate that samples arrive at.
+//
+//The chart owns its area of the layer, and is rendered in the same manner as QAS_LCD_Console (see QAS_LCD_Console.hpp).
+class QAS_LCD_Chart {
+private:
+
+	QAT_Rect_16       m_cArea;        //Area of the layer covered by the chart
+	QAD_LTDC_LayerIdx m_eLayer;       //Layer the chart is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+	uint16_t          m_uColor;       //ARGB4444 color of the trace
+	uint16_t          m_uBackColor;   //ARGB4444 color of the background
+	int16_t           m_iLow;         //Sample value shown at the bottom of the area
+	int16_t           m_iHigh;        //Sample value shown at the top of the area
+	uint16_t          m_uDecimation;  //Number of samples in each column
+	uint16_t          m_uWidth;       //Number of columns displayed
+
+	volatile int16_t  m_iSamples[QAS_LCD_CHART_SAMPLES]; //Sample ring buffer
+	volatile uint16_t m_uHead;        //Index that the next sample is written to by addSample()
+	volatile uint16_t m_uTail;        //Index that the next sample is read from by render()
+
+	QAS_LCD_ChartColumn m_sColumns[QAS_LCD_CHART_COLUMNS]; //Ring of completed columns, with column n stored at n % QAS_LCD_CHART_COLUMNS
+	uint32_t          m_uColumns;     //Number of completed columns
+	QAS_LCD_ChartColumn m_sCurrent;   //Column currently being filled with samples
+	uint16_t          m_uCount;       //Number of samples in the current column
+	int16_t           m_iLast;        //Most recent sample, used to connect each column to the previous one
+	bool              m_bStarted;     //Whether any samples have been decimated yet
+
+	QAS_LCD_ChartView m_sViews[QAD_LTDC_BUFFERCOUNT]; //What each buffer of the layer is showing, indexed by QAD_LTDC_BufferIdx defined in QAD_LTDC.hpp
+
+public:
+
+	//------------
+	//Constructors
+
+	//Constructor used to create a chart
+	//eLayer        - The layer the chart is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+	//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the chart's area
+	//iLow          - Sample value shown at the bottom of the area
+	//iHigh         - Sample value shown at the top of the area
+	//uDecimation   - Number of samples in each column. A value of 0 is treated as 1
+	//uColor        - ARGB4444 color of the trace
+	//uBackColor    - ARGB4444 color of the background
+	QAS_LCD_Chart(QAD_LTDC_LayerIdx eLayer, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, int16_t iLow, int16_t iHigh, uint16_t uDecimation,
+			          uint16_t uColor, uint16_t uBackColor);
+
+
+	//NOTE: See QAS_LCD_Chart.cpp for details of the following methods
+
+	//--------------
+	//Sample Methods
+
+	bool addSample(int16_t iSample);
+	uint16_t addSamples(const int16_t* pSamples, uint16_t uCount);
+	void setRange(int16_t iLow, int16_t iHigh);
+	void clear(void);
+
+
+	//-----------------
+	//Rendering Methods
+
+	void render(void);
+	void refresh(void);
+
+private:
+
+	//---------------
+	//Private Methods
+
+	void decimate(void);
+	int16_t valueY(int16_t iValue) const;
+	void drawColumn(int16_t iX, const QAS_LCD_ChartColumn& sColumn);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_CHART_HPP_ */
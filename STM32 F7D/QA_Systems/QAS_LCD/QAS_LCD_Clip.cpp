@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Clipping                                 */
+/*   Filename: QAS_LCD_Clip.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Clip.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//------------------------------------
+	//------------------------------------
+	//QAS_LCD_ClipStack Management Methods
+
+//QAS_LCD_ClipStack::push
+//QAS_LCD_ClipStack Management Method
+//
+//Used to push a clip rectangle onto the stack. The rectangle is intersected with the current clip rectangle, so rendering
+//can never escape a clip rectangle pushed further down the stack
+//cRect - The clip rectangle to be pushed
+void QAS_LCD_ClipStack::push(const QAT_Rect_16& cRect) {
+	if (m_uDepth >= QAS_LCD_CLIPSTACK_LENGTH) {
+		m_uOverflow++;
+		return;
+	}
+
+	m_cRects[m_uDepth] = m_uDepth ? cRect.intersect(m_cRects[m_uDepth-1]) : cRect;
+	m_uDepth++;
+}
+
+
+//QAS_LCD_ClipStack::pop
+//QAS_LCD_ClipStack Management Method
+//
+//Used to remove the most recently pushed clip rectangle from the stack
+void QAS_LCD_ClipStack::pop(void) {
+	if (m_uOverflow) {
+		m_uOverflow--;
+		return;
+	}
+
+	if (m_uDepth)
+		m_uDepth--;
+}
+
+
+	//--------------------------------
+	//--------------------------------
+	//QAS_LCD_Clip Clipping Methods
+
+//QAS_LCD_Clip::outCode
+//QAS_LCD_Clip Clipping Method
+//
+//Returns the Cohen-Sutherland outcode of a point relative to a clip rectangle, made up of QAS_LCD_OutCode bits
+//An outcode of 0 means that the point is inside the rectangle
+uint8_t QAS_LCD_Clip::outCode(int16_t x, int16_t y, const QAT_Rect_16& cRect) {
+	uint8_t uCode = 0;
+	if (x < cRect.x0)
+		uCode |= QAS_LCD_Out_Left; else
+	if (x > cRect.x1)
+		uCode |= QAS_LCD_Out_Right;
+	if (y < cRect.y0)
+		uCode |= QAS_LCD_Out_Top; else
+	if (y > cRect.y1)
+		uCode |= QAS_LCD_Out_Bottom;
+	return uCode;
+}
+
+
+//QAS_LCD_Clip::lineSteps
+//QAS_LCD_Clip Clipping Method
+//
+//Used to clip a line drawn by QAS_LCD::imp_drawALine() against a clip rectangle
+//Rather than moving the end points of the line, which would change which pixels Bresenham's algorithm selects, this method
+//returns the range of steps of the unclipped line that fall within the rectangle. The line is then drawn from its unclipped
+//state at step iFirst, producing exactly the same pixels as the unclipped line without any per-pixel tests.
+//
+//Cohen-Sutherland outcodes of the end points are used to trivially reject lines that lie entirely to one side of the
+//rectangle, and to trivially accept lines that lie entirely within it. Otherwise the step range is limited exactly along the
+//major axis, and then along the minor axis by solving the Bresenham error term for the first and last steps within range.
+//
+//cStart & cEnd   - The start and end points of the line. The line must be neither horizontal nor vertical
+//cRect           - The clip rectangle
+//iFirst & iLast  - Set to the first and last steps (inclusive) of the line that are within the rectangle. Step 0 is cStart,
+//                  and the final step is the pixel before cEnd, matching imp_drawALine()
+//Returns true if any part of the line is within the rectangle, or false if the line is rejected
+bool QAS_LCD_Clip::lineSteps(const QAT_Vector2_16& cStart, const QAT_Vector2_16& cEnd, const QAT_Rect_16& cRect, int32_t& iFirst, int32_t& iLast) {
+	//Vector components are treated as signed, so that lines starting or ending off the LCD panel are clipped correctly
+	int32_t iStartX = (int16_t)cStart.x;
+	int32_t iStartY = (int16_t)cStart.y;
+	int32_t iEndX   = (int16_t)cEnd.x;
+	int32_t iEndY   = (int16_t)cEnd.y;
+
+	uint8_t uCodeStart = outCode(iStartX, iStartY, cRect);
+	uint8_t uCodeEnd   = outCode(iEndX, iEndY, cRect);
+
+	//Trivially reject line if both end points are outside the same edge
+	if (uCodeStart & uCodeEnd)
+		return false;
+
+	int32_t iDeltaX = (iEndX >= iStartX) ? (iEndX - iStartX) : (iStartX - iEndX);
+	int32_t iDeltaY = (iEndY >= iStartY) ? (iEndY - iStartY) : (iStartY - iEndY);
+	bool    bXMajor = (iDeltaX >= iDeltaY);
+
+	int32_t iDen = bXMajor ? iDeltaX : iDeltaY;  //Major axis delta, which is also the number of steps
+	int32_t iAdd = bXMajor ? iDeltaY : iDeltaX;  //Minor axis delta
+	int32_t iNum = iDen / 2;                     //Initial Bresenham numerator
+
+	iFirst = 0;
+	iLast  = iDen - 1;
+
+	//Trivially accept line if both end points are inside the rectangle
+	if (!(uCodeStart | uCodeEnd))
+		return (iLast >= iFirst);
+
+	//Determine major and minor axis positions and directions
+	int32_t iMaj    = bXMajor ? iStartX : iStartY;
+	int32_t iMin    = bXMajor ? iStartY : iStartX;
+	bool    bMajInc = bXMajor ? (iEndX >= iStartX) : (iEndY >= iStartY);
+	bool    bMinInc = bXMajor ? (iEndY >= iStartY) : (iEndX >= iStartX);
+	int32_t iMajLo  = bXMajor ? cRect.x0 : cRect.y0;
+	int32_t iMajHi  = bXMajor ? cRect.x1 : cRect.y1;
+	int32_t iMinLo  = bXMajor ? cRect.y0 : cRect.x0;
+	int32_t iMinHi  = bXMajor ? cRect.y1 : cRect.x1;
+
+	//Limit steps along the major axis, where the position at step i is iMaj +/- i
+	int32_t iLo = bMajInc ? (iMajLo - iMaj) : (iMaj - iMajHi);
+	int32_t iHi = bMajInc ? (iMajHi - iMaj) : (iMaj - iMajLo);
+	if (iLo > iFirst)
+		iFirst = iLo;
+	if (iHi < iLast)
+		iLast = iHi;
+
+	//Limit steps along the minor axis, where the offset from iMin at step i is floor((iNum + i*iAdd) / iDen)
+	int32_t iOffLo = bMinInc ? (iMinLo - iMin) : (iMin - iMinHi);
+	int32_t iOffHi = bMinInc ? (iMinHi - iMin) : (iMin - iMinLo);
+	if (iOffHi < 0)
+		return false;
+	if (iOffLo > 0) {
+		int32_t iStep = (int32_t)((((int64_t)iOffLo * iDen) - iNum + iAdd - 1) / iAdd);
+		if (iStep > iFirst)
+			iFirst = iStep;
+	}
+	int64_t iStepHi = (((int64_t)(iOffHi + 1) * iDen) - iNum - 1) / iAdd;
+	if (iStepHi < iLast)
+		iLast = (int32_t)iStepHi;
+
+	return (iLast >= iFirst);
+}
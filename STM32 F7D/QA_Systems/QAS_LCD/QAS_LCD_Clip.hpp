@@ -0,0 +1,146 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Clipping                                 */
+/*   Filename: QAS_LCD_Clip.hpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_CLIP_HPP_
+#define __QAS_LCD_CLIP_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+#include "QAT_Vector.hpp"
+#include "QAT_Rect.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------------
+//QAS_LCD_CLIPSTACK_LENGTH
+//
+//Used to determine the maximum number of clip rectangles that can be pushed onto the clip stack
+#define QAS_LCD_CLIPSTACK_LENGTH  ((uint8_t)8)
+
+
+//----------------
+//QAS_LCD_OutCode
+//
+//Cohen-Sutherland outcode bits, used to describe which sides of a clip rectangle a point lies outside of
+enum QAS_LCD_OutCode : uint8_t {
+	QAS_LCD_Out_Left   = 0x01,
+	QAS_LCD_Out_Right  = 0x02,
+	QAS_LCD_Out_Top    = 0x04,
+	QAS_LCD_Out_Bottom = 0x08
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------
+//QAS_LCD_ClipStack
+//
+//Class used to hold the stack of clip rectangles pushed by QAS_LCD::pushClip()
+//Each pushed rectangle is intersected with the rectangle below it, so the top of the stack is always the effective clip rectangle.
+//Pushes made while the stack is full are counted rather than stored, so that their matching pops leave the stack unchanged.
+class QAS_LCD_ClipStack {
+private:
+
+	QAT_Rect_16 m_cRects[QAS_LCD_CLIPSTACK_LENGTH];  //Array of clip rectangles
+	uint8_t     m_uDepth;                            //Number of clip rectangles currently stored in m_cRects
+	uint8_t     m_uOverflow;                         //Number of pushes made while the stack was full
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty clip stack
+	QAS_LCD_ClipStack() :
+		m_uDepth(0),
+		m_uOverflow(0) {}
+
+
+	//NOTE: See QAS_LCD_Clip.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	void push(const QAT_Rect_16& cRect);
+	void pop(void);
+
+	//Used to remove all clip rectangles from the stack
+	void clear(void) {
+		m_uDepth    = 0;
+		m_uOverflow = 0;
+	}
+
+
+	//------------
+	//Data Methods
+
+	//Returns true if no clip rectangles are currently pushed
+	bool empty(void) const {
+		return (m_uDepth == 0);
+	}
+
+	//Returns the effective clip rectangle. Must only be called if the stack is not empty
+	const QAT_Rect_16& top(void) const {
+		return m_cRects[m_uDepth-1];
+	}
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------
+//QAS_LCD_Clip
+//
+//Static class providing the analytic clipping methods used by QAS_LCD primitives
+class QAS_LCD_Clip {
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Clip() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAS_LCD_Clip.cpp for details of the following methods
+
+	//----------------
+	//Clipping Methods
+
+	static uint8_t outCode(int16_t x, int16_t y, const QAT_Rect_16& cRect);
+	static bool lineSteps(const QAT_Vector2_16& cStart, const QAT_Vector2_16& cEnd, const QAT_Rect_16& cRect, int32_t& iFirst, int32_t& iLast);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_CLIP_HPP_ */
@@ -0,0 +1,211 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Text Console                             */
+/*   Filename: QAS_LCD_Console.cpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Console.hpp"
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Console Constructor
+
+//QAS_LCD_Console::QAS_LCD_Console
+//QAS_LCD_Console Constructor
+//
+//Creates an empty console. The number of rows is determined by the height of the area and the height of the font
+//eLayer        - The layer the console is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the console's area
+//uFont         - Index of the font used to render text
+//uColor        - ARGB4444 color of text
+//uBackColor    - ARGB4444 color of the background
+QAS_LCD_Console::QAS_LCD_Console(QAD_LTDC_LayerIdx eLayer, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, uint8_t uFont, uint16_t uColor,
+		                             uint16_t uBackColor) :
+	m_cArea(cStart, cEnd),
+	m_eLayer(eLayer),
+	m_uFont(uFont),
+	m_uColor(uColor),
+	m_uBackColor(uBackColor) {
+
+	m_uLineHeight = QAS_LCD::getFontHeight(uFont);
+	m_uRows       = 0;
+	if (m_uLineHeight) {
+		uint16_t uRows = m_cArea.height() / m_uLineHeight;
+		m_uRows = (uRows < QAS_LCD_CONSOLE_ROWS) ? uRows : QAS_LCD_CONSOLE_ROWS;
+	}
+
+	clear();
+}
+
+
+	//------------------------------
+	//------------------------------
+	//QAS_LCD_Console Text Methods
+
+//QAS_LCD_Console::write
+//QAS_LCD_Console Text Method
+//
+//Used to append text to the current line. Each newline character completes the current line and starts a new one, and carriage
+//returns are ignored, so text can be passed on exactly as it is sent over serial
+//str - The C-style string to be written
+void QAS_LCD_Console::write(const char* str) {
+	while (*str) {
+		char ch = *str++;
+		if (ch == '\n') {
+			newLine();
+		} else if ((ch != '\r') && (m_uLength < QAS_LCD_CONSOLE_COLUMNS)) {
+			char* strLine = m_strLines[m_uLines % QAS_LCD_CONSOLE_ROWS];
+			strLine[m_uLength++] = ch;
+			strLine[m_uLength]   = 0;
+			m_uRevision++;
+		}
+	}
+}
+
+
+//QAS_LCD_Console::writeLine
+//QAS_LCD_Console Text Method
+//
+//Used to append text to the current line and then complete it
+//str - The C-style string to be written
+void QAS_LCD_Console::writeLine(const char* str) {
+	write(str);
+	newLine();
+}
+
+
+//QAS_LCD_Console::clear
+//QAS_LCD_Console Text Method
+//
+//Used to remove all lines from the console. Both buffers are fully redrawn the next time they are rendered
+void QAS_LCD_Console::clear(void) {
+	for (uint8_t i=0; i<QAS_LCD_CONSOLE_ROWS; i++)
+		m_strLines[i][0] = 0;
+	m_uLines    = 0;
+	m_uLength   = 0;
+	m_uRevision = 0;
+	refresh();
+}
+
+
+	//-----------------------------------
+	//-----------------------------------
+	//QAS_LCD_Console Rendering Methods
+
+//QAS_LCD_Console::render
+//QAS_LCD_Console Rendering Method
+//
+//Used to bring the current back-buffer of the console's layer up to date, leaving the layer selected as the draw buffer
+//If lines have been completed since the buffer was last rendered, its rows are scrolled up by the number of new lines and only the
+//rows below the previous current line are redrawn. If only the current line has changed then only the bottom row is redrawn, and if
+//nothing has changed then nothing is rendered. The buffer is fully redrawn if it is not yet showing the console, or if more lines
+//have been completed than fit in the console.
+//Sets the font, draw color and clip stack of QAS_LCD, so any required state must be reselected afterwards
+void QAS_LCD_Console::render(void) {
+	if (!m_uRows)
+		return;
+
+	QAD_LTDC_BufferIdx eBuffer = (m_eLayer == QAD_LTDC_Layer0) ? QAD_LTDC::getLayer0BackBufferIdx() : QAD_LTDC::getLayer1BackBufferIdx();
+	QAS_LCD_ConsoleView& sView = m_sViews[eBuffer];
+
+	//Determine whether the buffer needs to be fully redrawn, or the first row that needs to be redrawn
+	uint32_t uNew  = m_uLines - sView.uLines;
+	bool     bFull = (!sView.bValid || (uNew >= m_uRows));
+	uint8_t  uFirst;
+	if (bFull)
+		uFirst = 0; else
+	if (uNew)
+		uFirst = m_uRows - 1 - uNew; else
+	if (sView.uRevision != m_uRevision)
+		uFirst = m_uRows - 1; else
+		return;
+
+	QAS_LCD::setDrawBuffer(m_eLayer);
+	QAS_LCD::pushClip(QAT_Vector2_16(m_cArea.x0, m_cArea.y0), QAT_Vector2_16(m_cArea.x1, m_cArea.y1));
+	QAS_LCD::setFontByIndex(m_uFont);
+	QAS_LCD::setDrawColor(m_uBackColor);
+
+	if (bFull) {
+		QAS_LCD::expose(QAT_Vector2_16(m_cArea.x0, m_cArea.y0), QAT_Vector2_16(m_cArea.x1, m_cArea.y1));
+		QAS_LCD::drawRectFill(QAT_Vector2_16(m_cArea.x0, m_cArea.y0), QAT_Vector2_16(m_cArea.x1, m_cArea.y1));
+	} else if (uNew) {
+		int16_t iBottom = m_cArea.y0 + (m_uRows * m_uLineHeight) - 1;
+		QAS_LCD::scrollRect(QAT_Vector2_16(m_cArea.x0, m_cArea.y0), QAT_Vector2_16(m_cArea.x1, iBottom), -(int16_t)(uNew * m_uLineHeight));
+	}
+
+	for (uint8_t i=uFirst; i<m_uRows; i++)
+		drawRow(i, !bFull);
+
+	QAS_LCD::popClip();
+
+	sView.uLines    = m_uLines;
+	sView.uRevision = m_uRevision;
+	sView.bValid    = true;
+}
+
+
+//QAS_LCD_Console::refresh
+//QAS_LCD_Console Rendering Method
+//
+//Used to mark every buffer of the layer as not showing the console, so that the console is fully redrawn into each of them
+void QAS_LCD_Console::refresh(void) {
+	for (uint8_t i=0; i<QAD_LTDC_BUFFERCOUNT; i++)
+		m_sViews[i].bValid = false;
+}
+
+
+	//---------------------------------
+	//---------------------------------
+	//QAS_LCD_Console Private Methods
+
+//QAS_LCD_Console::newLine
+//QAS_LCD_Console Private Method
+//
+//Used to complete the current line and start a new empty line
+void QAS_LCD_Console::newLine(void) {
+	m_uLines++;
+	m_uLength = 0;
+	m_strLines[m_uLines % QAS_LCD_CONSOLE_ROWS][0] = 0;
+	m_uRevision++;
+}
+
+
+//QAS_LCD_Console::drawRow
+//QAS_LCD_Console Private Method
+//
+//Used to draw a single row of the console. The bottom row shows the current line, with each row above it showing the line before
+//The draw color must be set to the background color before calling
+//uRow   - The index of the row, where 0 is the top row
+//bClear - True if the row is to be exposed and cleared before the text is drawn
+void QAS_LCD_Console::drawRow(uint8_t uRow, bool bClear) {
+	int16_t iY = m_cArea.y0 + (uRow * m_uLineHeight);
+
+	if (bClear) {
+		QAT_Vector2_16 cStart(m_cArea.x0, iY);
+		QAT_Vector2_16 cEnd(m_cArea.x1, iY + m_uLineHeight - 1);
+		QAS_LCD::expose(cStart, cEnd);
+		QAS_LCD::drawRectFill(cStart, cEnd);
+	}
+
+	int32_t iLine = (int32_t)m_uLines - ((m_uRows - 1) - uRow);
+	const char* strLine = m_strLines[(uint32_t)iLine % QAS_LCD_CONSOLE_ROWS];
+	if ((iLine >= 0) && strLine[0]) {
+		QAS_LCD::setDrawColor(m_uColor);
+		QAS_LCD::drawStrL(QAT_Vector2_16(m_cArea.x0, iY), strLine);
+		QAS_LCD::setDrawColor(m_uBackColor);
+	}
+}
+
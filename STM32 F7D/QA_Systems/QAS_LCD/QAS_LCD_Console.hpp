@@ -0,0 +1,138 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Text Console                             */
+/*   Filename: QAS_LCD_Console.hpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_CONSOLE_HPP_
+#define __QAS_LCD_CONSOLE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------------
+//QAS_LCD_CONSOLE_ROWS
+//
+//Used to determine the maximum number of rows of text a console can display. Consoles whose area holds more rows than this
+//only use the upper QAS_LCD_CONSOLE_ROWS rows of their area
+#define QAS_LCD_CONSOLE_ROWS     ((uint8_t)32)
+
+
+//-----------------------
+//QAS_LCD_CONSOLE_COLUMNS
+//
+//Used to determine the maximum number of characters stored for each line of a console. Further characters written to a line are discarded
+#define QAS_LCD_CONSOLE_COLUMNS  ((uint8_t)96)
+
+
+//-------------------
+//QAS_LCD_ConsoleView
+//
+//Structure used to store what a console last rendered into one of the buffers of its layer
+typedef struct {
+	uint32_t uLines;     //Number of completed lines when the buffer was last rendered
+	uint32_t uRevision;  //Revision of the current line when the buffer was last rendered
+	bool     bValid;     //Whether the buffer is showing the console. If false then the console is fully redrawn into the buffer
+} QAS_LCD_ConsoleView;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------
+//QAS_LCD_Console
+//
+//Class used to display a scrolling log of text lines in an area of a layer, such as a mirror of the serial output
+//
+//Text is written into the console as it arrives, and is rendered into the layer's draw buffer by render(). As each layer is double
+//buffered, the console keeps track of which lines each buffer is showing. When new lines have been completed the existing rows of the
+//buffer are moved upwards by QAS_LCD::scrollRect(), and only the rows that have changed are then rendered, so each update costs one
+//line of text rather than the entire console. The current line being written is shown on the bottom row, and is redrawn as it grows.
+//
+//The console owns its area of the layer. render() is to be called once per frame, after the rest of the layer has been rendered and
+//before the layer is flipped, either outside of a display list or at the end of one. If anything else draws over the area of the
+//console then refresh() must be called so that the console is fully redrawn into every buffer.
+class QAS_LCD_Console {
+private:
+
+	QAT_Rect_16       m_cArea;        //Area of the layer covered by the console
+	QAD_LTDC_LayerIdx m_eLayer;       //Layer the console is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+	uint8_t           m_uFont;        //Index of the font used to render text
+	uint16_t          m_uColor;       //ARGB4444 color of text
+	uint16_t          m_uBackColor;   //ARGB4444 color of the background
+	uint8_t           m_uLineHeight;  //Height in pixels of each row, taken from the font
+	uint8_t           m_uRows;        //Number of rows of text displayed
+
+	char              m_strLines[QAS_LCD_CONSOLE_ROWS][QAS_LCD_CONSOLE_COLUMNS+1]; //Ring of line text, with line n stored at n % QAS_LCD_CONSOLE_ROWS
+	uint32_t          m_uLines;       //Number of completed lines. The current line is line m_uLines
+	uint8_t           m_uLength;      //Number of characters in the current line
+	uint32_t          m_uRevision;    //Incremented each time the current line changes
+
+	QAS_LCD_ConsoleView m_sViews[QAD_LTDC_BUFFERCOUNT]; //What each buffer of the layer is showing, indexed by QAD_LTDC_BufferIdx defined in QAD_LTDC.hpp
+
+public:
+
+	//------------
+	//Constructors
+
+	//Constructor used to create a console. The font must already have been added to QAS_LCD
+	//eLayer        - The layer the console is rendered to. Member of QAD_LTDC_LayerIdx enum defined in QAD_LTDC.hpp
+	//cStart & cEnd - QAT_Vector2_16 classes that define X and Y coordinates of the diagonally opposing corners of the console's area
+	//uFont         - Index of the font used to render text
+	//uColor        - ARGB4444 color of text
+	//uBackColor    - ARGB4444 color of the background
+	QAS_LCD_Console(QAD_LTDC_LayerIdx eLayer, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, uint8_t uFont, uint16_t uColor, uint16_t uBackColor);
+
+
+	//NOTE: See QAS_LCD_Console.cpp for details of the following methods
+
+	//------------
+	//Text Methods
+
+	void write(const char* str);
+	void writeLine(const char* str);
+	void clear(void);
+
+
+	//-----------------
+	//Rendering Methods
+
+	void render(void);
+	void refresh(void);
+
+private:
+
+	//---------------
+	//Private Methods
+
+	void newLine(void);
+	void drawRow(uint8_t uRow, bool bClear);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_CONSOLE_HPP_ */
@@ -0,0 +1,494 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Curves                                   */
+/*   Filename: QAS_LCD_Curve.cpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Curve.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//Sine table for 0 to 90 degrees in 1 degree steps, stored as Q14 fixed-point values
+static const int16_t QAS_LCD_Curve_Sin14[91] = {
+	    0,   286,   572,   857,  1143,  1428,  1713,  1997,  2280,  2563,
+	 2845,  3126,  3406,  3686,  3964,  4240,  4516,  4790,  5063,  5334,
+	 5604,  5872,  6138,  6402,  6664,  6924,  7182,  7438,  7692,  7943,
+	 8192,  8438,  8682,  8923,  9162,  9397,  9630,  9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+
+//Limit used in place of an unbounded span edge. Chosen so that adding a screen coordinate cannot overflow
+#define QAS_LCD_CURVE_UNBOUNDED  ((int32_t)0x3FFFFFFF)
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Curve Math Methods
+
+//QAS_LCD_Curve::isqrt
+//QAS_LCD_Curve Math Method
+//
+//Returns the integer square root of a value, rounded down
+//Calculated one result bit at a time, so takes a fixed 32 iterations and requires no division or floating point
+uint32_t QAS_LCD_Curve::isqrt(uint64_t uValue) {
+	uint64_t uRoot = 0;
+	uint64_t uBit  = (uint64_t)1 << 62;
+
+	while (uBit > uValue)
+		uBit >>= 2;
+
+	while (uBit) {
+		if (uValue >= (uRoot + uBit)) {
+			uValue -= (uRoot + uBit);
+			uRoot   = (uRoot >> 1) + uBit;
+		} else {
+			uRoot >>= 1;
+		}
+		uBit >>= 2;
+	}
+	return (uint32_t)uRoot;
+}
+
+
+//QAS_LCD_Curve::sin14
+//QAS_LCD_Curve Math Method
+//
+//Returns the sine of an angle as a Q14 fixed-point value (16384 = 1.0)
+//iAngle - The angle in degrees. Any value is accepted
+int32_t QAS_LCD_Curve::sin14(int32_t iAngle) {
+	iAngle %= 360;
+	if (iAngle < 0)
+		iAngle += 360;
+
+	if (iAngle <= 90)
+		return QAS_LCD_Curve_Sin14[iAngle];
+	if (iAngle <= 180)
+		return QAS_LCD_Curve_Sin14[180 - iAngle];
+	if (iAngle <= 270)
+		return -QAS_LCD_Curve_Sin14[iAngle - 180];
+	return -QAS_LCD_Curve_Sin14[360 - iAngle];
+}
+
+
+//QAS_LCD_Curve::cos14
+//QAS_LCD_Curve Math Method
+//
+//Returns the cosine of an angle as a Q14 fixed-point value (16384 = 1.0)
+//iAngle - The angle in degrees. Any value is accepted
+int32_t QAS_LCD_Curve::cos14(int32_t iAngle) {
+	return sin14((iAngle % 360) + 90);
+}
+
+
+//QAS_LCD_Curve::floorDiv
+//QAS_LCD_Curve Math Method
+//
+//Returns the result of an integer division rounded towards negative infinity
+//iDen must not be 0
+int32_t QAS_LCD_Curve::floorDiv(int64_t iNum, int64_t iDen) {
+	int64_t iQuot = iNum / iDen;
+	if ((iNum % iDen) && ((iNum < 0) != (iDen < 0)))
+		iQuot--;
+	return (int32_t)iQuot;
+}
+
+
+//QAS_LCD_Curve::ceilDiv
+//QAS_LCD_Curve Math Method
+//
+//Returns the result of an integer division rounded towards positive infinity
+//iDen must not be 0
+int32_t QAS_LCD_Curve::ceilDiv(int64_t iNum, int64_t iDen) {
+	int64_t iQuot = iNum / iDen;
+	if ((iNum % iDen) && ((iNum < 0) == (iDen < 0)))
+		iQuot++;
+	return (int32_t)iQuot;
+}
+
+
+//QAS_LCD_Curve::limitRadius
+//QAS_LCD_Curve Math Method
+//
+//Returns a radius limited to between 0 and QAS_LCD_CURVE_MAXRADIUS
+int32_t QAS_LCD_Curve::limitRadius(int32_t iRadius) {
+	if (iRadius < 0)
+		return 0;
+	if (iRadius > QAS_LCD_CURVE_MAXRADIUS)
+		return QAS_LCD_CURVE_MAXRADIUS;
+	return iRadius;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_Sector Constructors
+
+//QAS_LCD_Sector::QAS_LCD_Sector
+//QAS_LCD_Sector Constructor
+//
+//iCenterX & iCenterY - The center of the arc
+//iStartAngle         - The angle in degrees at which the arc starts
+//iEndAngle           - The angle in degrees at which the arc ends
+QAS_LCD_Sector::QAS_LCD_Sector(int32_t iCenterX, int32_t iCenterY, int16_t iStartAngle, int16_t iEndAngle) :
+	m_iCenterX(iCenterX),
+	m_iCenterY(iCenterY) {
+
+	if (iEndAngle < iStartAngle) {
+		int16_t iTemp = iStartAngle;
+		iStartAngle   = iEndAngle;
+		iEndAngle     = iTemp;
+	}
+	int32_t iSweep = (int32_t)iEndAngle - iStartAngle;
+
+	m_bFull   = (iSweep >= 360);
+	m_bWide   = (iSweep > 180);
+	m_iStartX = QAS_LCD_Curve::cos14(iStartAngle);
+	m_iStartY = QAS_LCD_Curve::sin14(iStartAngle);
+	m_iEndX   = QAS_LCD_Curve::cos14(iEndAngle);
+	m_iEndY   = QAS_LCD_Curve::sin14(iEndAngle);
+}
+
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_Sector Data Methods
+
+//QAS_LCD_Sector::contains
+//QAS_LCD_Sector Data Method
+//
+//Returns true if a pixel lies within the angular range
+//A pixel is within the range if it is clockwise of the start direction and anti-clockwise of the end direction. For ranges of
+//up to 180 degrees both must be true, while for wider ranges either is sufficient
+//iX & iY - The position of the pixel
+bool QAS_LCD_Sector::contains(int32_t iX, int32_t iY) const {
+	if (m_bFull)
+		return true;
+
+	int64_t iDX    = iX - m_iCenterX;
+	int64_t iDY    = iY - m_iCenterY;
+	bool    bStart = ((m_iStartX * iDY) - (m_iStartY * iDX)) >= 0;
+	bool    bEnd   = ((iDX * m_iEndY) - (iDY * m_iEndX)) >= 0;
+
+	return m_bWide ? (bStart || bEnd) : (bStart && bEnd);
+}
+
+
+//QAS_LCD_Sector::clip
+//QAS_LCD_Sector Data Method
+//
+//Used to limit a set of spans from a single row to the portions within the angular range
+//The result is identical to testing each pixel of the spans with contains(), but only requires one division per range edge
+//iY     - The row of the spans
+//pSpans - Pointer to the spans to be clipped
+//uCount - The number of spans to be clipped. Must be no more than QAS_LCD_CURVE_SPANLENGTH/2
+//pOut   - Pointer to an array of at least QAS_LCD_CURVE_SPANLENGTH spans that the clipped spans are to be stored into
+//Returns the number of clipped spans
+uint8_t QAS_LCD_Sector::clip(int32_t iY, const QAS_LCD_CurveSpan* pSpans, uint8_t uCount, QAS_LCD_CurveSpan* pOut) const {
+	QAS_LCD_CurveSpan sRange[2];
+	uint8_t uRanges = 0;
+	uint8_t uOut    = 0;
+
+	if (m_bFull) {
+		sRange[0].iLeft  = -QAS_LCD_CURVE_UNBOUNDED;
+		sRange[0].iRight = QAS_LCD_CURVE_UNBOUNDED;
+		uRanges = 1;
+	} else {
+		uRanges = intervals(iY, sRange);
+	}
+
+	for (uint8_t i=0; i<uCount; i++) {
+		for (uint8_t j=0; j<uRanges; j++) {
+			int32_t iLeft  = (pSpans[i].iLeft > sRange[j].iLeft) ? pSpans[i].iLeft : sRange[j].iLeft;
+			int32_t iRight = (pSpans[i].iRight < sRange[j].iRight) ? pSpans[i].iRight : sRange[j].iRight;
+			if (iLeft <= iRight) {
+				pOut[uOut].iLeft  = iLeft;
+				pOut[uOut].iRight = iRight;
+				uOut++;
+			}
+		}
+	}
+	return uOut;
+}
+
+
+	//-------------------------------
+	//-------------------------------
+	//QAS_LCD_Sector Private Methods
+
+//QAS_LCD_Sector::intervals
+//QAS_LCD_Sector Private Method
+//
+//Used to determine the horizontal intervals of a row that are within the angular range
+//Each range edge limits the row to a half-plane, which for a single row is an interval bounded on one side. These are then
+//intersected for ranges of up to 180 degrees, or combined for wider ranges
+//iY   - The row
+//pOut - Pointer to an array of two spans that the intervals are to be stored into
+//Returns the number of intervals
+uint8_t QAS_LCD_Sector::intervals(int32_t iY, QAS_LCD_CurveSpan* pOut) const {
+	QAS_LCD_CurveSpan sStart;
+	QAS_LCD_CurveSpan sEnd;
+	int64_t iDY = iY - m_iCenterY;
+
+	//Start edge: m_iStartY * dx <= m_iStartX * dy
+	//End edge:   m_iEndY * dx >= m_iEndX * dy
+	bool bStart = halfPlane(m_iStartY, m_iStartX * iDY, sStart);
+	bool bEnd   = halfPlane(-m_iEndY, -m_iEndX * iDY, sEnd);
+
+	//Convert intervals from being relative to the center of the arc
+	if (sStart.iLeft != -QAS_LCD_CURVE_UNBOUNDED)
+		sStart.iLeft  += m_iCenterX;
+	if (sStart.iRight != QAS_LCD_CURVE_UNBOUNDED)
+		sStart.iRight += m_iCenterX;
+	if (sEnd.iLeft != -QAS_LCD_CURVE_UNBOUNDED)
+		sEnd.iLeft    += m_iCenterX;
+	if (sEnd.iRight != QAS_LCD_CURVE_UNBOUNDED)
+		sEnd.iRight   += m_iCenterX;
+
+	if (!m_bWide) {
+		if (!bStart || !bEnd)
+			return 0;
+		pOut[0].iLeft  = (sStart.iLeft > sEnd.iLeft) ? sStart.iLeft : sEnd.iLeft;
+		pOut[0].iRight = (sStart.iRight < sEnd.iRight) ? sStart.iRight : sEnd.iRight;
+		return (pOut[0].iLeft <= pOut[0].iRight) ? 1 : 0;
+	}
+
+	if (!bStart && !bEnd)
+		return 0;
+	if (!bStart || !bEnd) {
+		pOut[0] = bStart ? sStart : sEnd;
+		return 1;
+	}
+
+	//Combine intervals into a single interval if they overlap or touch
+	if ((sStart.iLeft <= (sEnd.iRight + 1)) && (sEnd.iLeft <= (sStart.iRight + 1))) {
+		pOut[0].iLeft  = (sStart.iLeft < sEnd.iLeft) ? sStart.iLeft : sEnd.iLeft;
+		pOut[0].iRight = (sStart.iRight > sEnd.iRight) ? sStart.iRight : sEnd.iRight;
+		return 1;
+	}
+	pOut[0] = sStart;
+	pOut[1] = sEnd;
+	return 2;
+}
+
+
+//QAS_LCD_Sector::halfPlane
+//QAS_LCD_Sector Private Method
+//
+//Used to determine the interval of dx values that satisfy iScale * dx <= iLimit
+//iScale - The scale applied to dx
+//iLimit - The limit
+//sOut   - Reference to the span that the interval is to be stored into
+//Returns true if the interval contains any values, or false if it is empty
+bool QAS_LCD_Sector::halfPlane(int32_t iScale, int64_t iLimit, QAS_LCD_CurveSpan& sOut) {
+	sOut.iLeft  = -QAS_LCD_CURVE_UNBOUNDED;
+	sOut.iRight = QAS_LCD_CURVE_UNBOUNDED;
+
+	if (iScale > 0)
+		sOut.iRight = QAS_LCD_Curve::floorDiv(iLimit, iScale); else
+	if (iScale < 0)
+		sOut.iLeft  = QAS_LCD_Curve::ceilDiv(iLimit, iScale); else
+		return (iLimit >= 0);
+	return true;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_Shape Constructors
+
+//QAS_LCD_Shape::roundRect
+//QAS_LCD_Shape Constructor
+//
+//Used to create a rectangle with rounded corners
+//The corner radius is limited so that opposing corners do not overlap
+//cRect   - The rectangle
+//iRadius - The radius of the corners
+//bExact  - True to include only pixels within the exact radius
+QAS_LCD_Shape QAS_LCD_Shape::roundRect(const QAT_Rect_16& cRect, int32_t iRadius, bool bExact) {
+	int32_t iLimit = ((cRect.width() < cRect.height()) ? cRect.width() : cRect.height());
+	iLimit = (iLimit > 0) ? ((iLimit - 1) / 2) : 0;
+	if (iRadius > iLimit)
+		iRadius = iLimit;
+
+	return QAS_LCD_Shape(QAS_LCD_Shape_RoundRect, cRect.x0, cRect.y0, cRect.x1, cRect.y1, iRadius, iRadius, bExact);
+}
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Shape Data Methods
+
+//QAS_LCD_Shape::span
+//QAS_LCD_Shape Data Method
+//
+//Used to determine the horizontal extent of the shape on a single row
+//iY     - The row
+//iLeft  - Reference to store the left-most pixel of the row into
+//iRight - Reference to store the right-most pixel of the row into
+//Returns true if the shape covers any pixels of the row, or false if it does not
+bool QAS_LCD_Shape::span(int32_t iY, int32_t& iLeft, int32_t& iRight) const {
+	int32_t iHalf;
+
+	if (m_eType == QAS_LCD_Shape_Ellipse) {
+		iHalf = halfWidth(iY - m_iY0, m_iRadX, m_iRadY);
+		if (iHalf < 0)
+			return false;
+		iLeft  = m_iX0 - iHalf;
+		iRight = m_iX0 + iHalf;
+		return true;
+	}
+
+	//Rounded rectangle. Rows between the corners cover the full width of the rectangle
+	if ((iY < m_iY0) || (iY > m_iY1))
+		return false;
+
+	int32_t iDY = 0;
+	if (iY < (m_iY0 + m_iRadY))
+		iDY = iY - (m_iY0 + m_iRadY); else
+	if (iY > (m_iY1 - m_iRadY))
+		iDY = iY - (m_iY1 - m_iRadY);
+
+	iHalf = (iDY != 0) ? halfWidth(iDY, m_iRadX, m_iRadY) : m_iRadX;
+	if (iHalf < 0)
+		return false;
+	iLeft  = m_iX0 + m_iRadX - iHalf;
+	iRight = m_iX1 - m_iRadX + iHalf;
+	return true;
+}
+
+
+//QAS_LCD_Shape::outline
+//QAS_LCD_Shape Data Method
+//
+//Used to determine the pixels of a single row that make up the outline of the shape
+//A pixel is part of the outline if it is within the shape and at least one of the four pixels beside it is not. This produces
+//a continuous outline a single pixel thick, and as each pixel of the outline belongs to exactly one row and one span, no pixel
+//is written more than once
+//iY   - The row
+//pOut - Pointer to an array of at least two spans that the outline spans are to be stored into
+//Returns the number of spans
+uint8_t QAS_LCD_Shape::outline(int32_t iY, QAS_LCD_CurveSpan* pOut) const {
+	int32_t iLeft, iRight, iPrevL, iPrevR, iNextL, iNextR;
+
+	if (!span(iY, iLeft, iRight))
+		return 0;
+
+	//If either neighbouring row is empty then the entire row is part of the outline
+	if (!span(iY-1, iPrevL, iPrevR) || !span(iY+1, iNextL, iNextR)) {
+		pOut[0].iLeft  = iLeft;
+		pOut[0].iRight = iRight;
+		return 1;
+	}
+
+	//Interior pixels are those within both neighbouring rows, excluding the first and last pixel of the row
+	int32_t iInnerL = (iPrevL > iNextL) ? iPrevL : iNextL;
+	int32_t iInnerR = (iPrevR < iNextR) ? iPrevR : iNextR;
+	if (iInnerL <= iLeft)
+		iInnerL = iLeft + 1;
+	if (iInnerR >= iRight)
+		iInnerR = iRight - 1;
+
+	if (iInnerL > iInnerR) {
+		pOut[0].iLeft  = iLeft;
+		pOut[0].iRight = iRight;
+		return 1;
+	}
+
+	pOut[0].iLeft  = iLeft;
+	pOut[0].iRight = iInnerL - 1;
+	pOut[1].iLeft  = iInnerR + 1;
+	pOut[1].iRight = iRight;
+	return 2;
+}
+
+
+//QAS_LCD_Shape::bounds
+//QAS_LCD_Shape Data Method
+//
+//Returns the bounding rectangle of the shape, limited to the range of QAT_Rect_16
+QAT_Rect_16 QAS_LCD_Shape::bounds(void) const {
+	int32_t iBounds[4] = {m_iX0, m_iY0, m_iX1, m_iY1};
+
+	if (m_eType == QAS_LCD_Shape_Ellipse) {
+		iBounds[0] -= m_iRadX;
+		iBounds[1] -= m_iRadY;
+		iBounds[2] += m_iRadX;
+		iBounds[3] += m_iRadY;
+	}
+
+	for (uint8_t i=0; i<4; i++) {
+		if (iBounds[i] < INT16_MIN)
+			iBounds[i] = INT16_MIN;
+		if (iBounds[i] > INT16_MAX)
+			iBounds[i] = INT16_MAX;
+	}
+	return QAT_Rect_16(iBounds[0], iBounds[1], iBounds[2], iBounds[3]);
+}
+
+
+	//------------------------------
+	//------------------------------
+	//QAS_LCD_Shape Private Methods
+
+//QAS_LCD_Shape::halfWidth
+//QAS_LCD_Shape Private Method
+//
+//Used to determine the number of pixels either side of the center of an ellipse that are within the ellipse for a single row
+//For the standard criterion, the largest x satisfying (2x)^2(2b+1)^2 + (2y)^2(2a+1)^2 <= (2a+1)^2(2b+1)^2 is found.
+//For the exact criterion, the largest x satisfying x^2b^2 + y^2a^2 <= a^2b^2 is found.
+//iY     - The row, relative to the center of the ellipse
+//iRadX  - The X radius of the ellipse
+//iRadY  - The Y radius of the ellipse
+//Returns the half-width of the row, or -1 if the row is outside of the ellipse
+int32_t QAS_LCD_Shape::halfWidth(int32_t iY, int32_t iRadX, int32_t iRadY) const {
+
+	//Exact criterion. Not applicable to zero radii, which would otherwise have no area
+	if (m_bExact && iRadX && iRadY) {
+		int64_t iRem = ((int64_t)iRadY * iRadY) - ((int64_t)iY * iY);
+		if (iRem < 0)
+			return -1;
+		return QAS_LCD_Curve::isqrt((uint64_t)iRadX * iRadX * iRem) / iRadY;
+	}
+
+	//Standard criterion, which matches the decisions made by the midpoint ellipse algorithm
+	int64_t iA   = (2 * iRadX) + 1;
+	int64_t iB   = (2 * iRadY) + 1;
+	int64_t iRem = (iB * iB) - (4 * (int64_t)iY * iY);
+	if (iRem < 0)
+		return -1;
+	return QAS_LCD_Curve::isqrt((uint64_t)(iA * iA * iRem)) / (2 * iB);
+}
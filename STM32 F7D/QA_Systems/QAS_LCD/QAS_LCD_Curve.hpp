@@ -0,0 +1,249 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Curves                                   */
+/*   Filename: QAS_LCD_Curve.hpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_CURVE_HPP_
+#define __QAS_LCD_CURVE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Rect.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------------
+//QAS_LCD_CURVE_MAXRADIUS
+//
+//Used to determine the largest radius supported by curved primitives. Larger radii are limited to this value
+//This keeps all intermediate values of the fixed-point calculations within 64bit integers
+#define QAS_LCD_CURVE_MAXRADIUS  ((int32_t)2047)
+
+
+//-------------------------
+//QAS_LCD_CURVE_SPANLENGTH
+//
+//Used to determine the maximum number of spans that a single row of a curved primitive can produce
+#define QAS_LCD_CURVE_SPANLENGTH ((uint8_t)4)
+
+
+//---------------------
+//QAS_LCD_CurveSpan
+//
+//Structure used to store a horizontal span of pixels produced by a curved primitive
+typedef struct {
+	int32_t iLeft;   //Left-most pixel of the span (inclusive)
+	int32_t iRight;  //Right-most pixel of the span (inclusive)
+} QAS_LCD_CurveSpan;
+
+
+//-----------------
+//QAS_LCD_CurveEdge
+//
+//Used to select which pixels along the edge of a curve are drawn by anti-aliased rendering methods
+enum QAS_LCD_CurveEdge : uint8_t {
+	QAS_LCD_Edge_Outline = 0,  //Both pixels either side of the curve, used for outlines
+	QAS_LCD_Edge_Outer,        //Only the pixel outside of the curve, used for the outer edge of filled shapes
+	QAS_LCD_Edge_Inner         //Only the pixel inside of the curve, used for the inner edge of filled arcs
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAS_LCD_Curve
+//
+//Static class providing the fixed-point math used by curved primitives
+class QAS_LCD_Curve {
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Curve() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAS_LCD_Curve.cpp for details of the following methods
+
+	//------------
+	//Math Methods
+
+	static uint32_t isqrt(uint64_t uValue);
+	static int32_t sin14(int32_t iAngle);
+	static int32_t cos14(int32_t iAngle);
+	static int32_t floorDiv(int64_t iNum, int64_t iDen);
+	static int32_t ceilDiv(int64_t iNum, int64_t iDen);
+	static int32_t limitRadius(int32_t iRadius);
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------
+//QAS_LCD_Sector
+//
+//Class used to describe the angular range of an arc
+//Angles are in degrees, measured clockwise from the positive X axis (3 o'clock), matching the downwards Y axis of the LCD panel.
+//If the end angle is less than the start angle then the two are exchanged, and a range of 360 degrees or more covers the whole circle.
+//The start and end of the range are stored as Q14 fixed-point direction vectors, so that whether a pixel lies within the range
+//can be tested using integer cross products rather than by calculating its angle.
+class QAS_LCD_Sector {
+private:
+
+	int32_t m_iCenterX; //Center of the arc
+	int32_t m_iCenterY;
+	int32_t m_iStartX;  //Q14 direction vector of the start of the range
+	int32_t m_iStartY;
+	int32_t m_iEndX;    //Q14 direction vector of the end of the range
+	int32_t m_iEndY;
+	bool    m_bFull;    //True if the range covers an entire circle
+	bool    m_bWide;    //True if the range covers more than 180 degrees
+
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Sector() = delete;  //Delete default constructor as the range needs to be supplied upon class creation
+
+	QAS_LCD_Sector(int32_t iCenterX, int32_t iCenterY, int16_t iStartAngle, int16_t iEndAngle);
+
+
+	//NOTE: See QAS_LCD_Curve.cpp for details of the following methods
+
+	//------------
+	//Data Methods
+
+	bool contains(int32_t iX, int32_t iY) const;
+	uint8_t clip(int32_t iY, const QAS_LCD_CurveSpan* pSpans, uint8_t uCount, QAS_LCD_CurveSpan* pOut) const;
+
+private:
+
+	//---------------
+	//Private Methods
+
+	uint8_t intervals(int32_t iY, QAS_LCD_CurveSpan* pOut) const;
+	static bool halfPlane(int32_t iScale, int64_t iLimit, QAS_LCD_CurveSpan& sOut);
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------
+//QAS_LCD_ShapeType
+//
+//Used to select the type of shape described by a QAS_LCD_Shape class
+enum QAS_LCD_ShapeType : uint8_t {
+	QAS_LCD_Shape_Ellipse = 0,  //Ellipse (or circle) described by a center and X and Y radii
+	QAS_LCD_Shape_RoundRect     //Rectangle with corners rounded to a radius
+};
+
+
+//-------------
+//QAS_LCD_Shape
+//
+//Class used to describe a convex curved shape as a set of horizontal spans, one per row
+//
+//Pixels are considered to be inside an ellipse if their centers are within the ellipse's radii plus half a pixel, which is the
+//same decision made by the midpoint ellipse algorithm. Shapes used for anti-aliased fills instead include only pixels whose centers
+//are within the exact radii, as the partially covered pixels around the edge are then drawn by the anti-aliasing methods.
+//All calculations use 64bit integer arithmetic with a single integer square root per row.
+class QAS_LCD_Shape {
+private:
+
+	QAS_LCD_ShapeType m_eType;    //The type of shape
+	int32_t           m_iX0;      //For ellipses, the center. For rounded rectangles, the upper-left corner
+	int32_t           m_iY0;
+	int32_t           m_iX1;      //For rounded rectangles only, the lower-right corner
+	int32_t           m_iY1;
+	int32_t           m_iRadX;    //For ellipses, the X and Y radii. For rounded rectangles, the corner radius in both
+	int32_t           m_iRadY;
+	bool              m_bExact;   //True if only pixels within the exact radii are included
+
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Shape() = delete;  //Delete default constructor as the shape needs to be supplied upon class creation
+
+	QAS_LCD_Shape(QAS_LCD_ShapeType eType, int32_t iX0, int32_t iY0, int32_t iX1, int32_t iY1, int32_t iRadX, int32_t iRadY, bool bExact) :
+		m_eType(eType),
+		m_iX0(iX0),
+		m_iY0(iY0),
+		m_iX1(iX1),
+		m_iY1(iY1),
+		m_iRadX(QAS_LCD_Curve::limitRadius(iRadX)),
+		m_iRadY(QAS_LCD_Curve::limitRadius(iRadY)),
+		m_bExact(bExact) {}
+
+	//Used to create an ellipse
+	//iX & iY       - The center of the ellipse
+	//iRadX & iRadY - The X and Y radii of the ellipse
+	//bExact        - True to include only pixels within the exact radii
+	static QAS_LCD_Shape ellipse(int32_t iX, int32_t iY, int32_t iRadX, int32_t iRadY, bool bExact) {
+		return QAS_LCD_Shape(QAS_LCD_Shape_Ellipse, iX, iY, iX, iY, iRadX, iRadY, bExact);
+	}
+
+	static QAS_LCD_Shape roundRect(const QAT_Rect_16& cRect, int32_t iRadius, bool bExact);
+
+
+	//NOTE: See QAS_LCD_Curve.cpp for details of the following methods
+
+	//------------
+	//Data Methods
+
+	bool span(int32_t iY, int32_t& iLeft, int32_t& iRight) const;
+	uint8_t outline(int32_t iY, QAS_LCD_CurveSpan* pOut) const;
+	QAT_Rect_16 bounds(void) const;
+
+	//Returns the X and Y radii of an ellipse, or the corner radius of a rounded rectangle
+	int32_t radX(void) const {
+		return m_iRadX;
+	}
+	int32_t radY(void) const {
+		return m_iRadY;
+	}
+
+private:
+
+	//---------------
+	//Private Methods
+
+	int32_t halfWidth(int32_t iY, int32_t iRadX, int32_t iRadY) const;
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_CURVE_HPP_ */
@@ -0,0 +1,305 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Display List                             */
+/*   Filename: QAS_LCD_DisplayList.cpp                                     */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_DisplayList.hpp"
+
+#include <string.h>
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//--------------------------------------
+	//--------------------------------------
+	//QAS_LCD_DisplayList Management Methods
+
+//QAS_LCD_DisplayList::hash
+//QAS_LCD_DisplayList Management Method
+//
+//Returns a 32bit FNV-1a hash of the commands currently stored in the display list
+//QAS_LCD_DISPLAYLIST_NOHASH is reserved to mean that no list has been presented, so is never returned
+uint32_t QAS_LCD_DisplayList::hash(void) const {
+	uint32_t uHash = 0x811C9DC5;
+	for (uint16_t i=0; i<m_uLength; i++) {
+		uHash ^= m_uData[i];
+		uHash *= 0x01000193;
+	}
+
+	if (uHash == QAS_LCD_DISPLAYLIST_NOHASH)
+		uHash = 0x00000001;
+	return uHash;
+}
+
+
+	//-------------------------------------
+	//-------------------------------------
+	//QAS_LCD_DisplayList Recording Methods
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has no parameters
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd) {
+	return write(&eCmd, 1);
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a single 8bit parameter, such as a layer or font index
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, uint8_t uParam) {
+	uint8_t uData[2] = {eCmd, uParam};
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a single 16bit color parameter
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, uint16_t uColor) {
+	uint8_t uData[3] = {eCmd};
+	memcpy(&uData[1], &uColor, sizeof(uColor));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a single position parameter
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos) {
+	uint8_t uData[5] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has start and end position parameters
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd) {
+	uint8_t uData[9] = {eCmd};
+	memcpy(&uData[1], &cStart.val, sizeof(cStart.val));
+	memcpy(&uData[5], &cEnd.val, sizeof(cEnd.val));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has three vector parameters, such as the center, radii and angles of an arc
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, QAT_Vector2_16 cExtra) {
+	uint8_t uData[13] = {eCmd};
+	memcpy(&uData[1], &cStart.val, sizeof(cStart.val));
+	memcpy(&uData[5], &cEnd.val, sizeof(cEnd.val));
+	memcpy(&uData[9], &cExtra.val, sizeof(cExtra.val));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a position and a character as parameters
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, char ch) {
+	uint8_t uData[6] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	uData[5] = (uint8_t)ch;
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a position, an 8bit parameter and a string as parameters
+//The string is copied into the display list along with its null termination character, so that it can be rendered directly during playback
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, uint8_t uParam, const char* str) {
+	uint16_t uLen = strlen(str) + 1;
+	if ((m_uLength + 8 + uLen) > QAS_LCD_DISPLAYLIST_SIZE)
+		return QA_Fail;
+
+	uint8_t uData[8] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	uData[5] = uParam;
+	memcpy(&uData[6], &uLen, sizeof(uLen));
+	write(uData, sizeof(uData));
+	return write(str, uLen);
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a position, a source rectangle, an 8bit parameter and an image as parameters
+//Only the image descriptor is copied into the display list. The image's pixel data is read from its original location during playback
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, QAT_Vector2_16 cSrcStart, QAT_Vector2_16 cSrcEnd, uint8_t uParam,
+		                               const QAS_LCD_Image& cImage) {
+	uint8_t uData[14 + sizeof(QAS_LCD_Image)] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	memcpy(&uData[5], &cSrcStart.val, sizeof(cSrcStart.val));
+	memcpy(&uData[9], &cSrcEnd.val, sizeof(cSrcEnd.val));
+	uData[13] = uParam;
+	memcpy(&uData[14], &cImage, sizeof(QAS_LCD_Image));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a position, an 8bit parameter and an encoded image as parameters
+//Only the image descriptor is copied into the display list. The encoded image is read from its original location during playback
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, uint8_t uParam, const QAS_LCD_RLEImage& cImage) {
+	uint8_t uData[6 + sizeof(QAS_LCD_RLEImage)] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	uData[5] = uParam;
+	memcpy(&uData[6], &cImage, sizeof(QAS_LCD_RLEImage));
+	return write(uData, sizeof(uData));
+}
+
+
+//QAS_LCD_DisplayList::add
+//QAS_LCD_DisplayList Recording Method
+//
+//Used to store a command that has a position and a text layout as parameters
+//Only a pointer to the layout is copied into the display list, so the layout must remain valid until the list has been played back.
+//The layout's hash is stored alongside it so that the hash of the display list changes whenever the layout is laid out differently
+QA_Result QAS_LCD_DisplayList::add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, const QAS_LCD_TextLayout* pLayout, uint32_t uHash) {
+	uint8_t uData[9 + sizeof(pLayout)] = {eCmd};
+	memcpy(&uData[1], &cPos.val, sizeof(cPos.val));
+	memcpy(&uData[5], &uHash, sizeof(uHash));
+	memcpy(&uData[9], &pLayout, sizeof(pLayout));
+	return write(uData, sizeof(uData));
+}
+
+
+	//------------------------------------
+	//------------------------------------
+	//QAS_LCD_DisplayList Playback Methods
+
+//QAS_LCD_DisplayList::read
+//QAS_LCD_DisplayList Playback Method
+//
+//Used to decode a single command from the display list
+//uIdx   - The byte index of the command to be decoded. The first command is at index 0
+//sEntry - Reference to a QAS_LCD_DisplayListEntry structure that the decoded command is to be stored into
+//Returns the byte index of the following command. Once this is equal to length() there are no more commands to decode
+uint16_t QAS_LCD_DisplayList::read(uint16_t uIdx, QAS_LCD_DisplayListEntry& sEntry) const {
+	sEntry.eCmd = (QAS_LCD_DisplayListCmd)m_uData[uIdx++];
+
+	switch (sEntry.eCmd) {
+	  case (QAS_LCD_DLCmd_SetDrawBuffer):
+	  case (QAS_LCD_DLCmd_SetFont):
+	  case (QAS_LCD_DLCmd_SetAntiAliasing):
+	  case (QAS_LCD_DLCmd_SetBlendMode):
+	  case (QAS_LCD_DLCmd_SetDrawSurface):
+	  	sEntry.uParam = m_uData[uIdx++];
+	  	break;
+	  case (QAS_LCD_DLCmd_SetDrawColor):
+	  	memcpy(&sEntry.uColor, &m_uData[uIdx], sizeof(sEntry.uColor));
+	  	uIdx += sizeof(sEntry.uColor);
+	  	break;
+	  case (QAS_LCD_DLCmd_ClearBuffer):
+	  case (QAS_LCD_DLCmd_PopClip):
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawPixel):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	uIdx += sizeof(sEntry.cStart.val);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLine):
+	  case (QAS_LCD_DLCmd_DrawRect):
+	  case (QAS_LCD_DLCmd_DrawRectFill):
+	  case (QAS_LCD_DLCmd_PushClip):
+	  case (QAS_LCD_DLCmd_DrawEllipse):
+	  case (QAS_LCD_DLCmd_DrawEllipseFill):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	memcpy(&sEntry.cEnd.val, &m_uData[uIdx+4], sizeof(sEntry.cEnd.val));
+	  	uIdx += 8;
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawArc):
+	  case (QAS_LCD_DLCmd_DrawArcFill):
+	  case (QAS_LCD_DLCmd_DrawRoundRect):
+	  case (QAS_LCD_DLCmd_DrawRoundRectFill):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	memcpy(&sEntry.cEnd.val, &m_uData[uIdx+4], sizeof(sEntry.cEnd.val));
+	  	memcpy(&sEntry.cExtra.val, &m_uData[uIdx+8], sizeof(sEntry.cExtra.val));
+	  	uIdx += 12;
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawChar):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	sEntry.uParam = m_uData[uIdx+4];
+	  	uIdx += 5;
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawStr): {
+	  	uint16_t uLen;
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	sEntry.uParam = m_uData[uIdx+4];
+	  	memcpy(&uLen, &m_uData[uIdx+5], sizeof(uLen));
+	  	sEntry.str = (const char*)&m_uData[uIdx+7];
+	  	uIdx += 7 + uLen;
+	  	break;
+	  }
+	  case (QAS_LCD_DLCmd_DrawImage):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	memcpy(&sEntry.cEnd.val, &m_uData[uIdx+4], sizeof(sEntry.cEnd.val));
+	  	memcpy(&sEntry.cExtra.val, &m_uData[uIdx+8], sizeof(sEntry.cExtra.val));
+	  	sEntry.uParam = m_uData[uIdx+12];
+	  	memcpy(&sEntry.cImage, &m_uData[uIdx+13], sizeof(QAS_LCD_Image));
+	  	uIdx += 13 + sizeof(QAS_LCD_Image);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawRLEImage):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	sEntry.uParam = m_uData[uIdx+4];
+	  	memcpy(&sEntry.cRLE, &m_uData[uIdx+5], sizeof(QAS_LCD_RLEImage));
+	  	uIdx += 5 + sizeof(QAS_LCD_RLEImage);
+	  	break;
+	  case (QAS_LCD_DLCmd_DrawLayout):
+	  	memcpy(&sEntry.cStart.val, &m_uData[uIdx], sizeof(sEntry.cStart.val));
+	  	memcpy(&sEntry.pLayout, &m_uData[uIdx+8], sizeof(sEntry.pLayout));
+	  	uIdx += 8 + sizeof(sEntry.pLayout);
+	  	break;
+	}
+
+	return uIdx;
+}
+
+
+	//-----------------------------------
+	//-----------------------------------
+	//QAS_LCD_DisplayList Private Methods
+
+//QAS_LCD_DisplayList::write
+//QAS_LCD_DisplayList Private Method
+//
+//Used to copy data to the end of the command buffer
+//Returns QA_OK if successful, or QA_Fail if there is not enough space remaining
+QA_Result QAS_LCD_DisplayList::write(const void* pData, uint16_t uSize) {
+	if ((m_uLength + uSize) > QAS_LCD_DISPLAYLIST_SIZE)
+		return QA_Fail;
+
+	memcpy(&m_uData[m_uLength], pData, uSize);
+	m_uLength += uSize;
+	return QA_OK;
+}
@@ -0,0 +1,189 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Display List                             */
+/*   Filename: QAS_LCD_DisplayList.hpp                                     */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_DISPLAYLIST_HPP_
+#define __QAS_LCD_DISPLAYLIST_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Vector.hpp"
+
+#include "QAS_LCD_Image.hpp"
+#include "QAS_LCD_RLE.hpp"
+
+
+//Forward declaration of QAS_LCD_TextLayout, defined in QAS_LCD_TextLayout.hpp
+class QAS_LCD_TextLayout;
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------------------
+//QAS_LCD_DISPLAYLIST_SIZE
+//
+//Used to determine the size in bytes of the display list command buffer
+#define QAS_LCD_DISPLAYLIST_SIZE  ((uint16_t)4096)
+
+
+//---------------------------
+//QAS_LCD_DISPLAYLIST_NOHASH
+//
+//Hash value used to indicate that no display list has been presented, so the next list must always be rendered
+#define QAS_LCD_DISPLAYLIST_NOHASH  ((uint32_t)0x00000000)
+
+
+//-----------------------
+//QAS_LCD_DisplayListCmd
+//
+//Used to identify each command stored within a display list
+enum QAS_LCD_DisplayListCmd : uint8_t {
+	QAS_LCD_DLCmd_SetDrawBuffer = 0, //Select draw buffer.     Parameters: layer (uint8_t)
+	QAS_LCD_DLCmd_SetDrawColor,      //Select draw color.      Parameters: color (uint16_t)
+	QAS_LCD_DLCmd_SetFont,           //Select font by index.   Parameters: font index (uint8_t)
+	QAS_LCD_DLCmd_ClearBuffer,       //Clear draw buffer.      Parameters: none
+	QAS_LCD_DLCmd_DrawPixel,         //Draw pixel.             Parameters: position (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawLine,          //Draw line.              Parameters: start & end (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawRect,          //Draw rectangle.         Parameters: start & end (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawRectFill,      //Draw filled rectangle.  Parameters: start & end (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawChar,          //Draw character.         Parameters: position (QAT_Vector2_16), character (char)
+	QAS_LCD_DLCmd_DrawStr,           //Draw string.            Parameters: position (QAT_Vector2_16), alignment (uint8_t), length (uint16_t),
+	                                 //                        null terminated string
+	QAS_LCD_DLCmd_PushClip,          //Push clip rectangle.    Parameters: start & end (QAT_Vector2_16)
+	QAS_LCD_DLCmd_PopClip,           //Pop clip rectangle.     Parameters: none
+	QAS_LCD_DLCmd_SetAntiAliasing,   //Select anti-aliasing.   Parameters: state (uint8_t)
+	QAS_LCD_DLCmd_DrawEllipse,       //Draw ellipse.           Parameters: center & radii (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawEllipseFill,   //Draw filled ellipse.    Parameters: center & radii (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawArc,           //Draw arc.               Parameters: center, radius & angles (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawArcFill,       //Draw filled arc.        Parameters: center, outer & inner radii, angles (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawRoundRect,     //Draw rounded rectangle. Parameters: start, end & radius (QAT_Vector2_16)
+	QAS_LCD_DLCmd_DrawRoundRectFill, //Draw filled rounded rectangle. Parameters: start, end & radius (QAT_Vector2_16)
+	QAS_LCD_DLCmd_SetBlendMode,      //Select blend mode.      Parameters: blend mode (uint8_t)
+	QAS_LCD_DLCmd_DrawImage,         //Draw image.             Parameters: position, source start & end (QAT_Vector2_16), blit mode (uint8_t),
+	                                 //                        image descriptor (QAS_LCD_Image)
+	QAS_LCD_DLCmd_DrawRLEImage,      //Draw encoded image.     Parameters: position (QAT_Vector2_16), blit mode (uint8_t),
+	                                 //                        image descriptor (QAS_LCD_RLEImage)
+	QAS_LCD_DLCmd_SetDrawSurface,    //Select draw surface.    Parameters: surface index (uint8_t)
+	QAS_LCD_DLCmd_DrawLayout         //Draw text layout.       Parameters: position (QAT_Vector2_16), layout pointer, layout hash (uint32_t)
+};
+
+
+//-------------------------
+//QAS_LCD_DisplayListEntry
+//
+//Structure used to return a decoded command from a display list
+typedef struct {
+	QAS_LCD_DisplayListCmd eCmd;    //The command
+	uint8_t                uParam;  //Layer index, surface index, font index, character, text alignment, state or blit mode, depending on command
+	uint16_t               uColor;  //Draw color, used by QAS_LCD_DLCmd_SetDrawColor
+	QAT_Vector2_16         cStart;  //Position, or start position, depending on command
+	QAT_Vector2_16         cEnd;    //End position, used by line and rectangle commands, radii used by curve commands, or source start used by
+	                                //image commands
+	QAT_Vector2_16         cExtra;  //Angles used by arc commands, radius used by rounded rectangle commands, or source end used by image commands
+	QAS_LCD_Image          cImage;  //Image descriptor, used by image commands
+	QAS_LCD_RLEImage       cRLE;    //Encoded image descriptor, used by encoded image commands
+	const char*            str;     //Pointer to null terminated string stored within the display list, used by string commands
+	const QAS_LCD_TextLayout* pLayout; //Pointer to text layout, used by QAS_LCD_DLCmd_DrawLayout
+} QAS_LCD_DisplayListEntry;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------------
+//QAS_LCD_DisplayList
+//
+//Class used to store a compact buffer of recorded rendering commands, which is used by QAS_LCD's display list mode
+//Commands are stored as a single command byte followed by their parameters. A 32bit FNV-1a hash of the buffer is then
+//used to determine whether a recorded frame is identical to the one that was previously presented.
+class QAS_LCD_DisplayList {
+private:
+
+	uint8_t  m_uData[QAS_LCD_DISPLAYLIST_SIZE];  //Command buffer
+	uint16_t m_uLength;                          //Number of bytes currently stored in the command buffer
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty display list
+	QAS_LCD_DisplayList() :
+		m_uLength(0) {}
+
+
+	//NOTE: See QAS_LCD_DisplayList.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	//Used to remove all commands from the display list
+	void clear(void) {
+		m_uLength = 0;
+	}
+
+	//Returns the number of bytes currently stored in the display list
+	uint16_t length(void) const {
+		return m_uLength;
+	}
+
+	uint32_t hash(void) const;
+
+
+	//-----------------
+	//Recording Methods
+	//
+	//Each of the following methods return QA_OK if the command was stored, or QA_Fail if there was not enough space remaining
+
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, uint8_t uParam);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, uint16_t uColor);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cStart, QAT_Vector2_16 cEnd, QAT_Vector2_16 cExtra);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, char ch);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, uint8_t uParam, const char* str);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, QAT_Vector2_16 cSrcStart, QAT_Vector2_16 cSrcEnd, uint8_t uParam,
+			          const QAS_LCD_Image& cImage);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, uint8_t uParam, const QAS_LCD_RLEImage& cImage);
+	QA_Result add(QAS_LCD_DisplayListCmd eCmd, QAT_Vector2_16 cPos, const QAS_LCD_TextLayout* pLayout, uint32_t uHash);
+
+
+	//----------------
+	//Playback Methods
+
+	uint16_t read(uint16_t uIdx, QAS_LCD_DisplayListEntry& sEntry) const;
+
+private:
+
+	//---------------
+	//Private Methods
+
+	QA_Result write(const void* pData, uint16_t uSize);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_DISPLAYLIST_HPP_ */
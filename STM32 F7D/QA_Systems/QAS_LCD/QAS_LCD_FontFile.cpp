@@ -0,0 +1,231 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Font Files                               */
+/*   Filename: QAS_LCD_FontFile.cpp                                        */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_FontFile.hpp"
+
+#include "QAD_FMC.hpp"
+
+#include <string.h>
+
+
+	//------------------------------------
+	//------------------------------------
+	//QAS_LCD_FontFile Validation Methods
+
+//QAS_LCD_FontFile::validate
+//QAS_LCD_FontFile Validation Method
+//
+//Used to check that the file is a complete font file that can be drawn from. As well as the header being checked, every glyph of the
+//glyph directory is checked to lie within the bitmap data, and the checksum is verified, so that a damaged file cannot cause reads
+//outside of the file when it is drawn
+//uSize - The number of bytes available from the start of the file
+//Returns QA_OK if the file is valid, or QA_Fail if it is not
+QA_Result QAS_LCD_FontFile::validate(uint32_t uSize) const {
+	if ((m_pFile == NULL) || (uSize < sizeof(QAS_LCD_FontFileHeader)) || ((uintptr_t)m_pFile % QAS_LCD_FONTFILE_ALIGN))
+		return QA_Fail;
+
+	//Check header
+	const QAS_LCD_FontFileHeader& sHeader = header();
+	if ((sHeader.uMagic != QAS_LCD_FONTFILE_MAGIC) || (sHeader.uVersion != QAS_LCD_FONTFILE_VERSION) ||
+			(sHeader.uChars != QAS_LCD_FONTFILE_CHARS) || (sHeader.cName[QAS_LCD_FONTNAME_LENGTH-1] != 0) || !sHeader.uHeight)
+		return QA_Fail;
+
+	//Check that each section lies within the file, and the file lies within the available bytes
+	uint32_t uDescSize = QAS_LCD_FONTFILE_CHARS * sizeof(QAS_LCD_FontDesc);
+	if ((sHeader.uFileSize > uSize) || (sHeader.uFileSize % QAS_LCD_FONTFILE_ALIGN) ||
+			(sHeader.uDescOffset % QAS_LCD_FONTFILE_ALIGN) || (sHeader.uDescOffset < sizeof(QAS_LCD_FontFileHeader)) ||
+			(sHeader.uDescOffset > sHeader.uFileSize) || (uDescSize > (sHeader.uFileSize - sHeader.uDescOffset)) ||
+			(sHeader.uDataOffset > sHeader.uFileSize) || (sHeader.uDataSize > (sHeader.uFileSize - sHeader.uDataOffset)))
+		return QA_Fail;
+
+	//Check that the bitmap data of each glyph lies within the bitmap data of the file
+	const QAS_LCD_FontDesc* pDesc = desc();
+	for (uint16_t i=0; i<QAS_LCD_FONTFILE_CHARS; i++) {
+		uint32_t uGlyphSize = (uint32_t)((pDesc[i].uWidth + 7) >> 3) * sHeader.uHeight;
+		if ((pDesc[i].uWidth > 255) || ((pDesc[i].uOffset + uGlyphSize) > sHeader.uDataSize))
+			return QA_Fail;
+	}
+
+	//Verify checksum
+	if (checksum(&m_pFile[sizeof(QAS_LCD_FontFileHeader)], sHeader.uFileSize - sizeof(QAS_LCD_FontFileHeader)) != sHeader.uChecksum)
+		return QA_Fail;
+
+	return QA_OK;
+}
+
+
+	//---------------------------------
+	//---------------------------------
+	//QAS_LCD_FontFile Packing Methods
+
+//QAS_LCD_FontFile::pack
+//QAS_LCD_FontFile Packing Method
+//
+//Used to create a font file from font data in the form generated by "The Dot Factory" application (see QAS_LCD_Fonts_SegoeUI12pt.hpp)
+//Only the bitmap data referred to by the glyph directory is stored, and the file is padded to a multiple of QAS_LCD_FONTFILE_ALIGN
+//pDst        - Pointer to the memory the file is to be written to
+//uMaxSize    - The number of bytes available at pDst
+//strName     - C-style string containing the name of the font, which must be shorter than QAS_LCD_FONTNAME_LENGTH
+//pDesc       - Pointer to an array of QAS_LCD_FontDesc structures for the font
+//pData       - Pointer to the bitmap data of the font
+//uHeight     - The height in pixels of the font
+//uSpaceWidth - The width in pixels of the space character of the font
+//uCharGap    - The width in pixels of the gap between each character when rendering strings of characters
+//Returns the size in bytes of the file, or 0 if the name is too long, the font is invalid, or the file does not fit in uMaxSize bytes
+uint32_t QAS_LCD_FontFile::pack(uint8_t* pDst, uint32_t uMaxSize, const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData,
+		                            uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap) {
+	if ((strlen(strName) >= QAS_LCD_FONTNAME_LENGTH) || !uHeight)
+		return 0;
+
+	//Determine the size of the bitmap data, being the end of the glyph that ends last
+	uint32_t uDataSize = 0;
+	for (uint16_t i=0; i<QAS_LCD_FONTFILE_CHARS; i++) {
+		if (pDesc[i].uWidth > 255)
+			return 0;
+		uint32_t uEnd = pDesc[i].uOffset + ((uint32_t)((pDesc[i].uWidth + 7) >> 3) * uHeight);
+		if (uEnd > uDataSize)
+			uDataSize = uEnd;
+	}
+
+	uint32_t uDescOffset = sizeof(QAS_LCD_FontFileHeader);
+	uint32_t uDataOffset = uDescOffset + (QAS_LCD_FONTFILE_CHARS * sizeof(QAS_LCD_FontDesc));
+	uint32_t uFileSize   = (uDataOffset + uDataSize + QAS_LCD_FONTFILE_ALIGN - 1) & ~(QAS_LCD_FONTFILE_ALIGN - 1);
+	if (uFileSize > uMaxSize)
+		return 0;
+
+	//Write header, glyph directory, bitmap data and padding
+	QAS_LCD_FontFileHeader sHeader;
+	memset(&sHeader, 0, sizeof(sHeader));
+	sHeader.uMagic      = QAS_LCD_FONTFILE_MAGIC;
+	sHeader.uVersion    = QAS_LCD_FONTFILE_VERSION;
+	sHeader.uChars      = QAS_LCD_FONTFILE_CHARS;
+	strcpy(sHeader.cName, strName);
+	sHeader.uHeight     = uHeight;
+	sHeader.uSpaceWidth = uSpaceWidth;
+	sHeader.uCharGap    = uCharGap;
+	sHeader.uDescOffset = uDescOffset;
+	sHeader.uDataOffset = uDataOffset;
+	sHeader.uDataSize   = uDataSize;
+	sHeader.uFileSize   = uFileSize;
+
+	memcpy(&pDst[uDescOffset], pDesc, QAS_LCD_FONTFILE_CHARS * sizeof(QAS_LCD_FontDesc));
+	memcpy(&pDst[uDataOffset], pData, uDataSize);
+	memset(&pDst[uDataOffset + uDataSize], 0, uFileSize - (uDataOffset + uDataSize));
+
+	sHeader.uChecksum = checksum(&pDst[sizeof(QAS_LCD_FontFileHeader)], uFileSize - sizeof(QAS_LCD_FontFileHeader));
+	memcpy(pDst, &sHeader, sizeof(sHeader));
+	return uFileSize;
+}
+
+
+//QAS_LCD_FontFile::checksum
+//QAS_LCD_FontFile Packing Method
+//
+//Returns the 32bit FNV-1a hash of a block of memory, as stored in the header of a font file
+//pData - Pointer to the memory to be hashed
+//uSize - The number of bytes to be hashed
+uint32_t QAS_LCD_FontFile::checksum(const uint8_t* pData, uint32_t uSize) {
+	uint32_t uHash = 0x811C9DC5;
+	for (uint32_t i=0; i<uSize; i++)
+		uHash = (uHash ^ pData[i]) * 0x01000193;
+	return uHash;
+}
+
+
+	//-------------------------------
+	//-------------------------------
+	//QAS_LCD_FontStore Constructors
+
+//QAS_LCD_FontStore::QAS_LCD_FontStore
+//QAS_LCD_FontStore Constructor
+//
+//Creates an empty store. Its memory is only allocated from SDRAM, as region "LCD Fonts", by the first call to load(), so that
+//applications that do not load font images from a block device do not give up SDRAM to the store
+QAS_LCD_FontStore::QAS_LCD_FontStore() :
+	m_pStore(NULL),
+	m_uUsed(0) {}
+
+
+	//------------------------------------
+	//------------------------------------
+	//QAS_LCD_FontStore Management Methods
+
+//QAS_LCD_FontStore::load
+//QAS_LCD_FontStore Management Method
+//
+//Used to read a font image, being one or more font files placed one after another as written by the font packer, from a block device
+//into the store. Blocks are read directly into the store, with each file being read only once its header has been checked, and reading
+//stops at the first block that does not continue a font file, or once the store is full
+//Only the headers are checked while loading. Each file is fully validated when it is registered with QAS_LCD_FontMgr::add()
+//The memory of the store is allocated from SDRAM by the first call. If there is not enough SDRAM remaining then no font images can be loaded
+//pRead      - Function used to read blocks from the device, such as QAD_SDMMC::readBlocks
+//uBlock     - The address of the first block of the image
+//uBlockSize - The size in bytes of each block
+//pImage     - Set to point to the start of the image within the store
+//Returns the size in bytes of the complete font files that were read, or 0 if no font files were found or the store could not be allocated
+uint32_t QAS_LCD_FontStore::load(QAS_LCD_FontReadFunc pRead, uint32_t uBlock, uint32_t uBlockSize, const uint8_t*& pImage) {
+	pImage = NULL;
+	if ((pRead == NULL) || !uBlockSize)
+		return 0;
+	if (m_pStore == NULL)
+		m_pStore = (uint8_t*)QAD_FMC::alloc("LCD Fonts", QAS_LCD_FONTFILE_STORESIZE, QAD_FMC_ALIGN_CACHELINE);
+	if (m_pStore == NULL)
+		return 0;
+	pImage = &m_pStore[m_uUsed];
+
+	uint8_t* pDst   = &m_pStore[m_uUsed];
+	uint32_t uFree  = QAS_LCD_FONTFILE_STORESIZE - m_uUsed;
+	uint32_t uRead  = 0;  //Number of bytes read into the store
+	uint32_t uFiles = 0;  //Number of bytes of complete font files
+
+	while (true) {
+
+		//Read the block(s) holding the header of the next file
+		uint32_t uNeed = uFiles + sizeof(QAS_LCD_FontFileHeader);
+		while (uRead < uNeed) {
+			if ((uRead + uBlockSize) > uFree)
+				break;
+			if (pRead(&pDst[uRead], uBlock + (uRead / uBlockSize), 1) != QA_OK)
+				break;
+			uRead += uBlockSize;
+		}
+		if (uRead < uNeed)
+			break;
+
+		//Stop once the blocks no longer continue a font file
+		const QAS_LCD_FontFileHeader* pHeader = (const QAS_LCD_FontFileHeader*)&pDst[uFiles];
+		if ((pHeader->uMagic != QAS_LCD_FONTFILE_MAGIC) || (pHeader->uFileSize < sizeof(QAS_LCD_FontFileHeader)) ||
+				(pHeader->uFileSize % QAS_LCD_FONTFILE_ALIGN))
+			break;
+
+		//Read the rest of the file in a single transfer
+		uNeed = uFiles + pHeader->uFileSize;
+		if (uRead < uNeed) {
+			uint32_t uBlocks = ((uNeed - uRead) + uBlockSize - 1) / uBlockSize;
+			if ((uRead + (uBlocks * uBlockSize)) > uFree)
+				break;
+			if (pRead(&pDst[uRead], uBlock + (uRead / uBlockSize), uBlocks) != QA_OK)
+				break;
+			uRead += uBlocks * uBlockSize;
+		}
+		uFiles = uNeed;
+	}
+
+	m_uUsed += uFiles;
+	return uFiles;
+}
@@ -0,0 +1,229 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Font Files                               */
+/*   Filename: QAS_LCD_FontFile.hpp                                        */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_FONTFILE_HPP_
+#define __QAS_LCD_FONTFILE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_Surface.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------------
+//QAS_LCD_FONTFILE_MAGIC
+//
+//Value stored at the start of every font file, being the characters "QAFN" when read as bytes
+#define QAS_LCD_FONTFILE_MAGIC     ((uint32_t)0x4E464151)
+
+
+//-------------------------
+//QAS_LCD_FONTFILE_VERSION
+//
+//Version of the font file format. Files with a different version are rejected
+#define QAS_LCD_FONTFILE_VERSION   ((uint16_t)1)
+
+
+//----------------------
+//QAS_LCD_FONTFILE_CHARS
+//
+//Number of characters in each font file, being the printable characters from '!' (33) to '~' (126)
+#define QAS_LCD_FONTFILE_CHARS     ((uint16_t)94)
+
+
+//----------------------
+//QAS_LCD_FONTFILE_ALIGN
+//
+//Alignment in bytes of the glyph directory, the bitmap data, and the size of each font file. As each file's size is a multiple of this,
+//files can be placed one after another in a font image, with each file correctly aligned
+#define QAS_LCD_FONTFILE_ALIGN     ((uint32_t)4)
+
+
+//--------------------------
+//QAS_LCD_FONTFILE_STORESIZE
+//
+//Used to determine the size in bytes of the memory that font files read from an SD card are stored in (see QAS_LCD_FontStore)
+//This is allocated from SDRAM as region "LCD Fonts" (see QAD_FMC.hpp), aligned to whole cache lines so that it can be read into by DMA
+#define QAS_LCD_FONTFILE_STORESIZE  ((uint32_t)0x00100000)
+
+
+//--------------------
+//QAS_LCD_FontReadFunc
+//
+//Function used by QAS_LCD_FontStore to read blocks of a font image from a block device, matching QAD_SDMMC::readBlocks()
+//pData  - Pointer to the memory the blocks are to be read into
+//uAddr  - The address of the first block to be read
+//uCount - The number of blocks to be read
+//Returns QA_OK if the blocks were read, or QA_Fail if they were not
+typedef QA_Result (*QAS_LCD_FontReadFunc)(uint8_t* pData, uint32_t uAddr, uint32_t uCount);
+
+
+//----------------------
+//QAS_LCD_FontFileHeader
+//
+//Structure stored at the start of a font file
+//
+//A font file holds a single font in the same form as the font data generated by "The Dot Factory" application (see
+//QAS_LCD_Fonts_SegoeUI12pt.hpp), so that fonts can be drawn directly from a file in memory without any of it being copied:
+//- The header
+//- The glyph directory, being an array of QAS_LCD_FontDesc structures for each character, starting at uDescOffset
+//- The bitmap data of every character, starting at uDataOffset, with each glyph's offset in the directory being relative to this
+//All values are little-endian
+typedef struct {
+	uint32_t uMagic;                               //Must be QAS_LCD_FONTFILE_MAGIC
+	uint16_t uVersion;                             //Must be QAS_LCD_FONTFILE_VERSION
+	uint16_t uChars;                               //Number of entries in the glyph directory. Must be QAS_LCD_FONTFILE_CHARS
+	char     cName[QAS_LCD_FONTNAME_LENGTH];       //Null terminated name of the font
+	uint16_t uHeight;                              //Height in pixels of the font
+	uint16_t uSpaceWidth;                          //Width in pixels of the space character
+	uint16_t uCharGap;                             //Width in pixels of the gap between each character
+	uint16_t uReserved;                            //Reserved, stored as 0
+	uint32_t uDescOffset;                          //Offset in bytes of the glyph directory from the start of the file
+	uint32_t uDataOffset;                          //Offset in bytes of the bitmap data from the start of the file
+	uint32_t uDataSize;                            //Size in bytes of the bitmap data
+	uint32_t uFileSize;                            //Size in bytes of the whole file, padded to a multiple of QAS_LCD_FONTFILE_ALIGN
+	uint32_t uChecksum;                            //32bit FNV-1a hash of the file following the header, up to uFileSize
+} QAS_LCD_FontFileHeader;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------
+//QAS_LCD_FontFile
+//
+//Class used to access a font file held in memory, such as in memory-mapped QuadSPI flash or in SDRAM after being read from an SD card
+//The class only holds a pointer to the file, so the file must remain in place for as long as its font is registered with QAS_LCD
+//
+//Font files are created with pack(), either on the target or on a desktop host using the font packer in QAS_LCD_FontPack_Host.cpp
+class QAS_LCD_FontFile {
+private:
+
+	const uint8_t* m_pFile;  //Pointer to the start of the file
+
+public:
+
+	//------------
+	//Constructors
+
+	//Constructor used to access a font file
+	//pFile - Pointer to the start of the file
+	QAS_LCD_FontFile(const void* pFile) :
+		m_pFile((const uint8_t*)pFile) {}
+
+
+	//NOTE: See QAS_LCD_FontFile.cpp for details of the following methods
+
+	//------------------
+	//Validation Methods
+
+	QA_Result validate(uint32_t uSize) const;
+
+
+	//------------
+	//Data Methods
+
+	//Returns the header of the file. The file must have been validated
+	const QAS_LCD_FontFileHeader& header(void) const {
+		return *(const QAS_LCD_FontFileHeader*)m_pFile;
+	}
+
+	//Returns a pointer to the glyph directory of the file. The file must have been validated
+	const QAS_LCD_FontDesc* desc(void) const {
+		return (const QAS_LCD_FontDesc*)&m_pFile[header().uDescOffset];
+	}
+
+	//Returns a pointer to the bitmap data of the file. The file must have been validated
+	const uint8_t* data(void) const {
+		return &m_pFile[header().uDataOffset];
+	}
+
+	//Returns the size in bytes of the file, which is also the offset of the following file within a font image
+	//The file must have been validated
+	uint32_t size(void) const {
+		return header().uFileSize;
+	}
+
+
+	//---------------
+	//Packing Methods
+
+	static uint32_t pack(uint8_t* pDst, uint32_t uMaxSize, const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData,
+			                 uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap);
+	static uint32_t checksum(const uint8_t* pData, uint32_t uSize);
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------
+//QAS_LCD_FontStore
+//
+//Class used to hold font images that have been read from a block device, such as an SD card, so that their fonts can be drawn from
+//SDRAM in the same manner as fonts in memory-mapped QuadSPI flash
+//Images are appended one after another, and remain in place until clear() is called, at which point any fonts registered from the
+//store must also have been removed from QAS_LCD
+class QAS_LCD_FontStore {
+private:
+
+	uint8_t* m_pStore;  //Pointer to the start of the store, or NULL if it has not yet been allocated
+	uint32_t m_uUsed;   //Number of bytes of the store that hold font files
+
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_FontStore();
+
+
+	//NOTE: See QAS_LCD_FontFile.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	//Used to remove all font images from the store
+	void clear(void) {
+		m_uUsed = 0;
+	}
+
+	//Returns the number of bytes of the store that hold font files
+	uint32_t used(void) const {
+		return m_uUsed;
+	}
+
+	uint32_t load(QAS_LCD_FontReadFunc pRead, uint32_t uBlock, uint32_t uBlockSize, const uint8_t*& pImage);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_FONTFILE_HPP_ */
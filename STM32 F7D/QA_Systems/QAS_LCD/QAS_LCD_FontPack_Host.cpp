@@ -0,0 +1,153 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Font Packer (Desktop Host)               */
+/*   Filename: QAS_LCD_FontPack_Host.cpp                                   */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_FontFile.hpp"
+
+//The font packer is a desktop host tool, which is only built when both QA_HOST and QA_FONTPACK are defined, being built as the
+//fontpack target of QA_Host/CMakeLists.txt
+//
+//It writes a font image, being one font file for each selected font placed one after another (see QAS_LCD_FontFile.hpp):
+//
+//  fontpack <image file> [font name ...]
+//
+//If no font names are given then every font in QAS_LCD_FontPackList is written. The image can then be programmed into QuadSPI flash
+//at any 4 byte aligned address and added with QAS_LCD::addFonts() once memory-mapped mode is entered, or written to an SD card from
+//the start of a block and read with QAS_LCD::loadFonts().
+//
+//Fonts are supplied in the form generated by "The Dot Factory" application. To pack a new font, include its header below and add it
+//to QAS_LCD_FontPackList. As the packer is built separately, fonts that are only packed are not placed in the firmware.
+#if defined(QA_HOST) && defined(QA_FONTPACK)
+
+#include "QAS_LCD_Fonts_SegoeUI12pt.hpp"
+#include "QAS_LCD_Fonts_SegoeUI20ptSB.hpp"
+#include "QAS_LCD_Fonts_ShowcardGothic18pt.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------
+//QAS_LCD_FontPackDesc
+//
+//Structure used to describe a font that can be packed
+typedef struct {
+	const char*             strName;      //Name of the font, stored in its font file
+	const QAS_LCD_FontDesc* pDesc;        //Pointer to the font's array of QAS_LCD_FontDesc structures
+	const uint8_t*          pData;        //Pointer to the font's bitmap data
+	uint16_t                uHeight;      //Height in pixels of the font
+	uint16_t                uSpaceWidth;  //Width in pixels of the space character
+	uint16_t                uCharGap;     //Width in pixels of the gap between each character
+} QAS_LCD_FontPackDesc;
+
+
+//QAS_LCD_FontPackList
+//Fonts that can be packed
+static const QAS_LCD_FontPackDesc QAS_LCD_FontPackList[] = {
+	{"SegoeUI12pt",        QAS_LCD_Fonts_SegoeUI12pt_Desc,        QAS_LCD_Fonts_SegoeUI12pt_Data,
+	 QAS_LCD_Fonts_SegoeUI12pt_Height,        QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth,        QAS_LCD_Fonts_SegoeUI12pt_CharGap},
+	{"SegoeUI20ptSB",      QAS_LCD_Fonts_SegoeUI20ptSB_Desc,      QAS_LCD_Fonts_SegoeUI20ptSB_Data,
+	 QAS_LCD_Fonts_SegoeUI20ptSB_Height,      QAS_LCD_Fonts_SegoeUI20ptSB_SpaceWidth,      QAS_LCD_Fonts_SegoeUI20ptSB_CharGap},
+	{"ShowcardGothic18pt", QAS_LCD_Fonts_ShowcardGothic18pt_Desc, QAS_LCD_Fonts_ShowcardGothic18pt_Data,
+	 QAS_LCD_Fonts_ShowcardGothic18pt_Height, QAS_LCD_Fonts_ShowcardGothic18pt_SpaceWidth, QAS_LCD_Fonts_ShowcardGothic18pt_CharGap}
+};
+static const uint8_t QAS_LCD_FontPackCount = sizeof(QAS_LCD_FontPackList) / sizeof(QAS_LCD_FontPackDesc);
+
+
+//QAS_LCD_FontPackBuffer
+//Buffer the font image is built in
+static uint32_t QAS_LCD_FontPackBuffer[QAS_LCD_FONTFILE_STORESIZE / sizeof(uint32_t)];
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//QAS_LCD_FontPack_add
+//Font Packer Function
+//
+//Used to pack a font onto the end of the image, and check that the resulting font file is valid
+//sFont  - The font to be packed
+//uSize  - The size in bytes of the image, which is increased by the size of the font file
+//Returns QA_OK if the font was packed, or QA_Fail if it could not be
+static QA_Result QAS_LCD_FontPack_add(const QAS_LCD_FontPackDesc& sFont, uint32_t& uSize) {
+	uint8_t* pImage = (uint8_t*)QAS_LCD_FontPackBuffer;
+	uint32_t uFile  = QAS_LCD_FontFile::pack(&pImage[uSize], sizeof(QAS_LCD_FontPackBuffer) - uSize, sFont.strName, sFont.pDesc, sFont.pData,
+			                                     sFont.uHeight, sFont.uSpaceWidth, sFont.uCharGap);
+	if (!uFile || QAS_LCD_FontFile(&pImage[uSize]).validate(uFile)) {
+		fprintf(stderr, "fontpack: unable to pack %s\n", sFont.strName);
+		return QA_Fail;
+	}
+
+	printf("  %-24s %3u px  %6u bytes\n", sFont.strName, sFont.uHeight, uFile);
+	uSize += uFile;
+	return QA_OK;
+}
+
+
+//main
+//Font Packer Entry Point
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "usage: fontpack <image file> [font name ...]\n");
+		for (uint8_t i=0; i<QAS_LCD_FontPackCount; i++)
+			fprintf(stderr, "  %s\n", QAS_LCD_FontPackList[i].strName);
+		return 1;
+	}
+
+	//Pack selected fonts, or all fonts if none are selected
+	uint32_t uSize = 0;
+	printf("fontpack: %s\n", argv[1]);
+	if (argc == 2) {
+		for (uint8_t i=0; i<QAS_LCD_FontPackCount; i++) {
+			if (QAS_LCD_FontPack_add(QAS_LCD_FontPackList[i], uSize))
+				return 1;
+		}
+	} else {
+		for (int iArg=2; iArg<argc; iArg++) {
+			uint8_t i = 0;
+			while ((i < QAS_LCD_FontPackCount) && strcmp(QAS_LCD_FontPackList[i].strName, argv[iArg]))
+				i++;
+			if (i == QAS_LCD_FontPackCount) {
+				fprintf(stderr, "fontpack: unknown font %s\n", argv[iArg]);
+				return 1;
+			}
+			if (QAS_LCD_FontPack_add(QAS_LCD_FontPackList[i], uSize))
+				return 1;
+		}
+	}
+
+	//Write image
+	FILE* pFile = fopen(argv[1], "wb");
+	if ((pFile == NULL) || (fwrite(QAS_LCD_FontPackBuffer, 1, uSize, pFile) != uSize)) {
+		fprintf(stderr, "fontpack: unable to write %s\n", argv[1]);
+		if (pFile)
+			fclose(pFile);
+		return 1;
+	}
+	fclose(pFile);
+	printf("fontpack: %u bytes\n", uSize);
+	return 0;
+}
+
+#endif /* QA_HOST && QA_FONTPACK */
@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Font Run Tables                          */
+/*   Filename: QAS_LCD_FontRuns.hpp                                        */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_FONTRUNS_HPP_
+#define __QAS_LCD_FONTRUNS_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD_Fonts.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------------
+//QAS_LCD_FONTRUNS_CHARS
+//
+//Number of characters in each font, being the printable characters from '!' (33) to '~' (126)
+#define QAS_LCD_FONTRUNS_CHARS  ((uint8_t)94)
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------------------
+//QAS_LCD_FontRuns Bitmap Methods
+//
+//constexpr methods used to read the bitmap data of fonts generated by "The Dot Factory", so that run tables can be built at compile time
+//The bitmap data must be declared constexpr. Each line of a glyph is one bit per pixel with the least significant bit first, padded to
+//a whole number of bytes
+
+//Returns whether a pixel of a glyph is set
+//pData   - Pointer to the first line of the glyph's bitmap data
+//uStride - Number of bytes in each line of the glyph
+//x & y   - The coordinates of the pixel within the glyph
+constexpr bool QAS_LCD_FontRuns_pixel(const uint8_t* pData, uint16_t uStride, uint16_t x, uint16_t y) {
+	return (pData[(y * uStride) + (x >> 3)] >> (x & 0x07)) & 0x01;
+}
+
+//Returns the number of runs of set pixels in a line of a glyph
+//pData   - Pointer to the first line of the glyph's bitmap data
+//uWidth  - The width in pixels of the glyph
+//y       - The line of the glyph
+constexpr uint16_t QAS_LCD_FontRuns_lineSpans(const uint8_t* pData, uint16_t uWidth, uint16_t y) {
+	uint16_t uStride = (uWidth + 7) >> 3;
+	uint16_t uSpans  = 0;
+	bool     bPrev   = false;
+	for (uint16_t x=0; x<uWidth; x++) {
+		bool bSet = QAS_LCD_FontRuns_pixel(pData, uStride, x, y);
+		if (bSet && !bPrev)
+			uSpans++;
+		bPrev = bSet;
+	}
+	return uSpans;
+}
+
+//Returns the total number of lines stored in the run table of a font, once blank lines at the top and bottom of each glyph are removed
+//pDesc   - Pointer to the font's array of QAS_LCD_FontDesc structures
+//pData   - Pointer to the font's bitmap data
+//uHeight - The height in pixels of the font
+constexpr uint16_t QAS_LCD_FontRuns_rows(const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight) {
+	uint16_t uRows = 0;
+	for (uint8_t i=0; i<QAS_LCD_FONTRUNS_CHARS; i++) {
+		int16_t iTop    = -1;
+		int16_t iBottom = -1;
+		for (uint16_t y=0; y<uHeight; y++) {
+			if (QAS_LCD_FontRuns_lineSpans(&pData[pDesc[i].uOffset], pDesc[i].uWidth, y)) {
+				if (iTop < 0)
+					iTop = y;
+				iBottom = y;
+			}
+		}
+		if (iTop >= 0)
+			uRows += (iBottom - iTop) + 1;
+	}
+	return uRows;
+}
+
+//Returns the total number of spans stored in the run table of a font
+//pDesc   - Pointer to the font's array of QAS_LCD_FontDesc structures
+//pData   - Pointer to the font's bitmap data
+//uHeight - The height in pixels of the font
+constexpr uint16_t QAS_LCD_FontRuns_spans(const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight) {
+	uint16_t uSpans = 0;
+	for (uint8_t i=0; i<QAS_LCD_FONTRUNS_CHARS; i++) {
+		for (uint16_t y=0; y<uHeight; y++)
+			uSpans += QAS_LCD_FontRuns_lineSpans(&pData[pDesc[i].uOffset], pDesc[i].uWidth, y);
+	}
+	return uSpans;
+}
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------
+//QAS_LCD_FontRunTable
+//
+//Template class used to store the glyphs of a font as runs of set pixels, in the same form as QAS_LCD_GlyphCache, built from the font's
+//bitmap data at compile time
+//
+//Run tables are declared constexpr alongside the bitmap data that they are built from (see QAS_LCD_Fonts_SegoeUI12pt.hpp), and are
+//passed to QAS_LCD_FontMgr::add() in place of the bitmap data. Characters of the font are then drawn with a span fill per run, with no
+//conversion taking place at runtime (see QAH_Bench_Text.cpp for the speed of each method of drawing glyphs).
+//Run tables trade flash for speed. Small glyphs are stored more compactly as one bit per pixel, so the tables of the built-in fonts are
+//larger than the bitmaps they are built from, although the bitmaps themselves are no longer referenced and are left out when optimizing.
+//uRows  - The number of stored lines. Must be the value returned by QAS_LCD_FontRuns_rows() for the font
+//uSpans - The number of spans. Must be the value returned by QAS_LCD_FontRuns_spans() for the font
+template <uint16_t uRows, uint16_t uSpans>
+class QAS_LCD_FontRunTable {
+public:
+
+	QAS_LCD_GlyphRuns sGlyphs[QAS_LCD_FONTRUNS_CHARS];  //Location of the runs of each glyph
+	uint8_t           uCounts[uRows ? uRows : 1];       //Number of spans in each stored line
+	QAS_LCD_GlyphSpan sSpans[uSpans ? uSpans : 1];      //Spans of each stored line
+
+public:
+
+	//------------
+	//Constructors
+
+	//constexpr constructor used to build the run table of a font
+	//pDesc   - Pointer to the font's array of QAS_LCD_FontDesc structures
+	//pData   - Pointer to the font's bitmap data
+	//uHeight - The height in pixels of the font
+	constexpr QAS_LCD_FontRunTable(const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight) :
+		sGlyphs{},
+		uCounts{},
+		sSpans{} {
+
+		uint16_t uCount = 0;
+		uint16_t uSpan  = 0;
+		for (uint8_t i=0; i<QAS_LCD_FONTRUNS_CHARS; i++) {
+			const uint8_t* pGlyph  = &pData[pDesc[i].uOffset];
+			uint16_t       uWidth  = pDesc[i].uWidth;
+			uint16_t       uStride = (uWidth + 7) >> 3;
+
+			//Find first and last lines of the glyph that contain set pixels
+			int16_t iTop    = -1;
+			int16_t iBottom = -1;
+			for (uint16_t y=0; y<uHeight; y++) {
+				if (QAS_LCD_FontRuns_lineSpans(pGlyph, uWidth, y)) {
+					if (iTop < 0)
+						iTop = y;
+					iBottom = y;
+				}
+			}
+
+			sGlyphs[i].uSpan  = uSpan;
+			sGlyphs[i].uCount = uCount;
+			sGlyphs[i].uTop   = (iTop < 0) ? 0 : iTop;
+			sGlyphs[i].uRows  = (iTop < 0) ? 0 : (iBottom - iTop) + 1;
+
+			//Store span count and spans of each line
+			for (int16_t y=iTop; (iTop >= 0) && (y<=iBottom); y++) {
+				uint8_t  uLineSpans = 0;
+				uint16_t x = 0;
+				while (x < uWidth) {
+					if (!QAS_LCD_FontRuns_pixel(pGlyph, uStride, x, y)) {
+						x++;
+						continue;
+					}
+					uint16_t uStart = x;
+					while ((x < uWidth) && QAS_LCD_FontRuns_pixel(pGlyph, uStride, x, y))
+						x++;
+					sSpans[uSpan].uX      = (uint8_t)uStart;
+					sSpans[uSpan].uLength = (uint8_t)(x - uStart);
+					uSpan++;
+					uLineSpans++;
+				}
+				uCounts[uCount++] = uLineSpans;
+			}
+		}
+	}
+
+
+	//------------
+	//Data Methods
+
+	//Returns the QAS_LCD_FontRuns structure referring to the run table, to be passed to QAS_LCD_FontMgr::add()
+	constexpr QAS_LCD_FontRuns runs(void) const {
+		return {sGlyphs, uCounts, sSpans};
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_FONTRUNS_HPP_ */
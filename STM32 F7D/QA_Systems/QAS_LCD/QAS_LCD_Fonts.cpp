@@ -17,6 +17,8 @@
 
 //Includes
 #include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_TextLayout.hpp"
+#include "QAS_LCD_FontFile.hpp"
 
 
   //------------------------------------------
@@ -38,13 +40,74 @@
 //uHeight     - the height in pixels of the font
 //uSpaceWidth - the width in pixels of the space character of the font
 //uCharGap    - the width in pixels of the gap between each character when rendering strings of characters
-void QAS_LCD_FontMgr::add(const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap) {
+//Returns the handle (index) of the font, or -1 if the font table is full or a font with the same name is already stored
+int8_t QAS_LCD_FontMgr::add(const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap) {
+
+	//Create the QAS_LCD_Font class for the new font, providing the required details, and store it in the font table
+	return insert(QAS_LCD_Font(strName, pDesc, pData, uHeight, uSpaceWidth, uCharGap));
+}
+
+
+//QAS_LCD_FontMgr::add
+//QAS_LCD_FontMgr Management Method
+//
+//Used to add a new font to the font manager, whose glyphs are stored as a run table built at compile time (see QAS_LCD_FontRuns.hpp)
+//Characters of the font are drawn directly from the run table, so are not held in the glyph cache
+//strName     - a C-style string containing the name of the font (must be no longer than QAS_LCD_FONTNAME_LENGTH, including the null termination character)
+//pDesc       - a pointer to an array of QAS_LCD_FontDesc structures for the font
+//sRuns       - a QAS_LCD_FontRuns structure referring to the run table of the font, as returned by QAS_LCD_FontRunTable::runs()
+//uHeight     - the height in pixels of the font
+//uSpaceWidth - the width in pixels of the space character of the font
+//uCharGap    - the width in pixels of the gap between each character when rendering strings of characters
+//Returns the handle (index) of the font, or -1 if the font table is full or a font with the same name is already stored
+int8_t QAS_LCD_FontMgr::add(const char* strName, const QAS_LCD_FontDesc* pDesc, const QAS_LCD_FontRuns& sRuns, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap) {
+	return insert(QAS_LCD_Font(strName, pDesc, sRuns, uHeight, uSpaceWidth, uCharGap));
+}
+
+
+//QAS_LCD_FontMgr::add
+//QAS_LCD_FontMgr Management Method
+//
+//Used to add a new font to the font manager from a font file held in memory, such as in memory-mapped QuadSPI flash or in SDRAM
+//(see QAS_LCD_FontFile.hpp). The font is drawn directly from the file, with none of it being copied, so the file must remain in
+//place until the font is removed. Glyphs are held in the glyph cache once drawn, so the file is only read again on a cache miss
+//pFile - Pointer to the start of the font file
+//uSize - The number of bytes available from the start of the file
+//Returns the handle (index) of the font, or -1 if the file is not a valid font file, the font table is full, or a font with the
+//same name is already stored
+int8_t QAS_LCD_FontMgr::add(const void* pFile, uint32_t uSize) {
+	QAS_LCD_FontFile cFile(pFile);
+	if (cFile.validate(uSize))
+		return -1;
+
+	const QAS_LCD_FontFileHeader& sHeader = cFile.header();
+	uint16_t uHeight     = sHeader.uHeight;
+	uint16_t uSpaceWidth = sHeader.uSpaceWidth;
+	uint16_t uCharGap    = sHeader.uCharGap;
+	return insert(QAS_LCD_Font(sHeader.cName, cFile.desc(), cFile.data(), uHeight, uSpaceWidth, uCharGap));
+}
 
-	//Create the QAS_LCD_Font class for the new font, providing the required details
-	QAS_LCD_Font* cFont = new QAS_LCD_Font(strName, pDesc, pData, uHeight, uSpaceWidth, uCharGap);
 
-	//Add the pointer to the font class to the m_vFonts vector
-  m_vFonts.push_back(cFont);
+//QAS_LCD_FontMgr::addImage
+//QAS_LCD_FontMgr Management Method
+//
+//Used to add every font of a font image, being one or more font files placed one after another as written by the font packer
+//Fonts are added in the order they are stored, with each font taking the lowest free handle
+//pImage - Pointer to the start of the font image
+//uSize  - The size in bytes of the image
+//Returns the number of fonts added. Fonts are added up to the first file that cannot be added or the end of the image
+uint8_t QAS_LCD_FontMgr::addImage(const void* pImage, uint32_t uSize) {
+	const uint8_t* pFile  = (const uint8_t*)pImage;
+	uint8_t        uFonts = 0;
+	while (uSize >= sizeof(QAS_LCD_FontFileHeader)) {
+		if (add(pFile, uSize) < 0)
+			break;
+		uint32_t uFileSize = QAS_LCD_FontFile(pFile).size();
+		pFile += uFileSize;
+		uSize -= uFileSize;
+		uFonts++;
+	}
+	return uFonts;
 }
 
 
@@ -52,15 +115,27 @@ void QAS_LCD_FontMgr::add(const char* strName, const QAS_LCD_FontDesc* pDesc, co
 //QAS_LCD_FontMgr Management Method
 //
 //Used to remove a font from the font manager
+//The handles of the remaining fonts are unchanged, and the handle of the removed font is given to the next font to be added
 //strName - The name of the font to be removed.
 void QAS_LCD_FontMgr::remove(const char* strName) {
 
-	//Find index of font matching the provided font name
+	//Find handle of font matching the provided font name
   int8_t iIdx = find(strName);
+  if (iIdx < 0)
+  	return;
+
+  //Mark the font's slot as unused and deselect the font if it is currently selected
+  m_sFonts[iIdx] = QAS_LCD_Font();
+  m_uCount--;
+  if (m_iCurrentIdx == iIdx) {
+  	m_iCurrentIdx = -1;
+  	m_pCurrent    = NULL;
+  }
 
-  //If a matching font has been found then remove it from the m_vFonts vector
-  if (iIdx >= 0)
-  	m_vFonts.erase(m_vFonts.begin()+iIdx);
+  //Rebuild the hash table, as searches for other fonts may have passed through the removed font's entry
+  //The glyph cache is flushed, as the removed font's handle may be reused by a different font
+  rehash();
+  m_cGlyphCache.clear();
 }
 
 
@@ -69,7 +144,13 @@ void QAS_LCD_FontMgr::remove(const char* strName) {
 //
 //Used to clear all fonts from the font manager
 void QAS_LCD_FontMgr::clear(void) {
-  m_vFonts.clear();
+	for (uint8_t i=0; i<QAS_LCD_FONTMGR_LENGTH; i++)
+		m_sFonts[i] = QAS_LCD_Font();
+	memset(m_uHashes, QAS_LCD_FONTMGR_NONE, QAS_LCD_FONTMGR_HASHSIZE);
+	m_uCount      = 0;
+	m_iCurrentIdx = -1;
+	m_pCurrent    = NULL;
+  m_cGlyphCache.clear();
 }
 
 
@@ -77,15 +158,35 @@ void QAS_LCD_FontMgr::clear(void) {
 //QAS_LCD_FontMgr Management Method
 //
 //Used to find if a font exists in the Font Manager
+//The font is found from the hash of its name, and its stored name is then compared, so that a different name with the same hash
+//does not select the wrong font
 //strName - The name of the font to search for
-//Returns -1 if a matching font is not found, or the index of the font if it is gound
-int8_t QAS_LCD_FontMgr::find(const char* strName) {
-  int8_t iIdx = -1;
-  for (uint8_t i=0; i<m_vFonts.size(); i++)
-  	if (*m_vFonts[i] == strName) {
-  		iIdx = i;
-  	}
-  return iIdx;
+//Returns -1 if a matching font is not found, or the handle (index) of the font if it is found
+int8_t QAS_LCD_FontMgr::find(const char* strName) const {
+	int8_t iIdx = find(QAS_LCD_FontHash(strName));
+	if ((iIdx >= 0) && strncmp(m_sFonts[iIdx].m_cName, strName, QAS_LCD_FONTNAME_LENGTH))
+		return -1;
+	return iIdx;
+}
+
+
+//QAS_LCD_FontMgr::find
+//QAS_LCD_FontMgr Management Method
+//
+//Used to find if a font exists in the Font Manager, from the hash of its name
+//The hash table is searched from the slot selected by the hash until the font or an empty slot is found. As the table is at least
+//twice the size of the font table, this is typically a single read
+//uHash - The hash of the name of the font to search for, as returned by QAS_LCD_FontHash() or QAS_LCD_FONTID()
+//Returns -1 if a matching font is not found, or the handle (index) of the font if it is found
+int8_t QAS_LCD_FontMgr::find(uint32_t uHash) const {
+	for (uint8_t i=0; i<QAS_LCD_FONTMGR_HASHSIZE; i++) {
+		uint8_t uIdx = m_uHashes[(uHash + i) & (QAS_LCD_FONTMGR_HASHSIZE - 1)];
+		if (uIdx == QAS_LCD_FONTMGR_NONE)
+			break;
+		if (m_sFonts[uIdx].m_uHash == uHash)
+			return uIdx;
+	}
+	return -1;
 }
 
 
@@ -95,9 +196,20 @@ int8_t QAS_LCD_FontMgr::find(const char* strName) {
 //Used to set the current selected font
 //strName - The name of the font to select
 void QAS_LCD_FontMgr::setFontByName(const char* strName) {
+	int8_t iIdx = find(strName);
+	setFontByIndex((iIdx < 0) ? QAS_LCD_FONTMGR_NONE : (uint8_t)iIdx);
+}
+
+
+//QAS_LCD_FontMgr::setFontByHash
+//QAS_LCD_FontMgr Management Method
+//
+//Used to set the current selected font from the hash of its name
+//uHash - The hash of the name of the font to select, as returned by QAS_LCD_FontHash() or QAS_LCD_FONTID()
+void QAS_LCD_FontMgr::setFontByHash(uint32_t uHash) {
 
 	//Search for matching font
-	int8_t iIdx = find(strName);
+	int8_t iIdx = find(uHash);
 
 	//If no matching font is found then set current font to none
   if (iIdx < 0) {
@@ -108,7 +220,7 @@ void QAS_LCD_FontMgr::setFontByName(const char* strName) {
 
   //If a matching font is found then set details as required
   m_iCurrentIdx = iIdx;
-  m_pCurrent    = m_vFonts[iIdx];
+  m_pCurrent    = &m_sFonts[iIdx];
 }
 
 
@@ -116,11 +228,11 @@ void QAS_LCD_FontMgr::setFontByName(const char* strName) {
 //QAS_LCD_FontMgr Management Method
 //
 //Used to set the currently selected font
-//uIdx - The index of the font to select
+//uIdx - The handle (index) of the font to select
 void QAS_LCD_FontMgr::setFontByIndex(uint8_t uIdx) {
 
-	//If uIdx is outside of the range of fonts currently stored in m_vFonts index then set current font to none
-  if (uIdx >= m_vFonts.size()) {
+	//If uIdx does not refer to a stored font then set current font to none
+  if (getFont(uIdx) == NULL) {
   	m_iCurrentIdx = -1;
   	m_pCurrent    = NULL;
   	return;
@@ -128,7 +240,7 @@ void QAS_LCD_FontMgr::setFontByIndex(uint8_t uIdx) {
 
   //Set current font details as required
   m_iCurrentIdx = uIdx;
-  m_pCurrent    = m_vFonts[uIdx];
+  m_pCurrent    = &m_sFonts[uIdx];
 }
 
 
@@ -136,6 +248,15 @@ void QAS_LCD_FontMgr::setFontByIndex(uint8_t uIdx) {
 	//----------------------------
 	//QAS_LCD_FontMgr Data Methods
 
+//QAS_LCD_FontMgr::getIndex
+//QAS_LCD_FontMgr Data Methods
+//
+//Returns the index of the currently selected font, or -1 if no font is currently selected
+int8_t QAS_LCD_FontMgr::getIndex(void) const {
+	return m_iCurrentIdx;
+}
+
+
 //QAS_LCD_FontMgr::getHeight
 //QAS_LCD_FontMgr Data Methods
 //
@@ -147,6 +268,19 @@ uint8_t QAS_LCD_FontMgr::getHeight(void) const {
 }
 
 
+//QAS_LCD_FontMgr::getHeight
+//QAS_LCD_FontMgr Data Methods
+//
+//Returns the height in pixels of the font with the given handle, or 0 if the handle is invalid
+//uIdx - The handle (index) of the font
+uint8_t QAS_LCD_FontMgr::getHeight(uint8_t uIdx) const {
+	const QAS_LCD_Font* pFont = getFont(uIdx);
+	if (pFont == NULL)
+		return 0;
+	return pFont->m_uHeight;
+}
+
+
 //QAS_LCD_FontMgr::getSpaceWidth
 //QAS_LCD_FontMgr Data Methods
 //
@@ -194,14 +328,13 @@ uint16_t QAS_LCD_FontMgr::getCharWidth(char ch) {
 //If no font is currently selected then 0 will be returned
 uint16_t QAS_LCD_FontMgr::getStringWidth(const char* str) {
   uint16_t uWidth = 0;
-  uint16_t uLength = strlen(str);
   uint8_t  uChar;
 
-  if ((uLength == 0) || (m_iCurrentIdx < 0))
+  if ((str[0] == 0) || (m_iCurrentIdx < 0))
     return uWidth;
 
-  for (uint8_t i=0; i<uLength; i++) {
-    uChar = (uint8_t)str[i];
+  for (const char* pChar=str; *pChar; pChar++) {
+    uChar = (uint8_t)*pChar;
     if (uChar == 32) {
       uWidth += (m_pCurrent->m_uSpaceWidth + m_pCurrent->m_uCharGap);
     } else if ((uChar >= 33) && (uChar <= 126)) {
@@ -213,17 +346,39 @@ uint16_t QAS_LCD_FontMgr::getStringWidth(const char* str) {
 }
 
 
+//QAS_LCD_FontMgr::count
+//QAS_LCD_FontMgr Data Methods
+//
+//Returns the number of fonts stored in the font manager
+uint8_t QAS_LCD_FontMgr::count(void) const {
+	return m_uCount;
+}
+
+
+//QAS_LCD_FontMgr::getFont
+//QAS_LCD_FontMgr Data Methods
+//
+//Returns a pointer to the font with the given handle, or NULL if the handle is invalid
+//This is used by QAS_LCD_TextLayout to measure strings with a font other than the currently selected font
+//uIdx - The handle (index) of the font
+const QAS_LCD_Font* QAS_LCD_FontMgr::getFont(uint8_t uIdx) const {
+	if ((uIdx >= QAS_LCD_FONTMGR_LENGTH) || (m_sFonts[uIdx].m_pDesc == NULL))
+		return NULL;
+	return &m_sFonts[uIdx];
+}
+
+
   //---------------------------------
 	//---------------------------------
 	//QAS_LCD_FontMgr Rendering Methods
 
-//QAS_LCD_FontMgr::setDrawBuffer
+//QAS_LCD_FontMgr::setDrawTarget
 //QAS_LCD_FontMgr Data Methods
 //
-//Sets the current frame buffer for text to be rendered to
-//This method is to be called by QAS_LCD::imp_SetDrawBuffer() method
-void QAS_LCD_FontMgr::setDrawBuffer(QAD_LTDC_Buffer* pBuffer) {
-  m_pBuffer = pBuffer;
+//Sets the render target for text to be rendered to. This will either be the current frame buffer, or a tile buffer when tiled rendering
+//This method is to be called by QAS_LCD::imp_setDrawBuffer() method
+void QAS_LCD_FontMgr::setDrawTarget(const QAS_LCD_Target* pTarget) {
+  m_pTarget = pTarget;
 }
 
 
@@ -237,6 +392,27 @@ void QAS_LCD_FontMgr::setDrawColor(uint16_t uColor) {
 }
 
 
+//QAS_LCD_FontMgr::setBlendMode
+//QAS_LCD_FontMgr Data Methods
+//
+//Sets how text pixels are combined with the existing pixels of the render target
+//This method is to be called by QAS_LCD::imp_setBlendMode() method
+void QAS_LCD_FontMgr::setBlendMode(QAS_LCD_BlendMode eMode) {
+  m_eBlendMode = eMode;
+}
+
+
+//QAS_LCD_FontMgr::setDrawRegion
+//QAS_LCD_FontMgr Data Methods
+//
+//Sets the region that text rendering is clipped against, along with the counter to be incremented for each pixel written
+//This method is to be called by QAS_LCD::imp_updateDrawRegion() method
+void QAS_LCD_FontMgr::setDrawRegion(QAS_LCD_Region* pRegion, uint32_t* pPixelCount) {
+	m_pRegion     = pRegion;
+	m_pPixelCount = pPixelCount;
+}
+
+
 //QAS_LCD_FontMgr::drawChar
 //QAS_LCD_FontMgr Data Methods
 //
@@ -245,7 +421,7 @@ void QAS_LCD_FontMgr::setDrawColor(uint16_t uColor) {
 //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of upper-left location of the character to be drawn
 //ch   - A referenece to the specific character to be rendered
 void QAS_LCD_FontMgr::drawChar(QAT_Vector2_16 cPos, char& ch) {
-  if ((m_pBuffer == NULL) || (m_iCurrentIdx < 0))
+  if ((m_pTarget == NULL) || (m_pRegion == NULL) || (m_iCurrentIdx < 0))
     return;
 
   if ((ch >= 33) && (ch <= 126))
@@ -261,21 +437,15 @@ void QAS_LCD_FontMgr::drawChar(QAT_Vector2_16 cPos, char& ch) {
 //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-left location of the string to be drawn
 //str  - The C-style string to be drawn
 void QAS_LCD_FontMgr::drawStrL(QAT_Vector2_16 cPos, const char* str) {
-  if ((m_pBuffer == NULL) || (m_iCurrentIdx < 0))
+  if ((m_pTarget == NULL) || (m_pRegion == NULL) || (m_iCurrentIdx < 0))
     return;
 
-  uint8_t uLen = strlen(str);
-  if (uLen < 0) return;
-
-  QAT_Vector2_16 cDrawPos = cPos;
-  for (uint8_t i=0; i<uLen; i++) {
-  	if ((str[i] >= 33) && (str[i] <= 126)) {
-      drawCharP(cDrawPos, str[i]);
-      cDrawPos.x += getCharWidth(str[i]) + getCharGap();
-  	} else {
-  		cDrawPos.x += getSpaceWidth() + getCharGap();
-  	}
-  }
+  //Reject string if it lies entirely outside of the region being rendered to. As the string extends to the right of cPos, it does
+  //not need to be measured for this, and drawStrP() stops once the rest of the string lies to the right of the region
+  QAT_Rect_16 cBounds = m_pRegion->bounds();
+  if (((int16_t)cPos.x > cBounds.x1) || ((int16_t)cPos.y > cBounds.y1) || (((int16_t)cPos.y + m_pCurrent->m_uHeight - 1) < cBounds.y0))
+  	return;
+  drawStrP(cPos, str);
 }
 
 
@@ -287,22 +457,17 @@ void QAS_LCD_FontMgr::drawStrL(QAT_Vector2_16 cPos, const char* str) {
 //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-center location of the string to be drawn
 //str  - The C-style string to be drawn
 void QAS_LCD_FontMgr::drawStrC(QAT_Vector2_16 cPos, const char* str) {
-  if ((m_pBuffer == NULL) || (m_iCurrentIdx < 0))
+  if ((m_pTarget == NULL) || (m_pRegion == NULL) || (m_iCurrentIdx < 0))
     return;
 
-  uint8_t uLen = strlen(str);
-  if (uLen < 0) return;
-
+  uint16_t uWidth = getStringWidth(str);
   QAT_Vector2_16 cDrawPos = cPos;
-  cDrawPos.x -= (getStringWidth(str) / 2);
-  for (uint8_t i=0; i<uLen; i++) {
-  	if ((str[i] >= 33) && (str[i] <= 126)) {
-      drawCharP(cDrawPos, str[i]);
-      cDrawPos.x += getCharWidth(str[i]) + getCharGap();
-  	} else {
-  		cDrawPos.x += getSpaceWidth() + getCharGap();
-  	}
-  }
+  cDrawPos.x -= (uWidth / 2);
+
+  //Reject string if it lies entirely outside of the region being rendered to
+  if (rejectStr(cDrawPos, uWidth))
+  	return;
+  drawStrP(cDrawPos, str);
 }
 
 
@@ -314,22 +479,134 @@ void QAS_LCD_FontMgr::drawStrC(QAT_Vector2_16 cPos, const char* str) {
 //cPos - A QAD_Vector2_16 class that defines the X and Y coordinates that define the position of the upper-right location of the string to be drawn
 //str  - The C-style string to be drawn
 void QAS_LCD_FontMgr::drawStrR(QAT_Vector2_16 cPos, const char* str) {
-  if ((m_pBuffer == NULL) || (m_iCurrentIdx < 0))
+  if ((m_pTarget == NULL) || (m_pRegion == NULL) || (m_iCurrentIdx < 0))
     return;
 
-  uint8_t uLen = strlen(str);
-  if (uLen < 0) return;
-
+  uint16_t uWidth = getStringWidth(str);
   QAT_Vector2_16 cDrawPos = cPos;
-  cDrawPos.x -= getStringWidth(str);
-  for (uint8_t i=0; i<uLen; i++) {
-  	if ((str[i] >= 33) && (str[i] <= 126)) {
-      drawCharP(cDrawPos, str[i]);
-      cDrawPos.x += getCharWidth(str[i]) + getCharGap();
-  	} else {
-  		cDrawPos.x += getSpaceWidth() + getCharGap();
+  cDrawPos.x -= uWidth;
+
+  //Reject string if it lies entirely outside of the region being rendered to
+  if (rejectStr(cDrawPos, uWidth))
+  	return;
+  drawStrP(cDrawPos, str);
+}
+
+
+//QAS_LCD_FontMgr::drawLayout
+//QAS_LCD_FontMgr Data Methods
+//
+//Used to draw a text layout, which holds the position of each of its characters so that no measuring takes place while drawing
+//The layout is drawn with the font it was laid out with, which does not need to be the currently selected font
+//String will be drawn to currently selected draw buffer with currently selected draw color
+//cPos    - A QAD_Vector2_16 class that defines the X and Y coordinates of the upper-left location of the layout's box
+//cLayout - The text layout to be drawn. See QAS_LCD_TextLayout.hpp
+void QAS_LCD_FontMgr::drawLayout(QAT_Vector2_16 cPos, const QAS_LCD_TextLayout& cLayout) {
+  if ((m_pTarget == NULL) || (m_pRegion == NULL) || (getFont(cLayout.font()) == NULL) || !cLayout.lines())
+    return;
+
+  //Reject layout if it lies entirely outside of the region being rendered to
+  const QAT_Rect_16& cBounds = m_pRegion->bounds();
+  QAT_Rect_16 cLayoutBounds = cLayout.bounds();
+  if (cLayoutBounds.empty())
+  	return;
+  if (!QAT_Rect_16(cLayoutBounds.x0 + (int16_t)cPos.x, cLayoutBounds.y0 + (int16_t)cPos.y,
+  		             cLayoutBounds.x1 + (int16_t)cPos.x, cLayoutBounds.y1 + (int16_t)cPos.y).intersects(cBounds))
+  	return;
+
+  //Temporarily select the layout's font, as drawCharP() draws with the currently selected font
+  int8_t        iPrevIdx = m_iCurrentIdx;
+  QAS_LCD_Font* pPrev    = m_pCurrent;
+  m_iCurrentIdx = cLayout.font();
+  m_pCurrent    = &m_sFonts[m_iCurrentIdx];
+
+  int16_t iHeight = cLayout.lineHeight();
+  for (uint8_t uLine=0; uLine<cLayout.lines(); uLine++) {
+  	const QAS_LCD_LayoutLine& sLine = cLayout.line(uLine);
+  	int16_t iY = (int16_t)cPos.y + (uLine * iHeight);
+  	int16_t iX = (int16_t)cPos.x + sLine.iX;
+
+  	//Reject lines above, below or entirely to the right of the region
+  	if (((iY + iHeight - 1) < cBounds.y0) || (iX > cBounds.x1))
+  		continue;
+  	if (iY > cBounds.y1)
+  		break;
+
+  	for (uint16_t i=sLine.uFirst; i<(sLine.uFirst + sLine.uCount); i++) {
+  		const QAS_LCD_LayoutGlyph& sGlyph = cLayout.glyph(i);
+  		if (sGlyph.ch != ' ')
+  			drawCharP(QAT_Vector2_16(iX + sGlyph.iX, iY), sGlyph.ch);
   	}
   }
+
+  m_iCurrentIdx = iPrevIdx;
+  m_pCurrent    = pPrev;
+}
+
+
+  //-----------------------------------
+  //-----------------------------------
+  //QAS_LCD_FontMgr Glyph Cache Methods
+
+//QAS_LCD_FontMgr::setGlyphCache
+//QAS_LCD_FontMgr Glyph Cache Method
+//
+//Used to enable or disable drawing of characters from the glyph cache. When inactive, every character is drawn directly from the
+//font's bitmap data. Disabling the cache also flushes it
+//eState - QA_Active to enable the glyph cache, or QA_Inactive to disable. Member of QA_ActiveState enum defined in setup.hpp
+void QAS_LCD_FontMgr::setGlyphCache(QA_ActiveState eState) {
+	m_eGlyphCache = eState;
+	if (!eState)
+		m_cGlyphCache.clear();
+}
+
+
+  //------------------------------------------
+  //------------------------------------------
+  //QAS_LCD_FontMgr Private Management Methods
+
+//QAS_LCD_FontMgr::insert
+//QAS_LCD_FontMgr Private Management Method
+//
+//Used to store a font in the lowest free slot of the font table, and enter it into the hash table
+//This method is to be used by the add() methods
+//cFont - The font to be stored
+//Fonts are found by the hash of their name, so a font whose name has the same hash as a stored font is rejected, even if the names
+//differ, as it could not otherwise be told apart from the stored font by setFontByHash()
+//Returns the handle (index) of the font, or -1 if the font table is full or a font with the same name hash is already stored
+int8_t QAS_LCD_FontMgr::insert(const QAS_LCD_Font& cFont) {
+	if ((m_uCount >= QAS_LCD_FONTMGR_LENGTH) || (cFont.m_pDesc == NULL) || (find(cFont.m_uHash) >= 0))
+		return -1;
+
+	uint8_t uIdx = 0;
+	while (m_sFonts[uIdx].m_pDesc != NULL)
+		uIdx++;
+	m_sFonts[uIdx] = cFont;
+	m_uCount++;
+
+	uint8_t uSlot = cFont.m_uHash & (QAS_LCD_FONTMGR_HASHSIZE - 1);
+	while (m_uHashes[uSlot] != QAS_LCD_FONTMGR_NONE)
+		uSlot = (uSlot + 1) & (QAS_LCD_FONTMGR_HASHSIZE - 1);
+	m_uHashes[uSlot] = uIdx;
+	return uIdx;
+}
+
+
+//QAS_LCD_FontMgr::rehash
+//QAS_LCD_FontMgr Private Management Method
+//
+//Used to rebuild the hash table from the fonts stored in the font table
+//This method is to be used by the remove() method
+void QAS_LCD_FontMgr::rehash(void) {
+	memset(m_uHashes, QAS_LCD_FONTMGR_NONE, QAS_LCD_FONTMGR_HASHSIZE);
+	for (uint8_t i=0; i<QAS_LCD_FONTMGR_LENGTH; i++) {
+		if (m_sFonts[i].m_pDesc == NULL)
+			continue;
+		uint8_t uSlot = m_sFonts[i].m_uHash & (QAS_LCD_FONTMGR_HASHSIZE - 1);
+		while (m_uHashes[uSlot] != QAS_LCD_FONTMGR_NONE)
+			uSlot = (uSlot + 1) & (QAS_LCD_FONTMGR_HASHSIZE - 1);
+		m_uHashes[uSlot] = i;
+	}
 }
 
 
@@ -337,49 +614,163 @@ void QAS_LCD_FontMgr::drawStrR(QAT_Vector2_16 cPos, const char* str) {
   //-----------------------------------------
   //QAS_LCD_FontMgr Private Rendering Methods
 
-//QAS_LCD_FontMgr::drawCharP
+//QAS_LCD_FontMgr::rejectStr
 //QAS_LCD_FontMgr Private Rendering Method
 //
-//Used to draw an individual character based on selected font's bitmap data
-//This method is to be used by drawChar(), drawStrL(), drawStrC() and drawStrR() methods
-void QAS_LCD_FontMgr::drawCharP(QAT_Vector2_16 cPos, char ch) {
-  uint16_t uLetter = (uint8_t)ch - 33;
-  uint16_t uWidth  = m_pCurrent->m_pDesc[uLetter].uWidth;
-  uint32_t uOffset = m_pCurrent->m_pDesc[uLetter].uOffset;
-
-  uint8_t uLine;
-  uint8_t uLineInc;
-  uint32_t uCur;
-
-  for (uint8_t uHeight=0; uHeight<m_pCurrent->m_uHeight; uHeight++) {
-    uLineInc = 0;
-    uCur = cPos.x+((cPos.y+uHeight)*QAD_LTDC_WIDTH);
-    for (uint16_t i=0; i<uWidth; i++) {
-      if (uLineInc == 0) {
-        uLine = m_pCurrent->m_pData[uOffset];
-        uOffset++;
-      }
-      if (uLine & 0x01)
-        m_pBuffer->pixel[uCur+i] = m_uColor;
-      uLine = uLine >> 1;
-      uLineInc++;
-      if (uLineInc > 7)
-        uLineInc = 0;
-    }
-  }
+//Used to determine whether a string lies entirely outside of the region being rendered to, so that it can be rejected
+//before any of its characters are processed
+//This method is to be used by drawStrL(), drawStrC() and drawStrR() methods
+//cPos   - The upper-left location of the string
+//uWidth - The width in pixels of the string
+//Returns true if the string can be rejected, or false if it needs to be drawn
+bool QAS_LCD_FontMgr::rejectStr(QAT_Vector2_16 cPos, uint16_t uWidth) {
+	QAT_Rect_16 cStr((int16_t)cPos.x, (int16_t)cPos.y, (int16_t)cPos.x+uWidth-1, (int16_t)cPos.y+m_pCurrent->m_uHeight-1);
+	return !cStr.intersects(m_pRegion->bounds());
 }
 
 
+//QAS_LCD_FontMgr::drawStrP
+//QAS_LCD_FontMgr Private Rendering Method
+//
+//Used to draw the characters of a string from left to right, walking the string a single time
+//Drawing stops once the rest of the string lies to the right of the region being rendered to
+//This method is to be used by drawStrL(), drawStrC() and drawStrR() methods
+//cPos - The upper-left location of the string
+//str  - The C-style string to be drawn
+void QAS_LCD_FontMgr::drawStrP(QAT_Vector2_16 cPos, const char* str) {
+  const QAS_LCD_FontDesc* pDesc  = m_pCurrent->m_pDesc;
+  int16_t                 iGap   = m_pCurrent->m_uCharGap;
+  int16_t                 iSpace = m_pCurrent->m_uSpaceWidth + iGap;
+  int16_t                 iRight = m_pRegion->bounds().x1;
 
+  QAT_Vector2_16 cDrawPos = cPos;
+  for (const char* pChar=str; *pChar && ((int16_t)cDrawPos.x <= iRight); pChar++) {
+  	char ch = *pChar;
+  	if ((ch >= 33) && (ch <= 126)) {
+      drawCharP(cDrawPos, ch);
+      cDrawPos.x += pDesc[ch-33].uWidth + iGap;
+  	} else {
+  		cDrawPos.x += iSpace;
+  	}
+  }
+}
 
 
+//QAS_LCD_FontMgr::drawCharP
+//QAS_LCD_FontMgr Private Rendering Method
+//
+//Used to draw an individual character based on selected font's run table or bitmap data
+//Fonts with a run table are drawn as a span fill for each run of set pixels. For fonts with only bitmap data, the glyph is drawn in the
+//same manner from the glyph cache when it is active. Otherwise, or if the glyph cannot be cached, each pixel of the bitmap data is
+//tested individually
+//This method is to be used by drawChar(), drawStrP() and drawLayout() methods
+void QAS_LCD_FontMgr::drawCharP(QAT_Vector2_16 cPos, char ch) {
+  uint16_t uLetter = (uint8_t)ch - 33;
+  uint16_t uWidth  = m_pCurrent->m_pDesc[uLetter].uWidth;
+  uint32_t uOffset = m_pCurrent->m_pDesc[uLetter].uOffset;
+  uint16_t uStride = (uWidth + 7) >> 3;  //Each line of bitmap data is padded to a whole number of bytes
 
+  //Reject character if it lies entirely outside of the region being rendered to
+  QAT_Rect_16 cGlyph((int16_t)cPos.x, (int16_t)cPos.y, (int16_t)cPos.x+uWidth-1, (int16_t)cPos.y+m_pCurrent->m_uHeight-1);
+  if (!cGlyph.intersects(m_pRegion->bounds()))
+  	return;
 
+  //Render the glyph's runs from the font's run table, or from the glyph cache
+  if (m_pCurrent->m_sRuns.pGlyphs != NULL) {
+  	const QAS_LCD_GlyphRuns& sGlyph = m_pCurrent->m_sRuns.pGlyphs[uLetter];
+  	drawSpansP(cGlyph, sGlyph.uTop, sGlyph.uRows, &m_pCurrent->m_sRuns.pCounts[sGlyph.uCount], &m_pCurrent->m_sRuns.pSpans[sGlyph.uSpan]);
+  	return;
+  }
+  if (m_eGlyphCache) {
+  	const QAS_LCD_GlyphEntry* pEntry = m_cGlyphCache.find((uint8_t)m_iCurrentIdx, (uint8_t)uLetter, &m_pCurrent->m_pData[uOffset], uWidth, m_pCurrent->m_uHeight);
+  	if (pEntry != NULL) {
+  		drawSpansP(cGlyph, 0, pEntry->uHeight, pEntry->uData, (const QAS_LCD_GlyphSpan*)&pEntry->uData[pEntry->uHeight]);
+  		return;
+  	}
+  }
 
+  //Render the portion of the character within each rectangle of the region
+  uint32_t uCount = 0;
+  m_pTarget->raster([&](auto cRaster) {
+  	typedef typename decltype(cRaster)::Pixel Pixel;
+
+  	//Convert draw color to the pixel format of the render target, for use when no blend mode is selected
+  	Pixel uPixel = cRaster.color(m_uColor);
+
+  	//Pixels are written directly, so any queued DMA2D jobs must complete first
+  	cRaster.sync();
+
+  	for (uint8_t uRect=0; uRect<m_pRegion->count(); uRect++) {
+  		QAT_Rect_16 cClip = cGlyph.intersect((*m_pRegion)[uRect]);
+  		if (cClip.empty())
+  			continue;
+
+  		for (int16_t y=cClip.y0; y<=cClip.y1; y++) {
+  			uint8_t* pLine = &m_pCurrent->m_pData[uOffset + ((y - cGlyph.y0) * uStride)];
+  			Pixel*   pDst  = (Pixel*)m_pTarget->pixel(cClip.x0, y);
+  			for (int16_t x=cClip.x0; x<=cClip.x1; x++) {
+  				uint16_t uBit = x - cGlyph.x0;
+  				if (pLine[uBit >> 3] & (1 << (uBit & 0x07))) {
+  					if (m_eBlendMode)
+  						cRaster.pixel(pDst, m_uColor, m_eBlendMode); else
+  						*pDst = uPixel;
+  					uCount++;
+  				}
+  				pDst++;
+  			}
+  		}
+  	}
+  });
 
+  if (m_pPixelCount != NULL)
+  	*m_pPixelCount += uCount;
+}
 
 
+//QAS_LCD_FontMgr::drawSpansP
+//QAS_LCD_FontMgr Private Rendering Method
+//
+//Used to draw the runs of set pixels of a glyph, from either a run table or the glyph cache, as one span fill per run
+//This method is to be used by drawCharP() method
+//cGlyph  - The area of the LCD covered by the glyph
+//uTop    - The line of the glyph that the first span count refers to
+//uRows   - The number of span counts
+//pCounts - Pointer to the number of spans in each line, starting from line uTop
+//pSpans  - Pointer to the spans of each line, in order
+void QAS_LCD_FontMgr::drawSpansP(const QAT_Rect_16& cGlyph, uint8_t uTop, uint8_t uRows, const uint8_t* pCounts, const QAS_LCD_GlyphSpan* pSpans) {
+  uint32_t uCount = 0;
+
+  //Render the portion of the glyph within each rectangle of the region
+  m_pTarget->raster([&](auto cRaster) {
+  	for (uint8_t uRect=0; uRect<m_pRegion->count(); uRect++) {
+  		QAT_Rect_16 cClip = cGlyph.intersect((*m_pRegion)[uRect]);
+  		if (cClip.empty())
+  			continue;
+
+  		const QAS_LCD_GlyphSpan* pSpan = pSpans;
+  		for (uint8_t uRow=0; uRow<uRows; uRow++) {
+  			int16_t y      = cGlyph.y0 + uTop + uRow;
+  			uint8_t uSpans = pCounts[uRow];
+  			if (y > cClip.y1)
+  				break;
+  			if (y >= cClip.y0) {
+  				for (uint8_t i=0; i<uSpans; i++) {
+  					int16_t iX0 = cGlyph.x0 + pSpan[i].uX;
+  					int16_t iX1 = iX0 + pSpan[i].uLength - 1;
+  					if (iX0 < cClip.x0) iX0 = cClip.x0;
+  					if (iX1 > cClip.x1) iX1 = cClip.x1;
+  					if (iX0 <= iX1) {
+  						cRaster.fill(m_pTarget->pixel(iX0, y), (iX1 - iX0) + 1, m_uColor, m_eBlendMode);
+  						uCount += (iX1 - iX0) + 1;
+  					}
+  				}
+  			}
+  			pSpan += uSpans;
+  		}
+  	}
+  });
 
-
-
+  if (m_pPixelCount != NULL)
+  	*m_pPixelCount += uCount;
+}
 
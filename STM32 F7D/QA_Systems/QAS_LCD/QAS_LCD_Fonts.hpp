@@ -26,9 +26,15 @@
 #include "QAD_LTDC.hpp"
 
 #include "QAT_Vector.hpp"
+#include "QAT_Rect.hpp"
+
+#include "QAS_LCD_Region.hpp"
+#include "QAS_LCD_Target.hpp"
+#include "QAS_LCD_Blend.hpp"
+#include "QAS_LCD_GlyphCache.hpp"
 
 #include <string.h>
-#include <vector>
+#include <type_traits>
 
 
   //------------------------------------------
@@ -43,6 +49,62 @@
 #define QAS_LCD_FONTNAME_LENGTH  ((uint8_t)48)
 
 
+//----------------------
+//QAS_LCD_FONTMGR_LENGTH
+//
+//Used to determine the maximum number of fonts that can be stored in the Font Manager at once
+//This matches QAS_LCD_GLYPHCACHE_FONTS, so that every font can have its glyphs cached
+#define QAS_LCD_FONTMGR_LENGTH    ((uint8_t)32)
+
+
+//------------------------
+//QAS_LCD_FONTMGR_HASHSIZE
+//
+//Used to determine the number of slots in the Font Manager's name hash table. Must be a power of 2, and at least twice
+//QAS_LCD_FONTMGR_LENGTH so that searches remain short
+#define QAS_LCD_FONTMGR_HASHSIZE  ((uint8_t)64)
+
+
+//--------------------
+//QAS_LCD_FONTMGR_NONE
+//
+//Value used to mark an empty slot of the Font Manager's name hash table
+#define QAS_LCD_FONTMGR_NONE      ((uint8_t)0xFF)
+
+
+//----------------
+//QAS_LCD_FontHash
+//
+//Returns the 32bit FNV-1a hash of a font name, which is used to find fonts in the Font Manager without comparing names
+//As this is constexpr, the hash of a string literal is calculated by the compiler. QAS_LCD_FONTID() guarantees this
+//strName - C-style string containing the name of the font
+constexpr uint32_t QAS_LCD_FontHash(const char* strName) {
+	uint32_t uHash = 0x811C9DC5;
+	for (uint8_t i=0; (i<QAS_LCD_FONTNAME_LENGTH) && strName[i]; i++)
+		uHash = (uHash ^ (uint8_t)strName[i]) * 0x01000193;
+	return uHash;
+}
+
+
+//--------------
+//QAS_LCD_FONTID
+//
+//Returns the hash of a font name given as a string literal, calculated at compile time, to be used with QAS_LCD::setFontByHash()
+//STR - String literal containing the name of the font
+#define QAS_LCD_FONTID(STR)  (std::integral_constant<uint32_t, QAS_LCD_FontHash(STR)>::value)
+
+
+//-----------------
+//QAS_LCD_TextAlign
+//
+//Used to select the horizontal alignment of a string relative to the position it is drawn at
+enum QAS_LCD_TextAlign : uint8_t {
+	QAS_LCD_Align_Left = 0,  //Position is the upper-left location of the string
+	QAS_LCD_Align_Center,    //Position is the upper-center location of the string
+	QAS_LCD_Align_Right      //Position is the upper-right location of the string
+};
+
+
 //----------------
 //QAS_LCD_FontDesc
 //
@@ -55,6 +117,30 @@ typedef struct {
 } QAS_LCD_FontDesc;
 
 
+//-----------------
+//QAS_LCD_GlyphRuns
+//
+//Structure used to locate the runs of a single glyph within a run table. Blank lines at the top and bottom of the glyph are not
+//stored, so only lines uTop to uTop+uRows-1 have span counts
+typedef struct {
+	uint16_t uSpan;   //Index of the first span of the glyph within the run table's spans
+	uint16_t uCount;  //Index of the first span count of the glyph within the run table's span counts
+	uint8_t  uTop;    //Line of the glyph that the first span count refers to
+	uint8_t  uRows;   //Number of lines that have span counts
+} QAS_LCD_GlyphRuns;
+
+
+//----------------
+//QAS_LCD_FontRuns
+//
+//Structure used by QAS_LCD_Font to refer to the run table of a font. See QAS_LCD_FontRunTable in QAS_LCD_FontRuns.hpp
+typedef struct {
+	const QAS_LCD_GlyphRuns* pGlyphs;  //Pointer to an array of QAS_LCD_FONTRUNS_CHARS glyph structures
+	const uint8_t*           pCounts;  //Pointer to the number of spans in each stored line of each glyph
+	const QAS_LCD_GlyphSpan* pSpans;   //Pointer to the spans of each stored line of each glyph, in order. See QAS_LCD_GlyphCache.hpp
+} QAS_LCD_FontRuns;
+
+
 	//------------------------------------------
 	//------------------------------------------
 	//------------------------------------------
@@ -64,15 +150,17 @@ typedef struct {
 //QAS_LCD_Font
 //
 //This class is used to hold data specific to an individual font.
-//The QAS_LCD_FontMgr uses an array (std::vector) of this class to more easily add, remove and select a particular font
+//The QAS_LCD_FontMgr uses a fixed array of this class to more easily add, remove and select a particular font
 class QAS_LCD_Font {
 public:
 
 	char m_cName[QAS_LCD_FONTNAME_LENGTH];  //Stores the name of the font.
 	                                        //This is used when using the QAS_LCD_FontMgr::setFontByName() method to select a particular font
+	uint32_t m_uHash;                       //Hash of the font name, as returned by QAS_LCD_FontHash()
 
 	QAS_LCD_FontDesc* m_pDesc;              //A pointer to an array of QAS_LCD_FontDesc structures storing the widths and data offsets for each character
-	uint8_t*          m_pData;              //A pointer to the bitmap data for characters in the font
+	uint8_t*          m_pData;              //A pointer to the bitmap data for characters in the font, or NULL if the font has a run table
+	QAS_LCD_FontRuns  m_sRuns;              //The run table of the font, with pGlyphs set to NULL if the font only has bitmap data
 
 	uint16_t          m_uHeight;            //The height in pixels of the the font
 	uint16_t          m_uSpaceWidth;        //The width in pixels of the space character for the font
@@ -83,7 +171,17 @@ public:
 	//------------
   //Constructors
 
-	QAS_LCD_Font() = delete;  //Delete default constructor as details for the font need to be supplied upon class creation
+	//Default constructor, used for unused entries of the Font Manager's font table. m_pDesc is set to NULL to mark the entry as unused
+	QAS_LCD_Font() :
+		m_uHash(0),
+		m_pDesc(NULL),
+		m_pData(NULL),
+		m_sRuns({NULL, NULL, NULL}),
+		m_uHeight(0),
+		m_uSpaceWidth(0),
+		m_uCharGap(0) {
+		memset(m_cName, 0, QAS_LCD_FONTNAME_LENGTH);
+	}
 
 	//This is the constructor to be used, which allows the required details of the font to be supplied
 	//strName     - a C-style string containing the name of the font (must be no longer than QAS_LCD_FONTNAME_LENGTH, including the null termination character)
@@ -99,13 +197,30 @@ public:
 
 		m_pDesc = (QAS_LCD_FontDesc*)pDesc;
 		m_pData = (uint8_t*)pData;
+		m_sRuns = {NULL, NULL, NULL};
 
 		//Clear the font name character array to null characters prior to copying strName into the array
 		//This is partly done to make sure that the below equality operators work correctly in all cases
+		//Names that are too long are truncated, leaving the last character as the null termination character
 		for (uint8_t i=0; i<QAS_LCD_FONTNAME_LENGTH; i++) {
 			m_cName[i] = 0;
 		}
-		strcpy(m_cName, strName);
+		for (uint8_t i=0; (i<(QAS_LCD_FONTNAME_LENGTH-1)) && strName[i]; i++) {
+			m_cName[i] = strName[i];
+		}
+		m_uHash = QAS_LCD_FontHash(m_cName);
+	}
+
+	//Constructor used to supply the details of a font whose glyphs are stored as a run table rather than as bitmap data
+	//strName     - a C-style string containing the name of the font (must be no longer than QAS_LCD_FONTNAME_LENGTH, including the null termination character)
+	//pDesc       - a pointer to an array of QAS_LCD_FontDesc structures for the font
+	//sRuns       - a QAS_LCD_FontRuns structure referring to the run table of the font. See QAS_LCD_FontRuns.hpp
+	//uHeight     - the height in pixels of the font
+	//uSpaceWidth - the width in pixels of the space character of the font
+	//uCharGap    - the width in pixels of the gap between each character when rendering strings of characters
+	QAS_LCD_Font(const char* strName, const QAS_LCD_FontDesc* pDesc, const QAS_LCD_FontRuns& sRuns, uint16_t& uHeight, uint16_t& uSpaceWidth, uint16_t& uCharGap) :
+		QAS_LCD_Font(strName, pDesc, NULL, uHeight, uSpaceWidth, uCharGap) {
+		m_sRuns = sRuns;
 	}
 
 
@@ -154,13 +269,15 @@ public:
 
 	//Assignment operator
 	//This is used to copy data from one QAS_LCD_Font class to another
-	//This may not be required at this stage with the Font Manager, but is included for future proofing
-	QAS_LCD_Font& operator=(QAS_LCD_Font& other) {
+	//This is used by the Font Manager to store fonts into its font table
+	QAS_LCD_Font& operator=(const QAS_LCD_Font& other) {
 		for (uint8_t i=0; i<QAS_LCD_FONTNAME_LENGTH; i++)
 			m_cName[i] = other.m_cName[i];
 
+		m_uHash       = other.m_uHash;
 		m_pDesc       = other.m_pDesc;
 		m_pData       = other.m_pData;
+		m_sRuns       = other.m_sRuns;
 		m_uHeight     = other.m_uHeight;
 		m_uSpaceWidth = other.m_uSpaceWidth;
 		m_uCharGap    = other.m_uCharGap;
@@ -175,6 +292,10 @@ public:
 	//------------------------------------------
 
 
+//Forward declaration of QAS_LCD_TextLayout, defined in QAS_LCD_TextLayout.hpp
+class QAS_LCD_TextLayout;
+
+
 //---------------
 //QAS_LCD_FontMgr
 //
@@ -184,13 +305,22 @@ public:
 class QAS_LCD_FontMgr {
 private:
 
-	std::vector<QAS_LCD_Font*> m_vFonts;       //A vector containing the array of QAS_LCD_Font class pointers to the specific fonts
+	QAS_LCD_Font               m_sFonts[QAS_LCD_FONTMGR_LENGTH];      //Table of fonts. The index of a font within the table is its handle
+	uint8_t                    m_uHashes[QAS_LCD_FONTMGR_HASHSIZE];   //Hash table of font names, holding the handle of each font or QAS_LCD_FONTMGR_NONE
+	uint8_t                    m_uCount;                              //Number of fonts stored
 
 	int8_t                     m_iCurrentIdx;  //The index of the currently selected font. Will be -1 if no font is selected.
 	QAS_LCD_Font*              m_pCurrent;     //A pointer to the QAS_LCD_Font class of the currently selected font
 
-	QAD_LTDC_Buffer*           m_pBuffer;      //A pointer to the currently selected rendering buffer.
+	const QAS_LCD_Target*      m_pTarget;      //A pointer to the currently selected render target
 	uint16_t                   m_uColor;       //Stores the currently selected rendering color
+	QAS_LCD_BlendMode          m_eBlendMode;   //Stores the currently selected blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+
+	QAS_LCD_Region*            m_pRegion;      //A pointer to the region that text rendering is clipped against
+	uint32_t*                  m_pPixelCount;  //A pointer to the counter to be incremented for each pixel written
+
+	QAS_LCD_GlyphCache         m_cGlyphCache;  //Cache of recently drawn glyphs, converted to spans. See QAS_LCD_GlyphCache.hpp
+	QA_ActiveState             m_eGlyphCache;  //Stores whether glyphs are drawn from the glyph cache. Member of QA_ActiveState enum defined in setup.hpp
 
 public:
 
@@ -199,19 +329,16 @@ public:
 
 	//Default constructor, which clears all data to default on class construction
 	QAS_LCD_FontMgr() :
+		m_uCount(0),
 		m_iCurrentIdx(-1),
 		m_pCurrent(NULL),
-		m_pBuffer(NULL),
-		m_uColor(0x0000) {
-		m_vFonts.clear();
-	}
-
-	//Class destructor which iterates through all fonts stored in m_vFonts vector and
-	//deletes/deallocates them to prevent memory leaks when class is destroyed
-	~QAS_LCD_FontMgr() {
-		for (uint8_t i=0; i<m_vFonts.size(); i++) {
-			delete m_vFonts[i];
-		}
+		m_pTarget(NULL),
+		m_uColor(0x0000),
+		m_eBlendMode(QAS_LCD_Blend_None),
+		m_pRegion(NULL),
+		m_pPixelCount(NULL),
+		m_eGlyphCache(QA_Active) {
+		clear();
 	}
 
 
@@ -220,40 +347,72 @@ public:
 	//------------------
 	//Management Methods
 
-	void add(const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap);
+	int8_t add(const char* strName, const QAS_LCD_FontDesc* pDesc, const uint8_t* pData, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap);
+	int8_t add(const char* strName, const QAS_LCD_FontDesc* pDesc, const QAS_LCD_FontRuns& sRuns, uint16_t uHeight, uint16_t uSpaceWidth, uint16_t uCharGap);
+	int8_t add(const void* pFile, uint32_t uSize);
+	uint8_t addImage(const void* pImage, uint32_t uSize);
 	void remove(const char* strName);
 	void clear(void);
-	int8_t find(const char* strName);
+	int8_t find(const char* strName) const;
+	int8_t find(uint32_t uHash) const;
 	void setFontByName(const char* strName);
+	void setFontByHash(uint32_t uHash);
 	void setFontByIndex(uint8_t uIdx);
 
 
 	//------------
 	//Data Methods
 
+	int8_t getIndex(void) const;
 	uint8_t getHeight(void) const;
+	uint8_t getHeight(uint8_t uIdx) const;
 	uint8_t getSpaceWidth(void) const;
 	uint8_t getCharGap(void) const;
 	uint16_t getCharWidth(char ch);
 	uint16_t getStringWidth(const char* str);
+	const QAS_LCD_Font* getFont(uint8_t uIdx) const;
+	uint8_t count(void) const;
 
 	//-----------------
 	//Rendering Methods
 
-	void setDrawBuffer(QAD_LTDC_Buffer* pBuffer);
+	void setDrawTarget(const QAS_LCD_Target* pTarget);
 	void setDrawColor(uint16_t uColor);
+	void setBlendMode(QAS_LCD_BlendMode eMode);
+	void setDrawRegion(QAS_LCD_Region* pRegion, uint32_t* pPixelCount);
 
 	void drawChar(QAT_Vector2_16 cPos, char& ch);
 	void drawStrL(QAT_Vector2_16 cPos, const char* str);
 	void drawStrC(QAT_Vector2_16 cPos, const char* str);
 	void drawStrR(QAT_Vector2_16 cPos, const char* str);
+	void drawLayout(QAT_Vector2_16 cPos, const QAS_LCD_TextLayout& cLayout);
+
+
+	//-------------------
+	//Glyph Cache Methods
+
+	void setGlyphCache(QA_ActiveState eState);
+
+	//Returns the glyph cache, so that its hit and miss counters can be read or reset
+	QAS_LCD_GlyphCache& getGlyphCache(void) {
+		return m_cGlyphCache;
+	}
 
 private:
 
+	//------------------
+	//Management Methods
+
+	int8_t insert(const QAS_LCD_Font& cFont);
+	void rehash(void);
+
 	//-----------------
 	//Rendering Methods
 
+	bool rejectStr(QAT_Vector2_16 cPos, uint16_t uWidth);
+	void drawStrP(QAT_Vector2_16 cPos, const char* str);
 	void drawCharP(QAT_Vector2_16 cPos, char ch);
+	void drawSpansP(const QAT_Rect_16& cGlyph, uint8_t uTop, uint8_t uRows, const uint8_t* pCounts, const QAS_LCD_GlyphSpan* pSpans);
 
 };
 
@@ -21,7 +21,7 @@
 
 
 //Includes
-#include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_FontRuns.hpp"
 
 
   /*  -----------------------  */
@@ -31,12 +31,12 @@
   /*  -----------------------  */
 
 //Font Data
-const uint16_t QAS_LCD_Fonts_SegoeUI12pt_Height = 17;
-const uint16_t QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth = 3;
-const uint16_t QAS_LCD_Fonts_SegoeUI12pt_CharGap = 2;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI12pt_Height = 17;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI12pt_SpaceWidth = 3;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI12pt_CharGap = 2;
 
 //QAS_LCD_Fonts_SegoeUI12pt_Desc
-const QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI12pt_Desc[] = {
+constexpr QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI12pt_Desc[] = {
 	{1, 0}, 		/* ! */
 	{4, 17}, 		/* " */
 	{8, 34}, 		/* # */
@@ -135,7 +135,7 @@ const QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI12pt_Desc[] = {
 
 
 //QAS_LCD_Fonts_SegoeUI12pt_Data
-const uint8_t QAS_LCD_Fonts_SegoeUI12pt_Data[] = {
+constexpr uint8_t QAS_LCD_Fonts_SegoeUI12pt_Data[] = {
 	/* @0 '!' (1 pixels wide) */
 	0x00, //
 	0x00, //
@@ -1924,5 +1924,12 @@ const uint8_t QAS_LCD_Fonts_SegoeUI12pt_Data[] = {
 };
 
 
+//QAS_LCD_Fonts_SegoeUI12pt_Runs
+//Run table built from the above bitmap data at compile time. See QAS_LCD_FontRuns.hpp
+constexpr QAS_LCD_FontRunTable<QAS_LCD_FontRuns_rows(QAS_LCD_Fonts_SegoeUI12pt_Desc, QAS_LCD_Fonts_SegoeUI12pt_Data, QAS_LCD_Fonts_SegoeUI12pt_Height),
+                               QAS_LCD_FontRuns_spans(QAS_LCD_Fonts_SegoeUI12pt_Desc, QAS_LCD_Fonts_SegoeUI12pt_Data, QAS_LCD_Fonts_SegoeUI12pt_Height)>
+	QAS_LCD_Fonts_SegoeUI12pt_Runs(QAS_LCD_Fonts_SegoeUI12pt_Desc, QAS_LCD_Fonts_SegoeUI12pt_Data, QAS_LCD_Fonts_SegoeUI12pt_Height);
+
+
 //Prevent Recursive Inclusion
 #endif  /* __QAS_LCD_FONTS_SEGOEUI12PT_HPP_ */
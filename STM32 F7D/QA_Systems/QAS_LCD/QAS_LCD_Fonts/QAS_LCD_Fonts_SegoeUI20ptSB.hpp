@@ -21,7 +21,7 @@
 
 
 //Includes
-#include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_FontRuns.hpp"
 
 
   /*  --------------------------------  */
@@ -32,14 +32,14 @@
 
 
 //Font Data
-const uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_Height     = 27;
-const uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_SpaceWidth = 5;
-const uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_CharGap    = 3;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_Height     = 27;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_SpaceWidth = 5;
+constexpr uint16_t QAS_LCD_Fonts_SegoeUI20ptSB_CharGap    = 3;
 
 
 //--------------------------------
 //QAS_LCD_Fonts_SegoeUI20ptSB_Desc
-const QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI20ptSB_Desc[] = {
+constexpr QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI20ptSB_Desc[] = {
 	{5, 0}, 		/* ! */
 	{9, 27}, 		/* " */
 	{16, 81}, 		/* # */
@@ -138,7 +138,7 @@ const QAS_LCD_FontDesc QAS_LCD_Fonts_SegoeUI20ptSB_Desc[] = {
 
 
 //QAS_LCD_Fonts_SegoeUI20ptSB_Data
-const uint8_t QAS_LCD_Fonts_SegoeUI20ptSB_Data[] = {
+constexpr uint8_t QAS_LCD_Fonts_SegoeUI20ptSB_Data[] = {
 	/* @0 '!' (5 pixels wide) */
 	0x00, //
 	0x00, //
@@ -2867,5 +2867,12 @@ const uint8_t QAS_LCD_Fonts_SegoeUI20ptSB_Data[] = {
 };
 
 
+//QAS_LCD_Fonts_SegoeUI20ptSB_Runs
+//Run table built from the above bitmap data at compile time. See QAS_LCD_FontRuns.hpp
+constexpr QAS_LCD_FontRunTable<QAS_LCD_FontRuns_rows(QAS_LCD_Fonts_SegoeUI20ptSB_Desc, QAS_LCD_Fonts_SegoeUI20ptSB_Data, QAS_LCD_Fonts_SegoeUI20ptSB_Height),
+                               QAS_LCD_FontRuns_spans(QAS_LCD_Fonts_SegoeUI20ptSB_Desc, QAS_LCD_Fonts_SegoeUI20ptSB_Data, QAS_LCD_Fonts_SegoeUI20ptSB_Height)>
+	QAS_LCD_Fonts_SegoeUI20ptSB_Runs(QAS_LCD_Fonts_SegoeUI20ptSB_Desc, QAS_LCD_Fonts_SegoeUI20ptSB_Data, QAS_LCD_Fonts_SegoeUI20ptSB_Height);
+
+
 //Prevent Recursive Inclusion
 #endif /* __QAS_LCD_FONTS_SEGOEUI20PTSB_HPP_ */
@@ -21,7 +21,7 @@
 
 
 //Includes
-#include "QAS_LCD_Fonts.hpp"
+#include "QAS_LCD_FontRuns.hpp"
 
 
   /*  -----------------------------  */
@@ -32,12 +32,12 @@
 
 
 //Font Data
-const uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_Height     = 26;
-const uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_SpaceWidth = 2;
-const uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_CharGap    = 2;
+constexpr uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_Height     = 26;
+constexpr uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_SpaceWidth = 2;
+constexpr uint16_t QAS_LCD_Fonts_ShowcardGothic18pt_CharGap    = 2;
 
 
-const QAS_LCD_FontDesc QAS_LCD_Fonts_ShowcardGothic18pt_Desc[] =
+constexpr QAS_LCD_FontDesc QAS_LCD_Fonts_ShowcardGothic18pt_Desc[] =
 {
 	{6, 0}, 		/* ! */
 	{8, 28}, 		/* " */
@@ -136,7 +136,7 @@ const QAS_LCD_FontDesc QAS_LCD_Fonts_ShowcardGothic18pt_Desc[] =
 };
 
 
-const uint8_t QAS_LCD_Fonts_ShowcardGothic18pt_Data[] =
+constexpr uint8_t QAS_LCD_Fonts_ShowcardGothic18pt_Data[] =
 {
 	/* @0 '!' (6 pixels wide) */
 	0x00, //
@@ -2963,5 +2963,12 @@ const uint8_t QAS_LCD_Fonts_ShowcardGothic18pt_Data[] =
 
 
 
+//QAS_LCD_Fonts_ShowcardGothic18pt_Runs
+//Run table built from the above bitmap data at compile time. See QAS_LCD_FontRuns.hpp
+constexpr QAS_LCD_FontRunTable<QAS_LCD_FontRuns_rows(QAS_LCD_Fonts_ShowcardGothic18pt_Desc, QAS_LCD_Fonts_ShowcardGothic18pt_Data, QAS_LCD_Fonts_ShowcardGothic18pt_Height),
+                               QAS_LCD_FontRuns_spans(QAS_LCD_Fonts_ShowcardGothic18pt_Desc, QAS_LCD_Fonts_ShowcardGothic18pt_Data, QAS_LCD_Fonts_ShowcardGothic18pt_Height)>
+	QAS_LCD_Fonts_ShowcardGothic18pt_Runs(QAS_LCD_Fonts_ShowcardGothic18pt_Desc, QAS_LCD_Fonts_ShowcardGothic18pt_Data, QAS_LCD_Fonts_ShowcardGothic18pt_Height);
+
+
 //Prevent Recursive Inclusion
 #endif /* __QAS_LCD_FONTS_SHOWCARDGOTHIC18PT_HPP_ */
@@ -0,0 +1,132 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Frame Pacing                             */
+/*   Filename: QAS_LCD_FramePacer.cpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_FramePacer.hpp"
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+  //--------------------------------
+  //--------------------------------
+  //QAS_LCD_FramePacer Frame Methods
+
+//QAS_LCD_FramePacer::invalidate
+//QAS_LCD_FramePacer Frame Method
+//
+//Used to request that a frame is rendered, as the content of the LCD has changed
+//If a frame has already been requested and not yet started, the request is coalesced into that frame
+void QAS_LCD_FramePacer::invalidate(void) {
+	m_sStats.uRequests++;
+	if (m_bRequested)
+		m_sStats.uCoalesced++;
+	m_bRequested = true;
+}
+
+
+//QAS_LCD_FramePacer::begin
+//QAS_LCD_FramePacer Frame Method
+//
+//To be called on each pass of the processing loop
+//Used to determine whether a frame is to be rendered, being when a frame has been requested, no frame is being rendered, and neither
+//layer has a flipped frame waiting to be presented. Requests made after this returns true are rendered in the following frame
+//Returns true if a frame is to be rendered, in which case end() must be called once it has been flipped or skipped, or false if not
+bool QAS_LCD_FramePacer::begin(void) {
+	if (!m_bRequested || m_bRendering)
+		return false;
+
+	//Hold back frame until the previous frame has been presented, so that a free back-buffer is available without waiting
+	if (QAD_LTDC::isFlipPending(QAD_LTDC_Layer0) || QAD_LTDC::isFlipPending(QAD_LTDC_Layer1)) {
+		if (!m_bDeferred)
+			m_sStats.uDeferred++;
+		m_bDeferred = true;
+		return false;
+	}
+
+	m_uFrameVBlank = QAD_LTDC::getVBlankCount();
+	m_uFrameStart  = QAD_LTDC::getTime();
+	m_sStats.uIdleTotal += m_uFrameStart - m_uIdleStart;
+
+	m_bRequested = false;
+	m_bDeferred  = false;
+	m_bRendering = true;
+	return true;
+}
+
+
+//QAS_LCD_FramePacer::end
+//QAS_LCD_FramePacer Frame Method
+//
+//To be called once a frame started by begin() has been rendered and flipped, or has been skipped without being rendered
+//Used to record the render time of the frame, and whether the frame missed the vertical blanking period following its start, in
+//which case it will be presented a refresh later than it could have been
+//A skipped frame, such as a display list found by QAS_LCD::endDisplayList() to match the frame already being shown, is only counted
+//as skipped, with the time since the frame started being counted as idle time
+//Times are unsigned differences, so remain correct when QAD_LTDC::getTime() wraps around
+//bRendered - true if the frame was rendered and flipped, or false if it was skipped
+void QAS_LCD_FramePacer::end(bool bRendered) {
+	if (!m_bRendering)
+		return;
+	m_bRendering = false;
+
+	if (!bRendered) {
+		m_sStats.uSkipped++;
+		m_uIdleStart = m_uFrameStart;
+		return;
+	}
+
+	uint32_t uTime   = QAD_LTDC::getTime();
+	uint32_t uRender = uTime - m_uFrameStart;
+
+	m_sStats.uFrames++;
+	m_sStats.uRenderLast   = uRender;
+	m_sStats.uRenderTotal += uRender;
+	if (uRender > m_sStats.uRenderMax)
+		m_sStats.uRenderMax = uRender;
+	if (QAD_LTDC::getVBlankCount() != m_uFrameVBlank)
+		m_sStats.uMissed++;
+
+	m_uIdleStart = uTime;
+}
+
+
+  //--------------------------------------
+  //--------------------------------------
+  //QAS_LCD_FramePacer Frame Stats Methods
+
+//QAS_LCD_FramePacer::getStats
+//QAS_LCD_FramePacer Frame Stats Method
+//
+//Returns the frame counters, with the idle time including the time since the most recent frame ended
+QAS_LCD_FramePacerStats QAS_LCD_FramePacer::getStats(void) const {
+	QAS_LCD_FramePacerStats sStats = m_sStats;
+	if (!m_bRendering)
+		sStats.uIdleTotal += QAD_LTDC::getTime() - m_uIdleStart;
+	return sStats;
+}
+
+
+//QAS_LCD_FramePacer::resetStats
+//QAS_LCD_FramePacer Frame Stats Method
+//
+//Used to reset the frame counters to zero, with idle time being measured from now
+void QAS_LCD_FramePacer::resetStats(void) {
+	m_sStats     = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	m_uIdleStart = QAD_LTDC::getTime();
+}
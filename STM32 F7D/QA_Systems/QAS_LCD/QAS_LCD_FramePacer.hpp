@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Frame Pacing                             */
+/*   Filename: QAS_LCD_FramePacer.hpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_FRAMEPACER_HPP_
+#define __QAS_LCD_FRAMEPACER_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------------
+//QAS_LCD_FramePacerStats
+//
+//Structure used to report the frame counters of a QAS_LCD_FramePacer
+//Times are measured in LCD lines using QAD_LTDC::getTime(), so dividing by QAD_LTDC_FRAMELINES gives the time in frames
+//Render times only include frames that were rendered, and not those that were skipped
+typedef struct {
+	uint32_t uFrames;       //Number of frames rendered
+	uint32_t uSkipped;      //Number of frames that were started but skipped without being rendered, such as unchanged display lists
+	uint32_t uRequests;     //Number of times a frame was requested with invalidate()
+	uint32_t uCoalesced;    //Number of requests that were merged into a frame that had already been requested
+	uint32_t uDeferred;     //Number of frames that were held back as the previous frame had not yet been presented
+	uint32_t uMissed;       //Number of frames that were still rendering at the vertical blanking period following their start
+	uint32_t uRenderLast;   //Render time of the most recent frame
+	uint32_t uRenderMax;    //Largest render time of a frame
+	uint32_t uRenderTotal;  //Sum of the render times of all frames. Dividing by uFrames gives the average render time
+	uint32_t uIdleTotal;    //Time spent between frames, during which the processing loop is free for other tasks
+} QAS_LCD_FramePacerStats;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_LCD_FramePacer
+//
+//Class used to schedule the rendering of frames from a processing loop, in step with the refresh of the LCD
+//
+//Rather than rendering at a fixed rate, a frame is only rendered once its content has been invalidated with invalidate(). Any number
+//of invalidations made before the frame starts are coalesced into that single frame. Each pass of the processing loop calls begin(),
+//which returns true if a frame is to be rendered, in which case the frame is rendered and flipped and end() is then called. If the
+//frame turns out to be unchanged and is skipped, as with QAS_LCD::endDisplayList(), end(false) is called instead.
+//
+//A requested frame is held back while a previously flipped frame is still waiting to be presented, as rendering would otherwise stall
+//until the next vertical blanking period for a free back-buffer (see QAD_LTDC.hpp). The processing loop is therefore never blocked by
+//the LCD, and at most one frame is rendered per refresh. When nothing is invalidated no frames are rendered at all.
+class QAS_LCD_FramePacer {
+private:
+
+	bool     m_bRequested;   //Whether a frame has been requested since the previous frame started
+	bool     m_bDeferred;    //Whether the requested frame has been held back
+	bool     m_bRendering;   //Whether a frame is currently being rendered, between begin() and end()
+	uint32_t m_uFrameStart;  //Time that the current or most recent frame started
+	uint32_t m_uFrameVBlank; //Vertical blanking count when the current or most recent frame started
+	uint32_t m_uIdleStart;   //Time that the most recent frame ended, or that the counters were last reset
+
+	QAS_LCD_FramePacerStats m_sStats; //Frame counters
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. The first frame is requested straight away so that the initial content of the LCD is rendered
+	QAS_LCD_FramePacer() :
+		m_bRequested(true),
+		m_bDeferred(false),
+		m_bRendering(false),
+		m_uFrameStart(0),
+		m_uFrameVBlank(0) {
+		resetStats();
+	}
+
+
+	//NOTE: See QAS_LCD_FramePacer.cpp for details of the following methods
+
+	//-------------
+	//Frame Methods
+
+	void invalidate(void);
+	bool begin(void);
+	void end(bool bRendered = true);
+
+	//Returns whether a frame has been requested and not yet started
+	bool requested(void) const {
+		return m_bRequested;
+	}
+
+
+	//-------------------
+	//Frame Stats Methods
+
+	QAS_LCD_FramePacerStats getStats(void) const;
+	void resetStats(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_FRAMEPACER_HPP_ */
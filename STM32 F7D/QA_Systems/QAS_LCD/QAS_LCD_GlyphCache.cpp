@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Glyph Cache                              */
+/*   Filename: QAS_LCD_GlyphCache.cpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_GlyphCache.hpp"
+
+#include <string.h>
+
+
+	//-------------------------------------
+	//-------------------------------------
+	//QAS_LCD_GlyphCache Management Methods
+
+//QAS_LCD_GlyphCache::clear
+//QAS_LCD_GlyphCache Management Method
+//
+//Used to remove all glyphs from the cache. Must be called whenever fonts are removed from QAS_LCD_FontMgr, as font indexes may
+//then refer to different fonts. Hit and miss counters are not affected
+void QAS_LCD_GlyphCache::clear(void) {
+	for (uint8_t i=0; i<QAS_LCD_GLYPHCACHE_LENGTH; i++)
+		m_sEntries[i].bUsed = false;
+	memset(m_uIndex, QAS_LCD_GLYPHCACHE_NONE, sizeof(m_uIndex));
+	m_uClock = 0;
+}
+
+
+	//--------------------------------
+	//--------------------------------
+	//QAS_LCD_GlyphCache Cache Methods
+
+//QAS_LCD_GlyphCache::find
+//QAS_LCD_GlyphCache Cache Method
+//
+//Used to find the cached form of a glyph. If the glyph is not already cached then it is converted from the font's bitmap data into
+//the least recently used entry of the cache
+//uFont   - The index of the font within QAS_LCD_FontMgr
+//uChar   - The index of the character within the font, where 0 is '!'
+//pBitmap - Pointer to the first line of the glyph's bitmap data, one bit per pixel with the least significant bit first, and each
+//          line padded to a whole number of bytes
+//uWidth  - The width in pixels of the glyph
+//uHeight - The height in pixels of the glyph
+//Returns a pointer to the cached glyph, or NULL if the glyph cannot be cached, in which case it is to be rendered from its bitmap data
+const QAS_LCD_GlyphEntry* QAS_LCD_GlyphCache::find(uint8_t uFont, uint8_t uChar, const uint8_t* pBitmap, uint16_t uWidth, uint16_t uHeight) {
+	if ((uFont >= QAS_LCD_GLYPHCACHE_FONTS) || (uChar >= QAS_LCD_GLYPHCACHE_CHARS))
+		return NULL;
+
+	//Cache hit
+	uint8_t uIdx = m_uIndex[uFont][uChar];
+	if (uIdx != QAS_LCD_GLYPHCACHE_NONE) {
+		m_sEntries[uIdx].uLastUse = ++m_uClock;
+		m_uHits++;
+		return &m_sEntries[uIdx];
+	}
+
+	//Cache miss - Convert the glyph into the least recently used entry
+	m_uMisses++;
+	uIdx = evict();
+	QAS_LCD_GlyphEntry& sEntry = m_sEntries[uIdx];
+	if (!expand(sEntry, pBitmap, uWidth, uHeight))
+		return NULL;
+
+	sEntry.uFont    = uFont;
+	sEntry.uChar    = uChar;
+	sEntry.uLastUse = ++m_uClock;
+	sEntry.bUsed    = true;
+	m_uIndex[uFont][uChar] = uIdx;
+	return &sEntry;
+}
+
+
+	//----------------------------------
+	//----------------------------------
+	//QAS_LCD_GlyphCache Private Methods
+
+//QAS_LCD_GlyphCache::evict
+//QAS_LCD_GlyphCache Private Method
+//
+//Used to free the entry to be used for a new glyph. This is either an unused entry, or the least recently used entry, in which case
+//the glyph it holds is removed from the look-up table
+//Returns the index of the freed entry
+uint8_t QAS_LCD_GlyphCache::evict(void) {
+	uint8_t  uIdx    = 0;
+	uint32_t uOldest = 0xFFFFFFFF;
+	for (uint8_t i=0; i<QAS_LCD_GLYPHCACHE_LENGTH; i++) {
+		if (!m_sEntries[i].bUsed)
+			return i;
+		if (m_sEntries[i].uLastUse < uOldest) {
+			uOldest = m_sEntries[i].uLastUse;
+			uIdx    = i;
+		}
+	}
+
+	QAS_LCD_GlyphEntry& sEntry = m_sEntries[uIdx];
+	m_uIndex[sEntry.uFont][sEntry.uChar] = QAS_LCD_GLYPHCACHE_NONE;
+	sEntry.bUsed = false;
+	return uIdx;
+}
+
+
+//QAS_LCD_GlyphCache::expand
+//QAS_LCD_GlyphCache Private Method
+//
+//Used to convert a glyph's bitmap data into span counts and spans, stored in an entry
+//sEntry  - The entry to store the glyph in
+//pBitmap - Pointer to the first line of the glyph's bitmap data
+//uWidth  - The width in pixels of the glyph
+//uHeight - The height in pixels of the glyph
+//Returns true if the glyph was stored, or false if it does not fit in the entry
+bool QAS_LCD_GlyphCache::expand(QAS_LCD_GlyphEntry& sEntry, const uint8_t* pBitmap, uint16_t uWidth, uint16_t uHeight) {
+	if ((uHeight > QAS_LCD_GLYPHCACHE_SLOTSIZE) || (uWidth > 255))
+		return false;
+
+	uint16_t uStride = (uWidth + 7) >> 3;
+	uint16_t uSize   = uHeight;
+	QAS_LCD_GlyphSpan* pSpan = (QAS_LCD_GlyphSpan*)&sEntry.uData[uHeight];
+
+	for (uint16_t y=0; y<uHeight; y++) {
+		const uint8_t* pLine = &pBitmap[y * uStride];
+		uint8_t uSpans = 0;
+		uint16_t x = 0;
+
+		while (x < uWidth) {
+			//Skip clear pixels
+			while ((x < uWidth) && !(pLine[x >> 3] & (1 << (x & 0x07))))
+				x++;
+			if (x >= uWidth)
+				break;
+
+			//Measure run of set pixels
+			uint16_t uStart = x;
+			while ((x < uWidth) && (pLine[x >> 3] & (1 << (x & 0x07))))
+				x++;
+
+			uSize += sizeof(QAS_LCD_GlyphSpan);
+			if (uSize > QAS_LCD_GLYPHCACHE_SLOTSIZE)
+				return false;
+			pSpan->uX      = (uint8_t)uStart;
+			pSpan->uLength = (uint8_t)(x - uStart);
+			pSpan++;
+			uSpans++;
+		}
+
+		sEntry.uData[y] = uSpans;
+	}
+
+	sEntry.uHeight = (uint8_t)uHeight;
+	return true;
+}
+
@@ -0,0 +1,181 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Glyph Cache                              */
+/*   Filename: QAS_LCD_GlyphCache.hpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_GLYPHCACHE_HPP_
+#define __QAS_LCD_GLYPHCACHE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------------
+//QAS_LCD_GLYPHCACHE_LENGTH
+//
+//Used to determine the number of glyphs that can be held in the glyph cache at the same time. Must be less than 255
+//Each entry uses QAS_LCD_GLYPHCACHE_SLOTSIZE + 8 bytes of internal RAM
+#define QAS_LCD_GLYPHCACHE_LENGTH    ((uint8_t)192)
+
+
+//----------------------------
+//QAS_LCD_GLYPHCACHE_SLOTSIZE
+//
+//Used to determine the size in bytes of the span list that can be stored for each glyph. A glyph requires one byte per line of the
+//font plus two bytes per span. Glyphs that do not fit are rendered directly from the font's bitmap data instead.
+//The default fits every glyph of the fonts included in QAS_LCD_Fonts, the largest of which requires 141 bytes
+#define QAS_LCD_GLYPHCACHE_SLOTSIZE  ((uint16_t)160)
+
+
+//-------------------------
+//QAS_LCD_GLYPHCACHE_FONTS
+//
+//Used to determine the number of fonts, starting from font index 0, that glyphs are cached for
+//This allows for fonts loaded from font files (see QAS_LCD_FontFile.hpp) as well as those compiled into the firmware. Each font
+//adds QAS_LCD_GLYPHCACHE_CHARS bytes to the look-up table
+#define QAS_LCD_GLYPHCACHE_FONTS     ((uint8_t)32)
+
+
+//-------------------------
+//QAS_LCD_GLYPHCACHE_CHARS
+//
+//Number of characters of each font that can be cached, being the printable characters from '!' (33) to '~' (126)
+#define QAS_LCD_GLYPHCACHE_CHARS     ((uint8_t)94)
+
+
+//------------------------
+//QAS_LCD_GLYPHCACHE_NONE
+//
+//Index used to indicate that a glyph is not held in the cache
+#define QAS_LCD_GLYPHCACHE_NONE      ((uint8_t)0xFF)
+
+
+//-----------------
+//QAS_LCD_GlyphSpan
+//
+//Structure used to store a single horizontal run of set pixels within a line of a glyph
+typedef struct {
+	uint8_t uX;       //Offset in pixels of the first pixel of the run from the left-hand edge of the glyph
+	uint8_t uLength;  //Number of pixels in the run
+} QAS_LCD_GlyphSpan;
+
+
+//------------------
+//QAS_LCD_GlyphEntry
+//
+//Structure used to store a single glyph held in the glyph cache
+//uData starts with the number of spans in each line of the glyph, one byte per line, followed by the QAS_LCD_GlyphSpan structures of
+//every line in order from the top of the glyph
+typedef struct {
+	uint32_t uLastUse;  //Value of the cache's use counter when the glyph was last used, for least recently used eviction
+	uint8_t  uFont;     //Index of the font the glyph belongs to
+	uint8_t  uChar;     //Index of the character within the font, where 0 is '!'
+	uint8_t  uHeight;   //Number of lines in the glyph
+	bool     bUsed;     //Whether the entry currently holds a glyph
+	uint8_t  uData[QAS_LCD_GLYPHCACHE_SLOTSIZE];  //Span counts and spans
+} QAS_LCD_GlyphEntry;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_LCD_GlyphCache
+//
+//Class used by QAS_LCD_FontMgr to hold recently used glyphs in a form that is ready to render
+//
+//Font bitmap data stores one bit per pixel, which would otherwise have to be unpacked and tested pixel by pixel every time a character
+//is drawn. Each cached glyph is instead stored as a list of the runs of set pixels on each line, so that drawing the glyph is a
+//single span fill per run, performed by the word-wide span kernels of the render target.
+//
+//Glyphs are found through a direct look-up table indexed by font and character, so a cache hit costs a single table read. When the
+//cache is full, the least recently used glyph is evicted to make room. The cache is a member of the QAS_LCD singleton, so is held
+//in internal RAM rather than in SDRAM.
+class QAS_LCD_GlyphCache {
+private:
+
+	QAS_LCD_GlyphEntry m_sEntries[QAS_LCD_GLYPHCACHE_LENGTH];                        //Cached glyphs
+	uint8_t            m_uIndex[QAS_LCD_GLYPHCACHE_FONTS][QAS_LCD_GLYPHCACHE_CHARS]; //Index of the entry holding each glyph, or QAS_LCD_GLYPHCACHE_NONE
+	uint32_t           m_uClock;   //Use counter, incremented each time a glyph is looked up
+	uint32_t           m_uHits;    //Number of look-ups that found the glyph in the cache
+	uint32_t           m_uMisses;  //Number of look-ups that did not find the glyph in the cache
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty cache
+	QAS_LCD_GlyphCache() {
+		clear();
+		resetStats();
+	}
+
+
+	//NOTE: See QAS_LCD_GlyphCache.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	void clear(void);
+
+	//Used to reset the hit and miss counters to zero
+	void resetStats(void) {
+		m_uHits   = 0;
+		m_uMisses = 0;
+	}
+
+
+	//-------------
+	//Cache Methods
+
+	const QAS_LCD_GlyphEntry* find(uint8_t uFont, uint8_t uChar, const uint8_t* pBitmap, uint16_t uWidth, uint16_t uHeight);
+
+
+	//------------
+	//Data Methods
+
+	//Returns the number of look-ups that found the glyph in the cache since the counters were last reset
+	uint32_t hits(void) const {
+		return m_uHits;
+	}
+
+	//Returns the number of look-ups that did not find the glyph in the cache since the counters were last reset
+	uint32_t misses(void) const {
+		return m_uMisses;
+	}
+
+private:
+
+	//---------------
+	//Private Methods
+
+	uint8_t evict(void);
+	bool expand(QAS_LCD_GlyphEntry& sEntry, const uint8_t* pBitmap, uint16_t uWidth, uint16_t uHeight);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_GLYPHCACHE_HPP_ */
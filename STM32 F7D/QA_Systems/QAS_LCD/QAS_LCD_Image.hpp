@@ -0,0 +1,119 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Images                                   */
+/*   Filename: QAS_LCD_Image.hpp                                           */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_IMAGE_HPP_
+#define __QAS_LCD_IMAGE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Rect.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------
+//QAS_LCD_BlitMode
+//
+//Used to select how the pixels of an image are drawn by QAS_LCD's image rendering methods
+enum QAS_LCD_BlitMode : uint8_t {
+	QAS_LCD_Blit_Opaque = 0,  //All pixels of the image are copied
+	QAS_LCD_Blit_ColorKey,    //Pixels matching the image's color key are skipped, and all other pixels are copied
+	QAS_LCD_Blit_Alpha        //Pixels are blended using their own alpha (see QAS_LCD_Blend.hpp)
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------
+//QAS_LCD_Image
+//
+//Class used to describe an ARGB4444 image that is stored in memory, so that it can be drawn by QAS_LCD's image rendering methods
+//
+//Images are read directly from wherever they are stored, with no intermediate copy. This is intended for images stored in the
+//QuadSPI flash while it is in memory-mapped mode (see QAD_QuadSPI::enterMemoryMapped()), where the base address is
+//QAD_QuadSPI::getMemoryMappedBaseAddress() and the offset is the flash address the image was programmed to, but images can
+//equally be stored in SDRAM or internal RAM. The base address can also be a plain byte array, such as a copy of the flash
+//contents, which allows images to be used without the QuadSPI peripheral.
+//
+//The image descriptor is copied into display lists, but the pixel data is not. As a result, a display list that draws an image
+//whose pixels have changed, but which is otherwise unchanged, will be skipped (see QAS_LCD Display List Methods).
+class QAS_LCD_Image {
+public:
+
+	const uint16_t* m_pPixels;    //Pointer to the upper-left pixel of the image
+	uint16_t        m_uWidth;     //Width of the image in pixels
+	uint16_t        m_uHeight;    //Height of the image in pixels
+	uint16_t        m_uStride;    //The number of pixels between the start of each line of the image
+	uint16_t        m_uColorKey;  //Color of pixels to be skipped by QAS_LCD_Blit_ColorKey
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty image
+	QAS_LCD_Image() :
+		m_pPixels(NULL),
+		m_uWidth(0),
+		m_uHeight(0),
+		m_uStride(0),
+		m_uColorKey(0x0000) {}
+
+	//Constructor used to set image details
+	//pBase     - Base address of the memory the image is stored in, such as the QuadSPI memory-mapped address
+	//uOffset   - Offset in bytes of the upper-left pixel from the base address. Must be a multiple of 2
+	//uWidth    - Width of the image in pixels
+	//uHeight   - Height of the image in pixels
+	//uStride   - The number of pixels between the start of each line, or 0 if lines are stored contiguously
+	//uColorKey - Color of pixels to be skipped by QAS_LCD_Blit_ColorKey
+	QAS_LCD_Image(const void* pBase, uint32_t uOffset, uint16_t uWidth, uint16_t uHeight, uint16_t uStride = 0, uint16_t uColorKey = 0x0000) :
+		m_pPixels((const uint16_t*)((const uint8_t*)pBase + uOffset)),
+		m_uWidth(uWidth),
+		m_uHeight(uHeight),
+		m_uStride(uStride ? uStride : uWidth),
+		m_uColorKey(uColorKey) {}
+
+
+	//------------
+	//Data Methods
+
+	//Returns a pointer to the pixel at the given image coordinates
+	//Coordinates must be within the image
+	const uint16_t* pixel(int16_t x, int16_t y) const {
+		return &m_pPixels[x + (y * m_uStride)];
+	}
+
+	//Returns the portion of a source rectangle that lies within the image
+	//cRect - The source rectangle, in image coordinates
+	QAT_Rect_16 source(const QAT_Rect_16& cRect) const {
+		return cRect.intersect(QAT_Rect_16(0, 0, m_uWidth-1, m_uHeight-1));
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_IMAGE_HPP_ */
@@ -0,0 +1,152 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Run-Length Encoded Images                */
+/*   Filename: QAS_LCD_RLE.cpp                                             */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_RLE.hpp"
+
+#include <string.h>
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_RLE Encode Methods
+
+//QAS_LCD_RLE::encode
+//QAS_LCD_RLE Encode Method
+//
+//Used to encode an ARGB4444 image, including its header and row table
+//The encoder does not depend on any peripherals, so can be built into host-side tools as well as the firmware
+//pPixels  - Pointer to the upper-left pixel of the image
+//uWidth   - Width of the image in pixels
+//uHeight  - Height of the image in pixels
+//uStride  - The number of pixels between the start of each line of the image, or 0 if lines are stored contiguously
+//pOut     - Pointer to the buffer the encoded image is to be stored into, or NULL to only measure the size of the encoded image
+//uMaxSize - The size in bytes of the buffer
+//Returns the size in bytes of the encoded image, or 0 if it does not fit within the buffer
+uint32_t QAS_LCD_RLE::encode(const uint16_t* pPixels, uint16_t uWidth, uint16_t uHeight, uint16_t uStride, uint8_t* pOut, uint32_t uMaxSize) {
+	if (!uStride)
+		uStride = uWidth;
+
+	//Measure the encoded size of each row, so that the buffer size can be checked before anything is written
+	uint32_t uSize = sizeof(QAS_LCD_RLEHeader) + (uHeight * sizeof(uint32_t));
+	for (uint16_t y=0; y<uHeight; y++)
+		uSize += encodeRow(&pPixels[y * uStride], uWidth, NULL) * sizeof(uint16_t);
+
+	if (!pOut)
+		return uSize;
+	if (uSize > uMaxSize)
+		return 0;
+
+	//Write header
+	QAS_LCD_RLEHeader sHeader = {QAS_LCD_RLE_MAGIC, uWidth, uHeight, uSize};
+	memcpy(pOut, &sHeader, sizeof(sHeader));
+
+	//Write row table and rows
+	uint32_t uOffset = sizeof(QAS_LCD_RLEHeader) + (uHeight * sizeof(uint32_t));
+	for (uint16_t y=0; y<uHeight; y++) {
+		memcpy(&pOut[sizeof(QAS_LCD_RLEHeader) + (y * sizeof(uint32_t))], &uOffset, sizeof(uOffset));
+		uOffset += encodeRow(&pPixels[y * uStride], uWidth, (uint16_t*)&pOut[uOffset]) * sizeof(uint16_t);
+	}
+
+	return uSize;
+}
+
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_RLE Private Methods
+
+//QAS_LCD_RLE::encodeRow
+//QAS_LCD_RLE Private Method
+//
+//Used to encode a single row of an image
+//Pixels with an alpha of 0 form skip runs regardless of their color. Runs of three or more identical pixels form fill runs, as do
+//runs of two identical pixels that do not interrupt a literal run, and all remaining pixels are gathered into literal runs
+//pPixels - Pointer to the first pixel of the row
+//uWidth  - Width of the row in pixels
+//pOut    - Pointer to where the encoded row is to be stored, or NULL to only measure the size of the encoded row
+//Returns the size of the encoded row in 16bit words
+uint32_t QAS_LCD_RLE::encodeRow(const uint16_t* pPixels, uint16_t uWidth, uint16_t* pOut) {
+	uint32_t uIdx     = 0;
+	uint16_t uLitX    = 0;
+	uint16_t uLitLen  = 0;
+	uint16_t x        = 0;
+
+	while (x < uWidth) {
+		uint16_t uColor = pPixels[x];
+		bool     bClear = !(uColor & 0xF000);
+
+		//Measure run of transparent or identical pixels starting at this pixel
+		uint16_t uLen = 1;
+		while (((x + uLen) < uWidth) && (uLen < QAS_LCD_RLE_MAXRUN) &&
+				   (bClear ? !(pPixels[x + uLen] & 0xF000) : (pPixels[x + uLen] == uColor)))
+			uLen++;
+
+		if (bClear || (uLen >= 3) || ((uLen == 2) && !uLitLen)) {
+
+			//Finish any pending literal run, then store the run
+			if (uLitLen) {
+				uIdx    = emit(pOut, uIdx, QAS_LCD_RLE_LITERAL, &pPixels[uLitX], uLitLen);
+				uLitLen = 0;
+			}
+			uIdx = emit(pOut, uIdx, bClear ? QAS_LCD_RLE_SKIP : QAS_LCD_RLE_FILL, &pPixels[x], uLen);
+			x   += uLen;
+		} else {
+
+			//Add pixel to the pending literal run
+			if (!uLitLen)
+				uLitX = x;
+			uLitLen++;
+			x++;
+
+			if (uLitLen == QAS_LCD_RLE_MAXRUN) {
+				uIdx    = emit(pOut, uIdx, QAS_LCD_RLE_LITERAL, &pPixels[uLitX], uLitLen);
+				uLitLen = 0;
+			}
+		}
+	}
+
+	if (uLitLen)
+		uIdx = emit(pOut, uIdx, QAS_LCD_RLE_LITERAL, &pPixels[uLitX], uLitLen);
+	return uIdx;
+}
+
+
+//QAS_LCD_RLE::emit
+//QAS_LCD_RLE Private Method
+//
+//Used to store a single run
+//pOut   - Pointer to where the encoded row is being stored, or NULL if the row is only being measured
+//uIdx   - Index of the 16bit word the run is to be stored at
+//uToken - The type of the run (QAS_LCD_RLE_SKIP, QAS_LCD_RLE_FILL or QAS_LCD_RLE_LITERAL)
+//pData  - Pointer to the first pixel of the run
+//uCount - The number of pixels in the run
+//Returns the index of the 16bit word following the run
+uint32_t QAS_LCD_RLE::emit(uint16_t* pOut, uint32_t uIdx, uint16_t uToken, const uint16_t* pData, uint16_t uCount) {
+	uint16_t uData = (uToken == QAS_LCD_RLE_SKIP) ? 0 : ((uToken == QAS_LCD_RLE_FILL) ? 1 : uCount);
+
+	if (pOut) {
+		pOut[uIdx] = uToken | uCount;
+		memcpy(&pOut[uIdx + 1], pData, uData * sizeof(uint16_t));
+	}
+	return uIdx + 1 + uData;
+}
@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Run-Length Encoded Images                */
+/*   Filename: QAS_LCD_RLE.hpp                                             */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_RLE_HPP_
+#define __QAS_LCD_RLE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAS_LCD_Blend.hpp"
+#include "QAS_LCD_Raster.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------------
+//QAS_LCD_RLE_MAGIC
+//
+//Value stored at the start of every run-length encoded image. Reads as "QRLE" when viewed as bytes
+#define QAS_LCD_RLE_MAGIC     ((uint32_t)0x454C5251)
+
+
+//-------------------
+//QAS_LCD_RLE Tokens
+//
+//Each run of an encoded row starts with a 16bit token. The upper 2 bits hold the type of the run, and the lower 14 bits hold
+//the number of pixels in the run (1 to QAS_LCD_RLE_MAXRUN)
+#define QAS_LCD_RLE_SKIP      ((uint16_t)0x0000)  //Run of transparent pixels. No data follows
+#define QAS_LCD_RLE_FILL      ((uint16_t)0x4000)  //Run of a single color. Followed by one 16bit color
+#define QAS_LCD_RLE_LITERAL   ((uint16_t)0x8000)  //Run of differing colors. Followed by one 16bit color per pixel
+#define QAS_LCD_RLE_TYPEMASK  ((uint16_t)0xC000)
+#define QAS_LCD_RLE_MAXRUN    ((uint16_t)0x3FFF)
+
+
+//-----------------
+//QAS_LCD_RLEHeader
+//
+//Structure stored at the start of every run-length encoded image
+//
+//The header is followed by a table of 32bit offsets, one per row, giving the byte offset of each row's runs from the start of
+//the header. The runs of each row then follow, with the pixel counts of each row's runs adding up to the width of the image.
+//The row table allows rows above a clip rectangle or tile to be skipped without decoding them.
+typedef struct {
+	uint32_t uMagic;   //QAS_LCD_RLE_MAGIC
+	uint16_t uWidth;   //Width of the image in pixels
+	uint16_t uHeight;  //Height of the image in pixels
+	uint32_t uSize;    //Total size of the encoded image in bytes, including the header and row table
+} QAS_LCD_RLEHeader;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------
+//QAS_LCD_RLEImage
+//
+//Class used to describe a run-length encoded ARGB4444 image that is stored in memory
+//
+//As with QAS_LCD_Image, encoded images are read directly from wherever they are stored, such as the memory-mapped QuadSPI flash
+//or a plain byte array on a host build. Encoded images must start on a 32bit boundary.
+//
+//As encoded images are usually read from external storage, their contents are not trusted. valid() checks that the header and
+//row table lie within the size of the image, and QAS_LCD_RLE::drawRow() stops decoding a row at the first run that is malformed.
+class QAS_LCD_RLEImage {
+public:
+
+	const QAS_LCD_RLEHeader* m_pHeader;  //Pointer to the header of the encoded image
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty image
+	QAS_LCD_RLEImage() :
+		m_pHeader(NULL) {}
+
+	//Constructor used to set image details
+	//pBase   - Base address of the memory the image is stored in, such as the QuadSPI memory-mapped address
+	//uOffset - Offset in bytes of the image's header from the base address. Must be a multiple of 4
+	QAS_LCD_RLEImage(const void* pBase, uint32_t uOffset) :
+		m_pHeader((const QAS_LCD_RLEHeader*)((const uint8_t*)pBase + uOffset)) {}
+
+
+	//------------
+	//Data Methods
+
+	//Returns true if the image has a valid header, its size covers the header and row table, and every row starts within the image
+	bool valid(void) const {
+		if (!hasHeader())
+			return false;
+
+		uint32_t uTable = sizeof(QAS_LCD_RLEHeader) + (m_pHeader->uHeight * sizeof(uint32_t));
+		if (m_pHeader->uSize < uTable)
+			return false;
+
+		const uint32_t* pTable = (const uint32_t*)(m_pHeader + 1);
+		for (uint16_t y=0; y<m_pHeader->uHeight; y++) {
+			if ((pTable[y] < uTable) || (pTable[y] >= m_pHeader->uSize) || (pTable[y] & 1))
+				return false;
+		}
+		return true;
+	}
+
+	//Returns the width of the image in pixels, or 0 if the image has no header
+	uint16_t width(void) const {
+		return hasHeader() ? m_pHeader->uWidth : 0;
+	}
+
+	//Returns the height of the image in pixels, or 0 if the image has no header
+	uint16_t height(void) const {
+		return hasHeader() ? m_pHeader->uHeight : 0;
+	}
+
+	//Returns a pointer to the end of the encoded image, being the first byte following it
+	//The image must be valid
+	const uint16_t* end(void) const {
+		return (const uint16_t*)((const uint8_t*)m_pHeader + (m_pHeader->uSize & ~1));
+	}
+
+	//Returns a pointer to the first token of a row
+	//y - The row. Must be within the image
+	const uint16_t* row(uint16_t y) const {
+		const uint32_t* pTable = (const uint32_t*)(m_pHeader + 1);
+		return (const uint16_t*)((const uint8_t*)m_pHeader + pTable[y]);
+	}
+
+private:
+
+	//Returns true if the image has a header, without checking the row table
+	bool hasHeader(void) const {
+		return (m_pHeader && (m_pHeader->uMagic == QAS_LCD_RLE_MAGIC));
+	}
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------
+//QAS_LCD_RLE
+//
+//Static class providing the run-length encoder and decoder for QAS_LCD_RLEImage
+//
+//The format is tuned for user interface artwork, which mostly consists of areas of flat color separated by transparent gaps.
+//Fully transparent pixels are stored as skip runs, which cost a single token and are never written to the frame buffer.
+//Runs of three or more identical pixels are stored as fill runs, which are decoded directly into the fill kernels of the target
+//(see QAS_LCD_Raster.hpp), and all other pixels are stored as literal runs, which are decoded directly into its copy kernels.
+//No intermediate buffer is required for either encoding or decoding.
+class QAS_LCD_RLE {
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_RLE() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAS_LCD_RLE.cpp for details of the following methods
+
+	//--------------
+	//Encode Methods
+
+	static uint32_t encode(const uint16_t* pPixels, uint16_t uWidth, uint16_t uHeight, uint16_t uStride, uint8_t* pOut, uint32_t uMaxSize);
+
+
+	//--------------
+	//Decode Methods
+
+	//Decodes part of an encoded row directly into a line of a frame buffer, and returns the number of frame buffer pixels written
+	//Skip runs are stepped over without touching the frame buffer, fill runs are written using the fill kernel of cRaster, and
+	//literal runs are copied from the encoded image using its copy kernel, blending if a blend mode is given
+	//Decoding stops at the first malformed run, being one with no pixels or an unknown type, one extending past the width of the
+	//image, or one whose data extends past the end of the image, leaving the rest of the row undrawn
+	//cRaster - The kernels for the pixel format of the frame buffer (see QAS_LCD_Raster.hpp and QAS_LCD_Target::raster())
+	//cImage  - The encoded image. Must be valid (see QAS_LCD_RLEImage::valid())
+	//y       - The row of the image. Must be within the image
+	//pDst    - Pointer to the frame buffer pixel that the first pixel to be drawn is to be written to
+	//uFirst  - The column of the image of the first pixel to be drawn
+	//uCount  - The number of pixels to be drawn
+	//eMode   - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+	template <class Raster>
+	static uint32_t drawRow(Raster cRaster, const QAS_LCD_RLEImage& cImage, uint16_t y, void* pDst, uint16_t uFirst, uint16_t uCount,
+			                    QAS_LCD_BlendMode eMode) {
+		const uint16_t* pRun     = cImage.row(y);
+		const uint16_t* pEnd     = cImage.end();
+		uint32_t        uWidth   = cImage.width();
+		uint32_t        uEnd     = uFirst + uCount;
+		uint32_t        uX       = 0;
+		uint32_t        uWritten = 0;
+
+		while ((uX < uEnd) && (pRun < pEnd)) {
+			uint16_t uToken = *pRun;
+			uint16_t uType  = uToken & QAS_LCD_RLE_TYPEMASK;
+			uint32_t uLen   = uToken & QAS_LCD_RLE_MAXRUN;
+
+			//Find the number of data values following the token, and stop at a malformed run
+			uint32_t uData = (uType == QAS_LCD_RLE_SKIP) ? 0 : ((uType == QAS_LCD_RLE_FILL) ? 1 : uLen);
+			if (!uLen || (uType == QAS_LCD_RLE_TYPEMASK) || ((uX + uLen) > uWidth) || (uData >= (uint32_t)(pEnd - pRun)))
+				break;
+
+			//Determine the part of the run that lies within the pixels to be drawn
+			uint32_t uLo = (uX > uFirst) ? uX : uFirst;
+			uint32_t uHi = ((uX + uLen) < uEnd) ? (uX + uLen) : uEnd;
+
+			if ((uType != QAS_LCD_RLE_SKIP) && (uLo < uHi)) {
+				uint8_t*  pOut = (uint8_t*)pDst + ((uLo - uFirst) * Raster::Bytes);
+				uint32_t  uNum = uHi - uLo;
+
+				if (uType == QAS_LCD_RLE_FILL)
+					cRaster.fill(pOut, uNum, pRun[1], eMode); else
+					cRaster.copy(pOut, &pRun[1 + (uLo - uX)], uNum, eMode);
+				uWritten += uNum;
+			}
+
+			//Advance to the next run
+			pRun += 1 + uData;
+			uX   += uLen;
+		}
+
+		return uWritten;
+	}
+
+private:
+
+	//---------------
+	//Private Methods
+
+	static uint32_t encodeRow(const uint16_t* pPixels, uint16_t uWidth, uint16_t* pOut);
+	static uint32_t emit(uint16_t* pOut, uint32_t uIdx, uint16_t uToken, const uint16_t* pData, uint16_t uCount);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_RLE_HPP_ */
@@ -0,0 +1,125 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - RLE Image Packer (Desktop Host)          */
+/*   Filename: QAS_LCD_RLEPack_Host.cpp                                    */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_RLE.hpp"
+
+//The RLE image packer is a desktop host tool, which is only built when both QA_HOST and QA_RLEPACK are defined, being built as the
+//rlepack target of QA_Host/CMakeLists.txt
+//
+//It run-length encodes an image of raw ARGB4444 pixels, stored as 16bit little-endian values one row after another, into an
+//encoded image (see QAS_LCD_RLE.hpp):
+//
+//  rlepack <raw file> <width> <height> <rle file>
+//
+//The encoded image can then be programmed into QuadSPI flash at any 4 byte aligned address and drawn using a QAS_LCD_RLEImage once
+//memory-mapped mode is entered.
+#if defined(QA_HOST) && defined(QA_RLEPACK)
+
+#include <stdio.h>
+#include <stdlib.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//QAS_LCD_RLEPack_read
+//RLE Image Packer Function
+//
+//Used to read the whole of a file into a newly allocated buffer, which is to be freed by the caller
+//strFilename - Name of the file
+//uSize       - The size in bytes of the file
+//Returns a pointer to the buffer, or NULL if the file could not be read
+static uint8_t* QAS_LCD_RLEPack_read(const char* strFilename, uint32_t& uSize) {
+	FILE* pFile = fopen(strFilename, "rb");
+	if (pFile == NULL)
+		return NULL;
+
+	fseek(pFile, 0, SEEK_END);
+	uSize = ftell(pFile);
+	fseek(pFile, 0, SEEK_SET);
+
+	uint8_t* pData = (uint8_t*)malloc(uSize ? uSize : 1);
+	if ((pData != NULL) && (fread(pData, 1, uSize, pFile) != uSize)) {
+		free(pData);
+		pData = NULL;
+	}
+	fclose(pFile);
+	return pData;
+}
+
+
+//main
+//RLE Image Packer Entry Point
+int main(int argc, char* argv[]) {
+	if (argc != 5) {
+		fprintf(stderr, "usage: rlepack <raw file> <width> <height> <rle file>\n");
+		return 1;
+	}
+
+	long iWidth  = strtol(argv[2], NULL, 0);
+	long iHeight = strtol(argv[3], NULL, 0);
+	if ((iWidth < 1) || (iHeight < 1) || (iWidth > 0xFFFF) || (iHeight > 0xFFFF)) {
+		fprintf(stderr, "rlepack: invalid size %sx%s\n", argv[2], argv[3]);
+		return 1;
+	}
+
+	//Read pixels
+	uint32_t uRawSize = 0;
+	uint8_t* pRaw     = QAS_LCD_RLEPack_read(argv[1], uRawSize);
+	if (pRaw == NULL) {
+		fprintf(stderr, "rlepack: unable to read %s\n", argv[1]);
+		return 1;
+	}
+	if (uRawSize != ((uint32_t)iWidth * iHeight * sizeof(uint16_t))) {
+		fprintf(stderr, "rlepack: %s is %u bytes, expected %lu for %ldx%ld ARGB4444 pixels\n", argv[1], uRawSize,
+				    iWidth * iHeight * sizeof(uint16_t), iWidth, iHeight);
+		free(pRaw);
+		return 1;
+	}
+
+	//Encode, measuring the encoded size first so that the output buffer can be allocated
+	const uint16_t* pPixels = (const uint16_t*)pRaw;
+	uint32_t        uSize   = QAS_LCD_RLE::encode(pPixels, iWidth, iHeight, 0, NULL, 0);
+	uint32_t*       pOut    = (uint32_t*)malloc(uSize);
+	if ((pOut == NULL) || (QAS_LCD_RLE::encode(pPixels, iWidth, iHeight, 0, (uint8_t*)pOut, uSize) != uSize)) {
+		fprintf(stderr, "rlepack: unable to encode %s\n", argv[1]);
+		free(pRaw);
+		free(pOut);
+		return 1;
+	}
+	free(pRaw);
+
+	//Write encoded image
+	FILE* pFile = fopen(argv[4], "wb");
+	if ((pFile == NULL) || (fwrite(pOut, 1, uSize, pFile) != uSize)) {
+		fprintf(stderr, "rlepack: unable to write %s\n", argv[4]);
+		if (pFile)
+			fclose(pFile);
+		free(pOut);
+		return 1;
+	}
+	fclose(pFile);
+	free(pOut);
+
+	printf("rlepack: %s, %ldx%ld px, %u bytes raw, %u bytes encoded\n", argv[4], iWidth, iHeight, uRawSize, uSize);
+	return 0;
+}
+
+#endif /* QA_HOST && QA_RLEPACK */
@@ -0,0 +1,260 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Pixel Format Rasterizers                 */
+/*   Filename: QAS_LCD_Raster.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Raster.hpp"
+
+#include <string.h>
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+	//---------------------------------------------
+	//---------------------------------------------
+	//QAS_LCD_RasterFormat<ARGB4444> Kernel Methods
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::fill
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to fill a horizontal span using QAS_LCD_Span::fill(), or QAS_LCD_Blend::fill() if a blend mode is given
+//pDst   - Pointer to the first pixel of the span
+//uCount - The number of pixels in the span
+//uColor - The color to fill the span with
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+	if (eMode)
+		QAS_LCD_Blend::fill((uint16_t*)pDst, uCount, uColor, eMode); else
+		QAS_LCD_Span::fill((uint16_t*)pDst, uCount, uColor);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::fillRect
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to fill a rectangle using QAS_LCD_Span::fillRect(), or QAS_LCD_Blend::fillRect() if a blend mode is given
+//pDst    - Pointer to the upper-left pixel of the rectangle
+//uStride - The number of pixels between the start of each line
+//uWidth  - The width in pixels of the rectangle
+//uHeight - The height in pixels of the rectangle
+//uColor  - The color to fill the rectangle with
+//eMode   - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor,
+		                                                          QAS_LCD_BlendMode eMode) {
+	if (eMode)
+		QAS_LCD_Blend::fillRect((uint16_t*)pDst, uStride, uWidth, uHeight, uColor, eMode); else
+		QAS_LCD_Span::fillRect((uint16_t*)pDst, uStride, uWidth, uHeight, uColor);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copy
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to copy a horizontal span using QAS_LCD_Span::copy(), or QAS_LCD_Blend::blend() if a blend mode is given
+//pDst   - Pointer to the first destination pixel
+//pSrc   - Pointer to the first source pixel
+//uCount - The number of pixels in the span
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode) {
+	if (eMode)
+		QAS_LCD_Blend::blend((uint16_t*)pDst, pSrc, uCount, eMode); else
+		QAS_LCD_Span::copy((uint16_t*)pDst, pSrc, uCount);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copyRect
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to copy a rectangle using QAS_LCD_Span::copyRect(), or QAS_LCD_Blend::blendRect() if a blend mode is given
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//eMode      - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride,
+		                                                          uint32_t uWidth, uint32_t uHeight, QAS_LCD_BlendMode eMode) {
+	if (eMode)
+		QAS_LCD_Blend::blendRect((uint16_t*)pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, eMode); else
+		QAS_LCD_Span::copyRect((uint16_t*)pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copyKeyRect
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to copy a rectangle, skipping pixels matching a color key, using QAS_LCD_Span::copyKeyRect()
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//uKey       - The color of source pixels that are not to be copied
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride,
+		                                                             uint32_t uWidth, uint32_t uHeight, uint16_t uKey) {
+	QAS_LCD_Span::copyKeyRect((uint16_t*)pDst, uDstStride, pSrc, uSrcStride, uWidth, uHeight, uKey);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::moveRect
+//QAS_LCD_RasterFormat<ARGB4444> Kernel Method
+//
+//Used to copy a rectangle of ARGB4444 pixels between two buffers using QAS_LCD_Span::copyRect()
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+void QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride,
+		                                                          uint32_t uWidth, uint32_t uHeight) {
+	QAS_LCD_Span::copyRect((uint16_t*)pDst, uDstStride, (const uint16_t*)pSrc, uSrcStride, uWidth, uHeight);
+}
+
+
+	//---------------------------------------
+	//---------------------------------------
+	//QAS_LCD_RasterFormat<L8> Kernel Methods
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::fill
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to fill a horizontal span using QAS_LCD_Span::fill(). If a blend mode is given the span is only filled if the color is at
+//least half opaque
+//pDst   - Pointer to the first pixel of the span
+//uCount - The number of pixels in the span
+//uColor - The color to fill the span with, holding a palette index in its lower 8 bits
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+	if (!eMode || opaque(uColor))
+		QAS_LCD_Span::fill<QAT_PixelFormat_L8>((uint8_t*)pDst, uCount, (uint8_t)uColor);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::fillRect
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to fill a rectangle using QAS_LCD_Span::fillRect(). If a blend mode is given the rectangle is only filled if the color is
+//at least half opaque
+//pDst    - Pointer to the upper-left pixel of the rectangle
+//uStride - The number of pixels between the start of each line
+//uWidth  - The width in pixels of the rectangle
+//uHeight - The height in pixels of the rectangle
+//uColor  - The color to fill the rectangle with, holding a palette index in its lower 8 bits
+//eMode   - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor,
+		                                                    QAS_LCD_BlendMode eMode) {
+	if (!eMode || opaque(uColor))
+		QAS_LCD_Span::fillRect<QAT_PixelFormat_L8>((uint8_t*)pDst, uStride, uWidth, uHeight, (uint8_t)uColor);
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copy
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to copy a horizontal span, taking the palette index from the lower 8 bits of each source pixel. If a blend mode is given,
+//source pixels that are less than half opaque are skipped
+//pDst   - Pointer to the first destination pixel
+//pSrc   - Pointer to the first source pixel
+//uCount - The number of pixels in the span
+//eMode  - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode) {
+	uint8_t* pPxl = (uint8_t*)pDst;
+	if (eMode) {
+		for (uint32_t i=0; i<uCount; i++) {
+			if (opaque(pSrc[i]))
+				pPxl[i] = (uint8_t)pSrc[i];
+		}
+	} else {
+		for (uint32_t i=0; i<uCount; i++)
+			pPxl[i] = (uint8_t)pSrc[i];
+	}
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copyRect
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to copy a rectangle, one line at a time using copy()
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//eMode      - The blend mode. Member of QAS_LCD_BlendMode enum defined in QAS_LCD_Blend.hpp
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride,
+		                                                    uint32_t uWidth, uint32_t uHeight, QAS_LCD_BlendMode eMode) {
+	uint8_t* pPxl = (uint8_t*)pDst;
+	for (uint32_t y=0; y<uHeight; y++) {
+		copy(pPxl, pSrc, uWidth, eMode);
+		pPxl += uDstStride;
+		pSrc += uSrcStride;
+	}
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copyKeyRect
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to copy a rectangle, skipping source pixels matching a color key
+//The key is compared with the full 16bit source pixel, so the same keyed image can be drawn to both 16bit and L8 layers
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//uKey       - The color of source pixels that are not to be copied
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride,
+		                                                       uint32_t uWidth, uint32_t uHeight, uint16_t uKey) {
+	uint8_t* pPxl = (uint8_t*)pDst;
+	for (uint32_t y=0; y<uHeight; y++) {
+		for (uint32_t x=0; x<uWidth; x++) {
+			if (pSrc[x] != uKey)
+				pPxl[x] = (uint8_t)pSrc[x];
+		}
+		pPxl += uDstStride;
+		pSrc += uSrcStride;
+	}
+}
+
+
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::moveRect
+//QAS_LCD_RasterFormat<L8> Kernel Method
+//
+//Used to copy a rectangle of L8 pixels between two buffers, one line at a time
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+void QAS_LCD_RasterFormat<QAT_PixelFormat_L8>::moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride,
+		                                                    uint32_t uWidth, uint32_t uHeight) {
+	uint8_t*       pOut = (uint8_t*)pDst;
+	const uint8_t* pIn  = (const uint8_t*)pSrc;
+	for (uint32_t y=0; y<uHeight; y++) {
+		memcpy(pOut, pIn, uWidth);
+		pOut += uDstStride;
+		pIn  += uSrcStride;
+	}
+}
+
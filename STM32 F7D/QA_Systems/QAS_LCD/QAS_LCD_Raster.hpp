@@ -0,0 +1,432 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Pixel Format Rasterizers                 */
+/*   Filename: QAS_LCD_Raster.hpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_RASTER_HPP_
+#define __QAS_LCD_RASTER_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_PixelFormat.hpp"
+
+#include "QAS_LCD_Span.hpp"
+#include "QAS_LCD_Blend.hpp"
+
+
+  //NOTE:
+  //QAS_LCD always describes colors and image pixels as ARGB4444, however each LTDC layer can use its own pixel format
+  //(see QAD_LTDC_Layer0Format and QAD_LTDC_Layer1Format in QAD_LTDC.hpp). For example, an opaque background can be held in RGB565,
+  //which gives finer gradients than ARGB4444 at the same memory bandwidth, while an overlay is held in ARGB4444 so that it keeps
+  //per-pixel alpha. A layer can also be held in L8, where each pixel is an index into the layer's color look-up table, which
+  //halves the memory bandwidth again for user interfaces that only use a limited number of flat colors, or in ARGB8888, which
+  //doubles the memory bandwidth but keeps the full precision of blended and anti-aliased pixels.
+  //
+  //Every method that writes to a render target does so through the kernels of the target's pixel format, which are generated at
+  //compile time by QAS_LCD_RasterFormat. The kernels convert ARGB4444 colors and image pixels into the target's format as they are
+  //written, and blend in the target's format when a blend mode is selected.
+  //
+  //Each target records which set of kernels it uses as a member of QAS_LCD_Raster. Rendering methods pass their inner loops to the
+  //target's raster() method (see QAS_LCD_Target.hpp) as a generic lambda, which is instantiated once for each set of kernels, and
+  //is called with the set used by the target. The format is therefore selected once per rendering method, with every kernel call
+  //and pixel write within the loops being resolved at compile time and free to be inlined.
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------
+//QAS_LCD_Raster
+//
+//Used to identify the set of kernels that a render target is written through, being the kernels of QAS_LCD_RasterFormat for
+//one of the pixel formats that QAS_LCD can render to, or the kernels of QAS_LCD_RasterAccel (see QAS_LCD_Accel.hpp) for the same
+//format while acceleration is active. The accelerated sets follow the CPU sets in the same order
+enum QAS_LCD_Raster : uint8_t {
+	QAS_LCD_Raster_ARGB4444 = 0,  //QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>
+	QAS_LCD_Raster_RGB565,        //QAS_LCD_RasterFormat<QAT_PixelFormat_RGB565>
+	QAS_LCD_Raster_L8,            //QAS_LCD_RasterFormat<QAT_PixelFormat_L8>
+	QAS_LCD_Raster_ARGB8888,      //QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB8888>
+	QAS_LCD_Raster_AccelARGB4444, //QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB4444>
+	QAS_LCD_Raster_AccelRGB565,   //QAS_LCD_RasterAccel<QAT_PixelFormat_RGB565>
+	QAS_LCD_Raster_AccelL8,       //QAS_LCD_RasterAccel<QAT_PixelFormat_L8>
+	QAS_LCD_Raster_AccelARGB8888  //QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB8888>
+};
+
+
+//----------------
+//QAS_LCD_RasterId
+//
+//Template trait giving the member of QAS_LCD_Raster enum that identifies the CPU kernels of a pixel format
+//Only the formats listed in QAS_LCD_Raster are defined, so a new format fails to compile until it is given its own set of kernels
+template <class Format>
+struct QAS_LCD_RasterId;
+
+template <>
+struct QAS_LCD_RasterId<QAT_PixelFormat_ARGB4444> {
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_ARGB4444;
+};
+
+template <>
+struct QAS_LCD_RasterId<QAT_PixelFormat_RGB565> {
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_RGB565;
+};
+
+template <>
+struct QAS_LCD_RasterId<QAT_PixelFormat_L8> {
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_L8;
+};
+
+template <>
+struct QAS_LCD_RasterId<QAT_PixelFormat_ARGB8888> {
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_ARGB8888;
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------
+//QAS_LCD_RasterFormat
+//
+//Template class providing the kernels used to write to render targets of a pixel format defined in QAT_PixelFormat.hpp
+//All colors and source pixels are ARGB4444, and all destination pixels are in the target's format
+//
+//The generic kernels unpack both the source and destination pixels into 8bit components, blend them using the same equations as
+//QAS_LCD_Blend, and then pack the result into the format. Formats without their own alpha cannot store a partially transparent
+//pixel, so colors written to them without blending are treated as having been composited over black, in the same manner as the
+//LTDC composites layer 0 over its black background. 32bit formats such as ARGB8888 keep the full 8bit result of each blend.
+//The blend mode is selected once per span, with each blending loop compiled separately for each mode (see withMode()), so that
+//no mode is tested for each pixel.
+//
+//The ARGB4444 format is specialised below to use the word-wide span and blending kernels directly.
+template <class Format>
+class QAS_LCD_RasterFormat {
+	static_assert((Format::Bytes == 2) || (Format::Bytes == 4), "QAS_LCD can only render to 16bit or 32bit pixel formats, or to L8");
+
+	static constexpr uint32_t Words = Format::Bytes / 2;  //The number of halfwords in a single pixel of the format
+
+	typedef QAT_PixelFormat_ARGB4444 Source;
+
+public:
+
+	typedef typename Format::Type Pixel;  //Storage type of a single pixel of the format
+
+	//Member of QAS_LCD_Raster enum identifying these kernels
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_RasterId<Format>::Raster;
+	static constexpr uint8_t        Bytes  = Format::Bytes;  //The size in bytes of a single pixel of the format
+	static constexpr bool           Alpha  = Format::Alpha;  //Whether pixels store their own alpha. If not, partially covered
+	                                                         //pixels must be blended
+
+
+	//------------
+	//Constructors
+
+	//Instances hold no data, and are only passed to the rendering methods' inner loops to select the kernels of a render target
+	//at compile time (see QAS_LCD_Target::raster())
+	constexpr QAS_LCD_RasterFormat() {}
+
+
+	//-------
+	//Kernels
+
+	//Returns a color converted into the format, ready to be written to the target without blending
+	static Pixel color(uint16_t uColor) {
+		if (Format::Alpha)
+			return QAT_PixelConvert<Format, Source>::convert(uColor);
+
+		uint32_t uA = Source::a(uColor);
+		return Format::pack(255, div255(Source::r(uColor) * uA), div255(Source::g(uColor) * uA), div255(Source::b(uColor) * uA));
+	}
+
+	//Writes a single pixel of a color, blended using eMode
+	static void pixel(void* pDst, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		Pixel* pPxl = (Pixel*)pDst;
+		if (!eMode) {
+			*pPxl = color(uColor);
+			return;
+		}
+		withMode(eMode, [&](auto cMode) {
+			*pPxl = blend<decltype(cMode)::Value>(*pPxl, uColor);
+		});
+	}
+
+	//Fills a horizontal span, or a rectangle, with a color blended using eMode
+	static void fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		Pixel* pPxl = (Pixel*)pDst;
+		if (!eMode) {
+			QAS_LCD_Span::fill<Format>(pPxl, uCount, color(uColor));
+			return;
+		}
+		withMode(eMode, [&](auto cMode) {
+			for (uint32_t i=0; i<uCount; i++)
+				pPxl[i] = blend<decltype(cMode)::Value>(pPxl[i], uColor);
+		});
+	}
+
+	static void fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		Pixel* pPxl = (Pixel*)pDst;
+		for (uint32_t y=0; y<uHeight; y++) {
+			fill(pPxl, uWidth, uColor, eMode);
+			pPxl += uStride;
+		}
+	}
+
+	//Copies a horizontal span, or a rectangle, of source pixels blended using eMode
+	static void copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode) {
+		Pixel* pPxl = (Pixel*)pDst;
+		if (!eMode) {
+			for (uint32_t i=0; i<uCount; i++)
+				pPxl[i] = color(pSrc[i]);
+			return;
+		}
+		withMode(eMode, [&](auto cMode) {
+			for (uint32_t i=0; i<uCount; i++)
+				pPxl[i] = blend<decltype(cMode)::Value>(pPxl[i], pSrc[i]);
+		});
+	}
+
+	static void copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                 QAS_LCD_BlendMode eMode) {
+		Pixel* pPxl = (Pixel*)pDst;
+		for (uint32_t y=0; y<uHeight; y++) {
+			copy(pPxl, pSrc, uWidth, eMode);
+			pPxl += uDstStride;
+			pSrc += uSrcStride;
+		}
+	}
+
+	//Copies a rectangle of source pixels, skipping source pixels that match a color key
+	static void copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                    uint16_t uKey) {
+		Pixel* pPxl = (Pixel*)pDst;
+		for (uint32_t y=0; y<uHeight; y++) {
+			for (uint32_t x=0; x<uWidth; x++) {
+				if (pSrc[x] != uKey)
+					pPxl[x] = color(pSrc[x]);
+			}
+			pPxl += uDstStride;
+			pSrc += uSrcStride;
+		}
+	}
+
+	//Copies a rectangle of pixels that are already in the format, such as between a frame buffer and a tile buffer
+	//32bit pixels are copied as pairs of halfwords, as the copy does not depend on the contents of each pixel
+	static void moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight) {
+		QAS_LCD_Span::copyRect((uint16_t*)pDst, uDstStride * Words, (const uint16_t*)pSrc, uSrcStride * Words, uWidth * Words, uHeight);
+	}
+
+	//Waits for any kernels that complete asynchronously (see QAS_LCD_Accel.hpp), before pixels are read or written directly
+	static void sync(void) {}
+
+private:
+
+	//Returns a product of two 8bit components divided by 255, rounded to the nearest value
+	static uint32_t div255(uint32_t uValue) {
+		uValue += 128;
+		return (uValue + (uValue >> 8)) >> 8;
+	}
+
+	//Type used to pass a blend mode to the functions called by withMode() as a compile-time constant
+	template <QAS_LCD_BlendMode Mode>
+	struct BlendMode {
+		static constexpr QAS_LCD_BlendMode Value = Mode;
+	};
+
+	//Calls a function, usually a generic lambda holding a blending loop, with a BlendMode for eMode, so that the loop is compiled
+	//once for each blend mode, and the mode is tested once rather than for each pixel
+	//eMode - The blend mode. Must not be QAS_LCD_Blend_None, which the kernels handle without blending
+	template <class Func>
+	static void withMode(QAS_LCD_BlendMode eMode, Func cFunc) {
+		switch (eMode) {
+		  case (QAS_LCD_Blend_Add):
+		  	cFunc(BlendMode<QAS_LCD_Blend_Add>());
+		  	break;
+		  case (QAS_LCD_Blend_Multiply):
+		  	cFunc(BlendMode<QAS_LCD_Blend_Multiply>());
+		  	break;
+		  default:
+		  	cFunc(BlendMode<QAS_LCD_Blend_SrcOver>());
+		  	break;
+		}
+	}
+
+	//Returns a single destination component blended with a single source component
+	template <QAS_LCD_BlendMode Mode>
+	static uint32_t component(uint32_t uDst, uint32_t uSrc, uint32_t uSrcA) {
+		if (Mode == QAS_LCD_Blend_Add) {
+			uSrc = uDst + div255(uSrc * uSrcA);
+			return (uSrc > 255) ? 255 : uSrc;
+		}
+		if (Mode == QAS_LCD_Blend_Multiply)
+			return div255(uSrc * uDst);
+		return div255((uSrc * uSrcA) + (uDst * (255 - uSrcA)));
+	}
+
+	//Returns a destination pixel blended with an ARGB4444 source pixel
+	template <QAS_LCD_BlendMode Mode>
+	static Pixel blend(Pixel uDst, uint16_t uSrc) {
+		uint32_t uSrcA = Source::a(uSrc);
+		uint32_t uDstA = Format::a(uDst);
+		uint32_t uA    = (Mode == QAS_LCD_Blend_SrcOver) ? div255((255 * uSrcA) + (uDstA * (255 - uSrcA))) : uDstA;
+
+		return Format::pack(uA, component<Mode>(Format::r(uDst), Source::r(uSrc), uSrcA),
+				                    component<Mode>(Format::g(uDst), Source::g(uSrc), uSrcA),
+				                    component<Mode>(Format::b(uDst), Source::b(uSrc), uSrcA));
+	}
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------------------------------
+//QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>
+//
+//ARGB4444 is the format used by QAS_LCD for colors and images, so no conversion is required, and the word-wide span kernels
+//(QAS_LCD_Span.hpp) and blending kernels (QAS_LCD_Blend.hpp) are used directly
+template <>
+class QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444> {
+public:
+
+	typedef QAT_PixelFormat_ARGB4444::Type Pixel;  //Storage type of a single pixel of the format
+
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_ARGB4444;          //Member of QAS_LCD_Raster enum identifying these kernels
+	static constexpr uint8_t        Bytes  = QAT_PixelFormat_ARGB4444::Bytes;  //The size in bytes of a single pixel of the format
+	static constexpr bool           Alpha  = QAT_PixelFormat_ARGB4444::Alpha;  //Whether pixels store their own alpha
+
+
+	//------------
+	//Constructors
+
+	//Instances hold no data (see QAS_LCD_RasterFormat above)
+	constexpr QAS_LCD_RasterFormat() {}
+
+
+	//-------
+	//Kernels
+	//
+	//See QAS_LCD_RasterFormat above for details of the following methods
+
+	//Colors are already ARGB4444, so are returned unchanged
+	static Pixel color(uint16_t uColor) {
+		return uColor;
+	}
+
+	//The pixel is blended using QAS_LCD_Blend::pixel() if a blend mode is given
+	static void pixel(void* pDst, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		uint16_t* pPxl = (uint16_t*)pDst;
+		*pPxl = eMode ? QAS_LCD_Blend::pixel(*pPxl, uColor, eMode) : uColor;
+	}
+
+
+	//NOTE: See QAS_LCD_Raster.cpp for details of the following methods
+
+	static void fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode);
+	static void fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode);
+	static void copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode);
+	static void copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                 QAS_LCD_BlendMode eMode);
+	static void copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                    uint16_t uKey);
+	static void moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight);
+	static void sync(void) {}
+
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------------------------------
+//QAS_LCD_RasterFormat<QAT_PixelFormat_L8>
+//
+//L8 pixels are indices into the layer's color look-up table (see QAD_LTDC::setCLUT()), so when rendering to an L8 target every
+//16bit color and source pixel is read as a palette index in its lower 8 bits, with the upper 4 bits holding its alpha as usual.
+//For example, a draw color of 0xF005 draws with palette entry 5 (see QAS_LCD::setDrawIndex()).
+//
+//Palette indices cannot be blended, so when a blend mode is selected a pixel is written only if its alpha is at least half,
+//otherwise the existing pixel is left unchanged. As a result anti-aliased edges and alpha blits are drawn with hard edges,
+//and the additive and multiply blend modes behave the same as source-over blending.
+template <>
+class QAS_LCD_RasterFormat<QAT_PixelFormat_L8> {
+public:
+
+	typedef QAT_PixelFormat_L8::Type Pixel;  //Storage type of a single pixel of the format
+
+	static constexpr QAS_LCD_Raster Raster = QAS_LCD_Raster_L8;          //Member of QAS_LCD_Raster enum identifying these kernels
+	static constexpr uint8_t        Bytes  = QAT_PixelFormat_L8::Bytes;  //The size in bytes of a single pixel of the format
+	static constexpr bool           Alpha  = QAT_PixelFormat_L8::Alpha;  //Whether pixels store their own alpha
+
+
+	//------------
+	//Constructors
+
+	//Instances hold no data (see QAS_LCD_RasterFormat above)
+	constexpr QAS_LCD_RasterFormat() {}
+
+
+	//-------
+	//Kernels
+	//
+	//See QAS_LCD_RasterFormat above for details of the following methods
+
+	//Returns the palette index held in the lower 8 bits of a color
+	static Pixel color(uint16_t uColor) {
+		return (uint8_t)uColor;
+	}
+
+	//The pixel is only written if no blend mode is given, or the color is at least half opaque
+	static void pixel(void* pDst, uint16_t uColor, QAS_LCD_BlendMode eMode) {
+		if (!eMode || opaque(uColor))
+			*(uint8_t*)pDst = (uint8_t)uColor;
+	}
+
+
+	//NOTE: See QAS_LCD_Raster.cpp for details of the following methods
+
+	static void fill(void* pDst, uint32_t uCount, uint16_t uColor, QAS_LCD_BlendMode eMode);
+	static void fillRect(void* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor, QAS_LCD_BlendMode eMode);
+	static void copy(void* pDst, const uint16_t* pSrc, uint32_t uCount, QAS_LCD_BlendMode eMode);
+	static void copyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                 QAS_LCD_BlendMode eMode);
+	static void copyKeyRect(void* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                    uint16_t uKey);
+	static void moveRect(void* pDst, uint32_t uDstStride, const void* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight);
+	static void sync(void) {}
+
+private:
+
+	//Returns true if a color is to be written when a blend mode is selected
+	static bool opaque(uint16_t uColor) {
+		return (uColor >= 0x8000);
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_RASTER_HPP_ */
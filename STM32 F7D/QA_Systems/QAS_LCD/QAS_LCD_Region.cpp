@@ -0,0 +1,168 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Regions                                  */
+/*   Filename: QAS_LCD_Region.cpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Region.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//---------------------------------
+	//---------------------------------
+	//QAS_LCD_Region Management Methods
+
+//QAS_LCD_Region::clear
+//QAS_LCD_Region Management Method
+//
+//Used to remove all rectangles from the region
+void QAS_LCD_Region::clear(void) {
+	m_uCount  = 0;
+	m_cBounds = QAT_Rect_16();
+}
+
+
+//QAS_LCD_Region::fill
+//QAS_LCD_Region Management Method
+//
+//Used to set the region as covering the entire 800x480 LCD panel
+void QAS_LCD_Region::fill(void) {
+	m_cRects[0] = QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1);
+	m_uCount    = 1;
+	m_cBounds   = m_cRects[0];
+}
+
+
+//QAS_LCD_Region::add
+//QAS_LCD_Region Management Method
+//
+//Used to add a rectangle to the region
+//The rectangle is first limited to the LCD panel. Any existing rectangles that overlap the new rectangle are then merged
+//into it, which is repeated until no overlaps remain so that the region always consists of non-overlapping rectangles.
+//If the region is full then the new rectangle is merged with whichever existing rectangle results in the smallest increase in area.
+//cRect - The rectangle to be added
+void QAS_LCD_Region::add(const QAT_Rect_16& cRect) {
+
+	//Limit rectangle to LCD panel, returning if nothing remains
+	QAT_Rect_16 cNew = cRect.intersect(QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1));
+	if (cNew.empty())
+		return;
+
+	//Early return if rectangle is already fully covered by a single existing rectangle
+	for (uint8_t i=0; i<m_uCount; i++) {
+		if (m_cRects[i].intersect(cNew) == cNew)
+			return;
+	}
+
+	bool bMerged = true;
+	while (bMerged) {
+		bMerged = false;
+
+		//Merge any overlapping rectangles into the new rectangle
+		for (uint8_t i=0; i<m_uCount; i++) {
+			if (m_cRects[i].intersects(cNew)) {
+				cNew = cNew.merge(m_cRects[i]);
+				remove(i);
+				bMerged = true;
+				break;
+			}
+		}
+
+		//If region is full and no overlaps remain, merge into the rectangle that grows the least
+		if (!bMerged && (m_uCount >= QAS_LCD_REGION_LENGTH)) {
+			uint8_t  uBest     = 0;
+			uint32_t uBestCost = 0xFFFFFFFF;
+			for (uint8_t i=0; i<m_uCount; i++) {
+				uint32_t uCost = cNew.merge(m_cRects[i]).area() - m_cRects[i].area();
+				if (uCost < uBestCost) {
+					uBestCost = uCost;
+					uBest     = i;
+				}
+			}
+			cNew = cNew.merge(m_cRects[uBest]);
+			remove(uBest);
+			bMerged = true;
+		}
+	}
+
+	//Store new rectangle
+	m_cRects[m_uCount] = cNew;
+	m_uCount++;
+	m_cBounds = m_cBounds.merge(cNew);
+}
+
+
+	//---------------------------
+	//---------------------------
+	//QAS_LCD_Region Data Methods
+
+//QAS_LCD_Region::contains
+//QAS_LCD_Region Data Method
+//
+//Returns true if the pixel at the given coordinates is within any rectangle of the region
+bool QAS_LCD_Region::contains(int16_t x, int16_t y) const {
+	if (!m_cBounds.contains(x, y))
+		return false;
+
+	for (uint8_t i=0; i<m_uCount; i++) {
+		if (m_cRects[i].contains(x, y))
+			return true;
+	}
+	return false;
+}
+
+
+//QAS_LCD_Region::area
+//QAS_LCD_Region Data Method
+//
+//Returns the total number of pixels covered by the region
+//As rectangles are non-overlapping this is the sum of the area of each rectangle
+uint32_t QAS_LCD_Region::area(void) const {
+	uint32_t uArea = 0;
+	for (uint8_t i=0; i<m_uCount; i++)
+		uArea += m_cRects[i].area();
+	return uArea;
+}
+
+
+	//------------------------------
+	//------------------------------
+	//QAS_LCD_Region Private Methods
+
+//QAS_LCD_Region::remove
+//QAS_LCD_Region Private Method
+//
+//Used to remove a rectangle from the region by moving the last rectangle into its place
+//Bounds are recalculated as the removed rectangle may have been defining part of them
+void QAS_LCD_Region::remove(uint8_t uIdx) {
+	m_uCount--;
+	m_cRects[uIdx] = m_cRects[m_uCount];
+	updateBounds();
+}
+
+
+//QAS_LCD_Region::updateBounds
+//QAS_LCD_Region Private Method
+//
+//Used to recalculate the bounding rectangle of the region
+void QAS_LCD_Region::updateBounds(void) {
+	m_cBounds = QAT_Rect_16();
+	for (uint8_t i=0; i<m_uCount; i++)
+		m_cBounds = m_cBounds.merge(m_cRects[i]);
+}
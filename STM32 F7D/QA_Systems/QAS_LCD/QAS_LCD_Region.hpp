@@ -0,0 +1,126 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Regions                                  */
+/*   Filename: QAS_LCD_Region.hpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_REGION_HPP_
+#define __QAS_LCD_REGION_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+#include "QAT_Rect.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------------
+//QAS_LCD_REGION_LENGTH
+//
+//Used to determine the maximum number of rectangles that can be held by a region
+//Once a region is full, newly added rectangles will be merged into whichever existing rectangle grows the least
+#define QAS_LCD_REGION_LENGTH  ((uint8_t)16)
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------
+//QAS_LCD_Region
+//
+//Class used to hold a set of non-overlapping rectangles describing an area of the LCD
+//This is used by QAS_LCD for dirty rectangle tracking, with one region being kept per layer and per buffer.
+//It is also used as the set of rectangles that all rendering methods are clipped against, which allows for
+//clears and redraws to only touch pixels within invalidated areas of the LCD.
+//
+//As rectangles are kept non-overlapping, a primitive clipped against each rectangle in turn will never have the
+//same pixel written twice.
+class QAS_LCD_Region {
+private:
+
+	QAT_Rect_16 m_cRects[QAS_LCD_REGION_LENGTH];  //Array of rectangles making up the region
+	uint8_t     m_uCount;                         //The number of rectangles currently stored in m_cRects
+
+	QAT_Rect_16 m_cBounds;                        //Bounding rectangle of all rectangles in the region, used for early rejection
+
+public:
+
+	//------------
+  //Constructors
+
+	//Default constructor. Creates an empty region
+	QAS_LCD_Region() :
+		m_uCount(0) {}
+
+
+	//NOTE: See QAS_LCD_Region.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	void clear(void);
+	void fill(void);
+	void add(const QAT_Rect_16& cRect);
+
+
+	//------------
+	//Data Methods
+
+	//Returns the number of rectangles currently in the region
+	uint8_t count(void) const {
+		return m_uCount;
+	}
+
+	//Returns true if the region contains no rectangles
+	bool empty(void) const {
+		return (m_uCount == 0);
+	}
+
+	//Returns a reference to a specific rectangle within the region
+	//uIdx - The index of the rectangle, which must be less than count()
+	const QAT_Rect_16& operator[](uint8_t uIdx) const {
+		return m_cRects[uIdx];
+	}
+
+	//Returns the bounding rectangle of the region. Will be empty if the region is empty
+	const QAT_Rect_16& bounds(void) const {
+		return m_cBounds;
+	}
+
+	bool contains(int16_t x, int16_t y) const;
+	uint32_t area(void) const;
+
+private:
+
+	//---------------
+	//Private Methods
+
+	void remove(uint8_t uIdx);
+	void updateBounds(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_REGION_HPP_ */
@@ -0,0 +1,224 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Span Fill Kernels                        */
+/*   Filename: QAS_LCD_Span.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Span.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//--------------------------
+	//--------------------------
+	//QAS_LCD_Span Fill Methods
+
+//QAS_LCD_Span::fill
+//QAS_LCD_Span Fill Method
+//
+//Used to fill a horizontal span of 16bit pixels with a single color
+//pDst   - Pointer to the first pixel of the span
+//uCount - The number of pixels in the span
+//uColor - The 16bit color to fill the span with
+void QAS_LCD_Span::fill(uint16_t* pDst, uint32_t uCount, uint16_t uColor) {
+	fill<QAT_PixelFormat_ARGB4444>(pDst, uCount, uColor);
+}
+
+
+//QAS_LCD_Span::fillRect
+//QAS_LCD_Span Fill Method
+//
+//Used to fill a rectangular block of 16bit pixels with a single color, one span per line
+//pDst    - Pointer to the upper-left pixel of the rectangle
+//uStride - The number of pixels between the start of each line (the width of the frame buffer)
+//uWidth  - The width in pixels of the rectangle
+//uHeight - The height in pixels of the rectangle
+//uColor  - The 16bit color to fill the rectangle with
+void QAS_LCD_Span::fillRect(uint16_t* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor) {
+	fillRect<QAT_PixelFormat_ARGB4444>(pDst, uStride, uWidth, uHeight, uColor);
+}
+
+
+	//--------------------------
+	//--------------------------
+	//QAS_LCD_Span Copy Methods
+
+//QAS_LCD_Span::copy
+//QAS_LCD_Span Copy Method
+//
+//Used to copy a horizontal span of 16bit pixels, 16 pixels per iteration
+//pDst   - Pointer to the first destination pixel
+//pSrc   - Pointer to the first source pixel
+//uCount - The number of pixels in the span
+void QAS_LCD_Span::copy(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount) {
+
+	//Copy leading pixel individually if span does not start on a 32bit boundary
+	if (((uintptr_t)pDst & 0x02) && uCount) {
+		*pDst++ = *pSrc++;
+		uCount--;
+	}
+
+	QAS_LCD_Span_Word* pWord = (QAS_LCD_Span_Word*)pDst;
+	uint32_t uWords = uCount >> 1;
+
+	if (!((uintptr_t)pSrc & 0x02)) {
+
+		//Source shares the alignment of the destination, so words are copied directly
+		const QAS_LCD_Span_Word* pSrcWord = (const QAS_LCD_Span_Word*)pSrc;
+		while (uWords >= 8) {
+			pWord[0] = pSrcWord[0];
+			pWord[1] = pSrcWord[1];
+			pWord[2] = pSrcWord[2];
+			pWord[3] = pSrcWord[3];
+			pWord[4] = pSrcWord[4];
+			pWord[5] = pSrcWord[5];
+			pWord[6] = pSrcWord[6];
+			pWord[7] = pSrcWord[7];
+			pWord    += 8;
+			pSrcWord += 8;
+			uWords   -= 8;
+		}
+		while (uWords) {
+			*pWord++ = *pSrcWord++;
+			uWords--;
+		}
+	} else if (uWords) {
+
+		//Source is offset by one pixel, so each destination word is assembled from the upper half of one source word and the
+		//lower half of the next. Every source word read contains at least one pixel of the span, so no reads fall outside of
+		//the 32bit words occupied by the span
+		const QAS_LCD_Span_Word* pSrcWord = (const QAS_LCD_Span_Word*)(pSrc - 1);
+		uint32_t uPrev = *pSrcWord++;
+		while (uWords >= 4) {
+			uint32_t uW0 = pSrcWord[0];
+			uint32_t uW1 = pSrcWord[1];
+			uint32_t uW2 = pSrcWord[2];
+			uint32_t uW3 = pSrcWord[3];
+			pWord[0] = (uPrev >> 16) | (uW0 << 16);
+			pWord[1] = (uW0 >> 16) | (uW1 << 16);
+			pWord[2] = (uW1 >> 16) | (uW2 << 16);
+			pWord[3] = (uW2 >> 16) | (uW3 << 16);
+			uPrev     = uW3;
+			pWord    += 4;
+			pSrcWord += 4;
+			uWords   -= 4;
+		}
+		while (uWords) {
+			uint32_t uW0 = *pSrcWord++;
+			*pWord++ = (uPrev >> 16) | (uW0 << 16);
+			uPrev    = uW0;
+			uWords--;
+		}
+	}
+
+	//Copy trailing pixel individually if an odd number of pixels remain
+	if (uCount & 0x01)
+		*(uint16_t*)pWord = pSrc[uCount - 1];
+}
+
+
+//QAS_LCD_Span::copyRect
+//QAS_LCD_Span Copy Method
+//
+//Used to copy a rectangular block of 16bit pixels between two buffers of differing widths, one line at a time
+//Each line is copied as a single sequential burst. If both buffers have the same width as the rectangle then the whole
+//rectangle is contiguous and is copied as one burst
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+void QAS_LCD_Span::copyRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight) {
+
+	//If the rectangle covers entire lines of both buffers then it is a single contiguous block
+	if ((uWidth == uDstStride) && (uWidth == uSrcStride)) {
+		copy(pDst, pSrc, uWidth * uHeight);
+		return;
+	}
+
+	for (uint32_t y=0; y<uHeight; y++) {
+		copy(pDst, pSrc, uWidth);
+		pDst += uDstStride;
+		pSrc += uSrcStride;
+	}
+}
+
+
+//QAS_LCD_Span::copyKey
+//QAS_LCD_Span Copy Method
+//
+//Used to copy a horizontal span of 16bit pixels, skipping any source pixels that match a color key
+//Pairs of pixels that contain no keyed pixels are written as a single 32bit word
+//pDst   - Pointer to the first destination pixel
+//pSrc   - Pointer to the first source pixel
+//uCount - The number of pixels in the span
+//uKey   - The 16bit color of source pixels that are not to be copied
+void QAS_LCD_Span::copyKey(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount, uint16_t uKey) {
+
+	//Copy leading pixel individually if span does not start on a 32bit boundary
+	if (((uintptr_t)pDst & 0x02) && uCount) {
+		if (*pSrc != uKey)
+			*pDst = *pSrc;
+		pDst++;
+		pSrc++;
+		uCount--;
+	}
+
+	uint32_t uWords = uCount >> 1;
+	while (uWords--) {
+		uint16_t uP0 = pSrc[0];
+		uint16_t uP1 = pSrc[1];
+		if ((uP0 != uKey) && (uP1 != uKey)) {
+			*(QAS_LCD_Span_Word*)pDst = uP0 | ((uint32_t)uP1 << 16);
+		} else {
+			if (uP0 != uKey)
+				pDst[0] = uP0;
+			if (uP1 != uKey)
+				pDst[1] = uP1;
+		}
+		pDst += 2;
+		pSrc += 2;
+	}
+
+	//Copy trailing pixel individually if an odd number of pixels remain
+	if ((uCount & 0x01) && (*pSrc != uKey))
+		*pDst = *pSrc;
+}
+
+
+//QAS_LCD_Span::copyKeyRect
+//QAS_LCD_Span Copy Method
+//
+//Used to copy a rectangular block of 16bit pixels between two buffers of differing widths, one line at a time,
+//skipping any source pixels that match a color key
+//pDst       - Pointer to the upper-left pixel of the destination rectangle
+//uDstStride - The number of pixels between the start of each line of the destination buffer
+//pSrc       - Pointer to the upper-left pixel of the source rectangle
+//uSrcStride - The number of pixels between the start of each line of the source buffer
+//uWidth     - The width in pixels of the rectangle
+//uHeight    - The height in pixels of the rectangle
+//uKey       - The 16bit color of source pixels that are not to be copied
+void QAS_LCD_Span::copyKeyRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+		                           uint16_t uKey) {
+	for (uint32_t y=0; y<uHeight; y++) {
+		copyKey(pDst, pSrc, uWidth, uKey);
+		pDst += uDstStride;
+		pSrc += uSrcStride;
+	}
+}
@@ -0,0 +1,157 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Span Fill Kernels                        */
+/*   Filename: QAS_LCD_Span.hpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_SPAN_HPP_
+#define __QAS_LCD_SPAN_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_PixelFormat.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_LCD_Span_Word
+//
+//32bit word type used by the span kernels to store two 16bit pixels at a time
+//This is marked as may_alias as frame buffers are otherwise accessed as arrays of QAT_Pixel_ARGB4444 classes
+typedef uint32_t __attribute__((__may_alias__)) QAS_LCD_Span_Word;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------
+//QAS_LCD_Span
+//
+//Static class providing the span fill and copy kernels used by QAS_LCD
+//
+//Writing one 16bit pixel per store only uses half of the 32bit SDRAM bus, so these kernels pack two pixels into each
+//32bit store. An unaligned leading pixel is written individually so that all word stores are 32bit aligned, the main loop
+//is unrolled to write 16 pixels per iteration, and any remaining words and a trailing odd pixel are then written individually.
+//Copies also read the source as aligned 32bit words, which halves the number of reads from slower memories such as the
+//memory-mapped QuadSPI flash. If the source and destination differ in alignment then each destination word is assembled
+//from the halves of two neighbouring source words.
+//
+//The fill kernels are also provided as templates taking one of the pixel formats defined in QAT_PixelFormat.hpp, so that buffers
+//of 8bit and 32bit pixels are filled a whole word at a time in the same way. The 16bit fill methods use the ARGB4444 instantiation,
+//which is equally suitable for any other 16bit format.
+class QAS_LCD_Span {
+public:
+
+	//------------
+	//Constructors
+
+	QAS_LCD_Span() = delete;  //Delete constructor as class only provides static methods
+
+
+	//NOTE: See QAS_LCD_Span.cpp for details of the following methods
+
+	//------------
+	//Fill Methods
+
+	static void fill(uint16_t* pDst, uint32_t uCount, uint16_t uColor);
+	static void fillRect(uint16_t* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, uint16_t uColor);
+
+
+	//-------------------
+	//Format Fill Methods
+
+	//Used to fill a horizontal span of pixels of any format with a single color
+	//Leading pixels are written individually until the span reaches a 32bit boundary, after which the color is replicated across
+	//each word and written 8 words per iteration, followed by any trailing pixels
+	//pDst   - Pointer to the first pixel of the span
+	//uCount - The number of pixels in the span
+	//uColor - The color to fill the span with, already packed into the format
+	template <class Format>
+	static void fill(typename Format::Type* pDst, uint32_t uCount, typename Format::Type uColor) {
+		const uint32_t uPerWord = 4 / Format::Bytes;
+
+		while (((uintptr_t)pDst & 0x03) && uCount) {
+			*pDst++ = uColor;
+			uCount--;
+		}
+
+		QAS_LCD_Span_Word* pWord = (QAS_LCD_Span_Word*)pDst;
+		uint32_t uWord  = Format::word(uColor);
+		uint32_t uWords = uCount / uPerWord;
+
+		while (uWords >= 8) {
+			pWord[0] = uWord;
+			pWord[1] = uWord;
+			pWord[2] = uWord;
+			pWord[3] = uWord;
+			pWord[4] = uWord;
+			pWord[5] = uWord;
+			pWord[6] = uWord;
+			pWord[7] = uWord;
+			pWord  += 8;
+			uWords -= 8;
+		}
+		while (uWords) {
+			*pWord++ = uWord;
+			uWords--;
+		}
+
+		pDst = (typename Format::Type*)pWord;
+		for (uint32_t i=0; i<(uCount % uPerWord); i++)
+			pDst[i] = uColor;
+	}
+
+	//Used to fill a rectangular block of pixels of any format with a single color, one span per line
+	//pDst    - Pointer to the upper-left pixel of the rectangle
+	//uStride - The number of pixels between the start of each line
+	//uWidth  - The width in pixels of the rectangle
+	//uHeight - The height in pixels of the rectangle
+	//uColor  - The color to fill the rectangle with, already packed into the format
+	template <class Format>
+	static void fillRect(typename Format::Type* pDst, uint32_t uStride, uint32_t uWidth, uint32_t uHeight, typename Format::Type uColor) {
+		if (uWidth == uStride) {
+			fill<Format>(pDst, uWidth * uHeight, uColor);
+			return;
+		}
+
+		for (uint32_t y=0; y<uHeight; y++) {
+			fill<Format>(pDst, uWidth, uColor);
+			pDst += uStride;
+		}
+	}
+
+
+	//------------
+	//Copy Methods
+
+	static void copy(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount);
+	static void copyRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight);
+	static void copyKey(uint16_t* pDst, const uint16_t* pSrc, uint32_t uCount, uint16_t uKey);
+	static void copyKeyRect(uint16_t* pDst, uint32_t uDstStride, const uint16_t* pSrc, uint32_t uSrcStride, uint32_t uWidth, uint32_t uHeight,
+			                    uint16_t uKey);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_SPAN_HPP_ */
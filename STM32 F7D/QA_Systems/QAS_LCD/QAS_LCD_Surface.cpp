@@ -0,0 +1,123 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Offscreen Surfaces                       */
+/*   Filename: QAS_LCD_Surface.cpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Surface.hpp"
+#include "QAS_LCD_Span.hpp"
+
+#include "QAD_FMC.hpp"
+
+
+	//-------------------------------
+	//-------------------------------
+	//QAS_LCD_SurfacePool Constructor
+
+//QAS_LCD_SurfacePool::QAS_LCD_SurfacePool
+//QAS_LCD_SurfacePool Constructor
+//
+//Creates a pool with no surfaces, allocating its memory from SDRAM as region "LCD Surfaces"
+//If there is not enough SDRAM remaining then no surfaces can be created
+QAS_LCD_SurfacePool::QAS_LCD_SurfacePool() {
+	m_pPool = (uint8_t*)QAD_FMC::alloc("LCD Surfaces", QAS_LCD_SURFACE_POOLSIZE, QAD_FMC_ALIGN_BURST);
+	clear();
+}
+
+
+	//--------------------------------------
+	//--------------------------------------
+	//QAS_LCD_SurfacePool Management Methods
+
+//QAS_LCD_SurfacePool::create
+//QAS_LCD_SurfacePool Management Method
+//
+//Used to create a surface, allocated directly after the most recently created surface that still exists
+//The surface's pixels are cleared to transparent black (0x0000)
+//uWidth  - Width of the surface in pixels
+//uHeight - Height of the surface in pixels
+//Returns the index of the new surface, or QAS_LCD_SURFACE_NONE if the size is invalid, all surfaces are in use, or there is not
+//enough memory remaining in the pool
+uint8_t QAS_LCD_SurfacePool::create(uint16_t uWidth, uint16_t uHeight) {
+	if (!uWidth || !uHeight || (uWidth > 0x7FFF) || (uHeight > 0x7FFF))
+		return QAS_LCD_SURFACE_NONE;
+
+	uint32_t uSize = (((uint32_t)uWidth * uHeight * sizeof(uint16_t)) + 3) & ~3;
+	if (uSize > available())
+		return QAS_LCD_SURFACE_NONE;
+
+	for (uint8_t i=0; i<QAS_LCD_SURFACE_LENGTH; i++) {
+		QAS_LCD_SurfaceEntry& sEntry = m_sEntries[i];
+		if (sEntry.bUsed)
+			continue;
+
+		sEntry.uOffset = m_uTop;
+		sEntry.uSize   = uSize;
+		sEntry.uWidth  = uWidth;
+		sEntry.uHeight = uHeight;
+		sEntry.bUsed   = true;
+		m_uTop += uSize;
+
+		QAS_LCD_Span::fill(pixels(i), (uint32_t)uWidth * uHeight, 0x0000);
+		return i;
+	}
+	return QAS_LCD_SURFACE_NONE;
+}
+
+
+//QAS_LCD_SurfacePool::destroy
+//QAS_LCD_SurfacePool Management Method
+//
+//Used to destroy a surface. Its memory is returned to the pool once every surface allocated after it has also been destroyed
+//uIdx - The index of the surface. Invalid indexes are ignored
+void QAS_LCD_SurfacePool::destroy(uint8_t uIdx) {
+	if (!valid(uIdx))
+		return;
+
+	m_sEntries[uIdx].bUsed = false;
+	reclaim();
+}
+
+
+//QAS_LCD_SurfacePool::clear
+//QAS_LCD_SurfacePool Management Method
+//
+//Used to destroy all surfaces, returning the entire pool to being free
+void QAS_LCD_SurfacePool::clear(void) {
+	for (uint8_t i=0; i<QAS_LCD_SURFACE_LENGTH; i++)
+		m_sEntries[i].bUsed = false;
+	m_uTop = 0;
+}
+
+
+	//-----------------------------------
+	//-----------------------------------
+	//QAS_LCD_SurfacePool Private Methods
+
+//QAS_LCD_SurfacePool::reclaim
+//QAS_LCD_SurfacePool Private Method
+//
+//Used to lower the top of the pool to the end of the highest surface that still exists, returning the memory of any destroyed
+//surfaces above it to the pool
+void QAS_LCD_SurfacePool::reclaim(void) {
+	uint32_t uTop = 0;
+	for (uint8_t i=0; i<QAS_LCD_SURFACE_LENGTH; i++) {
+		const QAS_LCD_SurfaceEntry& sEntry = m_sEntries[i];
+		if (sEntry.bUsed && ((sEntry.uOffset + sEntry.uSize) > uTop))
+			uTop = sEntry.uOffset + sEntry.uSize;
+	}
+	m_uTop = uTop;
+}
+
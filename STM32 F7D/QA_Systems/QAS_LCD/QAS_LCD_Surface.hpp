@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Offscreen Surfaces                       */
+/*   Filename: QAS_LCD_Surface.hpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_SURFACE_HPP_
+#define __QAS_LCD_SURFACE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+#include "QAT_Rect.hpp"
+
+#include "QAS_LCD_Image.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------------------
+//QAS_LCD_SURFACE_POOLSIZE
+//
+//Used to determine the size in bytes of the memory that surfaces are allocated from
+//This is allocated from SDRAM as region "LCD Surfaces" (see QAD_FMC.hpp), aligned to the bursts of the DMA2D which blits surfaces
+//The default of 4MB holds five full screen surfaces.
+#define QAS_LCD_SURFACE_POOLSIZE  ((uint32_t)0x00400000)
+
+
+//----------------------
+//QAS_LCD_SURFACE_LENGTH
+//
+//Used to determine the maximum number of surfaces that can exist at the same time
+#define QAS_LCD_SURFACE_LENGTH    ((uint8_t)16)
+
+
+//--------------------
+//QAS_LCD_SURFACE_NONE
+//
+//Surface index returned when a surface could not be created, and used by QAS_LCD to indicate that no surface is being rendered to
+#define QAS_LCD_SURFACE_NONE      ((uint8_t)0xFF)
+
+
+//---------------------
+//QAS_LCD_SurfaceEntry
+//
+//Structure used to store the details of a single surface
+typedef struct {
+	uint32_t uOffset;  //Offset in bytes of the surface's pixels from the start of the pool
+	uint32_t uSize;    //Size in bytes of the surface's pixels, rounded up to a multiple of 4 bytes
+	uint16_t uWidth;   //Width of the surface in pixels
+	uint16_t uHeight;  //Height of the surface in pixels
+	bool     bUsed;    //Whether the surface currently exists
+} QAS_LCD_SurfaceEntry;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-------------------
+//QAS_LCD_SurfacePool
+//
+//Class used to allocate the offscreen surfaces that QAS_LCD is able to render into (see QAS_LCD Surface Methods)
+//Each surface is a block of ARGB4444 pixels, so that surfaces keep per-pixel alpha and can be composited into a layer of any
+//pixel format using the same kernels as images.
+//
+//Surfaces are allocated from the pool as a stack, with each new surface being placed directly after the most recently created
+//surface that still exists. Destroying a surface only returns its memory to the pool once every surface created after it has also
+//been destroyed, so free memory is always a single block at the end of the pool and can never become fragmented. Surfaces that
+//exist for the lifetime of the application, such as static panels, should therefore be created first, with short-lived surfaces
+//being created and destroyed after them.
+class QAS_LCD_SurfacePool {
+private:
+
+	uint8_t*             m_pPool;                             //Pointer to the start of the memory that surfaces are allocated from, or NULL if it could not be allocated
+	QAS_LCD_SurfaceEntry m_sEntries[QAS_LCD_SURFACE_LENGTH];  //Details of each surface, indexed by surface index
+	uint32_t             m_uTop;                              //Offset in bytes of the first free byte of the pool
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates a pool with no surfaces
+	QAS_LCD_SurfacePool();
+
+
+	//NOTE: See QAS_LCD_Surface.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	uint8_t create(uint16_t uWidth, uint16_t uHeight);
+	void destroy(uint8_t uIdx);
+	void clear(void);
+
+
+	//------------
+	//Data Methods
+
+	//Returns true if a surface index refers to a surface that currently exists
+	//uIdx - The index of the surface
+	bool valid(uint8_t uIdx) const {
+		return ((uIdx < QAS_LCD_SURFACE_LENGTH) && m_sEntries[uIdx].bUsed);
+	}
+
+	//Returns a pointer to the upper-left pixel of a surface
+	//uIdx - The index of the surface, which must be valid
+	uint16_t* pixels(uint8_t uIdx) const {
+		return (uint16_t*)&m_pPool[m_sEntries[uIdx].uOffset];
+	}
+
+	//Returns the area of a surface, in surface coordinates where the upper-left pixel is (0, 0)
+	//uIdx - The index of the surface, which must be valid
+	QAT_Rect_16 area(uint8_t uIdx) const {
+		return QAT_Rect_16(0, 0, m_sEntries[uIdx].uWidth-1, m_sEntries[uIdx].uHeight-1);
+	}
+
+	//Returns an image describing the pixels of a surface, so that it can be drawn by QAS_LCD's image rendering methods
+	//The color key of the image is transparent black (0x0000), which is the color a surface is cleared to when created
+	//uIdx - The index of the surface, which must be valid
+	QAS_LCD_Image image(uint8_t uIdx) const {
+		return QAS_LCD_Image(pixels(uIdx), 0, m_sEntries[uIdx].uWidth, m_sEntries[uIdx].uHeight);
+	}
+
+	//Returns the number of bytes of the pool that are not currently allocated to a surface
+	//Returns 0 if the pool could not be allocated from SDRAM
+	uint32_t available(void) const {
+		return (m_pPool != NULL) ? (QAS_LCD_SURFACE_POOLSIZE - m_uTop) : 0;
+	}
+
+private:
+
+	//---------------
+	//Private Methods
+
+	void reclaim(void);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_SURFACE_HPP_ */
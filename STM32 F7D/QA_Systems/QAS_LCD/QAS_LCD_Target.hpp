@@ -0,0 +1,142 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Render Targets                           */
+/*   Filename: QAS_LCD_Target.hpp                                          */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_TARGET_HPP_
+#define __QAS_LCD_TARGET_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Rect.hpp"
+
+#include "QAS_LCD_Raster.hpp"
+#include "QAS_LCD_Accel.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//--------------
+//QAS_LCD_Target
+//
+//Class used to describe the block of pixels that rendering methods write to
+//A target covers an area of the LCD panel in screen coordinates, so rendering methods can always work in screen coordinates
+//regardless of whether they are drawing directly into a frame buffer or into a smaller tile buffer in internal RAM.
+//Each target also records the set of kernels for its pixel format, which all pixels are written through (see QAS_LCD_Raster.hpp).
+//As pixel formats differ in size, pixels are addressed in bytes using the size of the target's pixels.
+class QAS_LCD_Target {
+public:
+
+	void*       m_pPixels;  //Pointer to the pixel at the upper-left corner of the target's area
+	QAT_Rect_16 m_cArea;    //The area of the LCD panel covered by the target
+	uint16_t    m_uStride;  //The number of pixels between the start of each line
+
+	QAS_LCD_Raster m_eRaster;  //The set of kernels for the pixel format of the target. Member of QAS_LCD_Raster enum
+	uint8_t        m_uBytes;   //The size in bytes of a single pixel of the target
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates a target with no pixel data
+	QAS_LCD_Target() :
+		m_pPixels(NULL),
+		m_uStride(0),
+		m_eRaster(QAS_LCD_Raster_ARGB4444),
+		m_uBytes(QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>::Bytes) {}
+
+	//Constructor used to set target details
+	//pPixels - Pointer to the pixel at the upper-left corner of the area
+	//cArea   - The area of the LCD panel covered by the target
+	//uStride - The number of pixels between the start of each line
+	//eRaster - The set of kernels for the pixel format of the target. Member of QAS_LCD_Raster enum
+	QAS_LCD_Target(void* pPixels, const QAT_Rect_16& cArea, uint16_t uStride, QAS_LCD_Raster eRaster) :
+		m_pPixels(pPixels),
+		m_cArea(cArea),
+		m_uStride(uStride) {
+		setRaster(eRaster);
+	}
+
+
+	//------------
+	//Data Methods
+
+	//Returns a pointer to the pixel at the given screen coordinates
+	//Coordinates must be within the target's area
+	void* pixel(int16_t x, int16_t y) const {
+		return (uint8_t*)m_pPixels + (((x - m_cArea.x0) + ((y - m_cArea.y0) * m_uStride)) * m_uBytes);
+	}
+
+
+	//--------------
+	//Raster Methods
+
+	//Used to select the set of kernels that the target is written through, such as when acceleration is enabled or disabled
+	//eRaster - The set of kernels for the pixel format of the target. Member of QAS_LCD_Raster enum
+	void setRaster(QAS_LCD_Raster eRaster) {
+		m_eRaster = eRaster;
+		raster([this](auto cRaster) {
+			m_uBytes = cRaster.Bytes;
+		});
+	}
+
+	//Used to run the inner loops of a rendering method with the kernels of the target
+	//fLoop is a generic lambda taking a single parameter, which is instantiated once for each set of kernels, and is called with an
+	//instance of the kernel class selected by the target (QAS_LCD_RasterFormat<Format> or QAS_LCD_RasterAccel<Format>). As the
+	//class is known at compile time within each instantiation, kernels called through the parameter are called directly and can be
+	//inlined, and the format's pixel type is available as decltype(cRaster)::Pixel
+	//fLoop - The inner loops, for example [&](auto cRaster) { cRaster.fill(pDst, uCount, uColor, eMode); }
+	template <class Func>
+	void raster(Func fLoop) const {
+		switch (m_eRaster) {
+		  case (QAS_LCD_Raster_ARGB4444):
+		  	fLoop(QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB4444>());
+		  	break;
+		  case (QAS_LCD_Raster_RGB565):
+		  	fLoop(QAS_LCD_RasterFormat<QAT_PixelFormat_RGB565>());
+		  	break;
+		  case (QAS_LCD_Raster_L8):
+		  	fLoop(QAS_LCD_RasterFormat<QAT_PixelFormat_L8>());
+		  	break;
+		  case (QAS_LCD_Raster_ARGB8888):
+		  	fLoop(QAS_LCD_RasterFormat<QAT_PixelFormat_ARGB8888>());
+		  	break;
+		  case (QAS_LCD_Raster_AccelARGB4444):
+		  	fLoop(QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB4444>());
+		  	break;
+		  case (QAS_LCD_Raster_AccelRGB565):
+		  	fLoop(QAS_LCD_RasterAccel<QAT_PixelFormat_RGB565>());
+		  	break;
+		  case (QAS_LCD_Raster_AccelL8):
+		  	fLoop(QAS_LCD_RasterAccel<QAT_PixelFormat_L8>());
+		  	break;
+		  case (QAS_LCD_Raster_AccelARGB8888):
+		  	fLoop(QAS_LCD_RasterAccel<QAT_PixelFormat_ARGB8888>());
+		  	break;
+		}
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_TARGET_HPP_ */
@@ -0,0 +1,344 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Text Layout                              */
+/*   Filename: QAS_LCD_TextLayout.cpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_TextLayout.hpp"
+#include "QAS_LCD.hpp"
+
+
+	//-----------------------------------
+	//-----------------------------------
+	//QAS_LCD_TextLayout Layout Methods
+
+//QAS_LCD_TextLayout::layout
+//QAS_LCD_TextLayout Layout Method
+//
+//Used to lay out a string within a box, replacing the previous contents of the layout
+//The box starts at the position the layout is drawn at. Lines are aligned within the width of the box, or relative to the position
+//the layout is drawn at if the box has no width, in the same manner as QAS_LCD::drawStrL(), drawStrC() and drawStrR()
+//uFont     - The index of the font to lay out the string with
+//str       - The C-style string to be laid out. Newline characters start a new line, and carriage returns are ignored
+//iWidth    - The width in pixels of the box, or 0 if the box has no width, in which case lines are never wrapped or shortened
+//iHeight   - The height in pixels of the box, or 0 if the box has no height. Lines that would be below the box are left out, with the
+//            last line that fits being shortened to fit an ellipsis if selected. At least one line is always laid out
+//eAlign    - The alignment of each line. Member of QAS_LCD_TextAlign enum defined in QAS_LCD_Fonts.hpp
+//eWrap     - How lines are broken to fit the width of the box. Member of QAS_LCD_TextWrap enum
+//eOverflow - How text that does not fit in the box is shown. Member of QAS_LCD_TextOverflow enum
+//            When word-wrap is not selected, lines that are wider than the box are also shortened to fit an ellipsis
+//Returns QA_OK if the string was laid out, or QA_Fail if the font index is invalid, in which case the layout is left empty
+QA_Result QAS_LCD_TextLayout::layout(uint8_t uFont, const char* str, int16_t iWidth, int16_t iHeight, QAS_LCD_TextAlign eAlign,
+		                                 QAS_LCD_TextWrap eWrap, QAS_LCD_TextOverflow eOverflow) {
+	clear();
+	const QAS_LCD_Font* pFont = QAS_LCD::getFont(uFont);
+	if (pFont == NULL)
+		return QA_Fail;
+
+	m_uFont       = uFont;
+	m_uLineHeight = pFont->m_uHeight;
+	m_iWidth      = (iWidth > 0) ? iWidth : 0;
+	m_eAlign      = eAlign;
+
+	//Determine the number of lines that fit within the box
+	uint8_t uMaxLines = QAS_LCD_TEXTLAYOUT_LINES;
+	if ((iHeight > 0) && m_uLineHeight && ((iHeight / m_uLineHeight) < uMaxLines))
+		uMaxLines = (iHeight >= m_uLineHeight) ? (iHeight / m_uLineHeight) : 1;
+
+	bool     bWrap     = (eWrap == QAS_LCD_Wrap_Word) && m_iWidth;
+	bool     bEllipsis = (eOverflow == QAS_LCD_Overflow_Ellipsis);
+	bool     bShorten  = bEllipsis && !bWrap && m_iWidth;
+	int16_t  iGap      = pFont->m_uCharGap;
+	uint16_t uFirst    = 0;     //First glyph of the current line
+	uint16_t uStart    = 0;     //Index within the string of the first character of the current line
+	int16_t  iPen      = 0;     //Position of the next glyph on the current line
+	int32_t  iBreak    = -1;    //Glyph index of the last space on the current line
+	bool     bSkip     = false; //Whether the rest of the current line is being skipped, as it has been shortened to fit the box
+
+	for (uint16_t i=0; ; i++) {
+		char ch = str[i];
+
+		//End of string. A final newline character does not start a new line
+		if (!ch || ((ch == '\n') && !str[i+1])) {
+			endLine(uFirst, m_uGlyphs, uStart);
+			break;
+		}
+
+		//Newline, unless the current line is the last that fits in the box
+		if (ch == '\n') {
+			if ((m_uLines + 1) >= uMaxLines) {
+				if (bEllipsis)
+					ellipsis(pFont, uFirst, uStart);
+				m_bTruncated = true;
+				endLine(uFirst, m_uGlyphs, uStart);
+				break;
+			}
+
+			endLine(uFirst, m_uGlyphs, uStart);
+			uFirst = m_uGlyphs;
+			uStart = i + 1;
+			iPen   = 0;
+			iBreak = -1;
+			bSkip  = false;
+			continue;
+		}
+		if (bSkip || (ch == '\r'))
+			continue;
+
+		if ((ch < 32) || (ch > 126))
+			ch = ' ';
+		uint8_t uWidth = charWidth(pFont, ch);
+
+		//Stop if the layout is full
+		if (m_uGlyphs >= QAS_LCD_TEXTLAYOUT_GLYPHS) {
+			if (bEllipsis)
+				ellipsis(pFont, uFirst, uStart);
+			m_bTruncated = true;
+			endLine(uFirst, m_uGlyphs, uStart);
+			break;
+		}
+
+		//Wrap line if the character does not fit. Spaces are allowed to extend past the box, as they are not drawn
+		//If the word moved onto the new line still does not fit then it is also broken within the word
+		bool bFull = false;
+		while (bWrap && (ch != ' ') && (m_uGlyphs > uFirst) && ((iPen + uWidth) > m_iWidth)) {
+			if ((m_uLines + 1) >= uMaxLines) {
+				bFull = true;
+				break;
+			}
+
+			if (iBreak >= uFirst) {
+
+				//Break after the last space, moving the characters of the word that follows it onto the new line
+				uint16_t uNext = iBreak + 1;
+				int16_t  iBase = (uNext < m_uGlyphs) ? m_sGlyphs[uNext].iX : iPen;
+				endLine(uFirst, uNext, uStart);
+				for (uint16_t j=uNext; j<m_uGlyphs; j++)
+					m_sGlyphs[j].iX -= iBase;
+				iPen  -= iBase;
+				uFirst = uNext;
+				uStart = (uNext < m_uGlyphs) ? m_sGlyphs[uNext].uIndex : i;
+			} else {
+
+				//Break within a word that is wider than the box
+				endLine(uFirst, m_uGlyphs, uStart);
+				uFirst = m_uGlyphs;
+				uStart = i;
+				iPen   = 0;
+			}
+			iBreak = -1;
+		}
+		if (bFull) {
+			if (bEllipsis)
+				ellipsis(pFont, uFirst, uStart);
+			m_bTruncated = true;
+			endLine(uFirst, m_uGlyphs, uStart);
+			break;
+		}
+
+		//Shorten an unwrapped line that does not fit, skipping the rest of the line
+		if (bShorten && (ch != ' ') && ((iPen + uWidth) > m_iWidth)) {
+			ellipsis(pFont, uFirst, uStart);
+			m_bTruncated = true;
+			bSkip = true;
+			continue;
+		}
+
+		if (ch == ' ')
+			iBreak = m_uGlyphs;
+		addGlyph(iPen, i, uWidth, ch);
+		iPen += uWidth + iGap;
+	}
+
+	//Hash the result, so that display lists can identify whether the layout has changed
+	const uint8_t* pGlyphs = (const uint8_t*)m_sGlyphs;
+	const uint8_t* pLines  = (const uint8_t*)m_sLines;
+	uint32_t       uHash   = 0x811C9DC5;
+	uHash = (uHash ^ m_uFont) * 0x01000193;
+	for (uint32_t j=0; j<(m_uGlyphs * sizeof(QAS_LCD_LayoutGlyph)); j++)
+		uHash = (uHash ^ pGlyphs[j]) * 0x01000193;
+	for (uint32_t j=0; j<(m_uLines * sizeof(QAS_LCD_LayoutLine)); j++)
+		uHash = (uHash ^ pLines[j]) * 0x01000193;
+	m_uHash = uHash;
+
+	return QA_OK;
+}
+
+
+//QAS_LCD_TextLayout::clear
+//QAS_LCD_TextLayout Layout Method
+//
+//Used to remove all lines from the layout
+void QAS_LCD_TextLayout::clear(void) {
+	m_uGlyphs    = 0;
+	m_uLines     = 0;
+	m_cBounds    = QAT_Rect_16();
+	m_bTruncated = false;
+	m_uHash      = 0;
+}
+
+
+//QAS_LCD_TextLayout::hitTest
+//QAS_LCD_TextLayout Layout Method
+//
+//Used to find the position within the string that is closest to a point, such as a touch on the LCD
+//The line is found from the Y coordinate of the point, and the character within the line by a binary search of the character positions
+//cPoint - The point, relative to the position the layout is drawn at
+//Returns the index within the string of the character that a caret placed at the point would be in front of. Points beyond the end of a
+//line return the index following the last character of the line, and points above or below the layout are treated as being on the
+//first or last line
+uint16_t QAS_LCD_TextLayout::hitTest(QAT_Vector2_16 cPoint) const {
+	if (!m_uLines)
+		return 0;
+
+	//Find line
+	int16_t iY    = (int16_t)cPoint.y;
+	int16_t iLine = ((iY > 0) && m_uLineHeight) ? (iY / m_uLineHeight) : 0;
+	if (iLine >= m_uLines)
+		iLine = m_uLines - 1;
+	const QAS_LCD_LayoutLine& sLine = m_sLines[iLine];
+	if (!sLine.uCount)
+		return sLine.uStart;
+
+	//Find the last character starting at or before the point
+	int16_t  iX    = (int16_t)cPoint.x - sLine.iX;
+	uint16_t uLow  = sLine.uFirst;
+	uint16_t uHigh = sLine.uFirst + sLine.uCount - 1;
+	if (iX < m_sGlyphs[uLow].iX)
+		return m_sGlyphs[uLow].uIndex;
+	while (uLow < uHigh) {
+		uint16_t uMid = (uLow + uHigh + 1) >> 1;
+		if (m_sGlyphs[uMid].iX <= iX)
+			uLow = uMid; else
+			uHigh = uMid - 1;
+	}
+
+	//Place caret on whichever side of the character is closest
+	const QAS_LCD_LayoutGlyph& sGlyph = m_sGlyphs[uLow];
+	if (((iX - sGlyph.iX) * 2) < sGlyph.uWidth)
+		return sGlyph.uIndex;
+	return sGlyph.uIndex + 1;
+}
+
+
+	//-----------------------------------
+	//-----------------------------------
+	//QAS_LCD_TextLayout Private Methods
+
+//QAS_LCD_TextLayout::charWidth
+//QAS_LCD_TextLayout Private Method
+//
+//Returns the width in pixels of a character of a font
+//pFont - Pointer to the font
+//ch    - The character, which must be a space or a printable character
+uint8_t QAS_LCD_TextLayout::charWidth(const QAS_LCD_Font* pFont, char ch) const {
+	if (ch == ' ')
+		return pFont->m_uSpaceWidth;
+	return pFont->m_pDesc[ch-33].uWidth;
+}
+
+
+//QAS_LCD_TextLayout::addGlyph
+//QAS_LCD_TextLayout Private Method
+//
+//Used to add a glyph to the end of the current line. The layout must not be full
+//iX     - Offset in pixels of the glyph from the start of the line
+//uIndex - Index of the character within the string being laid out
+//uWidth - Width in pixels of the character
+//ch     - The character
+void QAS_LCD_TextLayout::addGlyph(int16_t iX, uint16_t uIndex, uint8_t uWidth, char ch) {
+	QAS_LCD_LayoutGlyph& sGlyph = m_sGlyphs[m_uGlyphs++];
+	sGlyph.iX     = iX;
+	sGlyph.uIndex = uIndex;
+	sGlyph.uWidth = uWidth;
+	sGlyph.ch     = ch;
+}
+
+
+//QAS_LCD_TextLayout::endLine
+//QAS_LCD_TextLayout Private Method
+//
+//Used to complete a line, measuring it and aligning it within the box
+//uFirst - Index of the first glyph of the line
+//uLast  - Index following the last glyph of the line
+//uStart - Index within the string of the first character of the line
+void QAS_LCD_TextLayout::endLine(uint16_t uFirst, uint16_t uLast, uint16_t uStart) {
+	if (m_uLines >= QAS_LCD_TEXTLAYOUT_LINES)
+		return;
+
+	//Measure line up to the end of its last character that is not a space
+	uint16_t uWidth = 0;
+	for (uint16_t i=uLast; i>uFirst; i--) {
+		if (m_sGlyphs[i-1].ch != ' ') {
+			uWidth = m_sGlyphs[i-1].iX + m_sGlyphs[i-1].uWidth;
+			break;
+		}
+	}
+
+	//Align line
+	int16_t iX = 0;
+	if (m_eAlign == QAS_LCD_Align_Center)
+		iX = (m_iWidth - (int16_t)uWidth) / 2; else
+	if (m_eAlign == QAS_LCD_Align_Right)
+		iX = m_iWidth - (int16_t)uWidth;
+
+	QAS_LCD_LayoutLine& sLine = m_sLines[m_uLines];
+	sLine.uFirst = uFirst;
+	sLine.uCount = uLast - uFirst;
+	sLine.uStart = uStart;
+	sLine.iX     = iX;
+	sLine.uWidth = uWidth;
+
+	if (uWidth) {
+		int16_t iY = m_uLines * m_uLineHeight;
+		m_cBounds = m_cBounds.merge(QAT_Rect_16(iX, iY, iX + uWidth - 1, iY + m_uLineHeight - 1));
+	}
+	m_uLines++;
+}
+
+
+//QAS_LCD_TextLayout::ellipsis
+//QAS_LCD_TextLayout Private Method
+//
+//Used to end the current line with an ellipsis, removing characters from the end of the line until the ellipsis fits within the box
+//pFont  - Pointer to the font being laid out with
+//uFirst - Index of the first glyph of the current line
+//uStart - Index within the string of the first character of the current line
+void QAS_LCD_TextLayout::ellipsis(const QAS_LCD_Font* pFont, uint16_t uFirst, uint16_t uStart) {
+	uint8_t uDot      = charWidth(pFont, '.');
+	int16_t iGap      = pFont->m_uCharGap;
+	int16_t iEllipsis = (3 * uDot) + (2 * iGap);
+
+	while (m_uGlyphs > uFirst) {
+		const QAS_LCD_LayoutGlyph& sLast = m_sGlyphs[m_uGlyphs-1];
+		if ((sLast.ch != ' ') && ((m_uGlyphs + 3) <= QAS_LCD_TEXTLAYOUT_GLYPHS) &&
+				(!m_iWidth || ((sLast.iX + sLast.uWidth + iGap + iEllipsis) <= m_iWidth)))
+			break;
+		m_uGlyphs--;
+	}
+
+	int16_t  iX     = 0;
+	uint16_t uIndex = uStart;
+	if (m_uGlyphs > uFirst) {
+		const QAS_LCD_LayoutGlyph& sLast = m_sGlyphs[m_uGlyphs-1];
+		iX     = sLast.iX + sLast.uWidth + iGap;
+		uIndex = sLast.uIndex + 1;
+	}
+	for (uint8_t i=0; (i<3) && (m_uGlyphs < QAS_LCD_TEXTLAYOUT_GLYPHS); i++) {
+		addGlyph(iX, uIndex, uDot, '.');
+		iX += uDot + iGap;
+	}
+}
+
@@ -0,0 +1,219 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Text Layout                              */
+/*   Filename: QAS_LCD_TextLayout.hpp                                      */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_TEXTLAYOUT_HPP_
+#define __QAS_LCD_TEXTLAYOUT_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Vector.hpp"
+#include "QAT_Rect.hpp"
+
+#include "QAS_LCD_Fonts.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------------------
+//QAS_LCD_TEXTLAYOUT_GLYPHS
+//
+//Used to determine the maximum number of characters, including spaces, that a text layout can hold. Text beyond this is truncated
+#define QAS_LCD_TEXTLAYOUT_GLYPHS  ((uint16_t)512)
+
+
+//--------------------------
+//QAS_LCD_TEXTLAYOUT_LINES
+//
+//Used to determine the maximum number of lines that a text layout can hold. Text beyond this is truncated
+#define QAS_LCD_TEXTLAYOUT_LINES   ((uint8_t)24)
+
+
+//----------------
+//QAS_LCD_TextWrap
+//
+//Used to select how text that is wider than the box of a text layout is broken into lines
+enum QAS_LCD_TextWrap : uint8_t {
+	QAS_LCD_Wrap_None = 0,  //Lines are only broken at newline characters
+	QAS_LCD_Wrap_Word       //Lines are broken at the last space that fits, or within a word that is wider than the box
+};
+
+
+//--------------------
+//QAS_LCD_TextOverflow
+//
+//Used to select how text that does not fit within the box of a text layout is shown
+enum QAS_LCD_TextOverflow : uint8_t {
+	QAS_LCD_Overflow_Clip = 0,  //Text that does not fit is left to be clipped
+	QAS_LCD_Overflow_Ellipsis   //The last visible line is shortened to fit an ellipsis ("...") at its end
+};
+
+
+//-------------------
+//QAS_LCD_LayoutGlyph
+//
+//Structure used to store the position of a single character of a text layout
+typedef struct {
+	int16_t  iX;      //Offset in pixels of the left-hand edge of the character from the start of its line
+	uint16_t uIndex;  //Index of the character within the string that was laid out
+	uint8_t  uWidth;  //Width in pixels of the character
+	char     ch;      //The character. Characters that cannot be drawn are stored as spaces
+} QAS_LCD_LayoutGlyph;
+
+
+//------------------
+//QAS_LCD_LayoutLine
+//
+//Structure used to store a single line of a text layout
+typedef struct {
+	uint16_t uFirst;  //Index of the first glyph of the line
+	uint16_t uCount;  //Number of glyphs in the line, including any trailing space at which the line was wrapped
+	uint16_t uStart;  //Index within the string that was laid out of the first character of the line
+	int16_t  iX;      //Offset in pixels of the start of the line from the position the layout is drawn at, set by the alignment
+	uint16_t uWidth;  //Width in pixels of the line, excluding trailing spaces
+} QAS_LCD_LayoutLine;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------
+//QAS_LCD_TextLayout
+//
+//Class used to measure and position a string once, so that it can be drawn any number of times without being measured again
+//
+//layout() walks the string a single time, placing each character at the running sum of the widths and gaps of the characters before it
+//on its line. Lines are broken at newline characters and, if word-wrap is selected, at the last space that fits within the width of
+//the box. Each line is then aligned within the box, and any text that does not fit can be replaced with an ellipsis.
+//
+//As the position of every character is stored, the characters of a line are sorted by position, so hitTest() can find the character
+//at a point, such as a touch on the LCD, with a binary search rather than measuring the string again.
+//
+//Layouts are drawn with QAS_LCD::drawLayout() using the font they were laid out with, regardless of the currently selected font.
+//A layout must be laid out again if the fonts held by QAS_LCD are changed.
+class QAS_LCD_TextLayout {
+private:
+
+	QAS_LCD_LayoutGlyph m_sGlyphs[QAS_LCD_TEXTLAYOUT_GLYPHS]; //Glyphs of every line, in order
+	QAS_LCD_LayoutLine  m_sLines[QAS_LCD_TEXTLAYOUT_LINES];   //Lines, in order from the top of the layout
+	uint16_t            m_uGlyphs;      //Number of glyphs
+	uint8_t             m_uLines;       //Number of lines
+
+	uint8_t             m_uFont;        //Index of the font the layout was laid out with
+	uint8_t             m_uLineHeight;  //Height in pixels of each line, taken from the font
+	int16_t             m_iWidth;       //Width in pixels of the box, or 0 if the box has no width
+	QAS_LCD_TextAlign   m_eAlign;       //Alignment of each line. Member of QAS_LCD_TextAlign enum defined in QAS_LCD_Fonts.hpp
+	QAT_Rect_16         m_cBounds;      //Area covered by the drawn characters, relative to the position the layout is drawn at
+	bool                m_bTruncated;   //Whether any of the string was left out of the layout
+	uint32_t            m_uHash;        //Hash of the glyphs and lines, used to identify the layout within display lists
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty layout
+	QAS_LCD_TextLayout() :
+		m_uGlyphs(0),
+		m_uLines(0),
+		m_uFont(0),
+		m_uLineHeight(0),
+		m_iWidth(0),
+		m_eAlign(QAS_LCD_Align_Left),
+		m_bTruncated(false),
+		m_uHash(0) {}
+
+
+	//NOTE: See QAS_LCD_TextLayout.cpp for details of the following methods
+
+	//--------------
+	//Layout Methods
+
+	QA_Result layout(uint8_t uFont, const char* str, int16_t iWidth = 0, int16_t iHeight = 0, QAS_LCD_TextAlign eAlign = QAS_LCD_Align_Left,
+			             QAS_LCD_TextWrap eWrap = QAS_LCD_Wrap_None, QAS_LCD_TextOverflow eOverflow = QAS_LCD_Overflow_Clip);
+	void clear(void);
+
+	uint16_t hitTest(QAT_Vector2_16 cPoint) const;
+
+
+	//------------
+	//Data Methods
+
+	//Returns the index of the font the layout was laid out with
+	uint8_t font(void) const {
+		return m_uFont;
+	}
+
+	//Returns the height in pixels of each line
+	uint8_t lineHeight(void) const {
+		return m_uLineHeight;
+	}
+
+	//Returns the number of lines
+	uint8_t lines(void) const {
+		return m_uLines;
+	}
+
+	//Returns a line of the layout
+	//uIdx - The index of the line, where 0 is the top line
+	const QAS_LCD_LayoutLine& line(uint8_t uIdx) const {
+		return m_sLines[uIdx];
+	}
+
+	//Returns a glyph of the layout
+	//uIdx - The index of the glyph
+	const QAS_LCD_LayoutGlyph& glyph(uint16_t uIdx) const {
+		return m_sGlyphs[uIdx];
+	}
+
+	//Returns the area covered by the drawn characters, relative to the position the layout is drawn at
+	const QAT_Rect_16& bounds(void) const {
+		return m_cBounds;
+	}
+
+	//Returns true if any of the string was left out of the layout, due to the size of the box or the capacity of the layout
+	bool truncated(void) const {
+		return m_bTruncated;
+	}
+
+	//Returns a hash of the glyphs and lines of the layout, which only changes if the result of layout() changes
+	uint32_t hash(void) const {
+		return m_uHash;
+	}
+
+private:
+
+	//---------------
+	//Private Methods
+
+	uint8_t charWidth(const QAS_LCD_Font* pFont, char ch) const;
+	void addGlyph(int16_t iX, uint16_t uIndex, uint8_t uWidth, char ch);
+	void endLine(uint16_t uFirst, uint16_t uLast, uint16_t uStart);
+	void ellipsis(const QAS_LCD_Font* pFont, uint16_t uFirst, uint16_t uStart);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_TEXTLAYOUT_HPP_ */
@@ -0,0 +1,81 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Tile Binning                             */
+/*   Filename: QAS_LCD_Tile.cpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Includes
+#include "QAS_LCD_Tile.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+	//----------------------------------
+	//----------------------------------
+	//QAS_LCD_TileBin Management Methods
+
+//QAS_LCD_TileBin::add
+//QAS_LCD_TileBin Management Method
+//
+//Used to add a display list command to the bin
+//Commands whose bounding rectangle lies entirely outside of the LCD panel are not stored, as they cannot touch any tile
+//uOffset - Byte index of the command within the display list
+//eCmd    - The command
+//uLayer  - The layer the command draws to, or QAS_LCD_TILEBIN_ANYLAYER for state commands
+//cBounds - The bounding rectangle of the pixels that the command can touch
+//Returns QA_OK if the command was stored or discarded, or QA_Fail if the bin is full
+QA_Result QAS_LCD_TileBin::add(uint16_t uOffset, QAS_LCD_DisplayListCmd eCmd, uint8_t uLayer, const QAT_Rect_16& cBounds) {
+
+	//Limit bounds to LCD panel, discarding command if nothing remains
+	QAT_Rect_16 cClip = cBounds.intersect(QAT_Rect_16(0, 0, QAD_LTDC_WIDTH-1, QAD_LTDC_HEIGHT-1));
+	if (cClip.empty())
+		return QA_OK;
+
+	if (m_uCount >= QAS_LCD_TILEBIN_LENGTH)
+		return QA_Fail;
+
+	QAS_LCD_TileBinEntry& sEntry = m_sEntries[m_uCount];
+	sEntry.uOffset = uOffset;
+	sEntry.eCmd    = eCmd;
+	sEntry.uLayer  = uLayer;
+	sEntry.uCol0   = cClip.x0 / QAS_LCD_TILE_WIDTH;
+	sEntry.uRow0   = cClip.y0 / QAS_LCD_TILE_HEIGHT;
+	sEntry.uCol1   = cClip.x1 / QAS_LCD_TILE_WIDTH;
+	sEntry.uRow1   = cClip.y1 / QAS_LCD_TILE_HEIGHT;
+	m_uCount++;
+
+	if (uLayer != QAS_LCD_TILEBIN_ANYLAYER)
+		m_uLayers |= (1 << uLayer);
+	return QA_OK;
+}
+
+
+	//----------------------------
+	//----------------------------
+	//QAS_LCD_TileBin Data Methods
+
+//QAS_LCD_TileBin::tileRect
+//QAS_LCD_TileBin Data Method
+//
+//Returns the area of the LCD panel covered by a specific tile
+//uCol - The column of the tile
+//uRow - The row of the tile
+QAT_Rect_16 QAS_LCD_TileBin::tileRect(uint8_t uCol, uint8_t uRow) {
+	int16_t x = uCol * QAS_LCD_TILE_WIDTH;
+	int16_t y = uRow * QAS_LCD_TILE_HEIGHT;
+	return QAT_Rect_16(x, y, x+QAS_LCD_TILE_WIDTH-1, y+QAS_LCD_TILE_HEIGHT-1);
+}
@@ -0,0 +1,175 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Systems - LCD Rendering                                       */
+/*   Role: LCD Rendering System - Tile Binning                             */
+/*   Filename: QAS_LCD_Tile.hpp                                            */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAS_LCD_TILE_HPP_
+#define __QAS_LCD_TILE_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAD_LTDC.hpp"
+
+#include "QAT_Rect.hpp"
+
+#include "QAS_LCD_DisplayList.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------------
+//QAS_LCD_TILE_MAXBUFFERSIZE
+//
+//Used to determine the largest size in bytes that the tile buffer may be, being the size of the 16KB L1 data cache of the Cortex-M7
+//The tile buffer is placed in the DTCM (see QA_DTCM in setup.hpp), and is kept to this size so that it leaves the rest of the DTCM
+//free, and still fits within the cache if it is ever moved out of the DTCM
+#define QAS_LCD_TILE_MAXBUFFERSIZE  ((uint32_t)16384)
+
+
+//-------------------------------------------
+//QAS_LCD_TILE_WIDTH and QAS_LCD_TILE_HEIGHT
+//
+//Used to determine the size in pixels of each tile used by tiled rendering
+//The tile buffer is sized for the larger pixel format of the two layers. Tiles are 160x40 when both layers use 16bit or smaller
+//pixel formats, and 160x20 when either layer uses a 32bit pixel format, giving a 12.8KB tile buffer in both cases.
+//Setting QAS_LCD_TILE_WIDTH to QAD_LTDC_WIDTH turns tiles into full width bands, allowing each tile to be written back
+//to the frame buffer as a single contiguous burst. Both values must divide evenly into the size of the LCD panel.
+#define QAS_LCD_TILE_BYTES      ((QAD_LTDC_Layer0Format::Bytes > QAD_LTDC_Layer1Format::Bytes) ? QAD_LTDC_Layer0Format::Bytes : QAD_LTDC_Layer1Format::Bytes)
+#define QAS_LCD_TILE_WIDTH      ((uint16_t)160)
+#define QAS_LCD_TILE_HEIGHT     ((uint16_t)((QAS_LCD_TILE_BYTES > 2) ? 20 : 40))
+#define QAS_LCD_TILE_COLUMNS    ((uint8_t)(QAD_LTDC_WIDTH / QAS_LCD_TILE_WIDTH))
+#define QAS_LCD_TILE_ROWS       ((uint8_t)(QAD_LTDC_HEIGHT / QAS_LCD_TILE_HEIGHT))
+#define QAS_LCD_TILE_PIXELCOUNT ((uint32_t)QAS_LCD_TILE_WIDTH * QAS_LCD_TILE_HEIGHT)
+#define QAS_LCD_TILE_BUFFERSIZE (QAS_LCD_TILE_PIXELCOUNT * QAS_LCD_TILE_BYTES)  //Size in bytes of the tile buffer
+
+static_assert((QAD_LTDC_WIDTH % QAS_LCD_TILE_WIDTH) == 0, "QAS_LCD_TILE_WIDTH must divide evenly into QAD_LTDC_WIDTH");
+static_assert((QAD_LTDC_HEIGHT % QAS_LCD_TILE_HEIGHT) == 0, "QAS_LCD_TILE_HEIGHT must divide evenly into QAD_LTDC_HEIGHT");
+static_assert(QAS_LCD_TILE_BUFFERSIZE <= QAS_LCD_TILE_MAXBUFFERSIZE, "The tile buffer must not exceed QAS_LCD_TILE_MAXBUFFERSIZE");
+
+
+//-----------------------
+//QAS_LCD_TILEBIN_LENGTH
+//
+//Used to determine the maximum number of display list commands that can be binned for a single frame
+//Frames containing more commands than this are rendered without tiling
+#define QAS_LCD_TILEBIN_LENGTH    ((uint16_t)512)
+
+
+//-------------------------
+//QAS_LCD_TILEBIN_ANYLAYER
+//
+//Layer value used for binned commands that change rendering state (draw color and font), which are replayed for every tile
+#define QAS_LCD_TILEBIN_ANYLAYER  ((uint8_t)0xFF)
+
+
+//---------------------
+//QAS_LCD_TileBinEntry
+//
+//Structure used to store a single binned display list command
+typedef struct {
+	uint16_t               uOffset;  //Byte index of the command within the display list
+	QAS_LCD_DisplayListCmd eCmd;     //The command, stored so that commands can be checked without being decoded
+	uint8_t                uLayer;   //The layer the command draws to, or QAS_LCD_TILEBIN_ANYLAYER for state commands
+	uint8_t                uCol0;    //Range of tile columns and rows (inclusive) that the command touches
+	uint8_t                uRow0;
+	uint8_t                uCol1;
+	uint8_t                uRow1;
+} QAS_LCD_TileBinEntry;
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//---------------
+//QAS_LCD_TileBin
+//
+//Class used to sort the commands of a display list into the screen tiles that they touch
+//Each drawing command is stored along with the range of tiles covered by its bounding rectangle, so that when a tile is
+//rendered only the commands that can touch it are decoded and executed. State commands are stored as touching every tile.
+class QAS_LCD_TileBin {
+private:
+
+	QAS_LCD_TileBinEntry m_sEntries[QAS_LCD_TILEBIN_LENGTH];  //Array of binned commands, in display list order
+	uint16_t             m_uCount;                            //Number of commands currently stored in m_sEntries
+	uint8_t              m_uLayers;                           //Bitmask of layers that binned drawing commands draw to
+
+public:
+
+	//------------
+	//Constructors
+
+	//Default constructor. Creates an empty bin
+	QAS_LCD_TileBin() :
+		m_uCount(0),
+		m_uLayers(0) {}
+
+
+	//NOTE: See QAS_LCD_Tile.cpp for details of the following methods
+
+	//------------------
+	//Management Methods
+
+	//Used to remove all commands from the bin
+	void clear(void) {
+		m_uCount  = 0;
+		m_uLayers = 0;
+	}
+
+	QA_Result add(uint16_t uOffset, QAS_LCD_DisplayListCmd eCmd, uint8_t uLayer, const QAT_Rect_16& cBounds);
+
+
+	//------------
+	//Data Methods
+
+	//Returns the number of commands currently stored in the bin
+	uint16_t count(void) const {
+		return m_uCount;
+	}
+
+	//Returns a reference to a specific binned command
+	//uIdx - The index of the command, which must be less than count()
+	const QAS_LCD_TileBinEntry& operator[](uint16_t uIdx) const {
+		return m_sEntries[uIdx];
+	}
+
+	//Returns a bitmask of the layers that binned drawing commands draw to
+	uint8_t layers(void) const {
+		return m_uLayers;
+	}
+
+	//Returns true if a binned command touches a specific tile
+	//uIdx  - The index of the command, which must be less than count()
+	//uCol  - The column of the tile
+	//uRow  - The row of the tile
+	bool touches(uint16_t uIdx, uint8_t uCol, uint8_t uRow) const {
+		const QAS_LCD_TileBinEntry& sEntry = m_sEntries[uIdx];
+		return ((uCol >= sEntry.uCol0) && (uCol <= sEntry.uCol1) && (uRow >= sEntry.uRow0) && (uRow <= sEntry.uRow1));
+	}
+
+	static QAT_Rect_16 tileRect(uint8_t uCol, uint8_t uRow);
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAS_LCD_TILE_HPP_ */
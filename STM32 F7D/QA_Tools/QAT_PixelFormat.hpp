@@ -0,0 +1,192 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Tools                                                         */
+/*   Role: Pixel Format Traits                                             */
+/*   Filename: QAT_PixelFormat.hpp                                         */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAT_PIXELFORMAT_HPP_
+#define __QAT_PIXELFORMAT_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+
+  //NOTE:
+  //Each of the following classes describes one of the pixel formats supported by the LTDC peripheral, and is intended to be used
+  //as a template parameter so that pixel packing, unpacking and conversion are resolved at compile time.
+  //
+  //Every format provides the same set of members:
+  //  Type      - The unsigned integer type used to store a single pixel
+  //  Bytes     - The size in bytes of a single pixel
+  //  LTDC      - The value of the LTDC layer pixel format register (LTDC_PIXEL_FORMAT_xxx as defined by the HAL)
+  //  Alpha     - Whether pixels store their own alpha value
+  //  pack()    - Packs 8bit alpha, red, green and blue components into a pixel
+  //  a(), r(), g(), b() - Unpack a single component of a pixel as an 8bit value
+  //  word()    - Replicates a pixel to fill a 32bit word, for use by word-wide fill kernels
+  //
+  //All methods are constexpr, so conversions between constant colors cost nothing at runtime
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//------------------------
+//QAT_PixelFormat_ARGB4444
+//
+//16bit pixels with 4 bits each for the Alpha, Red, Green and Blue components
+class QAT_PixelFormat_ARGB4444 {
+public:
+
+	typedef uint16_t Type;
+
+	static constexpr uint8_t Bytes = 2;
+	static constexpr uint8_t LTDC  = 0x04;
+	static constexpr bool    Alpha = true;
+
+	static constexpr Type pack(uint8_t a, uint8_t r, uint8_t g, uint8_t b) {
+		return (Type)(((a >> 4) << 12) | ((r >> 4) << 8) | ((g >> 4) << 4) | (b >> 4));
+	}
+
+	static constexpr uint8_t a(Type uPxl) {return ((uPxl >> 12) & 0x0F) * 17;}
+	static constexpr uint8_t r(Type uPxl) {return ((uPxl >> 8) & 0x0F) * 17;}
+	static constexpr uint8_t g(Type uPxl) {return ((uPxl >> 4) & 0x0F) * 17;}
+	static constexpr uint8_t b(Type uPxl) {return (uPxl & 0x0F) * 17;}
+
+	static constexpr uint32_t word(Type uPxl) {return (uint32_t)uPxl * 0x00010001;}
+};
+
+
+//----------------------
+//QAT_PixelFormat_RGB565
+//
+//16bit pixels with 5 bits for the Red and Blue components and 6 bits for the Green component
+//Pixels are always opaque, with any alpha being discarded when packed
+class QAT_PixelFormat_RGB565 {
+public:
+
+	typedef uint16_t Type;
+
+	static constexpr uint8_t Bytes = 2;
+	static constexpr uint8_t LTDC  = 0x02;
+	static constexpr bool    Alpha = false;
+
+	static constexpr Type pack(uint8_t, uint8_t r, uint8_t g, uint8_t b) {
+		return (Type)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+	}
+
+	static constexpr uint8_t a(Type) {return 255;}
+	static constexpr uint8_t r(Type uPxl) {return (((uPxl >> 11) & 0x1F) << 3) | ((uPxl >> 13) & 0x07);}
+	static constexpr uint8_t g(Type uPxl) {return (((uPxl >> 5) & 0x3F) << 2) | ((uPxl >> 9) & 0x03);}
+	static constexpr uint8_t b(Type uPxl) {return ((uPxl & 0x1F) << 3) | ((uPxl >> 2) & 0x07);}
+
+	static constexpr uint32_t word(Type uPxl) {return (uint32_t)uPxl * 0x00010001;}
+};
+
+
+//------------------------
+//QAT_PixelFormat_ARGB8888
+//
+//32bit pixels with 8 bits each for the Alpha, Red, Green and Blue components
+class QAT_PixelFormat_ARGB8888 {
+public:
+
+	typedef uint32_t Type;
+
+	static constexpr uint8_t Bytes = 4;
+	static constexpr uint8_t LTDC  = 0x00;
+	static constexpr bool    Alpha = true;
+
+	static constexpr Type pack(uint8_t a, uint8_t r, uint8_t g, uint8_t b) {
+		return ((Type)a << 24) | ((Type)r << 16) | ((Type)g << 8) | b;
+	}
+
+	static constexpr uint8_t a(Type uPxl) {return (uPxl >> 24) & 0xFF;}
+	static constexpr uint8_t r(Type uPxl) {return (uPxl >> 16) & 0xFF;}
+	static constexpr uint8_t g(Type uPxl) {return (uPxl >> 8) & 0xFF;}
+	static constexpr uint8_t b(Type uPxl) {return uPxl & 0xFF;}
+
+	static constexpr uint32_t word(Type uPxl) {return uPxl;}
+};
+
+
+//------------------
+//QAT_PixelFormat_L8
+//
+//8bit pixels that index into the layer's color look-up table (CLUT)
+//Packing and unpacking assume the default CLUT, which is a ramp of opaque grays where each index is its own luminance. Colors are
+//packed using the integer approximation of the ITU-R BT.601 luma weights (77, 150 and 29 out of 256)
+class QAT_PixelFormat_L8 {
+public:
+
+	typedef uint8_t Type;
+
+	static constexpr uint8_t Bytes = 1;
+	static constexpr uint8_t LTDC  = 0x05;
+	static constexpr bool    Alpha = false;
+
+	static constexpr Type pack(uint8_t, uint8_t r, uint8_t g, uint8_t b) {
+		return (Type)(((r * 77) + (g * 150) + (b * 29)) >> 8);
+	}
+
+	static constexpr uint8_t a(Type) {return 255;}
+	static constexpr uint8_t r(Type uPxl) {return uPxl;}
+	static constexpr uint8_t g(Type uPxl) {return uPxl;}
+	static constexpr uint8_t b(Type uPxl) {return uPxl;}
+
+	static constexpr uint32_t word(Type uPxl) {return (uint32_t)uPxl * 0x01010101;}
+};
+
+
+	//------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//----------------
+//QAT_PixelConvert
+//
+//Template class used to convert a pixel from one format to another, by unpacking it using the source format and then packing it
+//using the destination format. Conversion between identical formats is resolved to the pixel itself
+template <class To, class From>
+class QAT_PixelConvert {
+public:
+	static constexpr typename To::Type convert(typename From::Type uPxl) {
+		return To::pack(From::a(uPxl), From::r(uPxl), From::g(uPxl), From::b(uPxl));
+	}
+};
+
+template <class Format>
+class QAT_PixelConvert<Format, Format> {
+public:
+	static constexpr typename Format::Type convert(typename Format::Type uPxl) {
+		return uPxl;
+	}
+};
+
+
+//Compile-time checks of the packing and unpacking of each format
+static_assert(QAT_PixelFormat_ARGB4444::pack(0xFF, 0xFF, 0x80, 0x00) == 0xFF80, "QAT_PixelFormat_ARGB4444 packing error");
+static_assert(QAT_PixelFormat_RGB565::pack(0xFF, 0xFF, 0x80, 0x00) == 0xFC00, "QAT_PixelFormat_RGB565 packing error");
+static_assert(QAT_PixelFormat_RGB565::r(0xF800) == 0xFF, "QAT_PixelFormat_RGB565 unpacking error");
+static_assert(QAT_PixelConvert<QAT_PixelFormat_ARGB8888, QAT_PixelFormat_ARGB4444>::convert(0xF8C0) == 0xFF88CC00,
+		          "QAT_PixelConvert conversion error");
+static_assert(QAT_PixelFormat_L8::pack(0xFF, 0xFF, 0xFF, 0xFF) == 0xFF, "QAT_PixelFormat_L8 packing error");
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAT_PIXELFORMAT_HPP_ */
@@ -0,0 +1,145 @@
+/* ----------------------------------------------------------------------- */
+/*                                                                         */
+/*   Quartz Arc                                                            */
+/*                                                                         */
+/*   STM32 F769I Discovery                                                 */
+/*                                                                         */
+/*   System: Tools                                                         */
+/*   Role: Rectangle Tools                                                 */
+/*   Filename: QAT_Rect.hpp                                                */
+/*   Date: 16th October 2026                                               */
+/*   Created By: Benjamin Rosser                                           */
+/*                                                                         */
+/*   This code is covered by Creative Commons CC-BY-NC-SA license          */
+/*   (C) Copyright 2021 Benjamin Rosser                                    */
+/*                                                                         */
+/* ----------------------------------------------------------------------- */
+
+//Prevent Recursive Inclusion
+#ifndef __QAT_RECT_HPP_
+#define __QAT_RECT_HPP_
+
+
+//Includes
+#include "setup.hpp"
+
+#include "QAT_Vector.hpp"
+
+
+  //------------------------------------------
+	//------------------------------------------
+	//------------------------------------------
+
+
+//-----------
+//QAT_Rect_16
+//
+//Rectangle class used for describing regions of the LCD for rendering, clipping and dirty region tracking
+//Both corners are inclusive, matching the start/end coordinates used by the QAS_LCD rendering methods, so a
+//rectangle from (0,0) to (799,479) covers the entire 800x480 LCD panel.
+//Components are signed 16bit values, allowing regions that are partially off-screen to be described and then clipped.
+//A rectangle is considered empty if x1 is less than x0, or y1 is less than y0.
+class QAT_Rect_16 {
+public:
+
+	int16_t x0;  //Left edge (inclusive)
+	int16_t y0;  //Top edge (inclusive)
+	int16_t x1;  //Right edge (inclusive)
+	int16_t y1;  //Bottom edge (inclusive)
+
+public:
+
+	//------------
+  //Constructors
+
+	//Default constructor. Creates an empty rectangle
+	QAT_Rect_16() :
+		x0(0), y0(0), x1(-1), y1(-1) {}
+
+	//Constructor used to set individual edges
+	QAT_Rect_16(int16_t x0, int16_t y0, int16_t x1, int16_t y1) :
+		x0(x0), y0(y0), x1(x1), y1(y1) {}
+
+	//Constructor used to create a rectangle from two diagonally opposing corners, in any order
+	//Vector components are treated as signed, so that corners to the left of or above the LCD panel can be described
+	QAT_Rect_16(const QAT_Vector2_16& cStart, const QAT_Vector2_16& cEnd) {
+		int16_t iStartX = (int16_t)cStart.x;
+		int16_t iStartY = (int16_t)cStart.y;
+		int16_t iEndX   = (int16_t)cEnd.x;
+		int16_t iEndY   = (int16_t)cEnd.y;
+		x0 = (iStartX < iEndX) ? iStartX : iEndX;
+		x1 = (iStartX < iEndX) ? iEndX : iStartX;
+		y0 = (iStartY < iEndY) ? iStartY : iEndY;
+		y1 = (iStartY < iEndY) ? iEndY : iStartY;
+	}
+
+
+	//---------
+	//Operators
+
+	//Equality operator
+	bool operator==(const QAT_Rect_16& other) const {
+		return ((x0 == other.x0) && (y0 == other.y0) && (x1 == other.x1) && (y1 == other.y1));
+	}
+
+
+	//------------
+	//Data Methods
+
+	//Returns true if the rectangle covers no pixels
+	bool empty(void) const {
+		return ((x1 < x0) || (y1 < y0));
+	}
+
+	//Returns the width in pixels of the rectangle, or 0 if empty
+	uint16_t width(void) const {
+		return (x1 < x0) ? 0 : (x1 - x0 + 1);
+	}
+
+	//Returns the height in pixels of the rectangle, or 0 if empty
+	uint16_t height(void) const {
+		return (y1 < y0) ? 0 : (y1 - y0 + 1);
+	}
+
+	//Returns the number of pixels covered by the rectangle
+	uint32_t area(void) const {
+		return (uint32_t)width() * (uint32_t)height();
+	}
+
+	//Returns true if the pixel at the given coordinates is within the rectangle
+	bool contains(int16_t x, int16_t y) const {
+		return ((x >= x0) && (x <= x1) && (y >= y0) && (y <= y1));
+	}
+
+	//Returns true if the rectangle shares at least one pixel with another rectangle
+	bool intersects(const QAT_Rect_16& other) const {
+		return ((x0 <= other.x1) && (other.x0 <= x1) && (y0 <= other.y1) && (other.y0 <= y1));
+	}
+
+	//Returns the overlapping region of the rectangle and another rectangle
+	//Returned rectangle will be empty if the two do not intersect
+	QAT_Rect_16 intersect(const QAT_Rect_16& other) const {
+		return QAT_Rect_16((x0 > other.x0) ? x0 : other.x0,
+				               (y0 > other.y0) ? y0 : other.y0,
+				               (x1 < other.x1) ? x1 : other.x1,
+				               (y1 < other.y1) ? y1 : other.y1);
+	}
+
+	//Returns the smallest rectangle that contains both the rectangle and another rectangle
+	//If either rectangle is empty then the other is returned
+	QAT_Rect_16 merge(const QAT_Rect_16& other) const {
+		if (empty())
+			return other;
+		if (other.empty())
+			return *this;
+		return QAT_Rect_16((x0 < other.x0) ? x0 : other.x0,
+				               (y0 < other.y0) ? y0 : other.y0,
+				               (x1 > other.x1) ? x1 : other.x1,
+				               (y1 > other.y1) ? y1 : other.y1);
+	}
+
+};
+
+
+//Prevent Recursive Inclusion
+#endif /* __QAT_RECT_HPP_ */